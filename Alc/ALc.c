@@ -36,6 +36,7 @@
 #include "alAuxEffectSlot.h"
 #include "alError.h"
 #include "bformatdec.h"
+#include "limiter.h"
 #include "alu.h"
 
 #include "compat.h"
@@ -288,6 +289,135 @@ static const ALCfunction alcFunctions[] = {
     DECL(alGetSource3i64SOFT),
     DECL(alGetSourcei64vSOFT),
 
+    DECL(alSourceBatchfvSOFT),
+
+    DECL(alEnableDirect),
+    DECL(alDisableDirect),
+    DECL(alIsEnabledDirect),
+    DECL(alGetStringDirect),
+    DECL(alGetBooleanvDirect),
+    DECL(alGetIntegervDirect),
+    DECL(alGetFloatvDirect),
+    DECL(alGetDoublevDirect),
+    DECL(alGetBooleanDirect),
+    DECL(alGetIntegerDirect),
+    DECL(alGetFloatDirect),
+    DECL(alGetDoubleDirect),
+    DECL(alGetErrorDirect),
+    DECL(alIsExtensionPresentDirect),
+    DECL(alGetProcAddressDirect),
+    DECL(alGetEnumValueDirect),
+    DECL(alListenerfDirect),
+    DECL(alListener3fDirect),
+    DECL(alListenerfvDirect),
+    DECL(alListeneriDirect),
+    DECL(alListener3iDirect),
+    DECL(alListenerivDirect),
+    DECL(alGetListenerfDirect),
+    DECL(alGetListener3fDirect),
+    DECL(alGetListenerfvDirect),
+    DECL(alGetListeneriDirect),
+    DECL(alGetListener3iDirect),
+    DECL(alGetListenerivDirect),
+    DECL(alGenSourcesDirect),
+    DECL(alDeleteSourcesDirect),
+    DECL(alIsSourceDirect),
+    DECL(alSourcefDirect),
+    DECL(alSource3fDirect),
+    DECL(alSourcefvDirect),
+    DECL(alSourceiDirect),
+    DECL(alSource3iDirect),
+    DECL(alSourceivDirect),
+    DECL(alGetSourcefDirect),
+    DECL(alGetSource3fDirect),
+    DECL(alGetSourcefvDirect),
+    DECL(alGetSourceiDirect),
+    DECL(alGetSource3iDirect),
+    DECL(alGetSourceivDirect),
+    DECL(alSourcePlayvDirect),
+    DECL(alSourceStopvDirect),
+    DECL(alSourceRewindvDirect),
+    DECL(alSourcePausevDirect),
+    DECL(alSourcePlayDirect),
+    DECL(alSourceStopDirect),
+    DECL(alSourceRewindDirect),
+    DECL(alSourcePauseDirect),
+    DECL(alSourceQueueBuffersDirect),
+    DECL(alSourceUnqueueBuffersDirect),
+    DECL(alGenBuffersDirect),
+    DECL(alDeleteBuffersDirect),
+    DECL(alIsBufferDirect),
+    DECL(alBufferDataDirect),
+    DECL(alBufferfDirect),
+    DECL(alBuffer3fDirect),
+    DECL(alBufferfvDirect),
+    DECL(alBufferiDirect),
+    DECL(alBuffer3iDirect),
+    DECL(alBufferivDirect),
+    DECL(alGetBufferfDirect),
+    DECL(alGetBuffer3fDirect),
+    DECL(alGetBufferfvDirect),
+    DECL(alGetBufferiDirect),
+    DECL(alGetBuffer3iDirect),
+    DECL(alGetBufferivDirect),
+    DECL(alDopplerFactorDirect),
+    DECL(alDopplerVelocityDirect),
+    DECL(alSpeedOfSoundDirect),
+    DECL(alDistanceModelDirect),
+    DECL(alGenFiltersDirect),
+    DECL(alDeleteFiltersDirect),
+    DECL(alIsFilterDirect),
+    DECL(alFilteriDirect),
+    DECL(alFilterivDirect),
+    DECL(alFilterfDirect),
+    DECL(alFilterfvDirect),
+    DECL(alGetFilteriDirect),
+    DECL(alGetFilterivDirect),
+    DECL(alGetFilterfDirect),
+    DECL(alGetFilterfvDirect),
+    DECL(alGenEffectsDirect),
+    DECL(alDeleteEffectsDirect),
+    DECL(alIsEffectDirect),
+    DECL(alEffectiDirect),
+    DECL(alEffectivDirect),
+    DECL(alEffectfDirect),
+    DECL(alEffectfvDirect),
+    DECL(alGetEffectiDirect),
+    DECL(alGetEffectivDirect),
+    DECL(alGetEffectfDirect),
+    DECL(alGetEffectfvDirect),
+    DECL(alGenAuxiliaryEffectSlotsDirect),
+    DECL(alDeleteAuxiliaryEffectSlotsDirect),
+    DECL(alIsAuxiliaryEffectSlotDirect),
+    DECL(alAuxiliaryEffectSlotiDirect),
+    DECL(alAuxiliaryEffectSlotivDirect),
+    DECL(alAuxiliaryEffectSlotfDirect),
+    DECL(alAuxiliaryEffectSlotfvDirect),
+    DECL(alGetAuxiliaryEffectSlotiDirect),
+    DECL(alGetAuxiliaryEffectSlotivDirect),
+    DECL(alGetAuxiliaryEffectSlotfDirect),
+    DECL(alGetAuxiliaryEffectSlotfvDirect),
+    DECL(alDeferUpdatesDirectSOFT),
+    DECL(alProcessUpdatesDirectSOFT),
+    DECL(alSourcedDirectSOFT),
+    DECL(alSource3dDirectSOFT),
+    DECL(alSourcedvDirectSOFT),
+    DECL(alGetSourcedDirectSOFT),
+    DECL(alGetSource3dDirectSOFT),
+    DECL(alGetSourcedvDirectSOFT),
+    DECL(alSourcei64DirectSOFT),
+    DECL(alSource3i64DirectSOFT),
+    DECL(alSourcei64vDirectSOFT),
+    DECL(alGetSourcei64DirectSOFT),
+    DECL(alGetSource3i64DirectSOFT),
+    DECL(alGetSourcei64vDirectSOFT),
+    DECL(alBufferSubDataDirectSOFT),
+    DECL(alBufferSamplesDirectSOFT),
+    DECL(alBufferSubSamplesDirectSOFT),
+    DECL(alGetBufferSamplesDirectSOFT),
+    DECL(alIsBufferFormatSupportedDirectSOFT),
+    DECL(alSourceBatchfvDirectSOFT),
+
     { NULL, NULL }
 };
 #undef DECL
@@ -352,6 +482,9 @@ static const ALCenums enumeration[] = {
     DECL(ALC_HRTF_SPECIFIER_SOFT),
     DECL(ALC_HRTF_ID_SOFT),
 
+    DECL(ALC_OUTPUT_LIMITER_SOFTX),
+    DECL(ALC_OUTPUT_LIMITER_GAIN_REDUCTION_SOFTX),
+
     DECL(ALC_NO_ERROR),
     DECL(ALC_INVALID_DEVICE),
     DECL(ALC_INVALID_CONTEXT),
@@ -708,7 +841,10 @@ static const ALchar alExtList[] =
     "AL_EXT_source_distance_model AL_EXT_SOURCE_RADIUS AL_EXT_STEREO_ANGLES "
     "AL_LOKI_quadriphonic AL_SOFT_block_alignment AL_SOFT_deferred_updates "
     "AL_SOFT_direct_channels AL_SOFT_loop_points AL_SOFT_MSADPCM "
-    "AL_SOFT_source_latency AL_SOFT_source_length";
+    "AL_SOFT_source_latency AL_SOFT_source_length AL_SOFTX_direct_context "
+    "AL_SOFTX_convolution_reverb AL_SOFTX_effect_chain "
+    "AL_SOFTX_object_pool_stats AL_SOFTX_source_batch AL_SOFTX_source_resampler "
+    "AL_SOFTX_update_epsilon";
 
 static ATOMIC(ALCenum) LastNullDeviceError = ATOMIC_INIT_STATIC(ALC_NO_ERROR);
 
@@ -717,6 +853,22 @@ static altss_t LocalContext;
 /* Process-wide current context */
 static ATOMIC(ALCcontext*) GlobalContext = ATOMIC_INIT_STATIC(NULL);
 
+/* Hazard records, for referencing the process-wide context without locking.
+ * Each thread gets its own record to publish the context it's using, and a
+ * context isn't freed while any record holds it. Records are never freed
+ * until the library unloads, but are reused after their thread exits.
+ */
+typedef struct ContextHazard {
+    ATOMIC(ALCcontext*) Context;
+    ATOMIC(ALenum) InUse;
+    /* How many GetContextRef calls are using the published context, for AL
+     * calls that make other AL calls. Only used by the owning thread. */
+    ALuint Depth;
+    struct ContextHazard *next;
+} ContextHazard;
+static ATOMIC(ContextHazard*) ContextHazardList = ATOMIC_INIT_STATIC(NULL);
+static altss_t LocalHazard;
+
 /* Mixing thread piority level */
 ALint RTPrioLevel;
 
@@ -752,7 +904,7 @@ static const ALCchar alcExtensionList[] =
     "ALC_ENUMERATE_ALL_EXT ALC_ENUMERATION_EXT ALC_EXT_CAPTURE "
     "ALC_EXT_DEDICATED ALC_EXT_disconnect ALC_EXT_EFX "
     "ALC_EXT_thread_local_context ALC_SOFTX_device_clock ALC_SOFT_HRTF "
-    "ALC_SOFT_loopback ALC_SOFT_pause_device";
+    "ALC_SOFT_loopback ALC_SOFT_pause_device ALC_SOFTX_output_limiter";
 static const ALCint alcMajorVersion = 1;
 static const ALCint alcMinorVersion = 1;
 
@@ -842,6 +994,7 @@ static void alc_deinit(void) __attribute__((destructor));
 #endif
 
 static void ReleaseThreadCtx(void *ptr);
+static void ReleaseThreadHazard(void *ptr);
 static void alc_init(void)
 {
     const char *str;
@@ -863,6 +1016,9 @@ static void alc_init(void)
     ret = altss_create(&LocalContext, ReleaseThreadCtx);
     assert(ret == althrd_success);
 
+    ret = altss_create(&LocalHazard, ReleaseThreadHazard);
+    assert(ret == althrd_success);
+
     ret = almtx_init(&ListLock, almtx_recursive);
     assert(ret == althrd_success);
 
@@ -1174,6 +1330,8 @@ static void alc_cleanup(void)
 
 static void alc_deinit_safe(void)
 {
+    ContextHazard *hazard;
+
     alc_cleanup();
 
     FreeHrtfs();
@@ -1183,11 +1341,30 @@ static void alc_deinit_safe(void)
     almtx_destroy(&ListLock);
     altss_delete(LocalContext);
 
+    altss_delete(LocalHazard);
+    while((hazard=ATOMIC_LOAD(&ContextHazardList)) != NULL)
+    {
+        ATOMIC_STORE(&ContextHazardList, hazard->next);
+        al_free(hazard);
+    }
+
     if(LogFile != stderr)
         fclose(LogFile);
     LogFile = NULL;
 }
 
+#ifdef ALSOFT_PROFILING
+static void ReportProfilingStats(void)
+{
+    RWLockStats lockstats;
+
+    GetRWLockStats(&lockstats);
+    TRACE("RWLock: %u read, %u write acquisitions, %u spins, %u sleeps\n",
+          lockstats.ReadAcquires, lockstats.WriteAcquires, lockstats.Spins,
+          lockstats.Sleeps);
+}
+#endif
+
 static void alc_deinit(void)
 {
     int i;
@@ -1212,6 +1389,10 @@ static void alc_deinit(void)
         V0(factory,deinit)();
     }
 
+#ifdef ALSOFT_PROFILING
+    ReportProfilingStats();
+#endif
+
     alc_deinit_safe();
 }
 
@@ -1402,15 +1583,33 @@ DECL_CONST static ALCboolean IsValidALCChannels(ALCenum channels)
 
 extern inline void LockContext(ALCcontext *context);
 extern inline void UnlockContext(ALCcontext *context);
+extern inline ALboolean ExceedsUpdateEpsilon(ALCcontext *context, ALfloat epsilon, ALfloat used, ALfloat value);
+extern inline ALboolean ExceedsUpdateEpsilon3(ALCcontext *context, ALfloat epsilon, const ALfloat used[3], const ALfloat values[3]);
 
 void ALCdevice_Lock(ALCdevice *device)
 {
+    if(device->UpdateThreadActive)
+        almtx_lock(&device->UpdateCalcLock);
     V0(device->Backend,lock)();
 }
 
 void ALCdevice_Unlock(ALCdevice *device)
 {
     V0(device->Backend,unlock)();
+    if(device->UpdateThreadActive)
+        almtx_unlock(&device->UpdateCalcLock);
+}
+
+/* The backend's latency, plus the look-ahead the output limiter holds the
+ * mixed samples back by.
+ */
+ALint64 ALCdevice_GetLatency(ALCdevice *device)
+{
+    ALint64 latency = V0(device->Backend,getLatency)();
+    if(device->Limiter)
+        latency += (ALint64)(device->Limiter->Lookahead * DEVICE_CLOCK_RES /
+                             device->Frequency);
+    return latency;
 }
 
 
@@ -1544,7 +1743,7 @@ void ALCcontext_DeferUpdates(ALCcontext *context)
 
     SetMixerFPUMode(&oldMode);
 
-    V0(device->Backend,lock)();
+    ALCdevice_Lock(device);
     if(!context->DeferUpdates)
     {
         context->DeferUpdates = AL_TRUE;
@@ -1558,7 +1757,7 @@ void ALCcontext_DeferUpdates(ALCcontext *context)
         VECTOR_FOR_EACH(ALeffectslot*, context->ActiveAuxSlots, UPDATE_SLOT);
 #undef UPDATE_SLOT
     }
-    V0(device->Backend,unlock)();
+    ALCdevice_Unlock(device);
 
     RestoreFPUMode(&oldMode);
 }
@@ -1571,19 +1770,20 @@ void ALCcontext_ProcessUpdates(ALCcontext *context)
 {
     ALCdevice *device = context->Device;
 
-    V0(device->Backend,lock)();
+    ALCdevice_Lock(device);
     if(context->DeferUpdates)
     {
         ALsizei pos;
 
         context->DeferUpdates = AL_FALSE;
 
-        LockUIntMapRead(&context->SourceMap);
-        for(pos = 0;pos < context->SourceMap.size;pos++)
+        LockHandleMapRead(&context->SourceMap);
+        for(pos = 0;pos < GetHandleMapCapacity(&context->SourceMap);pos++)
         {
-            ALsource *Source = context->SourceMap.array[pos].value;
+            ALsource *Source = LookupHandleMapIndex(&context->SourceMap, pos);
             ALenum new_state;
 
+            if(!Source) continue;
             if((Source->state == AL_PLAYING || Source->state == AL_PAUSED) &&
                Source->Offset >= 0.0)
             {
@@ -1597,9 +1797,9 @@ void ALCcontext_ProcessUpdates(ALCcontext *context)
             if(new_state)
                 SetSourceState(Source, context, new_state);
         }
-        UnlockUIntMapRead(&context->SourceMap);
+        UnlockHandleMapRead(&context->SourceMap);
     }
-    V0(device->Backend,unlock)();
+    ALCdevice_Unlock(device);
 }
 
 
@@ -1867,6 +2067,9 @@ static ALCenum UpdateDeviceParams(ALCdevice *device, const ALCint *attrList)
     al_free(device->Bs2b);
     device->Bs2b = NULL;
 
+    al_free(device->Limiter);
+    device->Limiter = NULL;
+
     al_free(device->Dry.Buffer);
     device->Dry.Buffer = NULL;
     device->Dry.NumChannels = 0;
@@ -2038,38 +2241,78 @@ static ALCenum UpdateDeviceParams(ALCdevice *device, const ALCint *attrList)
         device->FOAOut.NumChannels = device->Dry.NumChannels;
     }
 
+    /* Set up the look-ahead limiter on the real output, if requested. The
+     * look-ahead, release, and ceiling are in milliseconds and decibels. */
+    if(GetConfigValueBool(al_string_get_cstr(device->DeviceName), NULL, "output-limiter", 0))
+    {
+        ALfloat lookahead = 2.0f;
+        ALfloat release = 100.0f;
+        ALfloat ceiling = -0.3f;
+
+        ConfigValueFloat(al_string_get_cstr(device->DeviceName), "limiter", "lookahead", &lookahead);
+        ConfigValueFloat(al_string_get_cstr(device->DeviceName), "limiter", "release", &release);
+        ConfigValueFloat(al_string_get_cstr(device->DeviceName), "limiter", "ceiling", &ceiling);
+        lookahead = clampf(lookahead, 0.5f, 5.0f);
+        release = clampf(release, 0.0f, 10000.0f);
+        ceiling = clampf(ceiling, -60.0f, 0.0f);
+
+        device->Limiter = CreateLimiter(device->RealOut.NumChannels, device->Frequency,
+            lookahead/1000.0f, release/1000.0f, powf(10.0f, ceiling/20.0f)
+        );
+        if(!device->Limiter)
+            ERR("Failed to allocate the output limiter\n");
+        else
+            TRACE("Output limiter: %.2fms look-ahead, %.1fms release, %.2fdB ceiling\n",
+                  lookahead, release, ceiling);
+    }
+
+    device->Dither = AL_FALSE;
+    if(device->FmtType == DevFmtShort || device->FmtType == DevFmtUShort)
+        device->Dither = GetConfigValueBool(al_string_get_cstr(device->DeviceName), NULL,
+                                            "dither", 0);
+    device->DitherSeed[0] = 0x2545f491;
+    device->DitherSeed[1] = 0x9e3779b9;
+    device->DitherSeed[2] = 0x6a09e667;
+    device->DitherSeed[3] = 0xbb67ae85;
+    TRACE("Dither %s\n", device->Dither ? "enabled" : "disabled");
+
     SetMixerFPUMode(&oldMode);
-    V0(device->Backend,lock)();
+    ALCdevice_Lock(device);
+    /* The filter banks are made for the old output rate. The active voices
+     * get new ones as they're updated below. */
+    aluFreePolyphaseBanks(device);
     context = ATOMIC_LOAD(&device->ContextList);
     while(context)
     {
         ALsizei pos;
 
         ATOMIC_STORE(&context->UpdateSources, AL_FALSE);
-        LockUIntMapRead(&context->EffectSlotMap);
-        for(pos = 0;pos < context->EffectSlotMap.size;pos++)
+        LockHandleMapRead(&context->EffectSlotMap);
+        for(pos = 0;pos < GetHandleMapCapacity(&context->EffectSlotMap);pos++)
         {
-            ALeffectslot *slot = context->EffectSlotMap.array[pos].value;
+            ALeffectslot *slot = LookupHandleMapIndex(&context->EffectSlotMap, pos);
+            if(!slot) continue;
 
             slot->EffectState->OutBuffer = device->Dry.Buffer;
             slot->EffectState->OutChannels = device->Dry.NumChannels;
             if(V(slot->EffectState,deviceUpdate)(device) == AL_FALSE)
             {
-                UnlockUIntMapRead(&context->EffectSlotMap);
-                V0(device->Backend,unlock)();
+                UnlockHandleMapRead(&context->EffectSlotMap);
+                ALCdevice_Unlock(device);
                 RestoreFPUMode(&oldMode);
                 return ALC_INVALID_DEVICE;
             }
             ATOMIC_STORE(&slot->NeedsUpdate, AL_FALSE);
             V(slot->EffectState,update)(device, slot);
         }
-        UnlockUIntMapRead(&context->EffectSlotMap);
+        UnlockHandleMapRead(&context->EffectSlotMap);
 
-        LockUIntMapRead(&context->SourceMap);
-        for(pos = 0;pos < context->SourceMap.size;pos++)
+        LockHandleMapRead(&context->SourceMap);
+        for(pos = 0;pos < GetHandleMapCapacity(&context->SourceMap);pos++)
         {
-            ALsource *source = context->SourceMap.array[pos].value;
+            ALsource *source = LookupHandleMapIndex(&context->SourceMap, pos);
             ALuint s = device->NumAuxSends;
+            if(!source) continue;
             while(s < MAX_SENDS)
             {
                 if(source->Send[s].Slot)
@@ -2081,15 +2324,17 @@ static ALCenum UpdateDeviceParams(ALCdevice *device, const ALCint *attrList)
             }
             ATOMIC_STORE(&source->NeedsUpdate, AL_TRUE);
         }
-        UnlockUIntMapRead(&context->SourceMap);
+        UnlockHandleMapRead(&context->SourceMap);
 
         for(pos = 0;pos < context->VoiceCount;pos++)
         {
             ALvoice *voice = &context->Voices[pos];
             ALsource *source = voice->Source;
 
+            voice->Polyphase = NULL;
             if(source)
             {
+                aluPreparePolyphaseBanks(device, source);
                 ATOMIC_STORE(&source->NeedsUpdate, AL_FALSE);
                 voice->Update(voice, source, context);
             }
@@ -2106,14 +2351,14 @@ static ALCenum UpdateDeviceParams(ALCdevice *device, const ALCint *attrList)
         state->OutChannels = device->Dry.NumChannels;
         if(V(state,deviceUpdate)(device) == AL_FALSE)
         {
-            V0(device->Backend,unlock)();
+            ALCdevice_Unlock(device);
             RestoreFPUMode(&oldMode);
             return ALC_INVALID_DEVICE;
         }
         ATOMIC_STORE(&slot->NeedsUpdate, AL_FALSE);
         V(slot->EffectState,update)(device, slot);
     }
-    V0(device->Backend,unlock)();
+    ALCdevice_Unlock(device);
     RestoreFPUMode(&oldMode);
 
     if(!(device->Flags&DEVICE_PAUSED))
@@ -2131,10 +2376,24 @@ static ALCenum UpdateDeviceParams(ALCdevice *device, const ALCint *attrList)
  * Frees the device structure, and destroys any objects the app failed to
  * delete. Called once there's no more references on the device.
  */
+#ifdef ALSOFT_PROFILING
+static void ReportObjectPoolStats(const char *name, ObjectPool *pool)
+{
+    ObjectPoolStats stats;
+
+    GetObjectPoolStats(pool, &stats);
+    TRACE("%s pool: %u allocations, %u chunk allocations, %u capacity, %u in use\n",
+          name, stats.Allocs, stats.ChunkAllocs, stats.Capacity, stats.InUse);
+}
+#endif
+
 static ALCvoid FreeDevice(ALCdevice *device)
 {
     TRACE("%p\n", device);
 
+    aluStopUpdateThread(device);
+    aluStopEffectThreads(device);
+
     V0(device->Backend,close)();
     DELETE_OBJ(device->Backend);
     device->Backend = NULL;
@@ -2151,21 +2410,30 @@ static ALCvoid FreeDevice(ALCdevice *device)
         WARN("(%p) Deleting %d Buffer(s)\n", device, device->BufferMap.size);
         ReleaseALBuffers(device);
     }
-    ResetUIntMap(&device->BufferMap);
+    ResetHandleMap(&device->BufferMap);
 
     if(device->EffectMap.size > 0)
     {
         WARN("(%p) Deleting %d Effect(s)\n", device, device->EffectMap.size);
         ReleaseALEffects(device);
     }
-    ResetUIntMap(&device->EffectMap);
+    ResetHandleMap(&device->EffectMap);
 
     if(device->FilterMap.size > 0)
     {
         WARN("(%p) Deleting %d Filter(s)\n", device, device->FilterMap.size);
         ReleaseALFilters(device);
     }
-    ResetUIntMap(&device->FilterMap);
+    ResetHandleMap(&device->FilterMap);
+
+#ifdef ALSOFT_PROFILING
+    ReportObjectPoolStats("Buffer", &device->BufferPool);
+    ReportObjectPoolStats("Effect", &device->EffectPool);
+    ReportObjectPoolStats("Filter", &device->FilterPool);
+#endif
+    DeinitObjectPool(&device->BufferPool);
+    DeinitObjectPool(&device->EffectPool);
+    DeinitObjectPool(&device->FilterPool);
 
     AL_STRING_DEINIT(device->Hrtf_Name);
     FreeHrtfList(&device->Hrtf_List);
@@ -2173,6 +2441,11 @@ static ALCvoid FreeDevice(ALCdevice *device)
     al_free(device->Bs2b);
     device->Bs2b = NULL;
 
+    al_free(device->Limiter);
+    device->Limiter = NULL;
+
+    aluFreePolyphaseBanks(device);
+
     al_free(device->Uhj_Encoder);
     device->Uhj_Encoder = NULL;
 
@@ -2242,6 +2515,7 @@ static ALCboolean VerifyDevice(ALCdevice **device)
 static ALvoid InitContext(ALCcontext *Context)
 {
     ALlistener *listener = Context->Listener;
+    const char *devname = al_string_get_cstr(Context->Device->DeviceName);
     //Initialise listener
     listener->Gain = 1.0f;
     listener->MetersPerUnit = 1.0f;
@@ -2260,12 +2534,33 @@ static ALvoid InitContext(ALCcontext *Context)
         0.0, 0.0, 0.0, 1.0
     );
     aluVectorSet(&listener->Params.Velocity, 0.0f, 0.0f, 0.0f, 0.0f);
+    listener->Params.Position[0] = 0.0;
+    listener->Params.Position[1] = 0.0;
+    listener->Params.Position[2] = 0.0;
+    memcpy(listener->Used.Position, listener->Position.v, sizeof(listener->Used.Position));
+    memcpy(listener->Used.Forward, (const ALfloat*)listener->Forward, sizeof(listener->Used.Forward));
+    memcpy(listener->Used.Up, (const ALfloat*)listener->Up, sizeof(listener->Used.Up));
+    listener->Used.Gain = listener->Gain;
 
     //Validate Context
     ATOMIC_INIT(&Context->LastError, AL_NO_ERROR);
     ATOMIC_INIT(&Context->UpdateSources, AL_FALSE);
-    InitUIntMap(&Context->SourceMap, Context->Device->MaxNoOfSources);
-    InitUIntMap(&Context->EffectSlotMap, Context->Device->AuxiliaryEffectSlotMax);
+    Context->UpdateEpsilon.Position = 0.0f;
+    Context->UpdateEpsilon.Orientation = 0.0f;
+    Context->UpdateEpsilon.Gain = 0.0f;
+    Context->UpdateEpsilon.Pitch = 0.0f;
+    ConfigValueFloat(devname, NULL, "position-epsilon", &Context->UpdateEpsilon.Position);
+    ConfigValueFloat(devname, NULL, "orientation-epsilon", &Context->UpdateEpsilon.Orientation);
+    ConfigValueFloat(devname, NULL, "gain-epsilon", &Context->UpdateEpsilon.Gain);
+    ConfigValueFloat(devname, NULL, "pitch-epsilon", &Context->UpdateEpsilon.Pitch);
+    InitRef(&Context->UpdatesPerformed, 0);
+    InitRef(&Context->UpdatesSkipped, 0);
+    InitHandleMap(&Context->SourceMap, Context->Device->MaxNoOfSources);
+    InitHandleMap(&Context->EffectSlotMap, Context->Device->AuxiliaryEffectSlotMax);
+    InitObjectPool(&Context->SourcePool, sizeof(ALsource), 16);
+    InitObjectPool(&Context->BufferListPool, sizeof(ALbufferlistitem), 64);
+    InitObjectPool(&Context->EffectSlotPool, sizeof(ALeffectslot), 1);
+    ATOMIC_INIT(&Context->RetiredBufferLists, NULL);
 
     //Set globals
     Context->DistanceModel = DefaultDistanceModel;
@@ -2286,6 +2581,8 @@ static ALvoid InitContext(ALCcontext *Context)
  */
 static void FreeContext(ALCcontext *context)
 {
+    ALsizei i;
+
     TRACE("%p\n", context);
 
     if(context->SourceMap.size > 0)
@@ -2293,15 +2590,27 @@ static void FreeContext(ALCcontext *context)
         WARN("(%p) Deleting %d Source(s)\n", context, context->SourceMap.size);
         ReleaseALSources(context);
     }
-    ResetUIntMap(&context->SourceMap);
+    ResetHandleMap(&context->SourceMap);
+    ReleaseRetiredBufferLists(context);
 
     if(context->EffectSlotMap.size > 0)
     {
         WARN("(%p) Deleting %d AuxiliaryEffectSlot(s)\n", context, context->EffectSlotMap.size);
         ReleaseALAuxiliaryEffectSlots(context);
     }
-    ResetUIntMap(&context->EffectSlotMap);
+    ResetHandleMap(&context->EffectSlotMap);
+
+#ifdef ALSOFT_PROFILING
+    ReportObjectPoolStats("Source", &context->SourcePool);
+    ReportObjectPoolStats("Buffer queue", &context->BufferListPool);
+    ReportObjectPoolStats("Effect slot", &context->EffectSlotPool);
+#endif
+    DeinitObjectPool(&context->SourcePool);
+    DeinitObjectPool(&context->BufferListPool);
+    DeinitObjectPool(&context->EffectSlotPool);
 
+    for(i = 0;i < context->MaxVoices;i++)
+        al_free(context->Voices[i].TargetStore);
     al_free(context->Voices);
     context->Voices = NULL;
     context->VoiceCount = 0;
@@ -2361,12 +2670,44 @@ void ALCcontext_IncRef(ALCcontext *context)
     TRACEREF("%p increasing refcount to %u\n", context, ref);
 }
 
+/* Increments the context's reference count, unless it already dropped to 0
+ * (meaning it's about to be freed).
+ */
+static ALCboolean ALCcontext_IncRefIfLive(ALCcontext *context)
+{
+    uint ref = ReadRef(&context->ref);
+    do {
+        if(ref == 0) return ALC_FALSE;
+    } while(!ATOMIC_COMPARE_EXCHANGE_WEAK(uint, &context->ref, &ref, ref+1));
+    TRACEREF("%p increasing refcount to %u\n", context, ref+1);
+    return ALC_TRUE;
+}
+
+/* Waits until no thread holds the given context in its hazard record. */
+static void WaitForContextHazards(ALCcontext *context)
+{
+    ContextHazard *hazard = ATOMIC_LOAD(&ContextHazardList);
+    while(hazard)
+    {
+        while(ATOMIC_LOAD(&hazard->Context) == context)
+            althrd_yield();
+        hazard = hazard->next;
+    }
+}
+
 void ALCcontext_DecRef(ALCcontext *context)
 {
     uint ref;
     ref = DecrementRef(&context->ref);
     TRACEREF("%p decreasing refcount to %u\n", context, ref);
-    if(ref == 0) FreeContext(context);
+    if(ref == 0)
+    {
+        WaitForContextHazards(context);
+        /* Also wait for any lookup made under the list lock to finish. */
+        LockLists();
+        UnlockLists();
+        FreeContext(context);
+    }
 }
 
 static void ReleaseThreadCtx(void *ptr)
@@ -2375,6 +2716,48 @@ static void ReleaseThreadCtx(void *ptr)
     ALCcontext_DecRef(ptr);
 }
 
+static void ReleaseThreadHazard(void *ptr)
+{
+    ContextHazard *hazard = ptr;
+    ATOMIC_STORE(&hazard->InUse, AL_FALSE);
+}
+
+/* Returns the calling thread's hazard record, claiming an unused one or
+ * allocating a new one as needed.
+ */
+static ContextHazard *GetThreadHazard(void)
+{
+    ContextHazard *hazard = altss_get(LocalHazard);
+    if(hazard) return hazard;
+
+    hazard = ATOMIC_LOAD(&ContextHazardList);
+    while(hazard)
+    {
+        ALenum inuse = AL_FALSE;
+        if(ATOMIC_COMPARE_EXCHANGE_STRONG(ALenum, &hazard->InUse, &inuse, AL_TRUE))
+            break;
+        hazard = hazard->next;
+    }
+    if(!hazard)
+    {
+        /* Pad each record out to its own cache line, since they're written by
+         * different threads. */
+        hazard = al_calloc(64, (sizeof(*hazard)+63) & ~(size_t)63);
+        if(!hazard) return NULL;
+        ATOMIC_INIT(&hazard->Context, NULL);
+        ATOMIC_INIT(&hazard->InUse, AL_TRUE);
+        hazard->Depth = 0;
+        hazard->next = ATOMIC_LOAD(&ContextHazardList);
+        while(!ATOMIC_COMPARE_EXCHANGE_WEAK(ContextHazard*, &ContextHazardList,
+                                            &hazard->next, hazard))
+        {
+        }
+    }
+    altss_set(LocalHazard, hazard);
+
+    return hazard;
+}
+
 /* VerifyContext
  *
  * Checks that the given context is valid, and increments its reference count.
@@ -2409,28 +2792,78 @@ static ALCboolean VerifyContext(ALCcontext **context)
 
 /* GetContextRef
  *
- * Returns the currently active context for this thread, and adds a reference
- * without locking it.
+ * Returns the currently active context for this thread, and keeps it from
+ * being freed until the matching ReleaseContextRef, without locking it.
  */
 ALCcontext *GetContextRef(void)
 {
+    ContextHazard *hazard;
     ALCcontext *context;
 
+    /* The thread's own reference keeps its current context alive, and only
+     * this thread can change it. */
     context = altss_get(LocalContext);
-    if(context)
-        ALCcontext_IncRef(context);
+    if(context) return context;
+
+    if((hazard=GetThreadHazard()) != NULL)
+    {
+        /* A nested call keeps using the context the outer call published. */
+        if(hazard->Depth > 0)
+        {
+            hazard->Depth++;
+            return ATOMIC_LOAD(&hazard->Context, almemory_order_relaxed);
+        }
+
+        /* Publish the process-wide context in the hazard record, and make sure
+         * it's still current afterward. Once that holds, the context can't be
+         * freed until ReleaseContextRef clears the record, so it doesn't need
+         * a reference. Releasing it in the mean time just makes the last
+         * reference wait for the record to clear.
+         */
+        do {
+            context = ATOMIC_LOAD(&GlobalContext);
+            ATOMIC_STORE(&hazard->Context, context);
+        } while(context != ATOMIC_LOAD(&GlobalContext));
+        if(context) hazard->Depth = 1;
+    }
     else
     {
+        /* Without a hazard record, fall back to looking it up under the list
+         * lock and adding a reference. A context that drops to no references
+         * waits for the lock before being freed, so it stays valid while the
+         * lock is held. */
         LockLists();
         context = ATOMIC_LOAD(&GlobalContext);
-        if(context)
-            ALCcontext_IncRef(context);
+        if(context && !ALCcontext_IncRefIfLive(context))
+            context = NULL;
         UnlockLists();
     }
 
     return context;
 }
 
+/* ReleaseContextRef
+ *
+ * Releases a context returned by GetContextRef.
+ */
+void ReleaseContextRef(ALCcontext *context)
+{
+    ContextHazard *hazard;
+
+    if(altss_get(LocalContext) == context)
+        return;
+
+    hazard = altss_get(LocalHazard);
+    if(hazard && hazard->Depth > 0)
+    {
+        if(--hazard->Depth == 0)
+            ATOMIC_STORE(&hazard->Context, NULL, almemory_order_release);
+        return;
+    }
+
+    ALCcontext_DecRef(context);
+}
+
 
 /************************************************
  * Standard ALC functions
@@ -2826,6 +3259,14 @@ static ALCsizei GetIntegerv(ALCdevice *device, ALCenum param, ALCsizei size, ALC
             values[0] = (ALCint)VECTOR_SIZE(device->Hrtf_List);
             return 1;
 
+        case ALC_OUTPUT_LIMITER_SOFTX:
+            values[0] = (device->Limiter ? ALC_TRUE : ALC_FALSE);
+            return 1;
+
+        case ALC_OUTPUT_LIMITER_GAIN_REDUCTION_SOFTX:
+            values[0] = (device->Limiter ? ATOMIC_LOAD(&device->Limiter->GainReduction) : 0);
+            return 1;
+
         default:
             alcSetError(device, ALC_INVALID_ENUM);
             return 0;
@@ -3244,8 +3685,10 @@ ALC_API ALCdevice* ALC_APIENTRY alcGetContextsDevice(ALCcontext *Context)
 ALC_API ALCdevice* ALC_APIENTRY alcOpenDevice(const ALCchar *deviceName)
 {
     const ALCchar *fmt;
+    ALuint effectThreads;
     ALCdevice *device;
     ALCenum err;
+    ALuint i;
 
     DO_INITCONFIG();
 
@@ -3283,6 +3726,7 @@ ALC_API ALCdevice* ALC_APIENTRY alcOpenDevice(const ALCchar *deviceName)
     device->Flags = 0;
     device->Bs2b = NULL;
     device->Uhj_Encoder = NULL;
+    device->Limiter = NULL;
     VECTOR_INIT(device->Hrtf_List);
     AL_STRING_INIT(device->Hrtf_Name);
     device->Render_Mode = NormalRender;
@@ -3295,6 +3739,8 @@ ALC_API ALCdevice* ALC_APIENTRY alcOpenDevice(const ALCchar *deviceName)
     device->RealOut.NumChannels = 0;
 
     ATOMIC_INIT(&device->ContextList, NULL);
+    for(i = 0;i < MAX_POLYPHASE_BANKS;i++)
+        ATOMIC_INIT(&device->PolyphaseBanks[i], NULL);
 
     device->ClockBase = 0;
     device->SamplesDone = 0;
@@ -3303,9 +3749,12 @@ ALC_API ALCdevice* ALC_APIENTRY alcOpenDevice(const ALCchar *deviceName)
     device->AuxiliaryEffectSlotMax = 4;
     device->NumAuxSends = MAX_SENDS;
 
-    InitUIntMap(&device->BufferMap, ~0);
-    InitUIntMap(&device->EffectMap, ~0);
-    InitUIntMap(&device->FilterMap, ~0);
+    InitHandleMap(&device->BufferMap, ~0);
+    InitHandleMap(&device->EffectMap, ~0);
+    InitHandleMap(&device->FilterMap, ~0);
+    InitObjectPool(&device->BufferPool, sizeof(ALbuffer), 16);
+    InitObjectPool(&device->EffectPool, sizeof(ALeffect), 4);
+    InitObjectPool(&device->FilterPool, sizeof(ALfilter), 4);
 
     //Set output format
     device->FmtChans = DevFmtChannelsDefault;
@@ -3425,6 +3874,11 @@ ALC_API ALCdevice* ALC_APIENTRY alcOpenDevice(const ALCchar *deviceName)
         return NULL;
     }
 
+    if(GetConfigValueBool(deviceName, NULL, "async-updates", 0))
+        aluStartUpdateThread(device);
+    if(ConfigValueUInt(deviceName, NULL, "effect-threads", &effectThreads))
+        aluStartEffectThreads(device, effectThreads);
+
     if(DefaultEffect.type != AL_EFFECT_NULL)
     {
         device->DefaultSlot = (ALeffectslot*)device->_slot_mem;
@@ -3554,9 +4008,12 @@ ALC_API ALCdevice* ALC_APIENTRY alcCaptureOpenDevice(const ALCchar *deviceName,
     device->RealOut.Buffer = NULL;
     device->RealOut.NumChannels = 0;
 
-    InitUIntMap(&device->BufferMap, ~0);
-    InitUIntMap(&device->EffectMap, ~0);
-    InitUIntMap(&device->FilterMap, ~0);
+    InitHandleMap(&device->BufferMap, ~0);
+    InitHandleMap(&device->EffectMap, ~0);
+    InitHandleMap(&device->FilterMap, ~0);
+    InitObjectPool(&device->BufferPool, sizeof(ALbuffer), 16);
+    InitObjectPool(&device->EffectPool, sizeof(ALeffect), 4);
+    InitObjectPool(&device->FilterPool, sizeof(ALfilter), 4);
 
     if(!CaptureBackend.getFactory)
         device->Backend = create_backend_wrapper(device, &CaptureBackend.Funcs,
@@ -3711,7 +4168,9 @@ ALC_API void ALC_APIENTRY alcCaptureSamples(ALCdevice *device, ALCvoid *buffer,
 ALC_API ALCdevice* ALC_APIENTRY alcLoopbackOpenDeviceSOFT(const ALCchar *deviceName)
 {
     ALCbackendFactory *factory;
+    ALuint effectThreads;
     ALCdevice *device;
+    ALuint i;
 
     DO_INITCONFIG();
 
@@ -3740,6 +4199,7 @@ ALC_API ALCdevice* ALC_APIENTRY alcLoopbackOpenDeviceSOFT(const ALCchar *deviceN
     AL_STRING_INIT(device->Hrtf_Name);
     device->Bs2b = NULL;
     device->Uhj_Encoder = NULL;
+    device->Limiter = NULL;
     device->Render_Mode = NormalRender;
     AL_STRING_INIT(device->DeviceName);
     device->Dry.Buffer = NULL;
@@ -3750,6 +4210,8 @@ ALC_API ALCdevice* ALC_APIENTRY alcLoopbackOpenDeviceSOFT(const ALCchar *deviceN
     device->RealOut.NumChannels = 0;
 
     ATOMIC_INIT(&device->ContextList, NULL);
+    for(i = 0;i < MAX_POLYPHASE_BANKS;i++)
+        ATOMIC_INIT(&device->PolyphaseBanks[i], NULL);
 
     device->ClockBase = 0;
     device->SamplesDone = 0;
@@ -3758,9 +4220,12 @@ ALC_API ALCdevice* ALC_APIENTRY alcLoopbackOpenDeviceSOFT(const ALCchar *deviceN
     device->AuxiliaryEffectSlotMax = 4;
     device->NumAuxSends = MAX_SENDS;
 
-    InitUIntMap(&device->BufferMap, ~0);
-    InitUIntMap(&device->EffectMap, ~0);
-    InitUIntMap(&device->FilterMap, ~0);
+    InitHandleMap(&device->BufferMap, ~0);
+    InitHandleMap(&device->EffectMap, ~0);
+    InitHandleMap(&device->FilterMap, ~0);
+    InitObjectPool(&device->BufferPool, sizeof(ALbuffer), 16);
+    InitObjectPool(&device->EffectPool, sizeof(ALeffect), 4);
+    InitObjectPool(&device->FilterPool, sizeof(ALfilter), 4);
 
     factory = ALCloopbackFactory_getFactory();
     device->Backend = V(factory,createBackend)(device, ALCbackend_Loopback);
@@ -3792,6 +4257,9 @@ ALC_API ALCdevice* ALC_APIENTRY alcLoopbackOpenDeviceSOFT(const ALCchar *deviceN
     device->NumStereoSources = 1;
     device->NumMonoSources = device->MaxNoOfSources - device->NumStereoSources;
 
+    if(ConfigValueUInt(NULL, NULL, "effect-threads", &effectThreads))
+        aluStartEffectThreads(device, effectThreads);
+
     // Open the "backend"
     V(device->Backend,open)("Loopback");
 
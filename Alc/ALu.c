@@ -36,6 +36,7 @@
 #include "hrtf.h"
 #include "uhjfilter.h"
 #include "bformatdec.h"
+#include "limiter.h"
 #include "static_assert.h"
 
 #include "mixer_defs.h"
@@ -116,6 +117,16 @@ static inline HrtfMixerFunc SelectHrtfMixer(void)
     return MixHrtf_C;
 }
 
+static inline GeometryFunc SelectGeometryFunc(void)
+{
+#ifdef HAVE_SSE2
+    if((CPUCapFlags&CPU_CAP_SSE2))
+        return CalcSourceGeometry_SSE2;
+#endif
+
+    return CalcSourceGeometry_C;
+}
+
 
 static inline void aluCrossproduct(const ALfloat *inVector1, const ALfloat *inVector2, ALfloat *outVector)
 {
@@ -200,22 +211,12 @@ static inline aluVector aluMatrixdVector(const aluMatrixd *mtx, const aluVector
  * modified for use with an interpolated increment for buttery-smooth pitch
  * changes.
  */
-static ALboolean BsincPrepare(const ALuint increment, BsincState *state)
+static ALboolean BsincPrepare(const ALuint increment, BsincState *state, const BsincTable *table)
 {
-    static const ALfloat scaleBase = 1.510578918e-01f, scaleRange = 1.177936623e+00f;
-    static const ALuint m[BSINC_SCALE_COUNT] = { 24, 24, 24, 24, 24, 24, 24, 20, 20, 20, 16, 16, 16, 12, 12, 12 };
-    static const ALuint to[4][BSINC_SCALE_COUNT] =
-    {
-        { 0, 24, 408, 792, 1176, 1560, 1944, 2328, 2648, 2968, 3288, 3544, 3800, 4056, 4248, 4440 },
-        { 4632, 5016, 5400, 5784, 6168, 6552, 6936, 7320, 7640, 7960, 8280, 8536, 8792, 9048, 9240, 0 },
-        { 0, 9432, 9816, 10200, 10584, 10968, 11352, 11736, 12056, 12376, 12696, 12952, 13208, 13464, 13656, 13848 },
-        { 14040, 14424, 14808, 15192, 15576, 15960, 16344, 16728, 17048, 17368, 17688, 17944, 18200, 18456, 18648, 0 }
-    };
-    static const ALuint tm[2][BSINC_SCALE_COUNT] =
-    {
-        { 0, 24, 24, 24, 24, 24, 24, 20, 20, 20, 16, 16, 16, 12, 12, 12 },
-        { 24, 24, 24, 24, 24, 24, 24, 20, 20, 20, 16, 16, 16, 12, 12, 0 }
-    };
+    const ALfloat scaleBase = table->scaleBase, scaleRange = table->scaleRange;
+    const ALuint *m = table->m;
+    const ALuint (*to)[BSINC_SCALE_COUNT] = table->to;
+    const ALuint (*tm)[BSINC_SCALE_COUNT] = table->tm;
     ALfloat sf;
     ALuint si, pi;
     ALboolean uncut = AL_TRUE;
@@ -257,10 +258,10 @@ static ALboolean BsincPrepare(const ALuint increment, BsincState *state)
      */
     for(pi = 0;pi < BSINC_PHASE_COUNT;pi++)
     {
-        state->coeffs[pi].filter  = &bsincTab[to[0][si] + tm[0][si]*pi];
-        state->coeffs[pi].scDelta = &bsincTab[to[1][si] + tm[1][si]*pi];
-        state->coeffs[pi].phDelta = &bsincTab[to[2][si] + tm[0][si]*pi];
-        state->coeffs[pi].spDelta = &bsincTab[to[3][si] + tm[1][si]*pi];
+        state->coeffs[pi].filter  = &table->Tab[to[0][si] + tm[0][si]*pi];
+        state->coeffs[pi].scDelta = &table->Tab[to[1][si] + tm[1][si]*pi];
+        state->coeffs[pi].phDelta = &table->Tab[to[2][si] + tm[0][si]*pi];
+        state->coeffs[pi].spDelta = &table->Tab[to[3][si] + tm[1][si]*pi];
     }
     return uncut;
 }
@@ -269,6 +270,7 @@ static ALboolean BsincPrepare(const ALuint increment, BsincState *state)
 static ALvoid CalcListenerParams(ALlistener *Listener)
 {
     ALdouble N[3], V[3], U[3], P[3];
+    ALsizei i;
 
     /* AT then UP */
     N[0] = Listener->Forward[0];
@@ -293,10 +295,289 @@ static ALvoid CalcListenerParams(ALlistener *Listener)
     P[0] = Listener->Position.v[0];
     P[1] = Listener->Position.v[1];
     P[2] = Listener->Position.v[2];
+    Listener->Params.Position[0] = P[0];
+    Listener->Params.Position[1] = P[1];
+    Listener->Params.Position[2] = P[2];
     aluMatrixdDouble3(P, 1.0, &Listener->Params.Matrix);
     aluMatrixdSetRow(&Listener->Params.Matrix, 3, -P[0], -P[1], -P[2], 1.0f);
 
     Listener->Params.Velocity = aluMatrixdVector(&Listener->Params.Matrix, &Listener->Velocity);
+
+    for(i = 0;i < 3;i++)
+    {
+        Listener->Used.Position[i] = Listener->Position.v[i];
+        Listener->Used.Forward[i] = Listener->Forward[i];
+        Listener->Used.Up[i] = Listener->Up[i];
+    }
+    Listener->Used.Gain = Listener->Gain;
+}
+
+/* Gets the filter table for a bsinc resampler, or NULL for the others. */
+static inline const BsincTable *GetBsincTable(enum Resampler resampler)
+{
+    switch(resampler)
+    {
+        case BSinc8Resampler: return &bsinc8;
+        case BSinc12Resampler: return &bsinc12;
+        case BSinc24Resampler: return &bsinc24;
+        default: break;
+    }
+    return NULL;
+}
+
+static inline ALuint Gcd(ALuint a, ALuint b)
+{
+    while(b > 0)
+    {
+        ALuint t = a % b;
+        a = b;
+        b = t;
+    }
+    return a;
+}
+
+static PolyphaseBank *CreatePolyphaseBank(enum Resampler resampler, ALuint srcrate,
+                                          ALuint dstrate, ALuint gcd)
+{
+    const BsincTable *bsinc = GetBsincTable(resampler);
+    const ALuint phases = dstrate / gcd;
+    const ALuint step = srcrate / gcd;
+    const ALfloat pitch = (ALfloat)srcrate / (ALfloat)dstrate;
+    PolyphaseBank *bank;
+    BsincState state;
+    ALuint k, j;
+
+    /* Only bsinc gains from this. The other filters are a single table lookup
+     * per sample already, which their mixers vectorize better as is.
+     */
+    if(!bsinc || pitch > (ALfloat)MAX_PITCH)
+        return NULL;
+    BsincPrepare(maxi(fastf2i(pitch*FRACTIONONE + 0.5f), 1), &state, bsinc);
+
+    bank = al_calloc(16, offsetof(PolyphaseBank, Coeffs) + phases*state.m*sizeof(ALfloat));
+    if(!bank) return NULL;
+
+    bank->Resampler = resampler;
+    bank->SrcRate = srcrate;
+    bank->DstRate = dstrate;
+    bank->Phases = phases;
+    bank->IntStep = step / phases;
+    bank->FracStep = step % phases;
+    bank->Taps = state.m;
+    bank->Offset = state.l;
+
+    /* Bake the scale and phase interpolation the bsinc mixer does for each
+     * sample into one filter per output phase.
+     */
+    for(k = 0;k < phases;k++)
+    {
+#define FRAC_PHASE_BITDIFF (FRACTIONBITS-BSINC_PHASE_BITS)
+        const ALuint frac = (ALuint)(((ALuint64)k << FRACTIONBITS) / phases);
+        const ALuint pi = frac >> FRAC_PHASE_BITDIFF;
+        const ALfloat pf = (frac & ((1<<FRAC_PHASE_BITDIFF)-1)) *
+                           (1.0f/(1<<FRAC_PHASE_BITDIFF));
+#undef FRAC_PHASE_BITDIFF
+        const ALfloat *fil = state.coeffs[pi].filter;
+        const ALfloat *scd = state.coeffs[pi].scDelta;
+        const ALfloat *phd = state.coeffs[pi].phDelta;
+        const ALfloat *spd = state.coeffs[pi].spDelta;
+        ALfloat *restrict row = &bank->Coeffs[k*state.m];
+
+        for(j = 0;j < state.m;j++)
+            row[j] = fil[j] + state.sf*scd[j] + pf*(phd[j] + state.sf*spd[j]);
+    }
+
+    return bank;
+}
+
+/* Finds the device's filter bank for resampling from the given rate at a
+ * fixed ratio. Returns NULL if there isn't one, so the source uses its normal
+ * resampler instead.
+ */
+static const PolyphaseBank *FindPolyphaseBank(const ALCdevice *device, enum Resampler resampler,
+                                              ALuint srcrate)
+{
+    const ALuint dstrate = device->Frequency;
+    const PolyphaseBank *bank;
+    ALuint i;
+
+    for(i = 0;i < MAX_POLYPHASE_BANKS;i++)
+    {
+        if(!(bank=ATOMIC_LOAD(&device->PolyphaseBanks[i])))
+            break;
+        if(bank->Resampler == resampler && bank->SrcRate == srcrate &&
+           bank->DstRate == dstrate)
+            return bank;
+    }
+    return NULL;
+}
+
+/* Gets the device's filter bank for resampling from the given rate at a fixed
+ * ratio, creating it if needed. Returns NULL if the ratio doesn't reduce to a
+ * small enough number of phases, or the resampler isn't one that gains from it.
+ */
+static const PolyphaseBank *GetPolyphaseBank(ALCdevice *device, enum Resampler resampler,
+                                             ALuint srcrate)
+{
+    const ALuint dstrate = device->Frequency;
+    PolyphaseBank *bank;
+    ALuint gcd, i;
+
+    if(srcrate == dstrate || !GetBsincTable(resampler))
+        return NULL;
+    gcd = Gcd(srcrate, dstrate);
+    if(dstrate/gcd > MAX_POLYPHASE_PHASES)
+        return NULL;
+
+    for(i = 0;i < MAX_POLYPHASE_BANKS;i++)
+    {
+        bank = ATOMIC_LOAD(&device->PolyphaseBanks[i]);
+        if(!bank)
+        {
+            /* Another thread may claim this slot first, in which case check
+             * what it added before moving on. */
+            PolyphaseBank *newbank = CreatePolyphaseBank(resampler, srcrate, dstrate, gcd);
+            if(!newbank) return NULL;
+            if(ATOMIC_COMPARE_EXCHANGE_STRONG(PolyphaseBank*, &device->PolyphaseBanks[i],
+                                              &bank, newbank))
+                return newbank;
+            al_free(newbank);
+        }
+        if(bank->Resampler == resampler && bank->SrcRate == srcrate &&
+           bank->DstRate == dstrate)
+            return bank;
+    }
+    return NULL;
+}
+
+void aluPreparePolyphaseBanks(ALCdevice *device, const ALsource *source)
+{
+    enum Resampler resampler = source->Resampler;
+
+    if(source->Frequency == 0)
+        return;
+    /* The resampler LOD may step down to any lower quality resampler. */
+    while(1)
+    {
+        GetPolyphaseBank(device, resampler, source->Frequency);
+        if(!ResamplerLOD || resampler == PointResampler)
+            break;
+        resampler--;
+    }
+}
+
+void aluFreePolyphaseBanks(ALCdevice *device)
+{
+    ALuint i;
+    for(i = 0;i < MAX_POLYPHASE_BANKS;i++)
+        al_free(ATOMIC_EXCHANGE(PolyphaseBank*, &device->PolyphaseBanks[i], NULL));
+}
+
+
+/* How far above a step's threshold the attenuation has to rise before the
+ * resampler LOD steps back up (~2dB), so a source hovering around it doesn't
+ * switch resamplers back and forth on every update.
+ */
+#define RESAMPLER_LOD_HYSTERESIS 1.25f
+
+static ALuint CountLODSteps(ALuint maxsteps, ALfloat attenuation, ALfloat threshold)
+{
+    ALuint steps = 0;
+    while(steps < maxsteps && attenuation < threshold)
+    {
+        steps++;
+        attenuation *= 2.0f;
+    }
+    return steps;
+}
+
+/* Picks the resampler for a source. With the resampler LOD enabled, the
+ * quality drops one step for each halving of the distance attenuation below
+ * -6dB, as the extra aliasing of cheaper resamplers goes unheard.
+ */
+static enum Resampler SelectSourceResampler(ALvoice *voice, const ALsource *source, ALfloat attenuation)
+{
+    enum Resampler resampler = source->Resampler;
+    ALuint maxsteps, steps;
+
+    if(!ResamplerLOD)
+        return resampler;
+
+    maxsteps = resampler - PointResampler;
+    steps = CountLODSteps(maxsteps, attenuation, 0.5f);
+    if(steps < voice->LODSteps)
+    {
+        /* Only regain quality once clearly past the threshold. */
+        steps = CountLODSteps(maxsteps, attenuation, 0.5f*RESAMPLER_LOD_HYSTERESIS);
+        steps = minu(steps, voice->LODSteps);
+    }
+    voice->LODSteps = steps;
+
+    return resampler - steps;
+}
+
+/* Hands the voice's newly calculated targets to the mixer, and gets the buffer
+ * to calculate the next ones in.
+ */
+static void PublishVoiceTargets(ALvoice *voice)
+{
+    ALuint idx = ATOMIC_EXCHANGE(ALuint, &voice->PendingTargets,
+                                 voice->NextTargets | VOICE_TARGETS_FRESH);
+    voice->NextTargets = idx & ~VOICE_TARGETS_FRESH;
+}
+
+/* Copies any pending targets into the voice, to be faded to by the mixer. */
+static void ApplyVoiceTargets(ALvoice *voice, const ALCdevice *Device)
+{
+    ALvoiceTargets *targets;
+    ALuint i, c;
+
+    if(!(ATOMIC_LOAD(&voice->PendingTargets)&VOICE_TARGETS_FRESH))
+        return;
+    voice->MixTargets = ATOMIC_EXCHANGE(ALuint, &voice->PendingTargets, voice->MixTargets) &
+                        ~VOICE_TARGETS_FRESH;
+    targets = &voice->TargetStore[voice->MixTargets];
+
+    /* A Step of 0 means there was no format to calculate it with. */
+    if(targets->Step > 0)
+    {
+        voice->Step = targets->Step;
+        voice->Resampler = SelectResampler(targets->Resampler);
+        if(!targets->Polyphase && GetBsincTable(targets->Resampler) != NULL)
+            voice->SincState = targets->SincState;
+        voice->Polyphase = targets->Polyphase;
+    }
+    voice->IsHrtf = targets->IsHrtf;
+
+    voice->Direct.OutBuffer = targets->Direct.OutBuffer;
+    voice->Direct.OutChannels = targets->Direct.OutChannels;
+    for(c = 0;c < targets->NumChannels;c++)
+    {
+        voice->Direct.Filters[c].ActiveType = targets->Direct.Filters[c].ActiveType;
+        ALfilterState_copyParams(&voice->Direct.Filters[c].LowPass, &targets->Direct.Filters[c].LowPass);
+        ALfilterState_copyParams(&voice->Direct.Filters[c].HighPass, &targets->Direct.Filters[c].HighPass);
+        if(targets->IsHrtf)
+            voice->Direct.Hrtf[c].Target = targets->Direct.Hrtf[c].Target;
+        else
+            memcpy(voice->Direct.Gains[c].Target, targets->Direct.Gains[c].Target,
+                   sizeof(voice->Direct.Gains[c].Target));
+    }
+
+    for(i = 0;i < Device->NumAuxSends;i++)
+    {
+        voice->Send[i].OutBuffer = targets->Send[i].OutBuffer;
+        voice->Send[i].OutChannels = targets->Send[i].OutChannels;
+        for(c = 0;c < targets->NumChannels;c++)
+        {
+            voice->Send[i].Filters[c].ActiveType = targets->Send[i].Filters[c].ActiveType;
+            ALfilterState_copyParams(&voice->Send[i].Filters[c].LowPass,
+                                     &targets->Send[i].Filters[c].LowPass);
+            ALfilterState_copyParams(&voice->Send[i].Filters[c].HighPass,
+                                     &targets->Send[i].Filters[c].HighPass);
+            memcpy(voice->Send[i].Gains[c].Target, targets->Send[i].Gains[c].Target,
+                   sizeof(voice->Send[i].Gains[c].Target));
+        }
+    }
 }
 
 ALvoid CalcNonAttnSourceParams(ALvoice *voice, const ALsource *ALSource, const ALCcontext *ALContext)
@@ -338,8 +619,8 @@ ALvoid CalcNonAttnSourceParams(ALvoice *voice, const ALsource *ALSource, const A
     };
 
     const ALCdevice *Device = ALContext->Device;
+    ALvoiceTargets *targets = &voice->TargetStore[voice->NextTargets];
     ALfloat SourceVolume,ListenerGain,MinVolume,MaxVolume;
-    ALbufferlistitem *BufferListItem;
     enum FmtChannels Channels;
     ALfloat DryGain, DryGainHF, DryGainLF;
     ALfloat WetGain[MAX_SENDS];
@@ -356,6 +637,7 @@ ALvoid CalcNonAttnSourceParams(ALvoice *voice, const ALsource *ALSource, const A
     ALuint num_channels = 0;
     ALboolean DirectChannels;
     ALboolean isbformat = AL_FALSE;
+    const BsincTable *bsinc;
     ALfloat Pitch;
     ALuint i, j, c;
 
@@ -378,8 +660,8 @@ ALvoid CalcNonAttnSourceParams(ALvoice *voice, const ALsource *ALSource, const A
     StereoMap[0].angle = -ALSource->StereoPan[0];
     StereoMap[1].angle = -ALSource->StereoPan[1];
 
-    voice->Direct.OutBuffer = Device->Dry.Buffer;
-    voice->Direct.OutChannels = Device->Dry.NumChannels;
+    targets->Direct.OutBuffer = Device->Dry.Buffer;
+    targets->Direct.OutChannels = Device->Dry.NumChannels;
     for(i = 0;i < NumSends;i++)
     {
         SendSlots[i] = ALSource->Send[i].Slot;
@@ -388,35 +670,36 @@ ALvoid CalcNonAttnSourceParams(ALvoice *voice, const ALsource *ALSource, const A
         if(!SendSlots[i] || SendSlots[i]->EffectType == AL_EFFECT_NULL)
         {
             SendSlots[i] = NULL;
-            voice->Send[i].OutBuffer = NULL;
-            voice->Send[i].OutChannels = 0;
+            targets->Send[i].OutBuffer = NULL;
+            targets->Send[i].OutChannels = 0;
         }
         else
         {
-            voice->Send[i].OutBuffer = SendSlots[i]->WetBuffer;
-            voice->Send[i].OutChannels = SendSlots[i]->NumChannels;
+            targets->Send[i].OutBuffer = SendSlots[i]->WetBuffer;
+            targets->Send[i].OutChannels = SendSlots[i]->NumChannels;
         }
     }
 
     /* Calculate the stepping value */
     Channels = FmtMono;
-    BufferListItem = ATOMIC_LOAD(&ALSource->queue);
-    while(BufferListItem != NULL)
+    targets->Step = 0;
+    targets->Polyphase = NULL;
+    if(ALSource->Frequency > 0)
     {
-        ALbuffer *ALBuffer;
-        if((ALBuffer=BufferListItem->buffer) != NULL)
-        {
-            Pitch = Pitch * ALBuffer->Frequency / Frequency;
-            if(Pitch > (ALfloat)MAX_PITCH)
-                voice->Step = MAX_PITCH<<FRACTIONBITS;
-            else
-                voice->Step = maxi(fastf2i(Pitch*FRACTIONONE + 0.5f), 1);
-            BsincPrepare(voice->Step, &voice->SincState);
+        targets->Resampler = SelectSourceResampler(voice, ALSource, 1.0f);
+        if(Pitch == 1.0f)
+            targets->Polyphase = FindPolyphaseBank(ALContext->Device, targets->Resampler,
+                                                   ALSource->Frequency);
+
+        Pitch = Pitch * ALSource->Frequency / Frequency;
+        if(Pitch > (ALfloat)MAX_PITCH)
+            targets->Step = MAX_PITCH<<FRACTIONBITS;
+        else
+            targets->Step = maxi(fastf2i(Pitch*FRACTIONONE + 0.5f), 1);
+        if(!targets->Polyphase && (bsinc=GetBsincTable(targets->Resampler)) != NULL)
+            BsincPrepare(targets->Step, &targets->SincState, bsinc);
 
-            Channels = ALBuffer->FmtChannels;
-            break;
-        }
-        BufferListItem = BufferListItem->next;
+        Channels = ALSource->FmtChannels;
     }
 
     /* Calculate gains */
@@ -481,6 +764,7 @@ ALvoid CalcNonAttnSourceParams(ALvoice *voice, const ALsource *ALSource, const A
         DirectChannels = AL_FALSE;
         break;
     }
+    targets->NumChannels = num_channels;
 
     if(isbformat)
     {
@@ -516,11 +800,11 @@ ALvoid CalcNonAttnSourceParams(ALvoice *voice, const ALsource *ALSource, const A
                     0.0f, -V[0]*scale,  V[1]*scale, -V[2]*scale
         );
 
-        voice->Direct.OutBuffer = Device->FOAOut.Buffer;
-        voice->Direct.OutChannels = Device->FOAOut.NumChannels;
+        targets->Direct.OutBuffer = Device->FOAOut.Buffer;
+        targets->Direct.OutChannels = Device->FOAOut.NumChannels;
         for(c = 0;c < num_channels;c++)
             ComputeFirstOrderGains(Device->FOAOut, matrix.m[c], DryGain,
-                                   voice->Direct.Gains[c].Target);
+                                   targets->Direct.Gains[c].Target);
 
         for(i = 0;i < NumSends;i++)
         {
@@ -529,7 +813,7 @@ ALvoid CalcNonAttnSourceParams(ALvoice *voice, const ALsource *ALSource, const A
                 for(c = 0;c < num_channels;c++)
                 {
                     for(j = 0;j < MAX_EFFECT_CHANNELS;j++)
-                        voice->Send[i].Gains[c].Target[j] = 0.0f;
+                        targets->Send[i].Gains[c].Target[j] = 0.0f;
                 }
             }
             else
@@ -538,12 +822,12 @@ ALvoid CalcNonAttnSourceParams(ALvoice *voice, const ALsource *ALSource, const A
                 {
                     const ALeffectslot *Slot = SendSlots[i];
                     ComputeFirstOrderGainsBF(Slot->ChanMap, Slot->NumChannels, matrix.m[c],
-                                             WetGain[i], voice->Send[i].Gains[c].Target);
+                                             WetGain[i], targets->Send[i].Gains[c].Target);
                 }
             }
         }
 
-        voice->IsHrtf = AL_FALSE;
+        targets->IsHrtf = AL_FALSE;
     }
     else
     {
@@ -552,15 +836,15 @@ ALvoid CalcNonAttnSourceParams(ALvoice *voice, const ALsource *ALSource, const A
         if(DirectChannels)
         {
             /* Skip the virtual channels and write inputs to the real output. */
-            voice->Direct.OutBuffer = Device->RealOut.Buffer;
-            voice->Direct.OutChannels = Device->RealOut.NumChannels;
+            targets->Direct.OutBuffer = Device->RealOut.Buffer;
+            targets->Direct.OutChannels = Device->RealOut.NumChannels;
             for(c = 0;c < num_channels;c++)
             {
                 int idx;
                 for(j = 0;j < MAX_OUTPUT_CHANNELS;j++)
-                    voice->Direct.Gains[c].Target[j] = 0.0f;
+                    targets->Direct.Gains[c].Target[j] = 0.0f;
                 if((idx=GetChannelIdxByName(Device->RealOut, chans[c].channel)) != -1)
-                    voice->Direct.Gains[c].Target[idx] = DryGain;
+                    targets->Direct.Gains[c].Target[idx] = DryGain;
             }
 
             /* Auxiliary sends still use normal panning since they mix to B-Format, which can't
@@ -574,43 +858,43 @@ ALvoid CalcNonAttnSourceParams(ALvoice *voice, const ALsource *ALSource, const A
                     if(!SendSlots[i])
                     {
                         for(j = 0;j < MAX_EFFECT_CHANNELS;j++)
-                            voice->Send[i].Gains[c].Target[j] = 0.0f;
+                            targets->Send[i].Gains[c].Target[j] = 0.0f;
                     }
                     else
                     {
                         const ALeffectslot *Slot = SendSlots[i];
                         ComputePanningGainsBF(Slot->ChanMap, Slot->NumChannels, coeffs,
-                                              WetGain[i], voice->Send[i].Gains[c].Target);
+                                              WetGain[i], targets->Send[i].Gains[c].Target);
                     }
                 }
             }
 
-            voice->IsHrtf = AL_FALSE;
+            targets->IsHrtf = AL_FALSE;
         }
         else if(Device->Render_Mode == HrtfRender)
         {
             /* Full HRTF rendering. Skip the virtual channels and render each
              * input channel to the real outputs.
              */
-            voice->Direct.OutBuffer = Device->RealOut.Buffer;
-            voice->Direct.OutChannels = Device->RealOut.NumChannels;
+            targets->Direct.OutBuffer = Device->RealOut.Buffer;
+            targets->Direct.OutChannels = Device->RealOut.NumChannels;
             for(c = 0;c < num_channels;c++)
             {
                 if(chans[c].channel == LFE)
                 {
                     /* Skip LFE */
-                    voice->Direct.Hrtf[c].Target.Delay[0] = 0;
-                    voice->Direct.Hrtf[c].Target.Delay[1] = 0;
+                    targets->Direct.Hrtf[c].Target.Delay[0] = 0;
+                    targets->Direct.Hrtf[c].Target.Delay[1] = 0;
                     for(i = 0;i < HRIR_LENGTH;i++)
                     {
-                        voice->Direct.Hrtf[c].Target.Coeffs[i][0] = 0.0f;
-                        voice->Direct.Hrtf[c].Target.Coeffs[i][1] = 0.0f;
+                        targets->Direct.Hrtf[c].Target.Coeffs[i][0] = 0.0f;
+                        targets->Direct.Hrtf[c].Target.Coeffs[i][1] = 0.0f;
                     }
 
                     for(i = 0;i < NumSends;i++)
                     {
                         for(j = 0;j < MAX_EFFECT_CHANNELS;j++)
-                            voice->Send[i].Gains[c].Target[j] = 0.0f;
+                            targets->Send[i].Gains[c].Target[j] = 0.0f;
                     }
 
                     continue;
@@ -619,8 +903,8 @@ ALvoid CalcNonAttnSourceParams(ALvoice *voice, const ALsource *ALSource, const A
                 /* Get the static HRIR coefficients and delays for this channel. */
                 GetLerpedHrtfCoeffs(Device->Hrtf,
                     chans[c].elevation, chans[c].angle, 0.0f, DryGain,
-                    voice->Direct.Hrtf[c].Target.Coeffs,
-                    voice->Direct.Hrtf[c].Target.Delay
+                    targets->Direct.Hrtf[c].Target.Coeffs,
+                    targets->Direct.Hrtf[c].Target.Delay
                 );
 
                 /* Normal panning for auxiliary sends. */
@@ -631,18 +915,18 @@ ALvoid CalcNonAttnSourceParams(ALvoice *voice, const ALsource *ALSource, const A
                     if(!SendSlots[i])
                     {
                         for(j = 0;j < MAX_EFFECT_CHANNELS;j++)
-                            voice->Send[i].Gains[c].Target[j] = 0.0f;
+                            targets->Send[i].Gains[c].Target[j] = 0.0f;
                     }
                     else
                     {
                         const ALeffectslot *Slot = SendSlots[i];
                         ComputePanningGainsBF(Slot->ChanMap, Slot->NumChannels, coeffs,
-                                              WetGain[i], voice->Send[i].Gains[c].Target);
+                                              WetGain[i], targets->Send[i].Gains[c].Target);
                     }
                 }
             }
 
-            voice->IsHrtf = AL_TRUE;
+            targets->IsHrtf = AL_TRUE;
         }
         else
         {
@@ -653,19 +937,19 @@ ALvoid CalcNonAttnSourceParams(ALvoice *voice, const ALsource *ALSource, const A
                 if(chans[c].channel == LFE)
                 {
                     for(j = 0;j < MAX_OUTPUT_CHANNELS;j++)
-                        voice->Direct.Gains[c].Target[j] = 0.0f;
+                        targets->Direct.Gains[c].Target[j] = 0.0f;
                     if(Device->Dry.Buffer == Device->RealOut.Buffer)
                     {
                         int idx;
                         if((idx=GetChannelIdxByName(Device->RealOut, chans[c].channel)) != -1)
-                            voice->Direct.Gains[c].Target[idx] = DryGain;
+                            targets->Direct.Gains[c].Target[idx] = DryGain;
                     }
 
                     for(i = 0;i < NumSends;i++)
                     {
                         ALuint j;
                         for(j = 0;j < MAX_EFFECT_CHANNELS;j++)
-                            voice->Send[i].Gains[c].Target[j] = 0.0f;
+                            targets->Send[i].Gains[c].Target[j] = 0.0f;
                     }
                     continue;
                 }
@@ -675,10 +959,10 @@ ALvoid CalcNonAttnSourceParams(ALvoice *voice, const ALsource *ALSource, const A
                     /* Clamp X so it remains within 30 degrees of 0 or 180 degree azimuth. */
                     ALfloat x = sinf(chans[c].angle) * cosf(chans[c].elevation);
                     coeffs[0] = clampf(-x, -0.5f, 0.5f) + 0.5f;
-                    voice->Direct.Gains[c].Target[0] = coeffs[0] * DryGain;
-                    voice->Direct.Gains[c].Target[1] = (1.0f-coeffs[0]) * DryGain;
+                    targets->Direct.Gains[c].Target[0] = coeffs[0] * DryGain;
+                    targets->Direct.Gains[c].Target[1] = (1.0f-coeffs[0]) * DryGain;
                     for(j = 2;j < MAX_OUTPUT_CHANNELS;j++)
-                        voice->Direct.Gains[c].Target[j] = 0.0f;
+                        targets->Direct.Gains[c].Target[j] = 0.0f;
 
                     CalcAngleCoeffs(chans[c].angle, chans[c].elevation, 0.0f, coeffs);
                 }
@@ -686,7 +970,7 @@ ALvoid CalcNonAttnSourceParams(ALvoice *voice, const ALsource *ALSource, const A
                 {
                     CalcAngleCoeffs(chans[c].angle, chans[c].elevation, 0.0f, coeffs);
                     ComputePanningGains(Device->Dry, coeffs, DryGain,
-                                        voice->Direct.Gains[c].Target);
+                                        targets->Direct.Gains[c].Target);
                 }
 
                 for(i = 0;i < NumSends;i++)
@@ -695,18 +979,18 @@ ALvoid CalcNonAttnSourceParams(ALvoice *voice, const ALsource *ALSource, const A
                     {
                         ALuint j;
                         for(j = 0;j < MAX_EFFECT_CHANNELS;j++)
-                            voice->Send[i].Gains[c].Target[j] = 0.0f;
+                            targets->Send[i].Gains[c].Target[j] = 0.0f;
                     }
                     else
                     {
                         const ALeffectslot *Slot = SendSlots[i];
                         ComputePanningGainsBF(Slot->ChanMap, Slot->NumChannels, coeffs,
-                                              WetGain[i], voice->Send[i].Gains[c].Target);
+                                              WetGain[i], targets->Send[i].Gains[c].Target);
                     }
                 }
             }
 
-            voice->IsHrtf = AL_FALSE;
+            targets->IsHrtf = AL_FALSE;
         }
     }
 
@@ -717,15 +1001,15 @@ ALvoid CalcNonAttnSourceParams(ALvoice *voice, const ALsource *ALSource, const A
         DryGainLF = maxf(DryGainLF, 0.0001f);
         for(c = 0;c < num_channels;c++)
         {
-            voice->Direct.Filters[c].ActiveType = AF_None;
-            if(DryGainHF != 1.0f) voice->Direct.Filters[c].ActiveType |= AF_LowPass;
-            if(DryGainLF != 1.0f) voice->Direct.Filters[c].ActiveType |= AF_HighPass;
+            targets->Direct.Filters[c].ActiveType = AF_None;
+            if(DryGainHF != 1.0f) targets->Direct.Filters[c].ActiveType |= AF_LowPass;
+            if(DryGainLF != 1.0f) targets->Direct.Filters[c].ActiveType |= AF_HighPass;
             ALfilterState_setParams(
-                &voice->Direct.Filters[c].LowPass, ALfilterType_HighShelf,
+                &targets->Direct.Filters[c].LowPass, ALfilterType_HighShelf,
                 DryGainHF, hfscale, calc_rcpQ_from_slope(DryGainHF, 0.75f)
             );
             ALfilterState_setParams(
-                &voice->Direct.Filters[c].HighPass, ALfilterType_LowShelf,
+                &targets->Direct.Filters[c].HighPass, ALfilterType_LowShelf,
                 DryGainLF, lfscale, calc_rcpQ_from_slope(DryGainLF, 0.75f)
             );
         }
@@ -738,39 +1022,50 @@ ALvoid CalcNonAttnSourceParams(ALvoice *voice, const ALsource *ALSource, const A
         WetGainLF[i] = maxf(WetGainLF[i], 0.0001f);
         for(c = 0;c < num_channels;c++)
         {
-            voice->Send[i].Filters[c].ActiveType = AF_None;
-            if(WetGainHF[i] != 1.0f) voice->Send[i].Filters[c].ActiveType |= AF_LowPass;
-            if(WetGainLF[i] != 1.0f) voice->Send[i].Filters[c].ActiveType |= AF_HighPass;
+            targets->Send[i].Filters[c].ActiveType = AF_None;
+            if(WetGainHF[i] != 1.0f) targets->Send[i].Filters[c].ActiveType |= AF_LowPass;
+            if(WetGainLF[i] != 1.0f) targets->Send[i].Filters[c].ActiveType |= AF_HighPass;
             ALfilterState_setParams(
-                &voice->Send[i].Filters[c].LowPass, ALfilterType_HighShelf,
+                &targets->Send[i].Filters[c].LowPass, ALfilterType_HighShelf,
                 WetGainHF[i], hfscale, calc_rcpQ_from_slope(WetGainHF[i], 0.75f)
             );
             ALfilterState_setParams(
-                &voice->Send[i].Filters[c].HighPass, ALfilterType_LowShelf,
+                &targets->Send[i].Filters[c].HighPass, ALfilterType_LowShelf,
                 WetGainLF[i], lfscale, calc_rcpQ_from_slope(WetGainLF[i], 0.75f)
             );
         }
     }
+
+    PublishVoiceTargets(voice);
 }
 
-ALvoid CalcSourceParams(ALvoice *voice, const ALsource *ALSource, const ALCcontext *ALContext)
+/* Gets the effect slot a source's send feeds, if any. */
+static inline ALeffectslot *GetSendSlot(const ALsource *source, const ALCdevice *device, ALsizei send)
+{
+    ALeffectslot *slot = source->Send[send].Slot;
+    if(!slot && send == 0)
+        slot = device->DefaultSlot;
+    if(!slot || slot->EffectType == AL_EFFECT_NULL)
+        return NULL;
+    return slot;
+}
+
+/* Calculates the source parameters that depend on its position relative to
+ * the listener, from the outputs of the source's lane in a geometry batch.
+ */
+static void CalcAttnSourceParams(ALvoice *voice, const ALsource *ALSource, const ALCcontext *ALContext,
+                                 const SourceGeometry *geom, ALsizei idx)
 {
     const ALCdevice *Device = ALContext->Device;
-    aluVector Position, Velocity, Direction, SourceToListener;
-    ALfloat InnerAngle,OuterAngle,Angle,Distance,ClampedDist;
-    ALfloat MinVolume,MaxVolume,MinDist,MaxDist,Rolloff;
+    ALvoiceTargets *targets = &voice->TargetStore[voice->NextTargets];
+    const ALfloat ToListener[3] = {
+        geom->ToListenerX[idx], geom->ToListenerY[idx], geom->ToListenerZ[idx]
+    };
+    const ALfloat Distance = geom->Distance[idx];
+    ALfloat MinVolume,MaxVolume;
     ALfloat ConeVolume,ConeHF,SourceVolume,ListenerGain;
-    ALfloat DopplerFactor, SpeedOfSound;
-    ALfloat AirAbsorptionFactor;
-    ALfloat RoomAirAbsorption[MAX_SENDS];
-    ALbufferlistitem *BufferListItem;
     ALeffectslot *SendSlots[MAX_SENDS];
     ALfloat Attenuation;
-    ALfloat RoomAttenuation[MAX_SENDS];
-    ALfloat MetersPerUnit;
-    ALfloat RoomRolloffBase;
-    ALfloat RoomRolloff[MAX_SENDS];
-    ALfloat DecayDistance[MAX_SENDS];
     ALfloat DryGain;
     ALfloat DryGainHF;
     ALfloat DryGainLF;
@@ -780,207 +1075,60 @@ ALvoid CalcSourceParams(ALvoice *voice, const ALsource *ALSource, const ALCconte
     ALfloat WetGainLF[MAX_SENDS];
     ALboolean WetGainAuto;
     ALboolean WetGainHFAuto;
+    const BsincTable *bsinc;
     ALfloat Pitch;
     ALuint Frequency;
     ALint NumSends;
     ALint i;
 
-    DryGainHF = 1.0f;
-    DryGainLF = 1.0f;
-    for(i = 0;i < MAX_SENDS;i++)
-    {
-        WetGainHF[i] = 1.0f;
-        WetGainLF[i] = 1.0f;
-    }
-
     /* Get context/device properties */
-    DopplerFactor = ALContext->DopplerFactor * ALSource->DopplerFactor;
-    SpeedOfSound  = ALContext->SpeedOfSound * ALContext->DopplerVelocity;
     NumSends      = Device->NumAuxSends;
     Frequency     = Device->Frequency;
 
     /* Get listener properties */
     ListenerGain  = ALContext->Listener->Gain;
-    MetersPerUnit = ALContext->Listener->MetersPerUnit;
 
     /* Get source properties */
     SourceVolume   = ALSource->Gain;
     MinVolume      = ALSource->MinGain;
     MaxVolume      = ALSource->MaxGain;
     Pitch          = ALSource->Pitch;
-    Position       = ALSource->Position;
-    Direction      = ALSource->Direction;
-    Velocity       = ALSource->Velocity;
-    MinDist        = ALSource->RefDistance;
-    MaxDist        = ALSource->MaxDistance;
-    Rolloff        = ALSource->RollOffFactor;
-    InnerAngle     = ALSource->InnerAngle;
-    OuterAngle     = ALSource->OuterAngle;
-    AirAbsorptionFactor = ALSource->AirAbsorptionFactor;
     DryGainHFAuto   = ALSource->DryGainHFAuto;
     WetGainAuto     = ALSource->WetGainAuto;
     WetGainHFAuto   = ALSource->WetGainHFAuto;
-    RoomRolloffBase = ALSource->RoomRolloffFactor;
 
-    voice->Direct.OutBuffer = Device->Dry.Buffer;
-    voice->Direct.OutChannels = Device->Dry.NumChannels;
+    targets->NumChannels = 1;
+    targets->Direct.OutBuffer = Device->Dry.Buffer;
+    targets->Direct.OutChannels = Device->Dry.NumChannels;
     for(i = 0;i < NumSends;i++)
     {
-        SendSlots[i] = ALSource->Send[i].Slot;
-
-        if(!SendSlots[i] && i == 0)
-            SendSlots[i] = Device->DefaultSlot;
-        if(!SendSlots[i] || SendSlots[i]->EffectType == AL_EFFECT_NULL)
-        {
-            SendSlots[i] = NULL;
-            RoomRolloff[i] = 0.0f;
-            DecayDistance[i] = 0.0f;
-            RoomAirAbsorption[i] = 1.0f;
-        }
-        else if(SendSlots[i]->AuxSendAuto)
-        {
-            RoomRolloff[i] = RoomRolloffBase;
-            if(IsReverbEffect(SendSlots[i]->EffectType))
-            {
-                RoomRolloff[i] += SendSlots[i]->EffectProps.Reverb.RoomRolloffFactor;
-                DecayDistance[i] = SendSlots[i]->EffectProps.Reverb.DecayTime *
-                                   SPEEDOFSOUNDMETRESPERSEC;
-                RoomAirAbsorption[i] = SendSlots[i]->EffectProps.Reverb.AirAbsorptionGainHF;
-            }
-            else
-            {
-                DecayDistance[i] = 0.0f;
-                RoomAirAbsorption[i] = 1.0f;
-            }
-        }
-        else
-        {
-            /* If the slot's auxiliary send auto is off, the data sent to the
-             * effect slot is the same as the dry path, sans filter effects */
-            RoomRolloff[i] = Rolloff;
-            DecayDistance[i] = 0.0f;
-            RoomAirAbsorption[i] = AIRABSORBGAINHF;
-        }
-
+        SendSlots[i] = GetSendSlot(ALSource, Device, i);
         if(!SendSlots[i])
         {
-            voice->Send[i].OutBuffer = NULL;
-            voice->Send[i].OutChannels = 0;
+            targets->Send[i].OutBuffer = NULL;
+            targets->Send[i].OutChannels = 0;
         }
         else
         {
-            voice->Send[i].OutBuffer = SendSlots[i]->WetBuffer;
-            voice->Send[i].OutChannels = SendSlots[i]->NumChannels;
+            targets->Send[i].OutBuffer = SendSlots[i]->WetBuffer;
+            targets->Send[i].OutChannels = SendSlots[i]->NumChannels;
         }
     }
 
-    /* Transform source to listener space (convert to head relative) */
-    if(ALSource->HeadRelative == AL_FALSE)
-    {
-        const aluMatrixd *Matrix = &ALContext->Listener->Params.Matrix;
-        /* Transform source vectors */
-        Position = aluMatrixdVector(Matrix, &Position);
-        Velocity = aluMatrixdVector(Matrix, &Velocity);
-        Direction = aluMatrixdVector(Matrix, &Direction);
-    }
-    else
-    {
-        const aluVector *lvelocity = &ALContext->Listener->Params.Velocity;
-        /* Offset the source velocity to be relative of the listener velocity */
-        Velocity.v[0] += lvelocity->v[0];
-        Velocity.v[1] += lvelocity->v[1];
-        Velocity.v[2] += lvelocity->v[2];
-    }
-
-    aluNormalize(Direction.v);
-    SourceToListener.v[0] = -Position.v[0];
-    SourceToListener.v[1] = -Position.v[1];
-    SourceToListener.v[2] = -Position.v[2];
-    SourceToListener.v[3] = 0.0f;
-    Distance = aluNormalize(SourceToListener.v);
-
-    /* Calculate distance attenuation */
-    ClampedDist = Distance;
-
-    Attenuation = 1.0f;
-    for(i = 0;i < NumSends;i++)
-        RoomAttenuation[i] = 1.0f;
-    switch(ALContext->SourceDistanceModel ? ALSource->DistanceModel :
-                                            ALContext->DistanceModel)
-    {
-        case InverseDistanceClamped:
-            ClampedDist = clampf(ClampedDist, MinDist, MaxDist);
-            if(MaxDist < MinDist)
-                break;
-            /*fall-through*/
-        case InverseDistance:
-            if(MinDist > 0.0f)
-            {
-                ALfloat dist = lerp(MinDist, ClampedDist, Rolloff);
-                if(dist > 0.0f) Attenuation = MinDist / dist;
-                for(i = 0;i < NumSends;i++)
-                {
-                    dist = lerp(MinDist, ClampedDist, RoomRolloff[i]);
-                    if(dist > 0.0f) RoomAttenuation[i] = MinDist / dist;
-                }
-            }
-            break;
-
-        case LinearDistanceClamped:
-            ClampedDist = clampf(ClampedDist, MinDist, MaxDist);
-            if(MaxDist < MinDist)
-                break;
-            /*fall-through*/
-        case LinearDistance:
-            if(MaxDist != MinDist)
-            {
-                Attenuation = 1.0f - (Rolloff*(ClampedDist-MinDist)/(MaxDist - MinDist));
-                Attenuation = maxf(Attenuation, 0.0f);
-                for(i = 0;i < NumSends;i++)
-                {
-                    RoomAttenuation[i] = 1.0f - (RoomRolloff[i]*(ClampedDist-MinDist)/(MaxDist - MinDist));
-                    RoomAttenuation[i] = maxf(RoomAttenuation[i], 0.0f);
-                }
-            }
-            break;
-
-        case ExponentDistanceClamped:
-            ClampedDist = clampf(ClampedDist, MinDist, MaxDist);
-            if(MaxDist < MinDist)
-                break;
-            /*fall-through*/
-        case ExponentDistance:
-            if(ClampedDist > 0.0f && MinDist > 0.0f)
-            {
-                Attenuation = powf(ClampedDist/MinDist, -Rolloff);
-                for(i = 0;i < NumSends;i++)
-                    RoomAttenuation[i] = powf(ClampedDist/MinDist, -RoomRolloff[i]);
-            }
-            break;
-
-        case DisableDistance:
-            ClampedDist = MinDist;
-            break;
-    }
-
-    /* Source Gain + Attenuation */
+    /* Source Gain + Attenuation, and distance-based air absorption */
+    Attenuation = geom->Attenuation[idx];
     DryGain = SourceVolume * Attenuation;
+    DryGainHF = geom->AirAbsorptionHF[idx];
+    DryGainLF = 1.0f;
     for(i = 0;i < NumSends;i++)
-        WetGain[i] = SourceVolume * RoomAttenuation[i];
-
-    /* Distance-based air absorption */
-    if(AirAbsorptionFactor > 0.0f && ClampedDist > MinDist)
     {
-        ALfloat meters = (ClampedDist-MinDist) * MetersPerUnit;
-        DryGainHF *= powf(AIRABSORBGAINHF, AirAbsorptionFactor*meters);
-        for(i = 0;i < NumSends;i++)
-            WetGainHF[i] *= powf(RoomAirAbsorption[i], AirAbsorptionFactor*meters);
+        WetGain[i] = SourceVolume * geom->RoomAttenuation[i][idx];
+        WetGainHF[i] = geom->RoomAirAbsorptionHF[i][idx];
+        WetGainLF[i] = 1.0f;
     }
 
     if(WetGainAuto)
     {
-        ALfloat ApparentDist = 1.0f/maxf(Attenuation, 0.00001f) - 1.0f;
-
         /* Apply a decay-time transformation to the wet path, based on the
          * attenuation of the dry path.
          *
@@ -989,30 +1137,12 @@ ALvoid CalcSourceParams(ALvoice *voice, const ALsource *ALSource, const ALCconte
          * wet path.
          */
         for(i = 0;i < NumSends;i++)
-        {
-            if(DecayDistance[i] > 0.0f)
-                WetGain[i] *= powf(0.001f/*-60dB*/, ApparentDist/DecayDistance[i]);
-        }
+            WetGain[i] *= geom->WetDecay[i][idx];
     }
 
-    /* Calculate directional soundcones */
-    Angle = RAD2DEG(acosf(aluDotproduct(&Direction, &SourceToListener)) * ConeScale) * 2.0f;
-    if(Angle > InnerAngle && Angle <= OuterAngle)
-    {
-        ALfloat scale = (Angle-InnerAngle) / (OuterAngle-InnerAngle);
-        ConeVolume = lerp(1.0f, ALSource->OuterGain, scale);
-        ConeHF = lerp(1.0f, ALSource->OuterGainHF, scale);
-    }
-    else if(Angle > OuterAngle)
-    {
-        ConeVolume = ALSource->OuterGain;
-        ConeHF = ALSource->OuterGainHF;
-    }
-    else
-    {
-        ConeVolume = 1.0f;
-        ConeHF = 1.0f;
-    }
+    /* Apply directional soundcones */
+    ConeVolume = geom->ConeGain[idx];
+    ConeHF = geom->ConeGainHF[idx];
 
     DryGain *= ConeVolume;
     if(WetGainAuto)
@@ -1044,43 +1174,29 @@ ALvoid CalcSourceParams(ALvoice *voice, const ALsource *ALSource, const ALCconte
         WetGainLF[i] *= ALSource->Send[i].GainLF;
     }
 
-    /* Calculate velocity-based doppler effect */
-    if(DopplerFactor > 0.0f)
-    {
-        const aluVector *lvelocity = &ALContext->Listener->Params.Velocity;
-        ALfloat VSS, VLS;
-
-        if(SpeedOfSound < 1.0f)
-        {
-            DopplerFactor *= 1.0f/SpeedOfSound;
-            SpeedOfSound   = 1.0f;
-        }
-
-        VSS = aluDotproduct(&Velocity, &SourceToListener) * DopplerFactor;
-        VLS = aluDotproduct(lvelocity, &SourceToListener) * DopplerFactor;
+    /* Apply velocity-based doppler effect */
+    Pitch *= geom->DopplerShift[idx];
 
-        Pitch *= clampf(SpeedOfSound-VLS, 1.0f, SpeedOfSound*2.0f - 1.0f) /
-                 clampf(SpeedOfSound-VSS, 1.0f, SpeedOfSound*2.0f - 1.0f);
-    }
-
-    BufferListItem = ATOMIC_LOAD(&ALSource->queue);
-    while(BufferListItem != NULL)
+    targets->Step = 0;
+    targets->Polyphase = NULL;
+    if(ALSource->Frequency > 0)
     {
-        ALbuffer *ALBuffer;
-        if((ALBuffer=BufferListItem->buffer) != NULL)
-        {
-            /* Calculate fixed-point stepping value, based on the pitch, buffer
-             * frequency, and output frequency. */
-            Pitch = Pitch * ALBuffer->Frequency / Frequency;
-            if(Pitch > (ALfloat)MAX_PITCH)
-                voice->Step = MAX_PITCH<<FRACTIONBITS;
-            else
-                voice->Step = maxi(fastf2i(Pitch*FRACTIONONE + 0.5f), 1);
-            BsincPrepare(voice->Step, &voice->SincState);
-
-            break;
-        }
-        BufferListItem = BufferListItem->next;
+        /* A source playing at its own rate, with no Doppler shift, can use a
+         * fixed-ratio resampler. */
+        targets->Resampler = SelectSourceResampler(voice, ALSource, Attenuation);
+        if(Pitch == 1.0f)
+            targets->Polyphase = FindPolyphaseBank(ALContext->Device, targets->Resampler,
+                                                   ALSource->Frequency);
+
+        /* Calculate fixed-point stepping value, based on the pitch, buffer
+         * frequency, and output frequency. */
+        Pitch = Pitch * ALSource->Frequency / Frequency;
+        if(Pitch > (ALfloat)MAX_PITCH)
+            targets->Step = MAX_PITCH<<FRACTIONBITS;
+        else
+            targets->Step = maxi(fastf2i(Pitch*FRACTIONONE + 0.5f), 1);
+        if(!targets->Polyphase && (bsinc=GetBsincTable(targets->Resampler)) != NULL)
+            BsincPrepare(targets->Step, &targets->SincState, bsinc);
     }
 
     if(Device->Render_Mode == HrtfRender)
@@ -1089,26 +1205,19 @@ ALvoid CalcSourceParams(ALvoice *voice, const ALsource *ALSource, const ALCconte
          * real outputs.
          */
         ALfloat dir[3] = { 0.0f, 0.0f, -1.0f };
-        ALfloat ev = 0.0f, az = 0.0f;
+        ALfloat ev = geom->Elevation[idx], az = geom->Azimuth[idx];
         ALfloat radius = ALSource->Radius;
         ALfloat coeffs[MAX_AMBI_COEFFS];
         ALfloat spread = 0.0f;
 
-        voice->Direct.OutBuffer = Device->RealOut.Buffer;
-        voice->Direct.OutChannels = Device->RealOut.NumChannels;
+        targets->Direct.OutBuffer = Device->RealOut.Buffer;
+        targets->Direct.OutChannels = Device->RealOut.NumChannels;
 
         if(Distance > FLT_EPSILON)
         {
-            dir[0] = -SourceToListener.v[0];
-            dir[1] = -SourceToListener.v[1];
-            dir[2] = -SourceToListener.v[2] * ZScale;
-
-            /* Calculate elevation and azimuth only when the source is not at
-             * the listener. This prevents +0 and -0 Z from producing
-             * inconsistent panning. Also, clamp Y in case FP precision errors
-             * cause it to land outside of -1..+1. */
-            ev = asinf(clampf(dir[1], -1.0f, 1.0f));
-            az = atan2f(dir[0], -dir[2]);
+            dir[0] = -ToListener[0];
+            dir[1] = -ToListener[1];
+            dir[2] = -ToListener[2] * ZScale;
         }
         if(radius > Distance)
             spread = F_TAU - Distance/radius*F_PI;
@@ -1117,8 +1226,8 @@ ALvoid CalcSourceParams(ALvoice *voice, const ALsource *ALSource, const ALCconte
 
         /* Get the HRIR coefficients and delays. */
         GetLerpedHrtfCoeffs(Device->Hrtf, ev, az, spread, DryGain,
-                            voice->Direct.Hrtf[0].Target.Coeffs,
-                            voice->Direct.Hrtf[0].Target.Delay);
+                            targets->Direct.Hrtf[0].Target.Coeffs,
+                            targets->Direct.Hrtf[0].Target.Delay);
 
         CalcDirectionCoeffs(dir, spread, coeffs);
 
@@ -1128,17 +1237,17 @@ ALvoid CalcSourceParams(ALvoice *voice, const ALsource *ALSource, const ALCconte
             {
                 ALuint j;
                 for(j = 0;j < MAX_EFFECT_CHANNELS;j++)
-                    voice->Send[i].Gains[0].Target[j] = 0.0f;
+                    targets->Send[i].Gains[0].Target[j] = 0.0f;
             }
             else
             {
                 const ALeffectslot *Slot = SendSlots[i];
                 ComputePanningGainsBF(Slot->ChanMap, Slot->NumChannels, coeffs,
-                                      WetGain[i], voice->Send[i].Gains[0].Target);
+                                      WetGain[i], targets->Send[i].Gains[0].Target);
             }
         }
 
-        voice->IsHrtf = AL_TRUE;
+        targets->IsHrtf = AL_TRUE;
     }
     else
     {
@@ -1151,9 +1260,9 @@ ALvoid CalcSourceParams(ALvoice *voice, const ALsource *ALSource, const ALCconte
         /* Get the localized direction, and compute panned gains. */
         if(Distance > FLT_EPSILON)
         {
-            dir[0] = -SourceToListener.v[0];
-            dir[1] = -SourceToListener.v[1];
-            dir[2] = -SourceToListener.v[2] * ZScale;
+            dir[0] = -ToListener[0];
+            dir[1] = -ToListener[1];
+            dir[2] = -ToListener[2] * ZScale;
         }
         if(radius > Distance)
             spread = F_TAU - Distance/radius*F_PI;
@@ -1165,17 +1274,17 @@ ALvoid CalcSourceParams(ALvoice *voice, const ALsource *ALSource, const ALCconte
             /* Clamp X so it remains within 30 degrees of 0 or 180 degree azimuth. */
             ALfloat x = -dir[0] * (0.5f * (cosf(spread*0.5f) + 1.0f));
             x = clampf(x, -0.5f, 0.5f) + 0.5f;
-            voice->Direct.Gains[0].Target[0] = x * DryGain;
-            voice->Direct.Gains[0].Target[1] = (1.0f-x) * DryGain;
+            targets->Direct.Gains[0].Target[0] = x * DryGain;
+            targets->Direct.Gains[0].Target[1] = (1.0f-x) * DryGain;
             for(i = 2;i < MAX_OUTPUT_CHANNELS;i++)
-                voice->Direct.Gains[0].Target[i] = 0.0f;
+                targets->Direct.Gains[0].Target[i] = 0.0f;
 
             CalcDirectionCoeffs(dir, spread, coeffs);
         }
         else
         {
             CalcDirectionCoeffs(dir, spread, coeffs);
-            ComputePanningGains(Device->Dry, coeffs, DryGain, voice->Direct.Gains[0].Target);
+            ComputePanningGains(Device->Dry, coeffs, DryGain, targets->Direct.Gains[0].Target);
         }
 
         for(i = 0;i < NumSends;i++)
@@ -1184,17 +1293,17 @@ ALvoid CalcSourceParams(ALvoice *voice, const ALsource *ALSource, const ALCconte
             {
                 ALuint j;
                 for(j = 0;j < MAX_EFFECT_CHANNELS;j++)
-                    voice->Send[i].Gains[0].Target[j] = 0.0f;
+                    targets->Send[i].Gains[0].Target[j] = 0.0f;
             }
             else
             {
                 const ALeffectslot *Slot = SendSlots[i];
                 ComputePanningGainsBF(Slot->ChanMap, Slot->NumChannels, coeffs,
-                                      WetGain[i], voice->Send[i].Gains[0].Target);
+                                      WetGain[i], targets->Send[i].Gains[0].Target);
             }
         }
 
-        voice->IsHrtf = AL_FALSE;
+        targets->IsHrtf = AL_FALSE;
     }
 
     {
@@ -1202,15 +1311,15 @@ ALvoid CalcSourceParams(ALvoice *voice, const ALsource *ALSource, const ALCconte
         ALfloat lfscale = ALSource->Direct.LFReference / Frequency;
         DryGainHF = maxf(DryGainHF, 0.0001f);
         DryGainLF = maxf(DryGainLF, 0.0001f);
-        voice->Direct.Filters[0].ActiveType = AF_None;
-        if(DryGainHF != 1.0f) voice->Direct.Filters[0].ActiveType |= AF_LowPass;
-        if(DryGainLF != 1.0f) voice->Direct.Filters[0].ActiveType |= AF_HighPass;
+        targets->Direct.Filters[0].ActiveType = AF_None;
+        if(DryGainHF != 1.0f) targets->Direct.Filters[0].ActiveType |= AF_LowPass;
+        if(DryGainLF != 1.0f) targets->Direct.Filters[0].ActiveType |= AF_HighPass;
         ALfilterState_setParams(
-            &voice->Direct.Filters[0].LowPass, ALfilterType_HighShelf,
+            &targets->Direct.Filters[0].LowPass, ALfilterType_HighShelf,
             DryGainHF, hfscale, calc_rcpQ_from_slope(DryGainHF, 0.75f)
         );
         ALfilterState_setParams(
-            &voice->Direct.Filters[0].HighPass, ALfilterType_LowShelf,
+            &targets->Direct.Filters[0].HighPass, ALfilterType_LowShelf,
             DryGainLF, lfscale, calc_rcpQ_from_slope(DryGainLF, 0.75f)
         );
     }
@@ -1220,29 +1329,208 @@ ALvoid CalcSourceParams(ALvoice *voice, const ALsource *ALSource, const ALCconte
         ALfloat lfscale = ALSource->Send[i].LFReference / Frequency;
         WetGainHF[i] = maxf(WetGainHF[i], 0.0001f);
         WetGainLF[i] = maxf(WetGainLF[i], 0.0001f);
-        voice->Send[i].Filters[0].ActiveType = AF_None;
-        if(WetGainHF[i] != 1.0f) voice->Send[i].Filters[0].ActiveType |= AF_LowPass;
-        if(WetGainLF[i] != 1.0f) voice->Send[i].Filters[0].ActiveType |= AF_HighPass;
+        targets->Send[i].Filters[0].ActiveType = AF_None;
+        if(WetGainHF[i] != 1.0f) targets->Send[i].Filters[0].ActiveType |= AF_LowPass;
+        if(WetGainLF[i] != 1.0f) targets->Send[i].Filters[0].ActiveType |= AF_HighPass;
         ALfilterState_setParams(
-            &voice->Send[i].Filters[0].LowPass, ALfilterType_HighShelf,
+            &targets->Send[i].Filters[0].LowPass, ALfilterType_HighShelf,
             WetGainHF[i], hfscale, calc_rcpQ_from_slope(WetGainHF[i], 0.75f)
         );
         ALfilterState_setParams(
-            &voice->Send[i].Filters[0].HighPass, ALfilterType_LowShelf,
+            &targets->Send[i].Filters[0].HighPass, ALfilterType_LowShelf,
             WetGainLF[i], lfscale, calc_rcpQ_from_slope(WetGainLF[i], 0.75f)
         );
     }
+
+    PublishVoiceTargets(voice);
+}
+
+
+/* Voices using CalcSourceParams are collected into batches, one for world-
+ * space sources and one for head-relative sources, so their positions,
+ * velocities, directions, and distance properties can be processed together.
+ */
+typedef struct GeometryBatch {
+    SourceGeometry Geom;
+    /* The listener position, subtracted from the source positions in double
+     * precision before they're narrowed for the batch. */
+    ALdouble Origin[3];
+    ALvoice *Voices[SOURCE_GEOMETRY_BATCH];
+    const ALsource *Sources[SOURCE_GEOMETRY_BATCH];
+    ALsizei Count;
+} GeometryBatch;
+
+static void InitGeometryBatch(GeometryBatch *batch, const ALCcontext *ctx, ALboolean relative)
+{
+    const ALlistener *Listener = ctx->Listener;
+    const aluMatrixd *Matrix = &Listener->Params.Matrix;
+    ALsizei i, j;
+
+    for(i = 0;i < 3;i++)
+    {
+        for(j = 0;j < 3;j++)
+            batch->Geom.Rotation[i][j] = relative ? ((i==j) ? 1.0f : 0.0f) :
+                                         (ALfloat)Matrix->m[i][j];
+        batch->Origin[i] = relative ? 0.0 : Listener->Params.Position[i];
+        batch->Geom.ListenerVel[i] = Listener->Params.Velocity.v[i];
+    }
+    batch->Geom.SpeedOfSound = ctx->SpeedOfSound * ctx->DopplerVelocity;
+    batch->Geom.NumSends = ctx->Device->NumAuxSends;
+    batch->Count = 0;
+}
+
+static void FlushGeometryBatch(GeometryBatch *batch, const ALCcontext *ctx)
+{
+    SourceGeometry *geom = &batch->Geom;
+    ALsizei i, s;
+
+    if(batch->Count == 0)
+        return;
+
+    /* Clear the unused inputs up to a multiple of 4. */
+    for(i = batch->Count;i < ((batch->Count+3)&~3);i++)
+    {
+        geom->PosX[i] = geom->PosY[i] = geom->PosZ[i] = 0.0f;
+        geom->VelX[i] = geom->VelY[i] = geom->VelZ[i] = 0.0f;
+        geom->DirX[i] = geom->DirY[i] = geom->DirZ[i] = 0.0f;
+        geom->DistanceModel[i] = DisableDistance;
+        geom->RefDistance[i] = geom->MaxDistance[i] = 1.0f;
+        geom->Rolloff[i] = geom->AirAbsorption[i] = 0.0f;
+        geom->InnerAngle[i] = geom->OuterAngle[i] = 360.0f;
+        geom->OuterGain[i] = geom->OuterGainHF[i] = 1.0f;
+        geom->DopplerFactor[i] = 0.0f;
+        for(s = 0;s < geom->NumSends;s++)
+        {
+            geom->RoomRolloff[s][i] = 0.0f;
+            geom->RoomAirAbsorption[s][i] = 1.0f;
+            geom->DecayDistance[s][i] = 0.0f;
+        }
+    }
+    SelectGeometryFunc()(geom, batch->Count);
+
+    for(i = 0;i < batch->Count;i++)
+        CalcAttnSourceParams(batch->Voices[i], batch->Sources[i], ctx, geom, i);
+    batch->Count = 0;
 }
 
+static void AddGeometry(GeometryBatch *batch, ALvoice *voice, const ALsource *source,
+                        const ALCcontext *ctx)
+{
+    const ALCdevice *device = ctx->Device;
+    SourceGeometry *geom = &batch->Geom;
+    ALsizei i = batch->Count++;
+    ALsizei s;
+
+    batch->Voices[i] = voice;
+    batch->Sources[i] = source;
+    geom->PosX[i] = (ALfloat)(source->Position.v[0] - batch->Origin[0]);
+    geom->PosY[i] = (ALfloat)(source->Position.v[1] - batch->Origin[1]);
+    geom->PosZ[i] = (ALfloat)(source->Position.v[2] - batch->Origin[2]);
+    geom->VelX[i] = source->Velocity.v[0];
+    geom->VelY[i] = source->Velocity.v[1];
+    geom->VelZ[i] = source->Velocity.v[2];
+    geom->DirX[i] = source->Direction.v[0];
+    geom->DirY[i] = source->Direction.v[1];
+    geom->DirZ[i] = source->Direction.v[2];
+    if(source->HeadRelative)
+    {
+        /* Offset the source velocity to be relative of the listener velocity */
+        geom->VelX[i] += geom->ListenerVel[0];
+        geom->VelY[i] += geom->ListenerVel[1];
+        geom->VelZ[i] += geom->ListenerVel[2];
+    }
+
+    geom->DistanceModel[i] = ctx->SourceDistanceModel ? source->DistanceModel :
+                                                        ctx->DistanceModel;
+    geom->RefDistance[i] = source->RefDistance;
+    geom->MaxDistance[i] = source->MaxDistance;
+    geom->Rolloff[i] = source->RollOffFactor;
+    geom->AirAbsorption[i] = source->AirAbsorptionFactor * ctx->Listener->MetersPerUnit;
+    geom->InnerAngle[i] = source->InnerAngle;
+    geom->OuterAngle[i] = source->OuterAngle;
+    geom->OuterGain[i] = source->OuterGain;
+    geom->OuterGainHF[i] = source->OuterGainHF;
+    geom->DopplerFactor[i] = ctx->DopplerFactor * source->DopplerFactor;
+
+    for(s = 0;s < geom->NumSends;s++)
+    {
+        const ALeffectslot *slot = GetSendSlot(source, device, s);
+        ALfloat rolloff = 0.0f;
+        ALfloat airabsorb = 1.0f;
+        ALfloat decaydist = 0.0f;
+
+        if(slot && slot->AuxSendAuto)
+        {
+            rolloff = source->RoomRolloffFactor;
+            if(IsReverbEffect(slot->EffectType))
+            {
+                rolloff += slot->EffectProps.Reverb.RoomRolloffFactor;
+                decaydist = slot->EffectProps.Reverb.DecayTime * SPEEDOFSOUNDMETRESPERSEC;
+                airabsorb = slot->EffectProps.Reverb.AirAbsorptionGainHF;
+            }
+        }
+        else if(slot)
+        {
+            /* If the slot's auxiliary send auto is off, the data sent to the
+             * effect slot is the same as the dry path, sans filter effects */
+            rolloff = source->RollOffFactor;
+            airabsorb = AIRABSORBGAINHF;
+        }
+        geom->RoomRolloff[s][i] = rolloff;
+        geom->RoomAirAbsorption[s][i] = airabsorb;
+        geom->DecayDistance[s][i] = decaydist;
+    }
+}
+
+ALvoid CalcSourceParams(ALvoice *voice, const ALsource *ALSource, const ALCcontext *ALContext)
+{
+    GeometryBatch batch;
+
+    InitGeometryBatch(&batch, ALContext, ALSource->HeadRelative);
+    AddGeometry(&batch, voice, ALSource, ALContext);
+    FlushGeometryBatch(&batch, ALContext);
+}
+
+static void UpdateVoice(GeometryBatch batches[2], ALvoice *voice, ALsource *source,
+                        ALCcontext *ctx)
+{
+    GeometryBatch *batch;
+
+    /* Record the properties this update used, for the setters to check any
+     * further changes against. */
+    source->Used.Position[0] = source->Position.v[0];
+    source->Used.Position[1] = source->Position.v[1];
+    source->Used.Position[2] = source->Position.v[2];
+    source->Used.Direction[0] = source->Direction.v[0];
+    source->Used.Direction[1] = source->Direction.v[1];
+    source->Used.Direction[2] = source->Direction.v[2];
+    source->Used.Gain = source->Gain;
+    source->Used.Pitch = source->Pitch;
+    IncrementRef(&ctx->UpdatesPerformed);
+
+    if(voice->Update != CalcSourceParams)
+    {
+        voice->Update(voice, source, ctx);
+        return;
+    }
+
+    batch = &batches[source->HeadRelative ? 1 : 0];
+    AddGeometry(batch, voice, source, ctx);
+    if(batch->Count == SOURCE_GEOMETRY_BATCH)
+        FlushGeometryBatch(batch, ctx);
+}
 
 void UpdateContextSources(ALCcontext *ctx)
 {
+    GeometryBatch batches[2];
     ALvoice *voice, *voice_end;
     ALsource *source;
 
     if(ATOMIC_EXCHANGE(ALenum, &ctx->UpdateSources, AL_FALSE))
     {
         CalcListenerParams(ctx->Listener);
+        InitGeometryBatch(&batches[0], ctx, AL_FALSE);
+        InitGeometryBatch(&batches[1], ctx, AL_TRUE);
 
         voice = ctx->Voices;
         voice_end = voice + ctx->VoiceCount;
@@ -1254,12 +1542,15 @@ void UpdateContextSources(ALCcontext *ctx)
             else
             {
                 ATOMIC_STORE(&source->NeedsUpdate, AL_FALSE);
-                voice->Update(voice, source, ctx);
+                UpdateVoice(batches, voice, source, ctx);
             }
         }
     }
     else
     {
+        InitGeometryBatch(&batches[0], ctx, AL_FALSE);
+        InitGeometryBatch(&batches[1], ctx, AL_TRUE);
+
         voice = ctx->Voices;
         voice_end = voice + ctx->VoiceCount;
         for(;voice != voice_end;++voice)
@@ -1268,9 +1559,169 @@ void UpdateContextSources(ALCcontext *ctx)
             if(source->state != AL_PLAYING && source->state != AL_PAUSED)
                 voice->Source = NULL;
             else if(ATOMIC_EXCHANGE(ALenum, &source->NeedsUpdate, AL_FALSE))
-                voice->Update(voice, source, ctx);
+                UpdateVoice(batches, voice, source, ctx);
         }
     }
+
+    FlushGeometryBatch(&batches[0], ctx);
+    FlushGeometryBatch(&batches[1], ctx);
+}
+
+
+/* Calculates the initial targets for a voice that just started, which has no
+ * targets to fade from and so can't wait for the next update.
+ */
+ALvoid aluStartVoice(ALCcontext *ctx, ALvoice *voice)
+{
+    GeometryBatch batches[2];
+    ALsource *source;
+    FPUCtl oldMode;
+
+    if(!(source=voice->Source) || !ATOMIC_EXCHANGE(ALenum, &source->NeedsUpdate, AL_FALSE))
+        return;
+
+    aluPreparePolyphaseBanks(ctx->Device, source);
+
+    SetMixerFPUMode(&oldMode);
+    /* The next update will still update every source for the changed
+     * listener, so leave the flag set. */
+    if(ATOMIC_LOAD(&ctx->UpdateSources))
+        CalcListenerParams(ctx->Listener);
+    InitGeometryBatch(&batches[0], ctx, AL_FALSE);
+    InitGeometryBatch(&batches[1], ctx, AL_TRUE);
+
+    UpdateVoice(batches, voice, source, ctx);
+
+    FlushGeometryBatch(&batches[0], ctx);
+    FlushGeometryBatch(&batches[1], ctx);
+    RestoreFPUMode(&oldMode);
+}
+
+
+/* Recalculates the effect state for slots with changed properties. */
+static void UpdateContextSlots(ALCcontext *ctx, ALCdevice *device)
+{
+#define UPDATE_SLOT(iter) do {                                         \
+    if(ATOMIC_EXCHANGE(ALenum, &(*iter)->NeedsUpdate, AL_FALSE))       \
+        V((*iter)->EffectState,update)(device, *iter);                 \
+} while(0)
+    VECTOR_FOR_EACH(ALeffectslot*, ctx->ActiveAuxSlots, UPDATE_SLOT);
+#undef UPDATE_SLOT
+}
+
+/* Recalculates a slot's effect state from the update thread. The reverb
+ * stages its new parameters for the mixer to pick up, so it can update while
+ * the mixer runs. Other effects write the parameters their process method
+ * reads, so they update with the mixer held off by the backend lock.
+ */
+static void UpdateSlotAsync(ALeffectslot *slot, ALCdevice *device)
+{
+    if(!ATOMIC_EXCHANGE(ALenum, &slot->NeedsUpdate, AL_FALSE))
+        return;
+    if(IsReverbEffect(slot->EffectType))
+        V(slot->EffectState,update)(device, slot);
+    else
+    {
+        V0(device->Backend,lock)();
+        V(slot->EffectState,update)(device, slot);
+        V0(device->Backend,unlock)();
+    }
+}
+
+static int UpdateThreadProc(void *arg)
+{
+    ALCdevice *device = arg;
+    ALuint done = ReadRef(&device->UpdateRequests);
+    ALCcontext *ctx;
+    FPUCtl oldMode;
+
+    althrd_setname(althrd_current(), UPDATE_THREAD_NAME);
+
+    almtx_lock(&device->UpdateLock);
+    while(!ATOMIC_LOAD(&device->UpdateThreadKill))
+    {
+        ALuint requests = ReadRef(&device->UpdateRequests);
+        if(requests == done)
+        {
+            alcnd_wait(&device->UpdateCond, &device->UpdateLock);
+            continue;
+        }
+        done = requests;
+        almtx_unlock(&device->UpdateLock);
+
+        SetMixerFPUMode(&oldMode);
+        almtx_lock(&device->UpdateCalcLock);
+        ctx = ATOMIC_LOAD(&device->ContextList);
+        while(ctx)
+        {
+            if(!ctx->DeferUpdates)
+            {
+#define UPDATE_SLOT(iter) UpdateSlotAsync(*iter, device)
+                UpdateContextSources(ctx);
+                VECTOR_FOR_EACH(ALeffectslot*, ctx->ActiveAuxSlots, UPDATE_SLOT);
+#undef UPDATE_SLOT
+            }
+            ctx = ctx->next;
+        }
+        if(device->DefaultSlot != NULL)
+            UpdateSlotAsync(device->DefaultSlot, device);
+        almtx_unlock(&device->UpdateCalcLock);
+        RestoreFPUMode(&oldMode);
+
+        almtx_lock(&device->UpdateLock);
+    }
+    almtx_unlock(&device->UpdateLock);
+
+    return 0;
+}
+
+void aluStartUpdateThread(ALCdevice *device)
+{
+    device->UpdateThreadActive = AL_FALSE;
+    if(almtx_init(&device->UpdateLock, almtx_plain) != althrd_success)
+        return;
+    if(alcnd_init(&device->UpdateCond) != althrd_success)
+    {
+        almtx_destroy(&device->UpdateLock);
+        return;
+    }
+    if(almtx_init(&device->UpdateCalcLock, almtx_recursive) != althrd_success)
+    {
+        alcnd_destroy(&device->UpdateCond);
+        almtx_destroy(&device->UpdateLock);
+        return;
+    }
+    InitRef(&device->UpdateRequests, 0);
+    ATOMIC_INIT(&device->UpdateThreadKill, AL_FALSE);
+
+    if(althrd_create(&device->UpdateThread, UpdateThreadProc, device) != althrd_success)
+    {
+        ERR("Failed to start update thread\n");
+        almtx_destroy(&device->UpdateCalcLock);
+        alcnd_destroy(&device->UpdateCond);
+        almtx_destroy(&device->UpdateLock);
+        return;
+    }
+    device->UpdateThreadActive = AL_TRUE;
+}
+
+void aluStopUpdateThread(ALCdevice *device)
+{
+    int res;
+
+    if(!device->UpdateThreadActive)
+        return;
+
+    almtx_lock(&device->UpdateLock);
+    ATOMIC_STORE(&device->UpdateThreadKill, AL_TRUE);
+    alcnd_signal(&device->UpdateCond);
+    almtx_unlock(&device->UpdateLock);
+    althrd_join(device->UpdateThread, &res);
+
+    almtx_destroy(&device->UpdateCalcLock);
+    alcnd_destroy(&device->UpdateCond);
+    almtx_destroy(&device->UpdateLock);
+    device->UpdateThreadActive = AL_FALSE;
 }
 
 
@@ -1305,6 +1756,37 @@ static inline ALbyte aluF2B(ALfloat val)
 static inline ALubyte aluF2UB(ALfloat val)
 { return aluF2B(val)+128; }
 
+/* Generates TPDF dither noise of +/-1 LSB for 4 samples, using 4 xorshift
+ * generators. Each noise value is the difference of the two 16-bit halves of
+ * a generator's output, which gives a triangular distribution. This must
+ * match the SSE2 version, so the output is the same either way.
+ */
+static inline void aluDither4(ALfloat *restrict noise, ALuint *restrict seed)
+{
+    ALuint i;
+    for(i = 0;i < 4;i++)
+    {
+        ALuint x = seed[i];
+        x ^= x << 13;
+        x ^= x >> 17;
+        x ^= x << 5;
+        seed[i] = x;
+        noise[i] = ((ALint)(x&0xffff) - (ALint)(x>>16)) * (1.0f/65536.0f);
+    }
+}
+
+/* Converts to 16-bit with dither, rounding to the nearest integer. The
+ * conversion may round toward 0, so step back any result that rounded up. */
+static inline ALshort aluF2SDither(ALfloat val, ALfloat noise)
+{
+    ALfloat v = aluClampf(val)*32767.0f + noise + 0.5f;
+    ALint i = fastf2i(v);
+    if((ALfloat)i > v) i--;
+    return clampi(i, -32768, 32767);
+}
+static inline ALushort aluF2USDither(ALfloat val, ALfloat noise)
+{ return aluF2SDither(val, noise)+32768; }
+
 #define DECL_TEMPLATE(T, func)                                                \
 static void Write_##T(ALfloatBUFFERSIZE *InBuffer, ALvoid *OutBuffer,         \
                       ALuint SamplesToDo, ALuint numchans)                    \
@@ -1329,6 +1811,311 @@ DECL_TEMPLATE(ALbyte, aluF2B)
 
 #undef DECL_TEMPLATE
 
+/* The dithered conversions go over 4 samples of each channel at a time, to
+ * use the dither noise in the same order as the SSE2 version. */
+#define DECL_TEMPLATE(T, func)                                                \
+static void WriteDither_##T(ALfloatBUFFERSIZE *InBuffer, ALvoid *OutBuffer,   \
+                            ALuint SamplesToDo, ALuint numchans,              \
+                            ALuint *restrict seed)                            \
+{                                                                             \
+    ALfloat noise[4];                                                         \
+    ALuint base, todo, i, j;                                                  \
+    for(base = 0;base < SamplesToDo;base += todo)                             \
+    {                                                                         \
+        todo = minu(SamplesToDo-base, 4);                                     \
+        for(j = 0;j < numchans;j++)                                           \
+        {                                                                     \
+            const ALfloat *in = InBuffer[j] + base;                           \
+            T *restrict out = (T*)OutBuffer + base*numchans + j;              \
+            aluDither4(noise, seed);                                          \
+            for(i = 0;i < todo;i++)                                           \
+                out[i*numchans] = func(in[i], noise[i]);                      \
+        }                                                                     \
+    }                                                                         \
+}
+
+DECL_TEMPLATE(ALushort, aluF2USDither)
+DECL_TEMPLATE(ALshort, aluF2SDither)
+
+#undef DECL_TEMPLATE
+
+
+/* Makes sure the first SamplesToDo samples of the slot's wet buffer are
+ * cleared for mixing, skipping what's already known to be silent.
+ */
+static inline void ClearEffectSlot(ALeffectslot *slot, ALuint SamplesToDo)
+{
+    ALuint c;
+
+    if(slot->WetCleared >= SamplesToDo)
+        return;
+    for(c = 0;c < slot->NumChannels;c++)
+        memset(&slot->WetBuffer[c][slot->WetCleared], 0,
+               (SamplesToDo-slot->WetCleared)*sizeof(ALfloat));
+    slot->WetCleared = SamplesToDo;
+}
+
+/* Checks if the slot's effect needs processing, which it doesn't when its
+ * input has been silent for longer than the effect's tail, as the output is
+ * known to be silent too.
+ */
+static ALboolean EffectSlotIsActive(ALeffectslot *slot, ALuint SamplesToDo)
+{
+    const ALeffectState *state = slot->EffectState;
+    ALuint c, i;
+
+    for(c = 0;c < slot->NumChannels;c++)
+    {
+        const ALfloat *restrict input = slot->WetBuffer[c];
+        for(i = 0;i < SamplesToDo;i++)
+        {
+            if(input[i] != 0.0f)
+                break;
+        }
+        if(i < SamplesToDo)
+            break;
+    }
+
+    if(c < slot->NumChannels)
+    {
+        slot->WetCleared = 0;
+        slot->TailRemaining = state->TailLength;
+    }
+    else if(slot->TailRemaining == 0)
+        return AL_FALSE;
+    else if(slot->TailRemaining != ~0u)
+        slot->TailRemaining -= minu(slot->TailRemaining, SamplesToDo);
+    return AL_TRUE;
+}
+
+static void ProcessEffectSlot(ALeffectslot *slot, ALuint SamplesToDo)
+{
+    ALeffectState *state = slot->EffectState;
+
+    if(EffectSlotIsActive(slot, SamplesToDo))
+        V(state,process)(SamplesToDo, slot->WetBuffer, state->OutBuffer,
+                         state->OutChannels);
+}
+
+
+/* An effect slot given to the effect threads, and the buffer it renders its
+ * output to. */
+typedef struct ALeffectJob {
+    ALeffectslot *Slot;
+    ALfloat (*Buffer)[BUFFERSIZE];
+    ALboolean Active;
+} ALeffectJob;
+
+static void RunEffectJob(ALeffectJob *job, ALuint SamplesToDo)
+{
+    ALeffectslot *slot = job->Slot;
+    ALeffectState *state = slot->EffectState;
+    ALuint c;
+
+    job->Active = EffectSlotIsActive(slot, SamplesToDo);
+    if(!job->Active)
+        return;
+
+    for(c = 0;c < state->OutChannels;c++)
+        memset(job->Buffer[c], 0, SamplesToDo*sizeof(ALfloat));
+    V(state,process)(SamplesToDo, slot->WetBuffer, job->Buffer, state->OutChannels);
+}
+
+static int EffectThreadProc(void *arg)
+{
+    ALCdevice *device = arg;
+    ALuint SamplesToDo, idx;
+    FPUCtl oldMode;
+
+    /* The mixer waits on these threads, so they need its priority. */
+    SetRTPriority();
+    althrd_setname(althrd_current(), EFFECT_THREAD_NAME);
+    SetMixerFPUMode(&oldMode);
+
+    almtx_lock(&device->EffectLock);
+    while(!ATOMIC_LOAD(&device->EffectThreadKill))
+    {
+        if(device->EffectJobNext >= device->EffectJobCount)
+        {
+            alcnd_wait(&device->EffectCond, &device->EffectLock);
+            continue;
+        }
+        idx = device->EffectJobNext++;
+        SamplesToDo = device->EffectSamplesToDo;
+        almtx_unlock(&device->EffectLock);
+
+        RunEffectJob(&device->EffectJobs[idx], SamplesToDo);
+
+        almtx_lock(&device->EffectLock);
+        if(++device->EffectJobsDone == device->EffectJobCount)
+            alcnd_signal(&device->EffectDoneCond);
+    }
+    almtx_unlock(&device->EffectLock);
+
+    RestoreFPUMode(&oldMode);
+    return 0;
+}
+
+/* Processes the context's effect slots, handing the independent ones to the
+ * effect threads. The mixer thread takes jobs too while it waits for them. */
+static void ProcessEffectSlotsThreaded(ALCdevice *device, ALCcontext *ctx, ALuint SamplesToDo)
+{
+    ALeffectJob *jobs = device->EffectJobs;
+    ALuint count, total;
+    ALuint i, c, j;
+
+    count = 0;
+    total = VECTOR_SIZE(ctx->ActiveAuxSlots);
+    for(i = 0;i < total;i++)
+    {
+        ALeffectslot *slot = VECTOR_ELEM(ctx->ActiveAuxSlots, i);
+        /* Chained slots mix into the input of other slots, so they're
+         * processed here. They're ordered before any slot they feed.
+         */
+        if(slot->Target || count == device->EffectJobMax ||
+           slot->EffectState->OutChannels > MAX_OUTPUT_CHANNELS)
+            ProcessEffectSlot(slot, SamplesToDo);
+        else
+            jobs[count++].Slot = slot;
+    }
+    if(count < 2)
+    {
+        if(count == 1)
+            ProcessEffectSlot(jobs[0].Slot, SamplesToDo);
+        return;
+    }
+
+    almtx_lock(&device->EffectLock);
+    device->EffectSamplesToDo = SamplesToDo;
+    device->EffectJobCount = count;
+    device->EffectJobNext = 0;
+    device->EffectJobsDone = 0;
+    alcnd_broadcast(&device->EffectCond);
+    while(device->EffectJobNext < count)
+    {
+        i = device->EffectJobNext++;
+        almtx_unlock(&device->EffectLock);
+        RunEffectJob(&jobs[i], SamplesToDo);
+        almtx_lock(&device->EffectLock);
+        device->EffectJobsDone++;
+    }
+    while(device->EffectJobsDone < count)
+        alcnd_wait(&device->EffectDoneCond, &device->EffectLock);
+    device->EffectJobCount = 0;
+    almtx_unlock(&device->EffectLock);
+
+    /* Sum the job outputs in slot order, so the result doesn't depend on
+     * which thread finished first. */
+    for(i = 0;i < count;i++)
+    {
+        const ALeffectState *state = jobs[i].Slot->EffectState;
+        if(!jobs[i].Active)
+            continue;
+        for(c = 0;c < state->OutChannels;c++)
+        {
+            const ALfloat *restrict src = jobs[i].Buffer[c];
+            ALfloat *restrict dst = state->OutBuffer[c];
+            for(j = 0;j < SamplesToDo;j++)
+                dst[j] += src[j];
+        }
+    }
+}
+
+void aluStartEffectThreads(ALCdevice *device, ALuint count)
+{
+    ALfloat (*buffers)[BUFFERSIZE];
+    size_t jobsize;
+    ALuint i;
+
+    device->NumEffectThreads = 0;
+    if(count == 0)
+        return;
+    count = minu(count, MAX_EFFECT_THREADS);
+
+    /* Each job needs its own output buffer, and a context can't have more
+     * effect slots than the device allows. */
+    device->EffectJobMax = device->AuxiliaryEffectSlotMax;
+    jobsize = (device->EffectJobMax*sizeof(ALeffectJob) + 15) & ~(size_t)15;
+    device->EffectJobs = al_calloc(16, jobsize + device->EffectJobMax *
+                                   sizeof(ALfloat[MAX_OUTPUT_CHANNELS][BUFFERSIZE]));
+    if(!device->EffectJobs)
+    {
+        ERR("Failed to allocate effect job buffers\n");
+        device->EffectJobMax = 0;
+        return;
+    }
+    buffers = (ALfloat(*)[BUFFERSIZE])((char*)device->EffectJobs + jobsize);
+    for(i = 0;i < device->EffectJobMax;i++)
+        device->EffectJobs[i].Buffer = buffers + i*MAX_OUTPUT_CHANNELS;
+
+    if(almtx_init(&device->EffectLock, almtx_plain) != althrd_success)
+        goto error;
+    if(alcnd_init(&device->EffectCond) != althrd_success)
+    {
+        almtx_destroy(&device->EffectLock);
+        goto error;
+    }
+    if(alcnd_init(&device->EffectDoneCond) != althrd_success)
+    {
+        alcnd_destroy(&device->EffectCond);
+        almtx_destroy(&device->EffectLock);
+        goto error;
+    }
+    device->EffectJobCount = 0;
+    device->EffectJobNext = 0;
+    device->EffectJobsDone = 0;
+    ATOMIC_INIT(&device->EffectThreadKill, AL_FALSE);
+
+    for(i = 0;i < count;i++)
+    {
+        if(althrd_create(&device->EffectThreads[i], EffectThreadProc, device) != althrd_success)
+        {
+            ERR("Failed to start effect thread %u\n", i);
+            break;
+        }
+    }
+    device->NumEffectThreads = i;
+    if(device->NumEffectThreads == 0)
+    {
+        alcnd_destroy(&device->EffectDoneCond);
+        alcnd_destroy(&device->EffectCond);
+        almtx_destroy(&device->EffectLock);
+        goto error;
+    }
+    TRACE("Started %u effect thread%s\n", device->NumEffectThreads,
+          (device->NumEffectThreads == 1) ? "" : "s");
+    return;
+
+error:
+    al_free(device->EffectJobs);
+    device->EffectJobs = NULL;
+    device->EffectJobMax = 0;
+}
+
+void aluStopEffectThreads(ALCdevice *device)
+{
+    ALuint i;
+    int res;
+
+    if(device->NumEffectThreads == 0)
+        return;
+
+    almtx_lock(&device->EffectLock);
+    ATOMIC_STORE(&device->EffectThreadKill, AL_TRUE);
+    alcnd_broadcast(&device->EffectCond);
+    almtx_unlock(&device->EffectLock);
+    for(i = 0;i < device->NumEffectThreads;i++)
+        althrd_join(device->EffectThreads[i], &res);
+
+    alcnd_destroy(&device->EffectDoneCond);
+    alcnd_destroy(&device->EffectCond);
+    almtx_destroy(&device->EffectLock);
+    device->NumEffectThreads = 0;
+
+    al_free(device->EffectJobs);
+    device->EffectJobs = NULL;
+    device->EffectJobMax = 0;
+}
 
 ALvoid aluMixData(ALCdevice *device, ALvoid *buffer, ALsizei size)
 {
@@ -1359,67 +2146,50 @@ ALvoid aluMixData(ALCdevice *device, ALvoid *buffer, ALsizei size)
 
         if((slot=device->DefaultSlot) != NULL)
         {
-            if(ATOMIC_EXCHANGE(ALenum, &slot->NeedsUpdate, AL_FALSE))
+            if(!device->UpdateThreadActive &&
+               ATOMIC_EXCHANGE(ALenum, &slot->NeedsUpdate, AL_FALSE))
                 V(slot->EffectState,update)(device, slot);
-            for(i = 0;i < slot->NumChannels;i++)
-                memset(slot->WetBuffer[i], 0, SamplesToDo*sizeof(ALfloat));
+            ClearEffectSlot(slot, SamplesToDo);
         }
 
         ctx = ATOMIC_LOAD(&device->ContextList);
         while(ctx)
         {
-            if(!ctx->DeferUpdates)
+            if(!ctx->DeferUpdates && !device->UpdateThreadActive)
             {
                 UpdateContextSources(ctx);
-#define UPDATE_SLOT(iter) do {                                         \
-    if(ATOMIC_EXCHANGE(ALenum, &(*iter)->NeedsUpdate, AL_FALSE))       \
-        V((*iter)->EffectState,update)(device, *iter);                 \
-    for(i = 0;i < (*iter)->NumChannels;i++)                            \
-        memset((*iter)->WetBuffer[i], 0, SamplesToDo*sizeof(ALfloat)); \
-} while(0)
-                VECTOR_FOR_EACH(ALeffectslot*, ctx->ActiveAuxSlots, UPDATE_SLOT);
-#undef UPDATE_SLOT
+                UpdateContextSlots(ctx, device);
             }
-            else
-            {
-#define CLEAR_WET_BUFFER(iter) do {                                    \
-    for(i = 0;i < (*iter)->NumChannels;i++)                            \
-        memset((*iter)->WetBuffer[i], 0, SamplesToDo*sizeof(ALfloat)); \
-} while(0)
-                VECTOR_FOR_EACH(ALeffectslot*, ctx->ActiveAuxSlots, CLEAR_WET_BUFFER);
+#define CLEAR_WET_BUFFER(iter) ClearEffectSlot(*iter, SamplesToDo)
+            VECTOR_FOR_EACH(ALeffectslot*, ctx->ActiveAuxSlots, CLEAR_WET_BUFFER);
 #undef CLEAR_WET_BUFFER
-            }
 
             /* source processing */
             voice = ctx->Voices;
             voice_end = voice + ctx->VoiceCount;
             for(;voice != voice_end;++voice)
             {
-                source = voice->Source;
-                if(source && source->state == AL_PLAYING)
+                if(!(source=voice->Source)) continue;
+                ApplyVoiceTargets(voice, device);
+                if(source->state == AL_PLAYING)
                     MixSource(voice, source, device, SamplesToDo);
             }
 
             /* effect slot processing */
-            c = VECTOR_SIZE(ctx->ActiveAuxSlots);
-            for(i = 0;i < c;i++)
+            if(device->NumEffectThreads > 0)
+                ProcessEffectSlotsThreaded(device, ctx, SamplesToDo);
+            else
             {
-                const ALeffectslot *slot = VECTOR_ELEM(ctx->ActiveAuxSlots, i);
-                ALeffectState *state = slot->EffectState;
-                V(state,process)(SamplesToDo, slot->WetBuffer, state->OutBuffer,
-                                 state->OutChannels);
+                c = VECTOR_SIZE(ctx->ActiveAuxSlots);
+                for(i = 0;i < c;i++)
+                    ProcessEffectSlot(VECTOR_ELEM(ctx->ActiveAuxSlots, i), SamplesToDo);
             }
 
             ctx = ctx->next;
         }
 
         if(device->DefaultSlot != NULL)
-        {
-            const ALeffectslot *slot = device->DefaultSlot;
-            ALeffectState *state = slot->EffectState;
-            V(state,process)(SamplesToDo, slot->WetBuffer, state->OutBuffer,
-                             state->OutChannels);
-        }
+            ProcessEffectSlot(device->DefaultSlot, SamplesToDo);
 
         /* Increment the clock time. Every second's worth of samples is
          * converted and added to clock base so that large sample counts don't
@@ -1494,46 +2264,88 @@ ALvoid aluMixData(ALCdevice *device, ALvoid *buffer, ALsizei size)
             }
         }
 
+        if(device->Limiter)
+            ApplyLimiter(device->Limiter, device->RealOut.Buffer, SamplesToDo);
+
         if(buffer)
         {
             ALfloat (*OutBuffer)[BUFFERSIZE] = device->RealOut.Buffer;
             ALuint OutChannels = device->RealOut.NumChannels;
+            ALuint *dither = (device->Dither ? device->DitherSeed : NULL);
+#ifdef HAVE_SSE2
+            /* The SSE2 conversions handle stereo, 5.1, and 7.1 output. */
+            ALboolean UseSSE2 = (CPUCapFlags&CPU_CAP_SSE2) &&
+                                (OutChannels == 2 || OutChannels == 6 || OutChannels == 8);
+#endif
 
-#define WRITE(T, a, b, c, d) do {               \
-    Write_##T((a), (b), (c), (d));              \
-    buffer = (T*)buffer + (c)*(d);              \
-} while(0)
             switch(device->FmtType)
             {
                 case DevFmtByte:
-                    WRITE(ALbyte, OutBuffer, buffer, SamplesToDo, OutChannels);
+                    Write_ALbyte(OutBuffer, buffer, SamplesToDo, OutChannels);
                     break;
                 case DevFmtUByte:
-                    WRITE(ALubyte, OutBuffer, buffer, SamplesToDo, OutChannels);
+                    Write_ALubyte(OutBuffer, buffer, SamplesToDo, OutChannels);
                     break;
                 case DevFmtShort:
-                    WRITE(ALshort, OutBuffer, buffer, SamplesToDo, OutChannels);
+#ifdef HAVE_SSE2
+                    if(UseSSE2)
+                    {
+                        WriteShort_SSE2(OutBuffer, buffer, SamplesToDo, OutChannels, dither);
+                        break;
+                    }
+#endif
+                    if(dither)
+                        WriteDither_ALshort(OutBuffer, buffer, SamplesToDo, OutChannels, dither);
+                    else
+                        Write_ALshort(OutBuffer, buffer, SamplesToDo, OutChannels);
                     break;
                 case DevFmtUShort:
-                    WRITE(ALushort, OutBuffer, buffer, SamplesToDo, OutChannels);
+                    if(dither)
+                        WriteDither_ALushort(OutBuffer, buffer, SamplesToDo, OutChannels, dither);
+                    else
+                        Write_ALushort(OutBuffer, buffer, SamplesToDo, OutChannels);
                     break;
                 case DevFmtInt:
-                    WRITE(ALint, OutBuffer, buffer, SamplesToDo, OutChannels);
+#ifdef HAVE_SSE2
+                    if(UseSSE2)
+                    {
+                        WriteInt_SSE2(OutBuffer, buffer, SamplesToDo, OutChannels);
+                        break;
+                    }
+#endif
+                    Write_ALint(OutBuffer, buffer, SamplesToDo, OutChannels);
                     break;
                 case DevFmtUInt:
-                    WRITE(ALuint, OutBuffer, buffer, SamplesToDo, OutChannels);
+                    Write_ALuint(OutBuffer, buffer, SamplesToDo, OutChannels);
                     break;
                 case DevFmtFloat:
-                    WRITE(ALfloat, OutBuffer, buffer, SamplesToDo, OutChannels);
+#ifdef HAVE_SSE2
+                    if(UseSSE2)
+                    {
+                        WriteFloat_SSE2(OutBuffer, buffer, SamplesToDo, OutChannels);
+                        break;
+                    }
+#endif
+                    Write_ALfloat(OutBuffer, buffer, SamplesToDo, OutChannels);
                     break;
             }
-#undef WRITE
+            buffer = (ALbyte*)buffer + SamplesToDo*OutChannels*BytesFromDevFmt(device->FmtType);
         }
 
         size -= SamplesToDo;
         IncrementRef(&device->MixCount);
     }
 
+    if(device->UpdateThreadActive)
+    {
+        /* Have the update thread calculate the next targets while the device
+         * plays this mix. */
+        IncrementRef(&device->UpdateRequests);
+        almtx_lock(&device->UpdateLock);
+        alcnd_signal(&device->UpdateCond);
+        almtx_unlock(&device->UpdateLock);
+    }
+
     RestoreFPUMode(&oldMode);
 }
 
@@ -4,64 +4,64 @@
 #include "bformatdec.h"
 #include "ambdec.h"
 #include "alu.h"
+#include "mixer_defs.h"
 
 #include "threads.h"
 #include "almalloc.h"
 
 
-typedef struct BandSplitter {
-    ALfloat coeff;
-    ALfloat lp_z1;
-    ALfloat lp_z2;
-    ALfloat hp_z1;
-} BandSplitter;
-
 static void bandsplit_init(BandSplitter *splitter, ALfloat freq_mult)
 {
     ALfloat w = freq_mult * F_TAU;
     ALfloat cw = cosf(w);
+    ALuint i;
+
     if(cw > FLT_EPSILON)
         splitter->coeff = (sinf(w) - 1.0f) / cw;
     else
         splitter->coeff = cw * -0.5f;
 
-    splitter->lp_z1 = 0.0f;
-    splitter->lp_z2 = 0.0f;
-    splitter->hp_z1 = 0.0f;
+    for(i = 0;i < MAX_FILTER_LANES;i++)
+    {
+        splitter->lp_z1[i] = 0.0f;
+        splitter->lp_z2[i] = 0.0f;
+        splitter->hp_z1[i] = 0.0f;
+    }
 }
 
-static void bandsplit_process(BandSplitter *splitter, ALfloat *restrict hpout, ALfloat *restrict lpout,
-                              const ALfloat *input, ALuint count)
+static inline BandSplitFunc SelectBandSplit(void)
 {
-    ALfloat coeff, d, x;
-    ALuint i;
-
-    coeff = splitter->coeff*0.5f + 0.5f;
-    for(i = 0;i < count;i++)
-    {
-        x = input[i];
+#ifdef HAVE_SSE
+    if((CPUCapFlags&CPU_CAP_SSE))
+        return BandSplit_SSE;
+#endif
 
-        d = (x - splitter->lp_z1) * coeff;
-        x = splitter->lp_z1 + d;
-        splitter->lp_z1 = x + d;
-
-        d = (x - splitter->lp_z2) * coeff;
-        x = splitter->lp_z2 + d;
-        splitter->lp_z2 = x + d;
+    return BandSplit_C;
+}
 
-        lpout[i] = x;
-    }
+/* Splits each input channel into high and low frequency bands, running up to
+ * MAX_FILTER_LANES channels through each splitter at once.
+ */
+static void bandsplit_process(BandSplitFunc split, BandSplitter *splitters,
+                              ALfloat (*restrict hpout)[BUFFERSIZE],
+                              ALfloat (*restrict lpout)[BUFFERSIZE],
+                              ALfloat (*restrict input)[BUFFERSIZE],
+                              ALuint numchans, ALuint count)
+{
+    ALfloat *hp[MAX_FILTER_LANES], *lp[MAX_FILTER_LANES];
+    const ALfloat *in[MAX_FILTER_LANES];
+    ALuint base, todo, c;
 
-    coeff = splitter->coeff;
-    for(i = 0;i < count;i++)
+    for(base = 0;base < numchans;base += todo)
     {
-        x = input[i];
-
-        d = x - coeff*splitter->hp_z1;
-        x = splitter->hp_z1 + coeff*d;
-        splitter->hp_z1 = d;
-
-        hpout[i] = x - lpout[i];
+        todo = minu(MAX_FILTER_LANES, numchans-base);
+        for(c = 0;c < todo;c++)
+        {
+            hp[c] = hpout[base+c];
+            lp[c] = lpout[base+c];
+            in[c] = input[base+c];
+        }
+        split(&splitters[base/MAX_FILTER_LANES], todo, hp, lp, in, count);
     }
 }
 
@@ -189,7 +189,9 @@ typedef struct BFormatDec {
     alignas(16) ALfloat MatrixHF[MAX_OUTPUT_CHANNELS][MAX_AMBI_COEFFS];
     alignas(16) ALfloat MatrixLF[MAX_OUTPUT_CHANNELS][MAX_AMBI_COEFFS];
 
-    BandSplitter XOver[MAX_AMBI_COEFFS];
+    /* Each splitter handles MAX_FILTER_LANES input channels. */
+    BandSplitter XOver[(MAX_AMBI_COEFFS+MAX_FILTER_LANES-1)/MAX_FILTER_LANES];
+    BandSplitFunc Split;
 
     ALfloat (*Samples)[BUFFERSIZE];
     /* These two alias into Samples */
@@ -204,7 +206,7 @@ typedef struct BFormatDec {
     } Delay[MAX_OUTPUT_CHANNELS];
 
     struct {
-        BandSplitter XOver[4];
+        BandSplitter XOver;
 
         const ALfloat (*restrict MatrixHF)[MAX_AMBI_COEFFS];
         const ALfloat (*restrict MatrixLF)[MAX_AMBI_COEFFS];
@@ -284,9 +286,10 @@ void bformatdec_reset(BFormatDec *dec, const AmbDecConf *conf, ALuint chancount,
     else if(conf->CoeffScale == ADS_FuMa)
         coeff_scale = FuMa2N3DScale;
 
+    dec->Split = SelectBandSplit();
+
     ratio = 400.0f / (ALfloat)srate;
-    for(i = 0;i < 4;i++)
-        bandsplit_init(&dec->UpSampler.XOver[i], ratio);
+    bandsplit_init(&dec->UpSampler.XOver, ratio);
     if((conf->ChanMask & ~0x831b))
     {
         dec->UpSampler.MatrixHF = CubeMatrixHF;
@@ -349,7 +352,7 @@ void bformatdec_reset(BFormatDec *dec, const AmbDecConf *conf, ALuint chancount,
         dec->DualBand = AL_TRUE;
 
         ratio = conf->XOverFreq / (ALfloat)srate;
-        for(i = 0;i < MAX_AMBI_COEFFS;i++)
+        for(i = 0;i < COUNTOF(dec->XOver);i++)
             bandsplit_init(&dec->XOver[i], ratio);
 
         ratio = powf(10.0f, conf->XOverRatio / 40.0f);
@@ -448,9 +451,8 @@ void bformatdec_process(struct BFormatDec *dec, ALfloat (*restrict OutBuffer)[BU
 
     if(dec->DualBand)
     {
-        for(i = 0;i < dec->NumChannels;i++)
-            bandsplit_process(&dec->XOver[i], dec->SamplesHF[i], dec->SamplesLF[i],
-                              InSamples[i], SamplesToDo);
+        bandsplit_process(dec->Split, dec->XOver, dec->SamplesHF, dec->SamplesLF,
+                          InSamples, dec->NumChannels, SamplesToDo);
 
         for(chan = 0;chan < OutChannels;chan++)
         {
@@ -538,9 +540,8 @@ void bformatdec_upSample(struct BFormatDec *dec, ALfloat (*restrict OutBuffer)[B
      * order content (to which, this up-sampler is only used with second-order
      * or higher decoding, so it will).
      */
-    for(i = 0;i < InChannels;i++)
-        bandsplit_process(&dec->UpSampler.XOver[i], dec->SamplesHF[i], dec->SamplesLF[i],
-                          InSamples[i], SamplesToDo);
+    bandsplit_process(dec->Split, &dec->UpSampler.XOver, dec->SamplesHF, dec->SamplesLF,
+                      InSamples, InChannels, SamplesToDo);
 
     /* This up-sampler is very simplistic. It essentially decodes the first-
      * order content to a square channel array (or cube if height is desired),
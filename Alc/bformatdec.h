@@ -2,10 +2,27 @@
 #define BFORMATDEC_H
 
 #include "alMain.h"
+#include "alFilter.h"
 
 struct AmbDecConf;
 struct BFormatDec;
 
+/* Splits MAX_FILTER_LANES channels into high and low frequency bands, with a
+ * shared crossover frequency. The low band is the input through a pair of
+ * one-pole low-pass filters, and the high band is the input through a one-
+ * pole all-pass filter, minus the low band.
+ */
+typedef struct BandSplitter {
+    ALfloat coeff;
+    alignas(16) ALfloat lp_z1[MAX_FILTER_LANES];
+    alignas(16) ALfloat lp_z2[MAX_FILTER_LANES];
+    alignas(16) ALfloat hp_z1[MAX_FILTER_LANES];
+} BandSplitter;
+
+typedef void (*BandSplitFunc)(BandSplitter *splitter, ALuint numchans,
+                              ALfloat *const *hpout, ALfloat *const *lpout,
+                              const ALfloat *const *input, ALuint count);
+
 enum BFormatDecFlags {
     BFDF_DistanceComp = 1<<0
 };
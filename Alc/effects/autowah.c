@@ -65,7 +65,9 @@ static ALboolean ALautowahState_deviceUpdate(ALautowahState *state, ALCdevice *d
 
 static ALvoid ALautowahState_update(ALautowahState *state, const ALCdevice *device, const ALeffectslot *slot)
 {
+    const MixParams *dry = GetEffectSlotDryOut(device, slot);
     ALfloat attackTime, releaseTime;
+    ALfilterState filter;
 
     attackTime = slot->EffectProps.Autowah.AttackTime * state->Frequency;
     releaseTime = slot->EffectProps.Autowah.ReleaseTime * state->Frequency;
@@ -75,7 +77,18 @@ static ALvoid ALautowahState_update(ALautowahState *state, const ALCdevice *devi
     state->PeakGain = slot->EffectProps.Autowah.PeakGain;
     state->Resonance = slot->EffectProps.Autowah.Resonance;
 
-    ComputeAmbientGains(device->Dry, slot->Gain, state->Gain);
+    /* The envelope needs to release before the output is known to be silent,
+     * then the filter rings the longest at its lowest cutoff.
+     */
+    ALfilterState_setParams(&filter, ALfilterType_LowPass, 1.0f,
+        20.0f / state->Frequency, 1.0f / (state->Resonance*0.1f)
+    );
+    STATIC_CAST(ALeffectState,state)->TailLength = fastf2u(releaseTime) +
+        minu(ALfilterState_calcTailLength(&filter), ~0u/2);
+
+    STATIC_CAST(ALeffectState,state)->OutBuffer = dry->Buffer;
+    STATIC_CAST(ALeffectState,state)->OutChannels = dry->NumChannels;
+    ComputeAmbientGains(*dry, slot->Gain, state->Gain);
 }
 
 static ALvoid ALautowahState_process(ALautowahState *state, ALuint SamplesToDo, const ALfloat (*restrict SamplesIn)[BUFFERSIZE], ALfloat (*restrict SamplesOut)[BUFFERSIZE], ALuint NumChannels)
@@ -57,11 +57,17 @@ static ALboolean ALcompressorState_deviceUpdate(ALcompressorState *state, ALCdev
 
 static ALvoid ALcompressorState_update(ALcompressorState *state, const ALCdevice *device, const ALeffectslot *slot)
 {
+    const MixParams *foa = GetEffectSlotFOAOut(device, slot);
     aluMatrixf matrix;
     ALuint i;
 
     state->Enabled = slot->EffectProps.Compressor.OnOff;
 
+    /* Output stops with the input, but give the gain control time to release
+     * so it resumes where it would have been. */
+    STATIC_CAST(ALeffectState,state)->TailLength =
+        state->Enabled ? fastf2u(1.0f / state->ReleaseRate) : 0;
+
     aluMatrixfSet(&matrix,
         1.0f, 0.0f, 0.0f, 0.0f,
         0.0f, 1.0f, 0.0f, 0.0f,
@@ -69,10 +75,10 @@ static ALvoid ALcompressorState_update(ALcompressorState *state, const ALCdevice
         0.0f, 0.0f, 0.0f, 1.0f
     );
 
-    STATIC_CAST(ALeffectState,state)->OutBuffer = device->FOAOut.Buffer;
-    STATIC_CAST(ALeffectState,state)->OutChannels = device->FOAOut.NumChannels;
+    STATIC_CAST(ALeffectState,state)->OutBuffer = foa->Buffer;
+    STATIC_CAST(ALeffectState,state)->OutChannels = foa->NumChannels;
     for(i = 0;i < 4;i++)
-        ComputeFirstOrderGains(device->FOAOut, matrix.m[i], slot->Gain,
+        ComputeFirstOrderGains(*foa, matrix.m[i], slot->Gain,
                                state->Gain[i]);
 }
 
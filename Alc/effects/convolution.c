@@ -0,0 +1,809 @@
+/**
+ * OpenAL cross platform audio library
+ * Copyright (C) 2016 by authors.
+ * This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Library General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Library General Public License for more details.
+ *
+ * You should have received a copy of the GNU Library General Public
+ *  License along with this library; if not, write to the
+ *  Free Software Foundation, Inc.,
+ *  51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ * Or go to http://www.gnu.org/copyleft/lgpl.html
+ */
+
+#include "config.h"
+
+#include <math.h>
+#include <stdlib.h>
+
+#include "alMain.h"
+#include "alAuxEffectSlot.h"
+#include "alBuffer.h"
+#include "alError.h"
+#include "alu.h"
+#include "mixer_defs.h"
+
+#include "threads.h"
+#include "almalloc.h"
+
+
+/* The impulse response is convolved in two levels of uniformly partitioned,
+ * frequency-domain (overlap-save) convolution. The head covers the start of
+ * the IR using short partitions, and runs on the mixer thread. The tail covers
+ * the rest using long partitions, and runs on a worker thread one tail block
+ * ahead of when its output is needed, so multi-second IRs cost the mixer about
+ * as much as a short one.
+ *
+ * The head covers the first 2*CONV_TAIL_SIZE samples of the IR, which gives
+ * the worker a full tail block of time to finish each block before the mixer
+ * waits on it. The output is delayed by CONV_HEAD_SIZE samples.
+ */
+#define CONV_HEAD_SIZE  128
+#define CONV_TAIL_SIZE  1024
+
+
+typedef struct ConvLevel {
+    /* Partition size, and the number of partitions and IR channels. Each
+     * partition is transformed using a real FFT of twice the partition size.
+     */
+    ALuint Size;
+    ALuint NumParts;
+    ALuint NumChannels;
+
+    /* Spectra are stored as separate real and imaginary arrays, each holding
+     * Size+1 bins padded to Stride floats.
+     */
+    ALuint Stride;
+
+    /* FFT tables. The bit-reversal permutation and twiddle factors for each
+     * stage of the half-size complex FFT, and the twiddle factors to split
+     * its output into the real transform.
+     */
+    ALuint  *BitRev;
+    ALfloat *Twiddle[2];
+    ALfloat *RealTwiddle[2];
+
+    /* IR spectra, as [NumChannels][NumParts][2][Stride]. */
+    ALfloat *Filter;
+
+    /* Spectra of the last NumParts input windows, as [NumParts][2][Stride],
+     * with FdlPos being the next one to write.
+     */
+    ALfloat *Fdl;
+    ALuint FdlPos;
+
+    /* Overlap-save input window, the last 2*Size input samples. */
+    ALfloat *Window;
+
+    /* Temporary storage used when processing. */
+    ALfloat *Work[2];
+    ALfloat *Accum;
+    ALfloat *Time;
+
+    SpectraMulAccFunc MulAcc;
+
+    void *Memory;
+} ConvLevel;
+
+
+static inline SpectraMulAccFunc SelectMulAccSpectra(void)
+{
+#ifdef HAVE_SSE
+    if((CPUCapFlags&CPU_CAP_SSE))
+        return MulAccSpectra_SSE;
+#endif
+
+    return MulAccSpectra_C;
+}
+
+
+static void ConvLevel_deinit(ConvLevel *level)
+{
+    al_free(level->Memory);
+    memset(level, 0, sizeof(*level));
+}
+
+static ALboolean ConvLevel_init(ConvLevel *level, ALuint size, ALuint numparts, ALuint numchans)
+{
+    ALuint stride = size + 4;
+    ALfloat *mem;
+    size_t total;
+    ALuint i, half;
+
+    total  = size;                        /* BitRev */
+    total += size*2;                      /* Twiddle */
+    total += stride*2;                    /* RealTwiddle */
+    total += (size_t)numchans*numparts*stride*2; /* Filter */
+    total += (size_t)numparts*stride*2;   /* Fdl */
+    total += size*2;                      /* Window */
+    total += size*2;                      /* Work */
+    total += (size_t)numchans*stride*2;   /* Accum */
+    total += size*2;                      /* Time */
+
+    memset(level, 0, sizeof(*level));
+    level->Memory = al_calloc(16, total*sizeof(ALfloat));
+    if(!level->Memory) return AL_FALSE;
+
+    level->Size = size;
+    level->NumParts = numparts;
+    level->NumChannels = numchans;
+    level->Stride = stride;
+    level->MulAcc = SelectMulAccSpectra();
+
+    mem = level->Memory;
+    level->BitRev = (ALuint*)mem;          mem += size;
+    level->Twiddle[0] = mem;               mem += size;
+    level->Twiddle[1] = mem;               mem += size;
+    level->RealTwiddle[0] = mem;           mem += stride;
+    level->RealTwiddle[1] = mem;           mem += stride;
+    level->Filter = mem;                   mem += (size_t)numchans*numparts*stride*2;
+    level->Fdl = mem;                      mem += (size_t)numparts*stride*2;
+    level->Window = mem;                   mem += size*2;
+    level->Work[0] = mem;                  mem += size;
+    level->Work[1] = mem;                  mem += size;
+    level->Accum = mem;                    mem += (size_t)numchans*stride*2;
+    level->Time = mem;
+
+    for(i = 0;i < size;i++)
+    {
+        ALuint rev = 0, bit;
+        for(bit = 1;bit < size;bit <<= 1)
+        {
+            rev <<= 1;
+            if((i&bit)) rev |= 1;
+        }
+        level->BitRev[i] = rev;
+    }
+    /* The twiddle factors for the stage combining pairs of 'half'-point
+     * transforms start at index half-1.
+     */
+    for(half = 1;half < size;half <<= 1)
+    {
+        for(i = 0;i < half;i++)
+        {
+            ALdouble phase = 3.14159265358979323846 * i / half;
+            level->Twiddle[0][half-1 + i] = (ALfloat)cos(phase);
+            level->Twiddle[1][half-1 + i] = (ALfloat)-sin(phase);
+        }
+    }
+    for(i = 0;i <= size;i++)
+    {
+        ALdouble phase = 3.14159265358979323846 * i / size;
+        level->RealTwiddle[0][i] = (ALfloat)cos(phase);
+        level->RealTwiddle[1][i] = (ALfloat)-sin(phase);
+    }
+
+    return AL_TRUE;
+}
+
+
+/* In-place forward FFT of Size complex points, with the input already in bit-
+ * reversed order. */
+static void ComplexFFT(const ConvLevel *level, ALfloat *restrict re, ALfloat *restrict im)
+{
+    const ALuint size = level->Size;
+    ALuint half, i, j;
+
+    for(half = 1;half < size;half <<= 1)
+    {
+        const ALfloat *restrict twr = level->Twiddle[0] + half-1;
+        const ALfloat *restrict twi = level->Twiddle[1] + half-1;
+        for(i = 0;i < size;i += half<<1)
+        {
+            ALfloat *restrict ar = re+i, *restrict ai = im+i;
+            ALfloat *restrict br = re+i+half, *restrict bi = im+i+half;
+            for(j = 0;j < half;j++)
+            {
+                ALfloat tr = br[j]*twr[j] - bi[j]*twi[j];
+                ALfloat ti = br[j]*twi[j] + bi[j]*twr[j];
+                br[j] = ar[j] - tr;
+                bi[j] = ai[j] - ti;
+                ar[j] += tr;
+                ai[j] += ti;
+            }
+        }
+    }
+}
+
+/* Forward FFT of 2*Size real samples, giving the Size+1 non-negative frequency
+ * bins. The even and odd samples are transformed together as one complex
+ * signal, then split apart.
+ */
+static void RealFFT(const ConvLevel *level, const ALfloat *restrict in, ALfloat *restrict outr, ALfloat *restrict outi)
+{
+    const ALuint size = level->Size;
+    const ALuint mask = size-1;
+    ALfloat *restrict zr = level->Work[0];
+    ALfloat *restrict zi = level->Work[1];
+    ALuint i;
+
+    for(i = 0;i < size;i++)
+    {
+        zr[level->BitRev[i]] = in[i*2 + 0];
+        zi[level->BitRev[i]] = in[i*2 + 1];
+    }
+    ComplexFFT(level, zr, zi);
+
+    for(i = 0;i <= size;i++)
+    {
+        const ALuint k0 = i&mask, k1 = (size-i)&mask;
+        const ALfloat evr = (zr[k0] + zr[k1]) * 0.5f;
+        const ALfloat evi = (zi[k0] - zi[k1]) * 0.5f;
+        const ALfloat odr = (zi[k0] + zi[k1]) * 0.5f;
+        const ALfloat odi = (zr[k1] - zr[k0]) * 0.5f;
+        const ALfloat wr = level->RealTwiddle[0][i];
+        const ALfloat wi = level->RealTwiddle[1][i];
+        outr[i] = evr + wr*odr - wi*odi;
+        outi[i] = evi + wr*odi + wi*odr;
+    }
+}
+
+/* Inverse of RealFFT, except the output is scaled by 2*Size. */
+static void RealIFFT(const ConvLevel *level, const ALfloat *restrict inr, const ALfloat *restrict ini, ALfloat *restrict out)
+{
+    const ALuint size = level->Size;
+    ALfloat *restrict zr = level->Work[0];
+    ALfloat *restrict zi = level->Work[1];
+    ALuint i;
+
+    /* The inverse is done as a forward transform on the conjugate. */
+    for(i = 0;i < size;i++)
+    {
+        const ALfloat evr = inr[i] + inr[size-i];
+        const ALfloat evi = ini[i] - ini[size-i];
+        const ALfloat dr = inr[i] - inr[size-i];
+        const ALfloat di = ini[i] + ini[size-i];
+        const ALfloat wr = level->RealTwiddle[0][i];
+        const ALfloat wi = level->RealTwiddle[1][i];
+        const ALfloat odr = dr*wr + di*wi;
+        const ALfloat odi = di*wr - dr*wi;
+        zr[level->BitRev[i]] = evr - odi;
+        zi[level->BitRev[i]] = -(evi + odr);
+    }
+    ComplexFFT(level, zr, zi);
+
+    for(i = 0;i < size;i++)
+    {
+        out[i*2 + 0] =  zr[i];
+        out[i*2 + 1] = -zi[i];
+    }
+}
+
+
+/* Sets the IR spectra for the given channel from 'len' samples of the IR,
+ * starting where this level begins. */
+static void ConvLevel_setFilter(ConvLevel *level, ALuint chan, const ALfloat *ir, ALuint len)
+{
+    const ALuint size = level->Size;
+    const ALuint stride = level->Stride;
+    const ALfloat scale = 1.0f / (ALfloat)(size*2);
+    ALfloat *filter = level->Filter + (size_t)chan*level->NumParts*stride*2;
+    ALuint p, i;
+
+    for(p = 0;p < level->NumParts;p++)
+    {
+        ALuint todo = (p*size < len) ? minu(size, len - p*size) : 0;
+
+        for(i = 0;i < todo;i++)
+            level->Time[i] = ir[p*size + i] * scale;
+        for(;i < size*2;i++)
+            level->Time[i] = 0.0f;
+        RealFFT(level, level->Time, filter, filter+stride);
+        filter += stride*2;
+    }
+}
+
+/* Convolves the next Size input samples, writing Size output samples for each
+ * channel, 'outstride' floats apart. */
+static void ConvLevel_process(ConvLevel *level, const ALfloat *restrict in, ALfloat *restrict out, ALuint outstride)
+{
+    const ALuint size = level->Size;
+    const ALuint stride = level->Stride;
+    const size_t chanstride = (size_t)level->NumParts*stride*2;
+    ALuint pos = level->FdlPos;
+    ALfloat *fdl;
+    ALuint c, p;
+
+    memmove(level->Window, level->Window+size, size*sizeof(ALfloat));
+    memcpy(level->Window+size, in, size*sizeof(ALfloat));
+
+    fdl = level->Fdl + (size_t)pos*stride*2;
+    RealFFT(level, level->Window, fdl, fdl+stride);
+
+    /* Each partition of the IR is applied to the input window from that many
+     * blocks ago, for all channels at once. */
+    memset(level->Accum, 0, (size_t)level->NumChannels*stride*2*sizeof(ALfloat));
+    for(p = 0;p < level->NumParts;p++)
+    {
+        const ALfloat *x = level->Fdl + (size_t)pos*stride*2;
+        const ALfloat *h = level->Filter + (size_t)p*stride*2;
+        ALfloat *acc = level->Accum;
+        for(c = 0;c < level->NumChannels;c++)
+        {
+            level->MulAcc(acc, acc+stride, x, x+stride, h, h+stride, stride);
+            acc += stride*2;
+            h += chanstride;
+        }
+        pos = (pos ? pos : level->NumParts) - 1;
+    }
+
+    for(c = 0;c < level->NumChannels;c++)
+    {
+        const ALfloat *acc = level->Accum + (size_t)c*stride*2;
+
+        /* Only the last half of the window is free of wrap-around. */
+        RealIFFT(level, acc, acc+stride, level->Time);
+        memcpy(out + (size_t)c*outstride, level->Time+size, size*sizeof(ALfloat));
+    }
+
+    level->FdlPos = (level->FdlPos+1) % level->NumParts;
+}
+
+
+/* An impulse response prepared for a device's sample rate, along with the
+ * convolution state and worker thread that render it. Loading one resamples
+ * and transforms the whole IR and starts a thread, so it's built without the
+ * device lock and swapped into the effect state with it held.
+ */
+struct ALconvolutionIR {
+    /* The buffer the IR was loaded from, and the rate it was converted to. */
+    struct ALbuffer *Buffer;
+    ALuint Frequency;
+
+    /* Number of IR channels, and the B-Format (ACN) channel each one outputs
+     * to. A mono IR just outputs to the W channel.
+     */
+    ALuint NumChannels;
+    ALuint ChanMap[MAX_EFFECT_CHANNELS];
+
+    ConvLevel Head;
+
+    /* Number of samples written to HeadIn, and read from HeadOut. */
+    ALuint HeadPos;
+    alignas(16) ALfloat HeadIn[CONV_HEAD_SIZE];
+    alignas(16) ALfloat HeadOut[MAX_EFFECT_CHANNELS][CONV_HEAD_SIZE];
+
+    struct {
+        ConvLevel Level;
+
+        /* Input collected for the next block, and the output of the last
+         * block finished by the worker. Pos is the number of samples taken
+         * from both. */
+        ALuint Pos;
+        alignas(16) ALfloat In[CONV_TAIL_SIZE];
+        alignas(16) ALfloat Out[MAX_EFFECT_CHANNELS][CONV_TAIL_SIZE];
+
+        /* The worker's own input and output block. These are only touched by
+         * the mixer when the worker has finished all submitted blocks. */
+        alignas(16) ALfloat JobIn[CONV_TAIL_SIZE];
+        alignas(16) ALfloat JobOut[MAX_EFFECT_CHANNELS][CONV_TAIL_SIZE];
+
+        ALboolean ThreadActive;
+        althrd_t Thread;
+        almtx_t Lock;
+        alcnd_t JobCond;
+        alcnd_t DoneCond;
+        ALuint Submitted;
+        ALuint Completed;
+        ALboolean Kill;
+    } Tail;
+};
+
+
+static int ConvolveThreadProc(void *arg)
+{
+    ALconvolutionIR *ir = arg;
+    FPUCtl oldMode;
+
+    SetRTPriority();
+    althrd_setname(althrd_current(), CONVOLVE_THREAD_NAME);
+
+    SetMixerFPUMode(&oldMode);
+    almtx_lock(&ir->Tail.Lock);
+    while(!ir->Tail.Kill)
+    {
+        if(ir->Tail.Completed == ir->Tail.Submitted)
+        {
+            alcnd_wait(&ir->Tail.JobCond, &ir->Tail.Lock);
+            continue;
+        }
+        almtx_unlock(&ir->Tail.Lock);
+
+        ConvLevel_process(&ir->Tail.Level, ir->Tail.JobIn, &ir->Tail.JobOut[0][0],
+                          CONV_TAIL_SIZE);
+
+        almtx_lock(&ir->Tail.Lock);
+        ir->Tail.Completed++;
+        alcnd_signal(&ir->Tail.DoneCond);
+    }
+    almtx_unlock(&ir->Tail.Lock);
+    RestoreFPUMode(&oldMode);
+
+    return 0;
+}
+
+static ALboolean StartTailThread(ALconvolutionIR *ir)
+{
+    ir->Tail.Submitted = 0;
+    ir->Tail.Completed = 0;
+    ir->Tail.Kill = AL_FALSE;
+
+    if(almtx_init(&ir->Tail.Lock, almtx_plain) != althrd_success)
+        return AL_FALSE;
+    if(alcnd_init(&ir->Tail.JobCond) != althrd_success)
+    {
+        almtx_destroy(&ir->Tail.Lock);
+        return AL_FALSE;
+    }
+    if(alcnd_init(&ir->Tail.DoneCond) != althrd_success)
+    {
+        alcnd_destroy(&ir->Tail.JobCond);
+        almtx_destroy(&ir->Tail.Lock);
+        return AL_FALSE;
+    }
+    if(althrd_create(&ir->Tail.Thread, ConvolveThreadProc, ir) != althrd_success)
+    {
+        ERR("Failed to start convolution thread\n");
+        alcnd_destroy(&ir->Tail.DoneCond);
+        alcnd_destroy(&ir->Tail.JobCond);
+        almtx_destroy(&ir->Tail.Lock);
+        return AL_FALSE;
+    }
+    ir->Tail.ThreadActive = AL_TRUE;
+    return AL_TRUE;
+}
+
+static void StopTailThread(ALconvolutionIR *ir)
+{
+    int res;
+
+    if(!ir->Tail.ThreadActive)
+        return;
+
+    almtx_lock(&ir->Tail.Lock);
+    ir->Tail.Kill = AL_TRUE;
+    alcnd_signal(&ir->Tail.JobCond);
+    almtx_unlock(&ir->Tail.Lock);
+    althrd_join(ir->Tail.Thread, &res);
+
+    alcnd_destroy(&ir->Tail.DoneCond);
+    alcnd_destroy(&ir->Tail.JobCond);
+    almtx_destroy(&ir->Tail.Lock);
+    ir->Tail.ThreadActive = AL_FALSE;
+}
+
+/* Passes the collected tail input to the worker, after waiting for it to
+ * finish the previous block and taking that block's output. */
+static void SubmitTailBlock(ALconvolutionIR *ir)
+{
+    almtx_lock(&ir->Tail.Lock);
+    while(ir->Tail.Completed != ir->Tail.Submitted)
+        alcnd_wait(&ir->Tail.DoneCond, &ir->Tail.Lock);
+
+    memcpy(ir->Tail.Out, ir->Tail.JobOut, sizeof(ir->Tail.Out));
+    memcpy(ir->Tail.JobIn, ir->Tail.In, sizeof(ir->Tail.JobIn));
+
+    ir->Tail.Submitted++;
+    alcnd_signal(&ir->Tail.JobCond);
+    almtx_unlock(&ir->Tail.Lock);
+}
+
+
+static ALfloat GetBufferSample(const ALbuffer *buffer, ALuint chan, ALuint numchans, ALuint pos)
+{
+    size_t idx = (size_t)pos*numchans + chan;
+    switch(buffer->FmtType)
+    {
+        case FmtByte: return ((const ALbyte*)buffer->data)[idx] * (1.0f/128.0f);
+        case FmtShort: return ((const ALshort*)buffer->data)[idx] * (1.0f/32768.0f);
+        case FmtFloat: return ((const ALfloat*)buffer->data)[idx];
+    }
+    return 0.0f;
+}
+
+/* Converts the buffer's samples to the IR's sample rate and B-Format layout,
+ * and prepares its spectra. */
+static ALboolean LoadIR(ALconvolutionIR *ir, const ALbuffer *buffer)
+{
+    /* FuMa-ordered input channels, and their ACN channel and N3D scaling. */
+    static const ALuint FuMa2ACN[MAX_EFFECT_CHANNELS] = { 0, 3, 1, 2 };
+    static const ALfloat FuMa2N3DScale[MAX_EFFECT_CHANNELS] = {
+        1.414213562f, 1.732050808f, 1.732050808f, 1.732050808f
+    };
+    ALuint numchans, srclen, len;
+    ALuint headparts, tailparts;
+    ALfloat *src = NULL, *samples = NULL;
+    ALuint64 step;
+    ALuint c, i;
+
+    if(buffer->FmtChannels == FmtBFormat3D)
+        numchans = 4;
+    else if(buffer->FmtChannels == FmtBFormat2D)
+        numchans = 3;
+    else if(buffer->FmtChannels == FmtMono)
+        numchans = 1;
+    else
+    {
+        ERR("Unsupported IR channel format 0x%04x\n", buffer->FmtChannels);
+        return AL_FALSE;
+    }
+
+    srclen = buffer->SampleLen;
+    len = (ALuint)(((ALuint64)srclen*ir->Frequency + buffer->Frequency-1) /
+                   buffer->Frequency);
+    if(len == 0) return AL_TRUE;
+
+    headparts = (minu(len, CONV_TAIL_SIZE*2) + CONV_HEAD_SIZE-1) / CONV_HEAD_SIZE;
+    tailparts = (len > CONV_TAIL_SIZE*2) ?
+                (len - CONV_TAIL_SIZE*2 + CONV_TAIL_SIZE-1) / CONV_TAIL_SIZE : 0;
+    TRACE("Loading %u-channel IR, %u samples (%u head and %u tail partitions)\n",
+          numchans, len, headparts, tailparts);
+
+    if(!ConvLevel_init(&ir->Head, CONV_HEAD_SIZE, headparts, numchans))
+        goto error;
+    if(tailparts > 0 && !ConvLevel_init(&ir->Tail.Level, CONV_TAIL_SIZE, tailparts, numchans))
+        goto error;
+
+    /* The source channel is padded for the resampler's filter. */
+    src = al_calloc(16, (srclen+8)*sizeof(ALfloat));
+    samples = al_calloc(16, len*sizeof(ALfloat));
+    if(!src || !samples) goto error;
+
+    step = ((ALuint64)buffer->Frequency<<FRACTIONBITS) / ir->Frequency;
+    for(c = 0;c < numchans;c++)
+    {
+        const ALfloat scale = (numchans > 1) ? FuMa2N3DScale[c] : 1.0f;
+
+        for(i = 0;i < srclen;i++)
+            src[3+i] = GetBufferSample(buffer, c, numchans, i) * scale;
+
+        if((ALuint)buffer->Frequency == ir->Frequency)
+            memcpy(samples, src+3, len*sizeof(ALfloat));
+        else for(i = 0;i < len;i++)
+        {
+            ALuint64 pos = i*step;
+            const ALfloat *vals = src + 3 + (pos>>FRACTIONBITS);
+            samples[i] = resample_fir8(vals[-3], vals[-2], vals[-1], vals[0],
+                                       vals[1], vals[2], vals[3], vals[4],
+                                       (ALuint)(pos&FRACTIONMASK));
+        }
+
+        ConvLevel_setFilter(&ir->Head, c, samples, minu(len, CONV_TAIL_SIZE*2));
+        if(tailparts > 0)
+            ConvLevel_setFilter(&ir->Tail.Level, c, samples + CONV_TAIL_SIZE*2,
+                                len - CONV_TAIL_SIZE*2);
+        ir->ChanMap[c] = (numchans > 1) ? FuMa2ACN[c] : 0;
+    }
+    al_free(samples);
+    al_free(src);
+
+    if(tailparts > 0 && !StartTailThread(ir))
+        goto error;
+    ir->NumChannels = numchans;
+
+    return AL_TRUE;
+
+error:
+    al_free(samples);
+    al_free(src);
+    return AL_FALSE;
+}
+
+ALconvolutionIR *ALconvolutionIR_create(const ALCdevice *device, struct ALbuffer *buffer)
+{
+    ALconvolutionIR *ir;
+    ALboolean ok;
+
+    ir = al_calloc(16, sizeof(*ir));
+    if(!ir) return NULL;
+    ir->Buffer = buffer;
+    ir->Frequency = device->Frequency;
+
+    ReadLock(&buffer->lock);
+    ok = LoadIR(ir, buffer);
+    ReadUnlock(&buffer->lock);
+    if(!ok)
+    {
+        ERR("Failed to load convolution IR\n");
+        ALconvolutionIR_delete(ir);
+        return NULL;
+    }
+    return ir;
+}
+
+void ALconvolutionIR_delete(ALconvolutionIR *ir)
+{
+    if(!ir) return;
+    StopTailThread(ir);
+    ConvLevel_deinit(&ir->Tail.Level);
+    ConvLevel_deinit(&ir->Head);
+    al_free(ir);
+}
+
+
+typedef struct ALconvolutionState {
+    DERIVE_FROM_TYPE(ALeffectState);
+
+    /* The IR being rendered, if any. Only changed with the device locked. */
+    ALconvolutionIR *IR;
+
+    ALfloat Gain[MAX_EFFECT_CHANNELS][MAX_OUTPUT_CHANNELS];
+} ALconvolutionState;
+
+static ALvoid ALconvolutionState_Destruct(ALconvolutionState *state)
+{
+    ALconvolutionIR_delete(state->IR);
+    state->IR = NULL;
+}
+
+static ALboolean ALconvolutionState_deviceUpdate(ALconvolutionState *state, ALCdevice *device)
+{
+    ALconvolutionIR *ir = state->IR;
+
+    /* The IR has to be reloaded if the sample rate changed. This is only
+     * called with the device stopped, or on a state not yet in use. */
+    if(ir && ir->Frequency != device->Frequency)
+    {
+        state->IR = ALconvolutionIR_create(device, ir->Buffer);
+        ALconvolutionIR_delete(ir);
+    }
+    return AL_TRUE;
+}
+
+static ALvoid ALconvolutionState_update(ALconvolutionState *state, const ALCdevice *device, const ALeffectslot *slot)
+{
+    const MixParams *foa = GetEffectSlotFOAOut(device, slot);
+    const ALconvolutionIR *ir = state->IR;
+    aluMatrixf matrix;
+    ALuint i;
+
+    aluMatrixfSet(&matrix,
+        1.0f, 0.0f, 0.0f, 0.0f,
+        0.0f, 1.0f, 0.0f, 0.0f,
+        0.0f, 0.0f, 1.0f, 0.0f,
+        0.0f, 0.0f, 0.0f, 1.0f
+    );
+
+    STATIC_CAST(ALeffectState,state)->OutBuffer = foa->Buffer;
+    STATIC_CAST(ALeffectState,state)->OutChannels = foa->NumChannels;
+    for(i = 0;ir && i < ir->NumChannels;i++)
+        ComputeFirstOrderGains(*foa, matrix.m[ir->ChanMap[i]], slot->Gain,
+                               state->Gain[i]);
+
+    /* The IR's length, plus the latency of a head block and two tail blocks
+     * (the one being collected and the one the worker is on). */
+    STATIC_CAST(ALeffectState,state)->TailLength = (!ir || !ir->NumChannels) ? 0 :
+        ir->Head.NumParts*CONV_HEAD_SIZE + ir->Tail.Level.NumParts*CONV_TAIL_SIZE +
+        CONV_HEAD_SIZE + CONV_TAIL_SIZE*2;
+}
+
+static ALvoid ALconvolutionState_process(ALconvolutionState *state, ALuint SamplesToDo, const ALfloat (*restrict SamplesIn)[BUFFERSIZE], ALfloat (*restrict SamplesOut)[BUFFERSIZE], ALuint NumChannels)
+{
+    ALconvolutionIR *ir = state->IR;
+    ALuint base, c, k, i;
+
+    if(!ir || ir->NumChannels == 0)
+        return;
+
+    for(base = 0;base < SamplesToDo;)
+    {
+        ALuint todo = minu(CONV_HEAD_SIZE - ir->HeadPos, SamplesToDo-base);
+
+        memcpy(&ir->HeadIn[ir->HeadPos], &SamplesIn[0][base], todo*sizeof(ALfloat));
+        for(c = 0;c < ir->NumChannels;c++)
+        {
+            const ALfloat *restrict out = &ir->HeadOut[c][ir->HeadPos];
+            for(k = 0;k < NumChannels;k++)
+            {
+                ALfloat gain = state->Gain[c][k];
+                if(!(fabsf(gain) > GAIN_SILENCE_THRESHOLD))
+                    continue;
+
+                for(i = 0;i < todo;i++)
+                    SamplesOut[k][base+i] += gain * out[i];
+            }
+        }
+        ir->HeadPos += todo;
+        base += todo;
+
+        if(ir->HeadPos == CONV_HEAD_SIZE)
+        {
+            ir->HeadPos = 0;
+            ConvLevel_process(&ir->Head, ir->HeadIn, &ir->HeadOut[0][0], CONV_HEAD_SIZE);
+            if(!ir->Tail.ThreadActive)
+                continue;
+
+            /* Mix in the tail's output for this block, and collect the input
+             * for the next tail block. */
+            for(c = 0;c < ir->NumChannels;c++)
+            {
+                const ALfloat *restrict tail = &ir->Tail.Out[c][ir->Tail.Pos];
+                for(i = 0;i < CONV_HEAD_SIZE;i++)
+                    ir->HeadOut[c][i] += tail[i];
+            }
+            memcpy(&ir->Tail.In[ir->Tail.Pos], ir->HeadIn, CONV_HEAD_SIZE*sizeof(ALfloat));
+            ir->Tail.Pos += CONV_HEAD_SIZE;
+            if(ir->Tail.Pos == CONV_TAIL_SIZE)
+            {
+                ir->Tail.Pos = 0;
+                SubmitTailBlock(ir);
+            }
+        }
+    }
+}
+
+DECLARE_DEFAULT_ALLOCATORS(ALconvolutionState)
+
+DEFINE_ALEFFECTSTATE_VTABLE(ALconvolutionState);
+
+
+typedef struct ALconvolutionStateFactory {
+    DERIVE_FROM_TYPE(ALeffectStateFactory);
+} ALconvolutionStateFactory;
+
+static ALeffectState *ALconvolutionStateFactory_create(ALconvolutionStateFactory *UNUSED(factory))
+{
+    ALconvolutionState *state;
+
+    state = ALconvolutionState_New(sizeof(*state));
+    if(!state) return NULL;
+    SET_VTABLE2(ALconvolutionState, ALeffectState, state);
+
+    state->IR = NULL;
+
+    return STATIC_CAST(ALeffectState, state);
+}
+
+DEFINE_ALEFFECTSTATEFACTORY_VTABLE(ALconvolutionStateFactory);
+
+ALeffectStateFactory *ALconvolutionStateFactory_getFactory(void)
+{
+    static ALconvolutionStateFactory ConvolutionFactory = { { GET_VTABLE2(ALconvolutionStateFactory, ALeffectStateFactory) } };
+
+    return STATIC_CAST(ALeffectStateFactory, &ConvolutionFactory);
+}
+
+
+ALconvolutionIR *ALconvolutionState_exchangeIR(ALeffectState *state, ALconvolutionIR *ir)
+{
+    ALconvolutionState *self = STATIC_UPCAST(ALconvolutionState, ALeffectState, state);
+    ALconvolutionIR *old = self->IR;
+    self->IR = ir;
+    return old;
+}
+
+
+void ALconvolution_setParami(ALeffect *UNUSED(effect), ALCcontext *context, ALenum UNUSED(param), ALint UNUSED(val))
+{ SET_ERROR_AND_RETURN(context, AL_INVALID_ENUM); }
+void ALconvolution_setParamiv(ALeffect *effect, ALCcontext *context, ALenum param, const ALint *vals)
+{
+    ALconvolution_setParami(effect, context, param, vals[0]);
+}
+void ALconvolution_setParamf(ALeffect *UNUSED(effect), ALCcontext *context, ALenum UNUSED(param), ALfloat UNUSED(val))
+{ SET_ERROR_AND_RETURN(context, AL_INVALID_ENUM); }
+void ALconvolution_setParamfv(ALeffect *effect, ALCcontext *context, ALenum param, const ALfloat *vals)
+{
+    ALconvolution_setParamf(effect, context, param, vals[0]);
+}
+
+void ALconvolution_getParami(const ALeffect *UNUSED(effect), ALCcontext *context, ALenum UNUSED(param), ALint *UNUSED(val))
+{ SET_ERROR_AND_RETURN(context, AL_INVALID_ENUM); }
+void ALconvolution_getParamiv(const ALeffect *effect, ALCcontext *context, ALenum param, ALint *vals)
+{
+    ALconvolution_getParami(effect, context, param, vals);
+}
+void ALconvolution_getParamf(const ALeffect *UNUSED(effect), ALCcontext *context, ALenum UNUSED(param), ALfloat *UNUSED(val))
+{ SET_ERROR_AND_RETURN(context, AL_INVALID_ENUM); }
+void ALconvolution_getParamfv(const ALeffect *effect, ALCcontext *context, ALenum param, ALfloat *vals)
+{
+    ALconvolution_getParamf(effect, context, param, vals);
+}
+
+DEFINE_ALEFFECT_VTABLE(ALconvolution);
@@ -47,17 +47,22 @@ static ALboolean ALdedicatedState_deviceUpdate(ALdedicatedState *UNUSED(state),
 
 static ALvoid ALdedicatedState_update(ALdedicatedState *state, const ALCdevice *device, const ALeffectslot *Slot)
 {
+    const MixParams *dry = GetEffectSlotDryOut(device, Slot);
     ALfloat Gain;
     ALuint i;
 
     for(i = 0;i < MAX_OUTPUT_CHANNELS;i++)
         state->gains[i] = 0.0f;
+    STATIC_CAST(ALeffectState,state)->OutBuffer = dry->Buffer;
+    STATIC_CAST(ALeffectState,state)->OutChannels = dry->NumChannels;
+    STATIC_CAST(ALeffectState,state)->TailLength = 0;
 
     Gain = Slot->Gain * Slot->EffectProps.Dedicated.Gain;
     if(Slot->EffectType == AL_EFFECT_DEDICATED_LOW_FREQUENCY_EFFECT)
     {
         int idx;
-        if((idx=GetChannelIdxByName(device->RealOut, LFE)) != -1)
+        /* A chained slot has no LFE channel to write to. */
+        if(!Slot->Target && (idx=GetChannelIdxByName(device->RealOut, LFE)) != -1)
         {
             STATIC_CAST(ALeffectState,state)->OutBuffer = device->RealOut.Buffer;
             STATIC_CAST(ALeffectState,state)->OutChannels = device->RealOut.NumChannels;
@@ -69,7 +74,7 @@ static ALvoid ALdedicatedState_update(ALdedicatedState *state, const ALCdevice *
         int idx;
         /* Dialog goes to the front-center speaker if it exists, otherwise it
          * plays from the front-center location. */
-        if((idx=GetChannelIdxByName(device->RealOut, FrontCenter)) != -1)
+        if(!Slot->Target && (idx=GetChannelIdxByName(device->RealOut, FrontCenter)) != -1)
         {
             STATIC_CAST(ALeffectState,state)->OutBuffer = device->RealOut.Buffer;
             STATIC_CAST(ALeffectState,state)->OutChannels = device->RealOut.NumChannels;
@@ -80,9 +85,7 @@ static ALvoid ALdedicatedState_update(ALdedicatedState *state, const ALCdevice *
             ALfloat coeffs[MAX_AMBI_COEFFS];
             CalcXYZCoeffs(0.0f, 0.0f, -1.0f, 0.0f, coeffs);
 
-            STATIC_CAST(ALeffectState,state)->OutBuffer = device->Dry.Buffer;
-            STATIC_CAST(ALeffectState,state)->OutChannels = device->Dry.NumChannels;
-            ComputePanningGains(device->Dry, coeffs, Gain, state->gains);
+            ComputePanningGains(*dry, coeffs, Gain, state->gains);
         }
     }
 }
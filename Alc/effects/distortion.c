@@ -54,6 +54,7 @@ static ALboolean ALdistortionState_deviceUpdate(ALdistortionState *UNUSED(state)
 
 static ALvoid ALdistortionState_update(ALdistortionState *state, const ALCdevice *Device, const ALeffectslot *Slot)
 {
+    const MixParams *dry = GetEffectSlotDryOut(Device, Slot);
     ALfloat frequency = (ALfloat)Device->Frequency;
     ALfloat bandwidth;
     ALfloat cutoff;
@@ -83,7 +84,14 @@ static ALvoid ALdistortionState_update(ALdistortionState *state, const ALCdevice
         cutoff / (frequency*4.0f), calc_rcpQ_from_bandwidth(cutoff / (frequency*4.0f), bandwidth)
     );
 
-    ComputeAmbientGains(Device->Dry, Slot->Gain, state->Gain);
+    /* The filters run at 4x the output rate, one after the other. */
+    STATIC_CAST(ALeffectState,state)->TailLength =
+        ALfilterState_calcTailLength(&state->lowpass)/4 +
+        ALfilterState_calcTailLength(&state->bandpass)/4 + 1;
+
+    STATIC_CAST(ALeffectState,state)->OutBuffer = dry->Buffer;
+    STATIC_CAST(ALeffectState,state)->OutChannels = dry->NumChannels;
+    ComputeAmbientGains(*dry, Slot->Gain, state->Gain);
 }
 
 static ALvoid ALdistortionState_process(ALdistortionState *state, ALuint SamplesToDo, const ALfloat (*restrict SamplesIn)[BUFFERSIZE], ALfloat (*restrict SamplesOut)[BUFFERSIZE], ALuint NumChannels)
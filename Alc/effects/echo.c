@@ -83,9 +83,11 @@ static ALboolean ALechoState_deviceUpdate(ALechoState *state, ALCdevice *Device)
 
 static ALvoid ALechoState_update(ALechoState *state, const ALCdevice *Device, const ALeffectslot *Slot)
 {
+    const MixParams *dry = GetEffectSlotDryOut(Device, Slot);
     ALuint frequency = Device->Frequency;
     ALfloat coeffs[MAX_AMBI_COEFFS];
     ALfloat gain, lrpan, spread;
+    ALfloat repeats;
 
     state->Tap[0].delay = fastf2u(Slot->EffectProps.Echo.Delay * frequency) + 1;
     state->Tap[1].delay = fastf2u(Slot->EffectProps.Echo.LRDelay * frequency);
@@ -101,20 +103,30 @@ static ALvoid ALechoState_update(ALechoState *state, const ALCdevice *Device, co
 
     state->FeedGain = Slot->EffectProps.Echo.Feedback;
 
+    /* The output continues until the fed-back echoes decay below -100dB. */
+    repeats = 0.0f;
+    if(state->FeedGain > GAIN_SILENCE_THRESHOLD)
+        repeats = ceilf(log10f(GAIN_SILENCE_THRESHOLD) / log10f(state->FeedGain));
+    STATIC_CAST(ALeffectState,state)->TailLength = fastf2u(
+        minf(state->Tap[1].delay * (repeats+1.0f), (ALfloat)(1<<30))
+    );
+
     gain = minf(1.0f - Slot->EffectProps.Echo.Damping, 0.01f);
     ALfilterState_setParams(&state->Filter, ALfilterType_HighShelf,
                             gain, LOWPASSFREQREF/frequency,
                             calc_rcpQ_from_slope(gain, 0.75f));
 
     gain = Slot->Gain;
+    STATIC_CAST(ALeffectState,state)->OutBuffer = dry->Buffer;
+    STATIC_CAST(ALeffectState,state)->OutChannels = dry->NumChannels;
 
     /* First tap panning */
     CalcXYZCoeffs(-lrpan, 0.0f, 0.0f, spread, coeffs);
-    ComputePanningGains(Device->Dry, coeffs, gain, state->Gain[0]);
+    ComputePanningGains(*dry, coeffs, gain, state->Gain[0]);
 
     /* Second tap panning */
     CalcXYZCoeffs( lrpan, 0.0f, 0.0f, spread, coeffs);
-    ComputePanningGains(Device->Dry, coeffs, gain, state->Gain[1]);
+    ComputePanningGains(*dry, coeffs, gain, state->Gain[1]);
 }
 
 static ALvoid ALechoState_process(ALechoState *state, ALuint SamplesToDo, const ALfloat (*restrict SamplesIn)[BUFFERSIZE], ALfloat (*restrict SamplesOut)[BUFFERSIZE], ALuint NumChannels)
@@ -28,6 +28,8 @@
 #include "alAuxEffectSlot.h"
 #include "alError.h"
 #include "alu.h"
+#include "mixer_defs.h"
+#include "static_assert.h"
 
 
 /*  The document  "Effects Extension Guide.pdf"  says that low and high  *
@@ -75,18 +77,34 @@
 /* The maximum number of sample frames per update. */
 #define MAX_UPDATE_SAMPLES 256
 
+/* All input channels go through the same four filters in lockstep. */
+static_assert(MAX_EFFECT_CHANNELS <= MAX_FILTER_LANES, "Too many channels for the filter lanes!");
+
 typedef struct ALequalizerState {
     DERIVE_FROM_TYPE(ALeffectState);
 
     /* Effect gains for each channel */
     ALfloat Gain[MAX_EFFECT_CHANNELS][MAX_OUTPUT_CHANNELS];
 
-    /* Effect parameters */
-    ALfilterState filter[4][MAX_EFFECT_CHANNELS];
+    /* Effect parameters, and each filter's history for the input channels. */
+    ALfilterState filter[4];
+    ALfilterLanes lanes[4];
+
+    FilterLanesFunc Filter;
 
-    ALfloat SampleBuffer[4][MAX_EFFECT_CHANNELS][MAX_UPDATE_SAMPLES];
+    alignas(16) ALfloat SampleBuffer[MAX_EFFECT_CHANNELS][MAX_UPDATE_SAMPLES];
 } ALequalizerState;
 
+static inline FilterLanesFunc SelectFilterLanes(void)
+{
+#ifdef HAVE_SSE
+    if((CPUCapFlags&CPU_CAP_SSE))
+        return FilterLanes_SSE;
+#endif
+
+    return FilterLanes_C;
+}
+
 static ALvoid ALequalizerState_Destruct(ALequalizerState *UNUSED(state))
 {
 }
@@ -100,8 +118,9 @@ static ALvoid ALequalizerState_update(ALequalizerState *state, const ALCdevice *
 {
     ALfloat frequency = (ALfloat)device->Frequency;
     ALfloat gain, freq_mult;
+    const MixParams *foa = GetEffectSlotFOAOut(device, slot);
     aluMatrixf matrix;
-    ALuint i;
+    ALuint i, tail;
 
     aluMatrixfSet(&matrix,
         1.0f, 0.0f, 0.0f, 0.0f,
@@ -110,10 +129,10 @@ static ALvoid ALequalizerState_update(ALequalizerState *state, const ALCdevice *
         0.0f, 0.0f, 0.0f, 1.0f
     );
 
-    STATIC_CAST(ALeffectState,state)->OutBuffer = device->FOAOut.Buffer;
-    STATIC_CAST(ALeffectState,state)->OutChannels = device->FOAOut.NumChannels;
+    STATIC_CAST(ALeffectState,state)->OutBuffer = foa->Buffer;
+    STATIC_CAST(ALeffectState,state)->OutChannels = foa->NumChannels;
     for(i = 0;i < MAX_EFFECT_CHANNELS;i++)
-        ComputeFirstOrderGains(device->FOAOut, matrix.m[i], slot->Gain,
+        ComputeFirstOrderGains(*foa, matrix.m[i], slot->Gain,
                                state->Gain[i]);
 
     /* Calculate coefficients for the each type of filter. Note that the shelf
@@ -122,84 +141,57 @@ static ALvoid ALequalizerState_update(ALequalizerState *state, const ALCdevice *
      */
     gain = sqrtf(slot->EffectProps.Equalizer.LowGain);
     freq_mult = slot->EffectProps.Equalizer.LowCutoff/frequency;
-    ALfilterState_setParams(&state->filter[0][0], ALfilterType_LowShelf,
+    ALfilterState_setParams(&state->filter[0], ALfilterType_LowShelf,
         gain, freq_mult, calc_rcpQ_from_slope(gain, 0.75f)
     );
-    /* Copy the filter coefficients for the other input channels. */
-    for(i = 1;i < MAX_EFFECT_CHANNELS;i++)
-    {
-        state->filter[0][i].a1 = state->filter[0][0].a1;
-        state->filter[0][i].a2 = state->filter[0][0].a2;
-        state->filter[0][i].b1 = state->filter[0][0].b1;
-        state->filter[0][i].b2 = state->filter[0][0].b2;
-        state->filter[0][i].input_gain = state->filter[0][0].input_gain;
-        state->filter[0][i].process = state->filter[0][0].process;
-    }
 
     gain = slot->EffectProps.Equalizer.Mid1Gain;
     freq_mult = slot->EffectProps.Equalizer.Mid1Center/frequency;
-    ALfilterState_setParams(&state->filter[1][0], ALfilterType_Peaking,
+    ALfilterState_setParams(&state->filter[1], ALfilterType_Peaking,
         gain, freq_mult, calc_rcpQ_from_bandwidth(freq_mult, slot->EffectProps.Equalizer.Mid1Width)
     );
-    for(i = 1;i < MAX_EFFECT_CHANNELS;i++)
-    {
-        state->filter[1][i].a1 = state->filter[1][0].a1;
-        state->filter[1][i].a2 = state->filter[1][0].a2;
-        state->filter[1][i].b1 = state->filter[1][0].b1;
-        state->filter[1][i].b2 = state->filter[1][0].b2;
-        state->filter[1][i].input_gain = state->filter[1][0].input_gain;
-        state->filter[1][i].process = state->filter[1][0].process;
-    }
 
     gain = slot->EffectProps.Equalizer.Mid2Gain;
     freq_mult = slot->EffectProps.Equalizer.Mid2Center/frequency;
-    ALfilterState_setParams(&state->filter[2][0], ALfilterType_Peaking,
+    ALfilterState_setParams(&state->filter[2], ALfilterType_Peaking,
         gain, freq_mult, calc_rcpQ_from_bandwidth(freq_mult, slot->EffectProps.Equalizer.Mid2Width)
     );
-    for(i = 1;i < MAX_EFFECT_CHANNELS;i++)
-    {
-        state->filter[2][i].a1 = state->filter[2][0].a1;
-        state->filter[2][i].a2 = state->filter[2][0].a2;
-        state->filter[2][i].b1 = state->filter[2][0].b1;
-        state->filter[2][i].b2 = state->filter[2][0].b2;
-        state->filter[2][i].input_gain = state->filter[2][0].input_gain;
-        state->filter[2][i].process = state->filter[2][0].process;
-    }
 
     gain = sqrtf(slot->EffectProps.Equalizer.HighGain);
     freq_mult = slot->EffectProps.Equalizer.HighCutoff/frequency;
-    ALfilterState_setParams(&state->filter[3][0], ALfilterType_HighShelf,
+    ALfilterState_setParams(&state->filter[3], ALfilterType_HighShelf,
         gain, freq_mult, calc_rcpQ_from_slope(gain, 0.75f)
     );
-    for(i = 1;i < MAX_EFFECT_CHANNELS;i++)
+
+    /* The four filters are in series, so their tails add up. */
+    tail = 0;
+    for(i = 0;i < 4;i++)
     {
-        state->filter[3][i].a1 = state->filter[3][0].a1;
-        state->filter[3][i].a2 = state->filter[3][0].a2;
-        state->filter[3][i].b1 = state->filter[3][0].b1;
-        state->filter[3][i].b2 = state->filter[3][0].b2;
-        state->filter[3][i].input_gain = state->filter[3][0].input_gain;
-        state->filter[3][i].process = state->filter[3][0].process;
+        ALuint len = ALfilterState_calcTailLength(&state->filter[i]);
+        tail = (len > ~0u-tail) ? ~0u : tail+len;
     }
+    STATIC_CAST(ALeffectState,state)->TailLength = tail;
 }
 
 static ALvoid ALequalizerState_process(ALequalizerState *state, ALuint SamplesToDo, const ALfloat (*restrict SamplesIn)[BUFFERSIZE], ALfloat (*restrict SamplesOut)[BUFFERSIZE], ALuint NumChannels)
 {
-    ALfloat (*Samples)[MAX_EFFECT_CHANNELS][MAX_UPDATE_SAMPLES] = state->SampleBuffer;
+    ALfloat (*Samples)[MAX_UPDATE_SAMPLES] = state->SampleBuffer;
+    const ALfloat *src[MAX_EFFECT_CHANNELS];
+    ALfloat *dst[MAX_EFFECT_CHANNELS];
     ALuint it, kt, ft;
     ALuint base;
 
+    for(ft = 0;ft < MAX_EFFECT_CHANNELS;ft++)
+        dst[ft] = Samples[ft];
+
     for(base = 0;base < SamplesToDo;)
     {
         ALuint td = minu(MAX_UPDATE_SAMPLES, SamplesToDo-base);
 
+        /* Run the input channels through the four filters in series. */
         for(ft = 0;ft < MAX_EFFECT_CHANNELS;ft++)
-            ALfilterState_process(&state->filter[0][ft], Samples[0][ft], &SamplesIn[ft][base], td);
-        for(ft = 0;ft < MAX_EFFECT_CHANNELS;ft++)
-            ALfilterState_process(&state->filter[1][ft], Samples[1][ft], Samples[0][ft], td);
-        for(ft = 0;ft < MAX_EFFECT_CHANNELS;ft++)
-            ALfilterState_process(&state->filter[2][ft], Samples[2][ft], Samples[1][ft], td);
-        for(ft = 0;ft < MAX_EFFECT_CHANNELS;ft++)
-            ALfilterState_process(&state->filter[3][ft], Samples[3][ft], Samples[2][ft], td);
+            src[ft] = &SamplesIn[ft][base];
+        state->Filter(state->filter, state->lanes, 4, MAX_EFFECT_CHANNELS, dst, src, td);
 
         for(ft = 0;ft < MAX_EFFECT_CHANNELS;ft++)
         {
@@ -210,7 +202,7 @@ static ALvoid ALequalizerState_process(ALequalizerState *state, ALuint SamplesTo
                     continue;
 
                 for(it = 0;it < td;it++)
-                    SamplesOut[kt][base+it] += gain * Samples[3][ft][it];
+                    SamplesOut[kt][base+it] += gain * Samples[ft][it];
             }
         }
 
@@ -230,7 +222,7 @@ typedef struct ALequalizerStateFactory {
 ALeffectState *ALequalizerStateFactory_create(ALequalizerStateFactory *UNUSED(factory))
 {
     ALequalizerState *state;
-    int it, ft;
+    int it;
 
     state = ALequalizerState_New(sizeof(*state));
     if(!state) return NULL;
@@ -239,10 +231,8 @@ ALeffectState *ALequalizerStateFactory_create(ALequalizerStateFactory *UNUSED(fa
     /* Initialize sample history only on filter creation to avoid */
     /* sound clicks if filter settings were changed in runtime.   */
     for(it = 0; it < 4; it++)
-    {
-        for(ft = 0;ft < MAX_EFFECT_CHANNELS;ft++)
-            ALfilterState_clear(&state->filter[it][ft]);
-    }
+        ALfilterLanes_clear(&state->lanes[it]);
+    state->Filter = SelectFilterLanes();
 
     return STATIC_CAST(ALeffectState, state);
 }
@@ -93,6 +93,7 @@ static ALboolean ALflangerState_deviceUpdate(ALflangerState *state, ALCdevice *D
 
 static ALvoid ALflangerState_update(ALflangerState *state, const ALCdevice *Device, const ALeffectslot *Slot)
 {
+    const MixParams *dry = GetEffectSlotDryOut(Device, Slot);
     ALfloat frequency = (ALfloat)Device->Frequency;
     ALfloat coeffs[MAX_AMBI_COEFFS];
     ALfloat rate;
@@ -111,11 +112,29 @@ static ALvoid ALflangerState_update(ALflangerState *state, const ALCdevice *Devi
     state->feedback = Slot->EffectProps.Flanger.Feedback;
     state->delay = fastf2i(Slot->EffectProps.Flanger.Delay * frequency);
 
+    /* The output continues until the fed-back signal decays below -100dB,
+     * going through up to the maximum modulated delay each time.
+     */
+    if(!(fabsf(state->feedback) < 1.0f))
+        STATIC_CAST(ALeffectState,state)->TailLength = ~0u;
+    else
+    {
+        ALfloat repeats = 1.0f;
+        if(fabsf(state->feedback) > GAIN_SILENCE_THRESHOLD)
+            repeats = maxf(ceilf(log10f(GAIN_SILENCE_THRESHOLD) /
+                                 log10f(fabsf(state->feedback))), 1.0f);
+        STATIC_CAST(ALeffectState,state)->TailLength = fastf2u(minf(
+            (state->delay*(1.0f + 2.0f*state->depth) + 1.0f) * repeats, (ALfloat)(1<<30)
+        ));
+    }
+
     /* Gains for left and right sides */
+    STATIC_CAST(ALeffectState,state)->OutBuffer = dry->Buffer;
+    STATIC_CAST(ALeffectState,state)->OutChannels = dry->NumChannels;
     CalcXYZCoeffs(-1.0f, 0.0f, 0.0f, 0.0f, coeffs);
-    ComputePanningGains(Device->Dry, coeffs, Slot->Gain, state->Gain[0]);
+    ComputePanningGains(*dry, coeffs, Slot->Gain, state->Gain[0]);
     CalcXYZCoeffs( 1.0f, 0.0f, 0.0f, 0.0f, coeffs);
-    ComputePanningGains(Device->Dry, coeffs, Slot->Gain, state->Gain[1]);
+    ComputePanningGains(*dry, coeffs, Slot->Gain, state->Gain[1]);
 
     phase = Slot->EffectProps.Flanger.Phase;
     rate = Slot->EffectProps.Flanger.Rate;
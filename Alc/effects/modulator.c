@@ -93,6 +93,7 @@ static ALboolean ALmodulatorState_deviceUpdate(ALmodulatorState *UNUSED(state),
 
 static ALvoid ALmodulatorState_update(ALmodulatorState *state, const ALCdevice *Device, const ALeffectslot *Slot)
 {
+    const MixParams *foa = GetEffectSlotFOAOut(Device, Slot);
     aluMatrixf matrix;
     ALfloat cw, a;
     ALuint i;
@@ -121,6 +122,8 @@ static ALvoid ALmodulatorState_update(ALmodulatorState *state, const ALCdevice *
         state->Filter[i].input_gain = a;
         state->Filter[i].process = ALfilterState_processC;
     }
+    STATIC_CAST(ALeffectState,state)->TailLength =
+        ALfilterState_calcTailLength(&state->Filter[0]);
 
     aluMatrixfSet(&matrix,
         1.0f, 0.0f, 0.0f, 0.0f,
@@ -129,10 +132,10 @@ static ALvoid ALmodulatorState_update(ALmodulatorState *state, const ALCdevice *
         0.0f, 0.0f, 0.0f, 1.0f
     );
 
-    STATIC_CAST(ALeffectState,state)->OutBuffer = Device->FOAOut.Buffer;
-    STATIC_CAST(ALeffectState,state)->OutChannels = Device->FOAOut.NumChannels;
+    STATIC_CAST(ALeffectState,state)->OutBuffer = foa->Buffer;
+    STATIC_CAST(ALeffectState,state)->OutChannels = foa->NumChannels;
     for(i = 0;i < MAX_EFFECT_CHANNELS;i++)
-        ComputeFirstOrderGains(Device->FOAOut, matrix.m[i], Slot->Gain,
+        ComputeFirstOrderGains(*foa, matrix.m[i], Slot->Gain,
                                state->Gain[i]);
 }
 
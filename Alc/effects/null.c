@@ -33,8 +33,10 @@ static ALboolean ALnullState_deviceUpdate(ALnullState* UNUSED(state), ALCdevice*
 /* This updates the effect state. This is called any time the effect is
  * (re)loaded into a slot.
  */
-static ALvoid ALnullState_update(ALnullState* UNUSED(state), const ALCdevice* UNUSED(device), const ALeffectslot* UNUSED(slot))
+static ALvoid ALnullState_update(ALnullState* state, const ALCdevice* UNUSED(device), const ALeffectslot* UNUSED(slot))
 {
+    /* Report how long the output may continue after the input goes silent. */
+    STATIC_CAST(ALeffectState,state)->TailLength = 0;
 }
 
 /* This processes the effect state, for the given number of samples from the
@@ -78,6 +80,7 @@ ALeffectState *ALnullStateFactory_create(ALnullStateFactory *UNUSED(factory))
     if(!state) return NULL;
     /* Set vtables for inherited types. */
     SET_VTABLE2(ALnullState, ALeffectState, state);
+    STATIC_CAST(ALeffectState,state)->TailLength = 0;
 
     return STATIC_CAST(ALeffectState, state);
 }
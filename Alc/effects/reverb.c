@@ -30,141 +30,10 @@
 #include "alEffect.h"
 #include "alFilter.h"
 #include "alError.h"
+#include "reverb.h"
+#include "static_assert.h"
 
 
-/* This is the maximum number of samples processed for each inner loop
- * iteration. */
-#define MAX_UPDATE_SAMPLES  256
-
-typedef struct DelayLine
-{
-    // The delay lines use sample lengths that are powers of 2 to allow the
-    // use of bit-masking instead of a modulus for wrapping.
-    ALuint   Mask;
-    ALfloat *Line;
-} DelayLine;
-
-typedef struct ALreverbState {
-    DERIVE_FROM_TYPE(ALeffectState);
-
-    ALboolean IsEax;
-    ALuint ExtraChannels; // For HRTF
-
-    // All delay lines are allocated as a single buffer to reduce memory
-    // fragmentation and management code.
-    ALfloat  *SampleBuffer;
-    ALuint    TotalSamples;
-
-    // Master effect filters
-    ALfilterState LpFilter;
-    ALfilterState HpFilter; // EAX only
-
-    struct {
-        // Modulator delay line.
-        DelayLine Delay;
-
-        // The vibrato time is tracked with an index over a modulus-wrapped
-        // range (in samples).
-        ALuint    Index;
-        ALuint    Range;
-
-        // The depth of frequency change (also in samples) and its filter.
-        ALfloat   Depth;
-        ALfloat   Coeff;
-        ALfloat   Filter;
-    } Mod; // EAX only
-
-    // Initial effect delay.
-    DelayLine Delay;
-    // The tap points for the initial delay.  First tap goes to early
-    // reflections, the last to late reverb.
-    ALuint    DelayTap[2];
-
-    struct {
-        // Early reflections are done with 4 delay lines.
-        ALfloat   Coeff[4];
-        DelayLine Delay[4];
-        ALuint    Offset[4];
-
-        // The gain for each output channel based on 3D panning.
-        // NOTE: With certain output modes, we may be rendering to the dry
-        // buffer and the "real" buffer. The two combined may be using more
-        // than the max output channels, so we need some extra for the real
-        // output too.
-        ALfloat PanGain[4][MAX_OUTPUT_CHANNELS*2];
-    } Early;
-
-    // Decorrelator delay line.
-    DelayLine Decorrelator;
-    // There are actually 4 decorrelator taps, but the first occurs at the
-    // initial sample.
-    ALuint    DecoTap[3];
-
-    struct {
-        // Output gain for late reverb.
-        ALfloat   Gain;
-
-        // Attenuation to compensate for the modal density and decay rate of
-        // the late lines.
-        ALfloat   DensityGain;
-
-        // The feed-back and feed-forward all-pass coefficient.
-        ALfloat   ApFeedCoeff;
-
-        // Mixing matrix coefficient.
-        ALfloat   MixCoeff;
-
-        // Late reverb has 4 parallel all-pass filters.
-        ALfloat   ApCoeff[4];
-        DelayLine ApDelay[4];
-        ALuint    ApOffset[4];
-
-        // In addition to 4 cyclical delay lines.
-        ALfloat   Coeff[4];
-        DelayLine Delay[4];
-        ALuint    Offset[4];
-
-        // The cyclical delay lines are 1-pole low-pass filtered.
-        ALfloat   LpCoeff[4];
-        ALfloat   LpSample[4];
-
-        // The gain for each output channel based on 3D panning.
-        // NOTE: Add some extra in case (see note about early pan).
-        ALfloat PanGain[4][MAX_OUTPUT_CHANNELS*2];
-    } Late;
-
-    struct {
-        // Attenuation to compensate for the modal density and decay rate of
-        // the echo line.
-        ALfloat   DensityGain;
-
-        // Echo delay and all-pass lines.
-        DelayLine Delay;
-        DelayLine ApDelay;
-
-        ALfloat   Coeff;
-        ALfloat   ApFeedCoeff;
-        ALfloat   ApCoeff;
-
-        ALuint    Offset;
-        ALuint    ApOffset;
-
-        // The echo line is 1-pole low-pass filtered.
-        ALfloat   LpCoeff;
-        ALfloat   LpSample;
-
-        // Echo mixing coefficient.
-        ALfloat   MixCoeff;
-    } Echo; // EAX only
-
-    // The current read offset for all delay lines.
-    ALuint Offset;
-
-    /* Temporary storage used when processing. */
-    ALfloat ReverbSamples[MAX_UPDATE_SAMPLES][4];
-    ALfloat EarlySamples[MAX_UPDATE_SAMPLES][4];
-} ALreverbState;
-
 static ALvoid ALreverbState_Destruct(ALreverbState *State)
 {
     free(State->SampleBuffer);
@@ -173,13 +42,16 @@ static ALvoid ALreverbState_Destruct(ALreverbState *State)
 
 static ALboolean ALreverbState_deviceUpdate(ALreverbState *State, ALCdevice *Device);
 static ALvoid ALreverbState_update(ALreverbState *State, const ALCdevice *Device, const ALeffectslot *Slot);
-static ALvoid ALreverbState_processStandard(ALreverbState *State, ALuint SamplesToDo, const ALfloat *restrict SamplesIn, ALfloat (*restrict SamplesOut)[BUFFERSIZE], ALuint NumChannels);
-static ALvoid ALreverbState_processEax(ALreverbState *State, ALuint SamplesToDo, const ALfloat *restrict SamplesIn, ALfloat (*restrict SamplesOut)[BUFFERSIZE], ALuint NumChannels);
+static ALvoid ALreverbState_processStandard(ALreverbState *State, const ReverbParams *params, ALuint SamplesToDo, const ALfloat *restrict SamplesIn, ALfloat (*restrict SamplesOut)[BUFFERSIZE], ALuint NumChannels);
+static ALvoid ALreverbState_processEax(ALreverbState *State, const ReverbParams *params, ALuint SamplesToDo, const ALfloat *restrict SamplesIn, ALfloat (*restrict SamplesOut)[BUFFERSIZE], ALuint NumChannels);
 static ALvoid ALreverbState_process(ALreverbState *State, ALuint SamplesToDo, const ALfloat (*restrict SamplesIn)[BUFFERSIZE], ALfloat (*restrict SamplesOut)[BUFFERSIZE], ALuint NumChannels);
 DECLARE_DEFAULT_ALLOCATORS(ALreverbState)
 
 DEFINE_ALEFFECTSTATE_VTABLE(ALreverbState);
 
+extern inline ALfloat DelayLineOut(DelayLine *Delay, ALuint offset);
+extern inline ALvoid DelayLineIn(DelayLine *Delay, ALuint offset, ALfloat in);
+
 /* This is a user config option for modifying the overall output of the reverb
  * effect.
  */
@@ -284,10 +156,11 @@ static ALuint CalcLineLength(ALfloat length, ptrdiff_t offset, ALuint frequency,
 }
 
 /* Calculates the delay line metrics and allocates the shared sample buffer
- * for all lines given the sample rate (frequency).  If an allocation failure
+ * for all lines given the sample rate (frequency), and the reduced rate used
+ * by the late reverb and echo lines (lateFrequency).  If an allocation failure
  * occurs, it returns AL_FALSE.
  */
-static ALboolean AllocLines(ALuint frequency, ALreverbState *State)
+static ALboolean AllocLines(ALuint frequency, ALuint lateFrequency, ALreverbState *State)
 {
     ALuint totalSamples, index;
     ALfloat length;
@@ -308,11 +181,12 @@ static ALboolean AllocLines(ALuint frequency, ALreverbState *State)
 
     // The initial delay is the sum of the reflections and late reverb
     // delays. This must include space for storing a loop update to feed the
-    // early reflections, decorrelator, and echo.
+    // early reflections, decorrelator, and echo, along with the history
+    // needed by the late reverb decimator.
     length = AL_EAXREVERB_MAX_REFLECTIONS_DELAY +
              AL_EAXREVERB_MAX_LATE_REVERB_DELAY;
     totalSamples += CalcLineLength(length, totalSamples, frequency,
-                                   MAX_UPDATE_SAMPLES, &State->Delay);
+        MAX_UPDATE_SAMPLES + MAX_LATE_DECIMATION*LATE_DECIM_TAPS, &State->Delay);
 
     // The early reflection lines.
     for(index = 0;index < 4;index++)
@@ -324,27 +198,27 @@ static ALboolean AllocLines(ALuint frequency, ALreverbState *State)
     // to feed the late reverb.
     length = (DECO_FRACTION * DECO_MULTIPLIER * DECO_MULTIPLIER) *
              LATE_LINE_LENGTH[0] * (1.0f + LATE_LINE_MULTIPLIER);
-    totalSamples += CalcLineLength(length, totalSamples, frequency, MAX_UPDATE_SAMPLES,
+    totalSamples += CalcLineLength(length, totalSamples, lateFrequency, MAX_UPDATE_SAMPLES,
                                    &State->Decorrelator);
 
     // The late all-pass lines.
     for(index = 0;index < 4;index++)
         totalSamples += CalcLineLength(ALLPASS_LINE_LENGTH[index], totalSamples,
-                                       frequency, 0, &State->Late.ApDelay[index]);
+                                       lateFrequency, 0, &State->Late.ApDelay[index]);
 
     // The late delay lines are calculated from the lowest reverb density.
     for(index = 0;index < 4;index++)
     {
         length = LATE_LINE_LENGTH[index] * (1.0f + LATE_LINE_MULTIPLIER);
-        totalSamples += CalcLineLength(length, totalSamples, frequency, 0,
+        totalSamples += CalcLineLength(length, totalSamples, lateFrequency, 0,
                                        &State->Late.Delay[index]);
     }
 
     // The echo all-pass and delay lines.
     totalSamples += CalcLineLength(ECHO_ALLPASS_LENGTH, totalSamples,
-                                   frequency, 0, &State->Echo.ApDelay);
+                                   lateFrequency, 0, &State->Echo.ApDelay);
     totalSamples += CalcLineLength(AL_EAXREVERB_MAX_ECHO_TIME, totalSamples,
-                                   frequency, 0, &State->Echo.Delay);
+                                   lateFrequency, 0, &State->Echo.Delay);
 
     if(totalSamples != State->TotalSamples)
     {
@@ -376,21 +250,73 @@ static ALboolean AllocLines(ALuint frequency, ALreverbState *State)
     return AL_TRUE;
 }
 
+/* Builds the low-pass prototype used to decimate and interpolate the late
+ * reverb.  This is a Blackman-windowed sinc with its cutoff at the reduced
+ * Nyquist frequency, normalized for unity gain at DC.  Using an odd length
+ * keeps the sinc's zero crossings on every factor'th tap, so one of the
+ * interpolator's phases simply passes the reduced-rate samples through.  The
+ * last coefficient is left as 0 to pad it out to the full tap count.
+ */
+static ALvoid InitLateDecimator(ALuint factor, ALreverbState *State)
+{
+    const ALuint count = factor*LATE_DECIM_TAPS - 1;
+    const ALuint center = (count-1) / 2;
+    ALfloat sum = 0.0f;
+    ALuint i;
+
+    State->Decim.Factor = factor;
+    if(factor == 1)
+        return;
+
+    for(i = 0;i < count;i++)
+    {
+        ALfloat x = (ALfloat)((ALint)i - (ALint)center) / (ALfloat)factor * F_PI;
+        ALfloat w = (ALfloat)(i+1) / (ALfloat)(count+1);
+        w = 0.42f - 0.5f*cosf(F_TAU*w) + 0.08f*cosf(2.0f*F_TAU*w);
+        State->Decim.Coeffs[i] = (i == center) ? w : (w * sinf(x)/x);
+        sum += State->Decim.Coeffs[i];
+    }
+    for(i = 0;i < count;i++)
+        State->Decim.Coeffs[i] /= sum;
+    State->Decim.Coeffs[count] = 0.0f;
+
+    // Each interpolator phase gets every factor'th tap, ordered from oldest
+    // to newest input and scaled to restore the gain lost to zero-stuffing.
+    for(i = 0;i < factor;i++)
+    {
+        ALuint k;
+        for(k = 0;k < LATE_DECIM_TAPS;k++)
+            State->Decim.InterpCoeffs[i][k] =
+                State->Decim.Coeffs[i + (LATE_DECIM_TAPS-1-k)*factor] * factor;
+    }
+}
+
 static ALboolean ALreverbState_deviceUpdate(ALreverbState *State, ALCdevice *Device)
 {
     ALuint frequency = Device->Frequency, index;
+    ALuint factor = 1, lateFrequency;
+
+    /* The late reverb may run at a reduced rate to save processing time. */
+    if(ConfigValueUInt(al_string_get_cstr(Device->DeviceName), "reverb", "late-decimation", &factor))
+    {
+        if(factor != 1 && factor != 2 && factor != MAX_LATE_DECIMATION)
+        {
+            ERR("Invalid late-decimation value: %u\n", factor);
+            factor = 1;
+        }
+    }
+    InitLateDecimator(factor, State);
+    lateFrequency = frequency / factor;
 
     // Allocate the delay lines.
-    if(!AllocLines(frequency, State))
+    if(!AllocLines(frequency, lateFrequency, State))
         return AL_FALSE;
 
-    /* WARNING: This assumes the real output follows the virtual output in the
-     * device's DryBuffer.
-     */
-    if(Device->Hrtf || Device->Uhj_Encoder)
-        State->ExtraChannels = ChannelsFromDevFmt(Device->FmtChans);
-    else
-        State->ExtraChannels = 0;
+    memset(State->Decim.Output, 0, sizeof(State->Decim.Output));
+
+    // The output channels may have changed, so fade in from silence.
+    memset(State->Early.CurrentGain, 0, sizeof(State->Early.CurrentGain));
+    memset(State->Late.CurrentGain, 0, sizeof(State->Late.CurrentGain));
 
     // Calculate the modulation filter coefficient.  Notice that the exponent
     // is calculated given the current sample rate.  This ensures that the
@@ -404,12 +330,12 @@ static ALboolean ALreverbState_deviceUpdate(ALreverbState *State, ALCdevice *Dev
     for(index = 0;index < 4;index++)
     {
         State->Early.Offset[index] = fastf2u(EARLY_LINE_LENGTH[index] * frequency);
-        State->Late.ApOffset[index] = fastf2u(ALLPASS_LINE_LENGTH[index] * frequency);
+        State->Late.ApOffset[index] = fastf2u(ALLPASS_LINE_LENGTH[index] * lateFrequency);
     }
 
     // The echo all-pass filter line length is static, so its offset only
     // needs to be calculated once.
-    State->Echo.ApOffset = fastf2u(ECHO_ALLPASS_LENGTH * frequency);
+    State->Echo.ApOffset = fastf2u(ECHO_ALLPASS_LENGTH * lateFrequency);
 
     return AL_TRUE;
 }
@@ -519,10 +445,10 @@ static inline ALfloat CalcDampingCoeff(ALfloat hfRatio, ALfloat length, ALfloat
     return coeff;
 }
 
-// Update the EAX modulation index, range, and depth.  Keep in mind that this
+// Update the EAX modulation range and depth.  Keep in mind that this
 // kind of vibrato is additive and not multiplicative as one may expect.  The
 // downswing will sound stronger than the upswing.
-static ALvoid UpdateModulator(ALfloat modTime, ALfloat modDepth, ALuint frequency, ALreverbState *State)
+static ALvoid UpdateModulator(ALfloat modTime, ALfloat modDepth, ALuint frequency, ReverbParams *Params)
 {
     ALuint range;
 
@@ -531,13 +457,11 @@ static ALvoid UpdateModulator(ALfloat modTime, ALfloat modDepth, ALuint frequenc
      * The modulation time effects the sinus applied to the change in
      * frequency.  An index out of the current time range (both in samples)
      * is incremented each sample.  The range is bound to a reasonable
-     * minimum (1 sample) and when the timing changes, the index is rescaled
-     * to the new range (to keep the sinus consistent).
+     * minimum (1 sample) and when the timing changes, the mixer rescales the
+     * index to the new range (to keep the sinus consistent).
      */
     range = maxu(fastf2u(modTime*frequency), 1);
-    State->Mod.Index = (ALuint)(State->Mod.Index * (ALuint64)range /
-                                State->Mod.Range);
-    State->Mod.Range = range;
+    Params->Mod.Range = range;
 
     /* The modulation depth effects the amount of frequency change over the
      * range of the sinus.  It needs to be scaled by the modulation time so
@@ -547,20 +471,26 @@ static ALvoid UpdateModulator(ALfloat modTime, ALfloat modDepth, ALuint frequenc
      * in time (half of it is spent decreasing the frequency, half is spent
      * increasing it).
      */
-    State->Mod.Depth = modDepth * MODULATION_DEPTH_COEFF * modTime / 2.0f /
-                       2.0f * frequency;
+    Params->Mod.Depth = modDepth * MODULATION_DEPTH_COEFF * modTime / 2.0f /
+                        2.0f * frequency;
 }
 
 // Update the offsets for the initial effect delay line.
-static ALvoid UpdateDelayLine(ALfloat earlyDelay, ALfloat lateDelay, ALuint frequency, ALreverbState *State)
+static ALvoid UpdateDelayLine(ALfloat earlyDelay, ALfloat lateDelay, ALuint frequency, ALuint decimFactor, ReverbParams *Params)
 {
     // Calculate the initial delay taps.
-    State->DelayTap[0] = fastf2u(earlyDelay * frequency);
-    State->DelayTap[1] = fastf2u((earlyDelay + lateDelay) * frequency);
+    Params->DelayTap[0] = fastf2u(earlyDelay * frequency);
+    Params->DelayTap[1] = fastf2u((earlyDelay + lateDelay) * frequency);
+
+    // When decimating, tap the late reverb input earlier to make up for the
+    // delay of the decimation and interpolation filters.
+    if(decimFactor > 1)
+        Params->DelayTap[1] -= minu(Params->DelayTap[1],
+                                    decimFactor*LATE_DECIM_TAPS - 1);
 }
 
 // Update the early reflections mix and line coefficients.
-static ALvoid UpdateEarlyLines(ALfloat lateDelay, ALreverbState *State)
+static ALvoid UpdateEarlyLines(ALfloat lateDelay, ReverbParams *Params)
 {
     ALuint index;
 
@@ -568,12 +498,12 @@ static ALvoid UpdateEarlyLines(ALfloat lateDelay, ALreverbState *State)
     // late delay time.  This expands the early reflections to the start of
     // the late reverb.
     for(index = 0;index < 4;index++)
-        State->Early.Coeff[index] = CalcDecayCoeff(EARLY_LINE_LENGTH[index],
-                                                   lateDelay);
+        Params->Early.Coeff[index] = CalcDecayCoeff(EARLY_LINE_LENGTH[index],
+                                                    lateDelay);
 }
 
 // Update the offsets for the decorrelator line.
-static ALvoid UpdateDecorrelator(ALfloat density, ALuint frequency, ALreverbState *State)
+static ALvoid UpdateDecorrelator(ALfloat density, ALuint frequency, ReverbParams *Params)
 {
     ALuint index;
     ALfloat length;
@@ -589,12 +519,12 @@ static ALvoid UpdateDecorrelator(ALfloat density, ALuint frequency, ALreverbStat
     {
         length = (DECO_FRACTION * powf(DECO_MULTIPLIER, (ALfloat)index)) *
                  LATE_LINE_LENGTH[0] * (1.0f + (density * LATE_LINE_MULTIPLIER));
-        State->DecoTap[index] = fastf2u(length * frequency);
+        Params->DecoTap[index] = fastf2u(length * frequency);
     }
 }
 
 // Update the late reverb mix, line lengths, and line coefficients.
-static ALvoid UpdateLateLines(ALfloat xMix, ALfloat density, ALfloat decayTime, ALfloat diffusion, ALfloat echoDepth, ALfloat hfRatio, ALfloat cw, ALuint frequency, ALreverbState *State)
+static ALvoid UpdateLateLines(ALfloat xMix, ALfloat density, ALfloat decayTime, ALfloat diffusion, ALfloat echoDepth, ALfloat hfRatio, ALfloat cw, ALuint frequency, ReverbParams *Params)
 {
     ALfloat length;
     ALuint index;
@@ -606,7 +536,7 @@ static ALvoid UpdateLateLines(ALfloat xMix, ALfloat density, ALfloat decayTime,
      * echo is slightly stronger than the decorrelated echos in the reverb
      * tail.
      */
-    State->Late.Gain = xMix * (1.0f - (echoDepth*0.5f*(1.0f - diffusion)));
+    Params->Late.Gain = xMix * (1.0f - (echoDepth*0.5f*(1.0f - diffusion)));
 
     /* To compensate for changes in modal density and decay time of the late
      * reverb signal, the input is attenuated based on the maximal energy of
@@ -619,17 +549,17 @@ static ALvoid UpdateLateLines(ALfloat xMix, ALfloat density, ALfloat decayTime,
     length = (LATE_LINE_LENGTH[0] + LATE_LINE_LENGTH[1] +
               LATE_LINE_LENGTH[2] + LATE_LINE_LENGTH[3]) / 4.0f;
     length *= 1.0f + (density * LATE_LINE_MULTIPLIER);
-    State->Late.DensityGain = CalcDensityGain(
+    Params->Late.DensityGain = CalcDensityGain(
         CalcDecayCoeff(length, decayTime)
     );
 
     // Calculate the all-pass feed-back and feed-forward coefficient.
-    State->Late.ApFeedCoeff = 0.5f * powf(diffusion, 2.0f);
+    Params->Late.ApFeedCoeff = 0.5f * powf(diffusion, 2.0f);
 
     for(index = 0;index < 4;index++)
     {
         // Calculate the gain (coefficient) for each all-pass line.
-        State->Late.ApCoeff[index] = CalcDecayCoeff(
+        Params->Late.ApCoeff[index] = CalcDecayCoeff(
             ALLPASS_LINE_LENGTH[index], decayTime
         );
 
@@ -638,54 +568,54 @@ static ALvoid UpdateLateLines(ALfloat xMix, ALfloat density, ALfloat decayTime,
                  (1.0f + (density * LATE_LINE_MULTIPLIER));
 
         // Calculate the delay offset for each cyclical delay line.
-        State->Late.Offset[index] = fastf2u(length * frequency);
+        Params->Late.Offset[index] = fastf2u(length * frequency);
 
         // Calculate the gain (coefficient) for each cyclical line.
-        State->Late.Coeff[index] = CalcDecayCoeff(length, decayTime);
+        Params->Late.Coeff[index] = CalcDecayCoeff(length, decayTime);
 
         // Calculate the damping coefficient for each low-pass filter.
-        State->Late.LpCoeff[index] = CalcDampingCoeff(
-            hfRatio, length, decayTime, State->Late.Coeff[index], cw
+        Params->Late.LpCoeff[index] = CalcDampingCoeff(
+            hfRatio, length, decayTime, Params->Late.Coeff[index], cw
         );
 
         // Attenuate the cyclical line coefficients by the mixing coefficient
         // (x).
-        State->Late.Coeff[index] *= xMix;
+        Params->Late.Coeff[index] *= xMix;
     }
 }
 
 // Update the echo gain, line offset, line coefficients, and mixing
 // coefficients.
-static ALvoid UpdateEchoLine(ALfloat echoTime, ALfloat decayTime, ALfloat diffusion, ALfloat echoDepth, ALfloat hfRatio, ALfloat cw, ALuint frequency, ALreverbState *State)
+static ALvoid UpdateEchoLine(ALfloat echoTime, ALfloat decayTime, ALfloat diffusion, ALfloat echoDepth, ALfloat hfRatio, ALfloat cw, ALuint frequency, ReverbParams *Params)
 {
     // Update the offset and coefficient for the echo delay line.
-    State->Echo.Offset = fastf2u(echoTime * frequency);
+    Params->Echo.Offset = fastf2u(echoTime * frequency);
 
     // Calculate the decay coefficient for the echo line.
-    State->Echo.Coeff = CalcDecayCoeff(echoTime, decayTime);
+    Params->Echo.Coeff = CalcDecayCoeff(echoTime, decayTime);
 
     // Calculate the energy-based attenuation coefficient for the echo delay
     // line.
-    State->Echo.DensityGain = CalcDensityGain(State->Echo.Coeff);
+    Params->Echo.DensityGain = CalcDensityGain(Params->Echo.Coeff);
 
     // Calculate the echo all-pass feed coefficient.
-    State->Echo.ApFeedCoeff = 0.5f * powf(diffusion, 2.0f);
+    Params->Echo.ApFeedCoeff = 0.5f * powf(diffusion, 2.0f);
 
     // Calculate the echo all-pass attenuation coefficient.
-    State->Echo.ApCoeff = CalcDecayCoeff(ECHO_ALLPASS_LENGTH, decayTime);
+    Params->Echo.ApCoeff = CalcDecayCoeff(ECHO_ALLPASS_LENGTH, decayTime);
 
     // Calculate the damping coefficient for each low-pass filter.
-    State->Echo.LpCoeff = CalcDampingCoeff(hfRatio, echoTime, decayTime,
-                                           State->Echo.Coeff, cw);
+    Params->Echo.LpCoeff = CalcDampingCoeff(hfRatio, echoTime, decayTime,
+                                            Params->Echo.Coeff, cw);
 
     /* Calculate the echo mixing coefficient. This is applied to the output mix
      * only, not the feedback.
      */
-    State->Echo.MixCoeff = echoDepth;
+    Params->Echo.MixCoeff = echoDepth;
 }
 
 // Update the early and late 3D panning gains.
-static ALvoid UpdateMixedPanning(const ALCdevice *Device, const ALfloat *ReflectionsPan, const ALfloat *LateReverbPan, ALfloat Gain, ALfloat EarlyGain, ALfloat LateGain, ALreverbState *State)
+static ALvoid UpdateMixedPanning(const ALCdevice *Device, const ALfloat *ReflectionsPan, const ALfloat *LateReverbPan, ALfloat Gain, ALfloat EarlyGain, ALfloat LateGain, ReverbParams *Params)
 {
     ALfloat DirGains[MAX_OUTPUT_CHANNELS];
     ALfloat coeffs[MAX_AMBI_COEFFS];
@@ -699,12 +629,12 @@ static ALvoid UpdateMixedPanning(const ALCdevice *Device, const ALfloat *Reflect
      * WARNING: This assumes the real output follows the virtual output in the
      * device's DryBuffer.
      */
-    memset(State->Early.PanGain, 0, sizeof(State->Early.PanGain));
+    memset(Params->Early.PanGain, 0, sizeof(Params->Early.PanGain));
     length = sqrtf(ReflectionsPan[0]*ReflectionsPan[0] + ReflectionsPan[1]*ReflectionsPan[1] + ReflectionsPan[2]*ReflectionsPan[2]);
     if(!(length > FLT_EPSILON))
     {
         for(i = 0;i < Device->RealOut.NumChannels;i++)
-            State->Early.PanGain[i&3][Device->Dry.NumChannels+i] = Gain * EarlyGain;
+            Params->Early.PanGain[i&3][Device->Dry.NumChannels+i] = Gain * EarlyGain;
     }
     else
     {
@@ -722,17 +652,17 @@ static ALvoid UpdateMixedPanning(const ALCdevice *Device, const ALfloat *Reflect
         CalcDirectionCoeffs(pan, 0.0f, coeffs);
         ComputePanningGains(Device->Dry, coeffs, Gain, DirGains);
         for(i = 0;i < Device->Dry.NumChannels;i++)
-            State->Early.PanGain[3][i] = DirGains[i] * EarlyGain * length;
+            Params->Early.PanGain[3][i] = DirGains[i] * EarlyGain * length;
         for(i = 0;i < Device->RealOut.NumChannels;i++)
-            State->Early.PanGain[i&3][Device->Dry.NumChannels+i] = Gain * EarlyGain * (1.0f-length);
+            Params->Early.PanGain[i&3][Device->Dry.NumChannels+i] = Gain * EarlyGain * (1.0f-length);
     }
 
-    memset(State->Late.PanGain, 0, sizeof(State->Late.PanGain));
+    memset(Params->Late.PanGain, 0, sizeof(Params->Late.PanGain));
     length = sqrtf(LateReverbPan[0]*LateReverbPan[0] + LateReverbPan[1]*LateReverbPan[1] + LateReverbPan[2]*LateReverbPan[2]);
     if(!(length > FLT_EPSILON))
     {
         for(i = 0;i < Device->RealOut.NumChannels;i++)
-            State->Late.PanGain[i&3][Device->Dry.NumChannels+i] = Gain * LateGain;
+            Params->Late.PanGain[i&3][Device->Dry.NumChannels+i] = Gain * LateGain;
     }
     else
     {
@@ -746,13 +676,13 @@ static ALvoid UpdateMixedPanning(const ALCdevice *Device, const ALfloat *Reflect
         CalcDirectionCoeffs(pan, 0.0f, coeffs);
         ComputePanningGains(Device->Dry, coeffs, Gain, DirGains);
         for(i = 0;i < Device->Dry.NumChannels;i++)
-            State->Late.PanGain[3][i] = DirGains[i] * LateGain * length;
+            Params->Late.PanGain[3][i] = DirGains[i] * LateGain * length;
         for(i = 0;i < Device->RealOut.NumChannels;i++)
-            State->Late.PanGain[i&3][Device->Dry.NumChannels+i] = Gain * LateGain * (1.0f-length);
+            Params->Late.PanGain[i&3][Device->Dry.NumChannels+i] = Gain * LateGain * (1.0f-length);
     }
 }
 
-static ALvoid UpdateDirectPanning(const ALCdevice *Device, const ALfloat *ReflectionsPan, const ALfloat *LateReverbPan, ALfloat Gain, ALfloat EarlyGain, ALfloat LateGain, ALreverbState *State)
+static ALvoid UpdateDirectPanning(const ALCdevice *Device, const ALfloat *ReflectionsPan, const ALfloat *LateReverbPan, ALfloat Gain, ALfloat EarlyGain, ALfloat LateGain, ReverbParams *Params)
 {
     ALfloat AmbientGains[MAX_OUTPUT_CHANNELS];
     ALfloat DirGains[MAX_OUTPUT_CHANNELS];
@@ -763,12 +693,12 @@ static ALvoid UpdateDirectPanning(const ALCdevice *Device, const ALfloat *Reflec
     /* Apply a boost of about 3dB to better match the expected stereo output volume. */
     ComputeAmbientGains(Device->Dry, Gain*1.414213562f, AmbientGains);
 
-    memset(State->Early.PanGain, 0, sizeof(State->Early.PanGain));
+    memset(Params->Early.PanGain, 0, sizeof(Params->Early.PanGain));
     length = sqrtf(ReflectionsPan[0]*ReflectionsPan[0] + ReflectionsPan[1]*ReflectionsPan[1] + ReflectionsPan[2]*ReflectionsPan[2]);
     if(!(length > FLT_EPSILON))
     {
         for(i = 0;i < Device->Dry.NumChannels;i++)
-            State->Early.PanGain[i&3][i] = AmbientGains[i] * EarlyGain;
+            Params->Early.PanGain[i&3][i] = AmbientGains[i] * EarlyGain;
     }
     else
     {
@@ -786,15 +716,15 @@ static ALvoid UpdateDirectPanning(const ALCdevice *Device, const ALfloat *Reflec
         CalcDirectionCoeffs(pan, 0.0f, coeffs);
         ComputePanningGains(Device->Dry, coeffs, Gain, DirGains);
         for(i = 0;i < Device->Dry.NumChannels;i++)
-            State->Early.PanGain[i&3][i] = lerp(AmbientGains[i], DirGains[i], length) * EarlyGain;
+            Params->Early.PanGain[i&3][i] = lerp(AmbientGains[i], DirGains[i], length) * EarlyGain;
     }
 
-    memset(State->Late.PanGain, 0, sizeof(State->Late.PanGain));
+    memset(Params->Late.PanGain, 0, sizeof(Params->Late.PanGain));
     length = sqrtf(LateReverbPan[0]*LateReverbPan[0] + LateReverbPan[1]*LateReverbPan[1] + LateReverbPan[2]*LateReverbPan[2]);
     if(!(length > FLT_EPSILON))
     {
         for(i = 0;i < Device->Dry.NumChannels;i++)
-            State->Late.PanGain[i&3][i] = AmbientGains[i] * LateGain;
+            Params->Late.PanGain[i&3][i] = AmbientGains[i] * LateGain;
     }
     else
     {
@@ -808,11 +738,11 @@ static ALvoid UpdateDirectPanning(const ALCdevice *Device, const ALfloat *Reflec
         CalcDirectionCoeffs(pan, 0.0f, coeffs);
         ComputePanningGains(Device->Dry, coeffs, Gain, DirGains);
         for(i = 0;i < Device->Dry.NumChannels;i++)
-            State->Late.PanGain[i&3][i] = lerp(AmbientGains[i], DirGains[i], length) * LateGain;
+            Params->Late.PanGain[i&3][i] = lerp(AmbientGains[i], DirGains[i], length) * LateGain;
     }
 }
 
-static ALvoid Update3DPanning(const ALCdevice *Device, const ALfloat *ReflectionsPan, const ALfloat *LateReverbPan, ALfloat Gain, ALfloat EarlyGain, ALfloat LateGain, ALreverbState *State)
+static ALvoid Update3DPanning(const MixParams *Dry, const ALfloat *ReflectionsPan, const ALfloat *LateReverbPan, ALfloat Gain, ALfloat EarlyGain, ALfloat LateGain, ReverbParams *Params)
 {
     static const ALfloat PanDirs[4][3] = {
         { -0.707106781f, 0.0f, -0.707106781f }, /* Front left */
@@ -856,8 +786,8 @@ static ALvoid Update3DPanning(const ALCdevice *Device, const ALfloat *Reflection
     for(i = 0;i < 4;i++)
     {
         CalcDirectionCoeffs(PanDirs[i], 0.0f, coeffs);
-        ComputePanningGains(Device->Dry, coeffs, Gain*EarlyGain*gain[i],
-                            State->Early.PanGain[i]);
+        ComputePanningGains(*Dry, coeffs, Gain*EarlyGain*gain[i],
+                            Params->Early.PanGain[i]);
     }
 
     gain[0] = gain[1] = gain[2] = gain[3] = 0.5f;
@@ -887,52 +817,56 @@ static ALvoid Update3DPanning(const ALCdevice *Device, const ALfloat *Reflection
     for(i = 0;i < 4;i++)
     {
         CalcDirectionCoeffs(PanDirs[i], 0.0f, coeffs);
-        ComputePanningGains(Device->Dry, coeffs, Gain*LateGain*gain[i],
-                            State->Late.PanGain[i]);
+        ComputePanningGains(*Dry, coeffs, Gain*LateGain*gain[i],
+                            Params->Late.PanGain[i]);
     }
 }
 
 static ALvoid ALreverbState_update(ALreverbState *State, const ALCdevice *Device, const ALeffectslot *Slot)
 {
     const ALeffectProps *props = &Slot->EffectProps;
+    const MixParams *dry = GetEffectSlotDryOut(Device, Slot);
+    ReverbParams *params = &State->Params[State->NextParams];
     ALuint frequency = Device->Frequency;
+    ALuint lateFrequency = frequency / State->Decim.Factor;
     ALfloat lfscale, hfscale, hfRatio;
     ALfloat gain, gainlf, gainhf;
     ALfloat cw, x, y;
+    ALuint outChannels, idx;
 
     if(Slot->EffectType == AL_EFFECT_EAXREVERB && !EmulateEAXReverb)
-        State->IsEax = AL_TRUE;
+        params->IsEax = AL_TRUE;
     else if(Slot->EffectType == AL_EFFECT_REVERB || EmulateEAXReverb)
-        State->IsEax = AL_FALSE;
+        params->IsEax = AL_FALSE;
 
     // Calculate the master filters
     hfscale = props->Reverb.HFReference / frequency;
     gainhf = maxf(props->Reverb.GainHF, 0.0001f);
-    ALfilterState_setParams(&State->LpFilter, ALfilterType_HighShelf,
+    ALfilterState_setParams(&params->LpFilter, ALfilterType_HighShelf,
                             gainhf, hfscale, calc_rcpQ_from_slope(gainhf, 0.75f));
     lfscale = props->Reverb.LFReference / frequency;
     gainlf = maxf(props->Reverb.GainLF, 0.0001f);
-    ALfilterState_setParams(&State->HpFilter, ALfilterType_LowShelf,
+    ALfilterState_setParams(&params->HpFilter, ALfilterType_LowShelf,
                             gainlf, lfscale, calc_rcpQ_from_slope(gainlf, 0.75f));
 
     // Update the modulator line.
     UpdateModulator(props->Reverb.ModulationTime, props->Reverb.ModulationDepth,
-                    frequency, State);
+                    frequency, params);
 
     // Update the initial effect delay.
     UpdateDelayLine(props->Reverb.ReflectionsDelay, props->Reverb.LateReverbDelay,
-                    frequency, State);
+                    frequency, State->Decim.Factor, params);
 
     // Update the early lines.
-    UpdateEarlyLines(props->Reverb.LateReverbDelay, State);
+    UpdateEarlyLines(props->Reverb.LateReverbDelay, params);
 
     // Update the decorrelator.
-    UpdateDecorrelator(props->Reverb.Density, frequency, State);
+    UpdateDecorrelator(props->Reverb.Density, lateFrequency, params);
 
     // Get the mixing matrix coefficients (x and y).
     CalcMatrixCoeffs(props->Reverb.Diffusion, &x, &y);
     // Then divide x into y to simplify the matrix calculation.
-    State->Late.MixCoeff = y / x;
+    params->Late.MixCoeff = y / x;
 
     // If the HF limit parameter is flagged, calculate an appropriate limit
     // based on the air absorption parameter.
@@ -941,34 +875,79 @@ static ALvoid ALreverbState_update(ALreverbState *State, const ALCdevice *Device
         hfRatio = CalcLimitedHfRatio(hfRatio, props->Reverb.AirAbsorptionGainHF,
                                      props->Reverb.DecayTime);
 
-    cw = cosf(F_TAU * hfscale);
+    // The damping filters run at the late reverb's rate, so keep the HF
+    // reference below its Nyquist frequency when decimating.
+    if(State->Decim.Factor > 1)
+        cw = cosf(F_TAU * minf(hfscale*State->Decim.Factor, 0.49f));
+    else
+        cw = cosf(F_TAU * hfscale);
     // Update the late lines.
     UpdateLateLines(x, props->Reverb.Density, props->Reverb.DecayTime,
                     props->Reverb.Diffusion, props->Reverb.EchoDepth,
-                    hfRatio, cw, frequency, State);
+                    hfRatio, cw, lateFrequency, params);
 
     // Update the echo line.
     UpdateEchoLine(props->Reverb.EchoTime, props->Reverb.DecayTime,
                    props->Reverb.Diffusion, props->Reverb.EchoDepth,
-                   hfRatio, cw, frequency, State);
+                   hfRatio, cw, lateFrequency, params);
+
+    // The decay time is for -60dB, so scale it for -100dB using the longest
+    // (HF) decay, after the initial delays. The total delay line length is
+    // added to let anything still sitting in the lines get through. The
+    // mixer reads this before processing, so it's set directly instead of
+    // being staged. Using the old length for one more mix is harmless.
+    STATIC_CAST(ALeffectState,State)->TailLength = fastf2u(
+        (props->Reverb.ReflectionsDelay + props->Reverb.LateReverbDelay +
+         props->Reverb.EchoTime +
+         props->Reverb.DecayTime*maxf(hfRatio, 1.0f)*(100.0f/60.0f)) * frequency
+    ) + State->TotalSamples;
 
     gain = props->Reverb.Gain * Slot->Gain * ReverbBoost;
-    // Update early and late 3D panning.
-    if(Device->Hrtf || Device->Uhj_Encoder)
+    outChannels = dry->NumChannels;
+    // Update early and late 3D panning. A chained slot's output goes to the
+    // target slot's B-Format buffer.
+    if(Slot->Target)
+        Update3DPanning(dry, props->Reverb.ReflectionsPan,
+                        props->Reverb.LateReverbPan, gain,
+                        props->Reverb.ReflectionsGain,
+                        props->Reverb.LateReverbGain, params);
+    else if(Device->Hrtf || Device->Uhj_Encoder)
+    {
+        /* The real output channels are written too. WARNING: This assumes
+         * the real output follows the virtual output in the device's
+         * DryBuffer.
+         */
+        outChannels += ChannelsFromDevFmt(Device->FmtChans);
         UpdateMixedPanning(Device, props->Reverb.ReflectionsPan,
                            props->Reverb.LateReverbPan, gain,
                            props->Reverb.ReflectionsGain,
-                           props->Reverb.LateReverbGain, State);
+                           props->Reverb.LateReverbGain, params);
+    }
     else if(Device->FmtChans == DevFmtBFormat3D || Device->AmbiDecoder)
-        Update3DPanning(Device, props->Reverb.ReflectionsPan,
+        Update3DPanning(dry, props->Reverb.ReflectionsPan,
                         props->Reverb.LateReverbPan, gain,
                         props->Reverb.ReflectionsGain,
-                        props->Reverb.LateReverbGain, State);
+                        props->Reverb.LateReverbGain, params);
     else
         UpdateDirectPanning(Device, props->Reverb.ReflectionsPan,
                             props->Reverb.LateReverbPan, gain,
                             props->Reverb.ReflectionsGain,
-                            props->Reverb.LateReverbGain, State);
+                            props->Reverb.LateReverbGain, params);
+
+    /* The output only changes with the device or the slot's target, which
+     * are both updated with the mixer held off. Only write it then, so an
+     * update running alongside the mixer leaves it alone.
+     */
+    if(STATIC_CAST(ALeffectState,State)->OutBuffer != dry->Buffer ||
+       STATIC_CAST(ALeffectState,State)->OutChannels != outChannels)
+    {
+        STATIC_CAST(ALeffectState,State)->OutBuffer = dry->Buffer;
+        STATIC_CAST(ALeffectState,State)->OutChannels = outChannels;
+    }
+
+    idx = ATOMIC_EXCHANGE(ALuint, &State->PendingParams,
+                          State->NextParams | REVERB_PARAMS_FRESH);
+    State->NextParams = idx & ~REVERB_PARAMS_FRESH;
 }
 
 
@@ -976,17 +955,6 @@ static ALvoid ALreverbState_update(ALreverbState *State, const ALCdevice *Device
  *  Effect Processing                 *
  **************************************/
 
-// Basic delay line input/output routines.
-static inline ALfloat DelayLineOut(DelayLine *Delay, ALuint offset)
-{
-    return Delay->Line[offset&Delay->Mask];
-}
-
-static inline ALvoid DelayLineIn(DelayLine *Delay, ALuint offset, ALfloat in)
-{
-    Delay->Line[offset&Delay->Mask] = in;
-}
-
 // Given an input sample, this function produces modulation for the late
 // reverb.
 static inline ALfloat EAXModulation(ALreverbState *State, ALuint offset, ALfloat in)
@@ -1028,7 +996,7 @@ static inline ALfloat EAXModulation(ALreverbState *State, ALuint offset, ALfloat
 
 // Given some input sample, this function produces four-channel outputs for the
 // early reflections.
-static inline ALvoid EarlyReflection(ALreverbState *State, ALuint todo, ALfloat (*restrict out)[4])
+ALvoid EarlyReflection_C(ALreverbState *State, ALuint todo, ALfloat (*restrict out)[4])
 {
     ALfloat d[4], v, f[4];
     ALuint i;
@@ -1112,26 +1080,121 @@ static inline ALfloat LateLowPassInOut(ALreverbState *State, ALuint index, ALflo
     return in;
 }
 
-// Given four decorrelated input samples, this function produces four-channel
-// output for the late reverb.
-static inline ALvoid LateReverb(ALreverbState *State, ALuint todo, ALfloat (*restrict out)[4])
+// Gets the input for the late reverb and echo from the second delay tap,
+// decimating it when the late reverb runs at a reduced rate.  Returns the
+// number of late reverb samples to process for this update.
+static inline ALuint GetLateInput(ALreverbState *State, ALuint todo)
+{
+    const ALuint factor = State->Decim.Factor;
+    const ALuint taps = factor * LATE_DECIM_TAPS;
+    ALfloat hist[MAX_UPDATE_SAMPLES + MAX_LATE_DECIMATION*LATE_DECIM_TAPS];
+    ALfloat *restrict out = State->Decim.Input;
+    ALuint offset, total, split;
+    ALuint first, count, i, k;
+
+    if(factor == 1)
+    {
+        for(i = 0;i < todo;i++)
+            out[i] = DelayLineOut(&State->Delay, State->Offset+i - State->DelayTap[1]);
+        return todo;
+    }
+
+    // Get the tapped input along with the history needed by the filter, in
+    // up to two parts if it wraps around the end of the line.
+    offset = (State->Offset - (taps-1) - State->DelayTap[1]) & State->Delay.Mask;
+    total = todo + taps-1;
+    split = minu(total, State->Delay.Mask+1 - offset);
+    memcpy(hist, &State->Delay.Line[offset], split*sizeof(ALfloat));
+    memcpy(hist+split, State->Delay.Line, (total-split)*sizeof(ALfloat));
+
+    // Reduced-rate samples are taken at offsets that are a multiple of the
+    // factor, so each update continues where the last left off. The filter is
+    // symmetric, so it can be applied to the history in order.
+    first = (factor - (State->Offset&(factor-1))) & (factor-1);
+    count = 0;
+    for(i = first;i < todo;i += factor)
+    {
+        const ALfloat *restrict src = &hist[i];
+        ALfloat sum[4] = { 0.0f, 0.0f, 0.0f, 0.0f };
+
+        // The tap count is a multiple of 4, so keep four running sums.
+        for(k = 0;k < taps;k += 4)
+        {
+            sum[0] += src[k  ] * State->Decim.Coeffs[k  ];
+            sum[1] += src[k+1] * State->Decim.Coeffs[k+1];
+            sum[2] += src[k+2] * State->Decim.Coeffs[k+2];
+            sum[3] += src[k+3] * State->Decim.Coeffs[k+3];
+        }
+        out[count++] = (sum[0]+sum[1]) + (sum[2]+sum[3]);
+    }
+    return count;
+}
+
+static_assert(LATE_DECIM_TAPS == 8, "The late interpolator is unrolled for 8 taps!");
+
+// Interpolates the reduced-rate late reverb in the decimator's output buffer
+// back up to the full rate.
+static inline ALvoid InterpolateLateOutput(ALreverbState *State, ALuint todo, ALuint count, ALfloat (*restrict late)[4])
+{
+    const ALuint factor = State->Decim.Factor;
+    const ALfloat (*restrict coeffs)[LATE_DECIM_TAPS] = State->Decim.InterpCoeffs;
+    ALfloat (*restrict in)[4] = State->Decim.Output;
+    ALuint phase = State->Offset & (factor-1);
+    ALuint pos = 0;
+    ALuint i, l;
+
+    for(i = 0;i < todo;i++)
+    {
+        // Step to the next reduced-rate sample once it's been reached. The
+        // phase is how far behind it this output is.
+        const ALfloat *restrict c = coeffs[phase];
+        const ALfloat (*restrict src)[4];
+        if(phase == 0) pos++;
+        src = &in[pos];
+
+        if(phase == factor-1)
+        {
+            // This phase only has the center tap.
+            for(l = 0;l < 4;l++)
+                late[i][l] = src[LATE_DECIM_TAPS/2][l] * c[LATE_DECIM_TAPS/2];
+        }
+        else
+        {
+            for(l = 0;l < 4;l++)
+                late[i][l] = src[0][l]*c[0] + src[1][l]*c[1] + src[2][l]*c[2] +
+                             src[3][l]*c[3] + src[4][l]*c[4] + src[5][l]*c[5] +
+                             src[6][l]*c[6] + src[7][l]*c[7];
+        }
+
+        phase = (phase+1) & (factor-1);
+    }
+
+    // Keep the last samples for the next update.
+    memmove(in, in[count], LATE_DECIM_TAPS*sizeof(in[0]));
+}
+
+// Feed the decorrelator from the energy-attenuated late reverb input.
+static inline ALvoid FeedDecorrelator(ALreverbState *State, ALuint todo)
 {
-    ALfloat d[4], f[4];
     ALuint i;
 
-    // Feed the decorrelator from the energy-attenuated output of the second
-    // delay tap.
     for(i = 0;i < todo;i++)
     {
-        ALuint offset = State->Offset+i;
-        ALfloat sample = DelayLineOut(&State->Delay, offset - State->DelayTap[1]) *
-                         State->Late.DensityGain;
-        DelayLineIn(&State->Decorrelator, offset, sample);
+        ALfloat sample = State->Decim.Input[i] * State->Late.DensityGain;
+        DelayLineIn(&State->Decorrelator, State->LateOffset+i, sample);
     }
+}
+
+// Given four decorrelated input samples, this function produces four-channel
+// output for the late reverb.
+ALvoid LateReverb_C(ALreverbState *State, ALuint todo, ALfloat (*restrict out)[4])
+{
+    ALfloat d[4], f[4];
+    ALuint i;
 
     for(i = 0;i < todo;i++)
     {
-        ALuint offset = State->Offset+i;
+        ALuint offset = State->LateOffset+i;
 
         /* Obtain four decorrelated input samples. */
         f[0] = DelayLineOut(&State->Decorrelator, offset);
@@ -1219,7 +1282,7 @@ static inline ALvoid EAXEcho(ALreverbState *State, ALuint todo, ALfloat (*restri
 
     for(i = 0;i < todo;i++)
     {
-        ALuint offset = State->Offset+i;
+        ALuint offset = State->LateOffset+i;
 
         // Get the latest attenuated echo sample for output.
         feed = DelayLineOut(&State->Echo.Delay, offset-State->Echo.Offset) *
@@ -1234,8 +1297,7 @@ static inline ALvoid EAXEcho(ALreverbState *State, ALuint todo, ALfloat (*restri
 
         // Mix the energy-attenuated input with the output and pass it through
         // the echo low-pass filter.
-        feed += DelayLineOut(&State->Delay, offset-State->DelayTap[1]) *
-                State->Echo.DensityGain;
+        feed += State->Decim.Input[i] * State->Echo.DensityGain;
         feed = lerp(feed, State->Echo.LpSample, State->Echo.LpCoeff);
         State->Echo.LpSample = feed;
 
@@ -1253,7 +1315,8 @@ static inline ALvoid EAXEcho(ALreverbState *State, ALuint todo, ALfloat (*restri
 // four-channel output.
 static inline ALvoid VerbPass(ALreverbState *State, ALuint todo, const ALfloat *in, ALfloat (*restrict early)[4], ALfloat (*restrict late)[4])
 {
-    ALuint i;
+    ALfloat (*restrict lowlate)[4] = late;
+    ALuint i, count;
 
     // Low-pass filter the incoming samples.
     for(i = 0;i < todo;i++)
@@ -1262,20 +1325,29 @@ static inline ALvoid VerbPass(ALreverbState *State, ALuint todo, const ALfloat *
         );
 
     // Calculate the early reflection from the first delay tap.
-    EarlyReflection(State, todo, early);
-
-    // Calculate the late reverb from the decorrelator taps.
-    LateReverb(State, todo, late);
+    State->EarlyReflection(State, todo, early);
+
+    // Calculate the late reverb from the decorrelator taps, at the reduced
+    // rate if decimating.
+    count = GetLateInput(State, todo);
+    if(State->Decim.Factor > 1)
+        lowlate = &State->Decim.Output[LATE_DECIM_TAPS];
+    FeedDecorrelator(State, count);
+    State->LateReverb(State, count, lowlate);
+    if(State->Decim.Factor > 1)
+        InterpolateLateOutput(State, todo, count, late);
 
     // Step all delays forward one sample.
     State->Offset += todo;
+    State->LateOffset += count;
 }
 
 // Perform the EAX reverb pass on a given input sample, resulting in four-
 // channel output.
 static inline ALvoid EAXVerbPass(ALreverbState *State, ALuint todo, const ALfloat *input, ALfloat (*restrict early)[4], ALfloat (*restrict late)[4])
 {
-    ALuint i;
+    ALfloat (*restrict lowlate)[4] = late;
+    ALuint i, count;
 
     // Band-pass and modulate the incoming samples.
     for(i = 0;i < todo;i++)
@@ -1292,99 +1364,196 @@ static inline ALvoid EAXVerbPass(ALreverbState *State, ALuint todo, const ALfloa
     }
 
     // Calculate the early reflection from the first delay tap.
-    EarlyReflection(State, todo, early);
+    State->EarlyReflection(State, todo, early);
 
-    // Calculate the late reverb from the decorrelator taps.
-    LateReverb(State, todo, late);
+    // Calculate the late reverb from the decorrelator taps, at the reduced
+    // rate if decimating.
+    count = GetLateInput(State, todo);
+    if(State->Decim.Factor > 1)
+        lowlate = &State->Decim.Output[LATE_DECIM_TAPS];
+    FeedDecorrelator(State, count);
+    State->LateReverb(State, count, lowlate);
 
     // Calculate and mix in any echo.
-    EAXEcho(State, todo, late);
+    EAXEcho(State, count, lowlate);
+
+    if(State->Decim.Factor > 1)
+        InterpolateLateOutput(State, todo, count, late);
 
     // Step all delays forward.
     State->Offset += todo;
+    State->LateOffset += count;
 }
 
-static ALvoid ALreverbState_processStandard(ALreverbState *State, ALuint SamplesToDo, const ALfloat *restrict SamplesIn, ALfloat (*restrict SamplesOut)[BUFFERSIZE], ALuint NumChannels)
+/* Mixes the four output lines to the output channels, from the current gains.
+ * If fade is non-0, the gains step toward the target gains to reach them
+ * after that many samples.
+ */
+static inline ALvoid MixVerbOutput(ALfloat (*restrict CurrentGain)[MAX_OUTPUT_CHANNELS*2], const ALfloat (*restrict TargetGain)[MAX_OUTPUT_CHANNELS*2], ALuint fade, const ALfloat (*restrict in)[4], ALuint todo, ALfloat (*restrict SamplesOut)[BUFFERSIZE], ALuint offset, ALuint NumChannels)
+{
+    ALuint l, c, i;
+    ALfloat gain, step;
+
+    for(l = 0;l < 4;l++)
+    {
+        for(c = 0;c < NumChannels;c++)
+        {
+            gain = CurrentGain[l][c];
+            i = 0;
+            if(fade > 0 && gain != TargetGain[l][c])
+            {
+                ALuint count = minu(todo, fade);
+                step = (TargetGain[l][c] - gain) / (ALfloat)fade;
+                for(;i < count;i++)
+                {
+                    SamplesOut[c][offset+i] += gain*in[i][l];
+                    gain += step;
+                }
+                if(count == fade)
+                    gain = TargetGain[l][c];
+                CurrentGain[l][c] = gain;
+            }
+            else if(gain != TargetGain[l][c])
+                CurrentGain[l][c] = gain = TargetGain[l][c];
+
+            if(fabsf(gain) > GAIN_SILENCE_THRESHOLD)
+            {
+                for(;i < todo;i++)
+                    SamplesOut[c][offset+i] += gain*in[i][l];
+            }
+        }
+    }
+}
+
+/* Picks up the newest parameters from an update, if there are any. The taps
+ * and offsets are stepped to right away, along with the master filters and
+ * the modulator. The returned parameters hold the coefficients and gains to
+ * fade to, which the mixer keeps until it reads the next ones.
+ */
+static const ReverbParams *ApplyReverbParams(ALreverbState *State)
+{
+    const ReverbParams *params;
+    ALuint index;
+
+    if(!(ATOMIC_LOAD(&State->PendingParams)&REVERB_PARAMS_FRESH))
+        return NULL;
+    State->MixParams = ATOMIC_EXCHANGE(ALuint, &State->PendingParams, State->MixParams) &
+                       ~REVERB_PARAMS_FRESH;
+    params = &State->Params[State->MixParams];
+
+    State->IsEax = params->IsEax;
+    ALfilterState_copyParams(&State->LpFilter, &params->LpFilter);
+    ALfilterState_copyParams(&State->HpFilter, &params->HpFilter);
+
+    // Rescale the modulation index to the new range, to keep the sinus
+    // consistent.
+    State->Mod.Index = (ALuint)(State->Mod.Index * (ALuint64)params->Mod.Range /
+                                State->Mod.Range);
+    State->Mod.Range = params->Mod.Range;
+    // The depth is already filtered as it's applied.
+    State->Mod.Depth = params->Mod.Depth;
+
+    State->DelayTap[0] = params->DelayTap[0];
+    State->DelayTap[1] = params->DelayTap[1];
+    for(index = 0;index < 3;index++)
+        State->DecoTap[index] = params->DecoTap[index];
+    for(index = 0;index < 4;index++)
+        State->Late.Offset[index] = params->Late.Offset[index];
+    State->Echo.Offset = params->Echo.Offset;
+
+    memcpy(State->Early.PanGain, params->Early.PanGain, sizeof(State->Early.PanGain));
+    memcpy(State->Late.PanGain, params->Late.PanGain, sizeof(State->Late.PanGain));
+
+    return params;
+}
+
+/* Moves the coefficients toward the given parameters, by the fraction mu of
+ * the remaining difference. A 1 for mu reaches them.
+ */
+static ALvoid StepReverbCoeffs(ALreverbState *State, const ReverbParams *params, ALfloat mu)
+{
+    ALuint index;
+
+    for(index = 0;index < 4;index++)
+    {
+        State->Early.Coeff[index] = lerp(State->Early.Coeff[index], params->Early.Coeff[index], mu);
+        State->Late.ApCoeff[index] = lerp(State->Late.ApCoeff[index], params->Late.ApCoeff[index], mu);
+        State->Late.Coeff[index] = lerp(State->Late.Coeff[index], params->Late.Coeff[index], mu);
+        State->Late.LpCoeff[index] = lerp(State->Late.LpCoeff[index], params->Late.LpCoeff[index], mu);
+    }
+    State->Late.Gain = lerp(State->Late.Gain, params->Late.Gain, mu);
+    State->Late.DensityGain = lerp(State->Late.DensityGain, params->Late.DensityGain, mu);
+    State->Late.ApFeedCoeff = lerp(State->Late.ApFeedCoeff, params->Late.ApFeedCoeff, mu);
+    State->Late.MixCoeff = lerp(State->Late.MixCoeff, params->Late.MixCoeff, mu);
+
+    State->Echo.DensityGain = lerp(State->Echo.DensityGain, params->Echo.DensityGain, mu);
+    State->Echo.Coeff = lerp(State->Echo.Coeff, params->Echo.Coeff, mu);
+    State->Echo.ApFeedCoeff = lerp(State->Echo.ApFeedCoeff, params->Echo.ApFeedCoeff, mu);
+    State->Echo.ApCoeff = lerp(State->Echo.ApCoeff, params->Echo.ApCoeff, mu);
+    State->Echo.LpCoeff = lerp(State->Echo.LpCoeff, params->Echo.LpCoeff, mu);
+    State->Echo.MixCoeff = lerp(State->Echo.MixCoeff, params->Echo.MixCoeff, mu);
+}
+
+static ALvoid ALreverbState_processStandard(ALreverbState *State, const ReverbParams *params, ALuint SamplesToDo, const ALfloat *restrict SamplesIn, ALfloat (*restrict SamplesOut)[BUFFERSIZE], ALuint NumChannels)
 {
     ALfloat (*restrict early)[4] = State->EarlySamples;
     ALfloat (*restrict late)[4] = State->ReverbSamples;
-    ALuint index, c, i, l;
-    ALfloat gain;
+    ALuint fade = params ? SamplesToDo : 0;
+    ALuint index;
 
     /* Process reverb for these samples. */
     for(index = 0;index < SamplesToDo;)
     {
         ALuint todo = minu(SamplesToDo-index, MAX_UPDATE_SAMPLES);
 
+        if(fade > 0)
+            StepReverbCoeffs(State, params, (ALfloat)todo / (ALfloat)fade);
         VerbPass(State, todo, &SamplesIn[index], early, late);
 
-        for(l = 0;l < 4;l++)
-        {
-            for(c = 0;c < NumChannels;c++)
-            {
-                gain = State->Early.PanGain[l][c];
-                if(fabsf(gain) > GAIN_SILENCE_THRESHOLD)
-                {
-                    for(i = 0;i < todo;i++)
-                        SamplesOut[c][index+i] += gain*early[i][l];
-                }
-                gain = State->Late.PanGain[l][c];
-                if(fabsf(gain) > GAIN_SILENCE_THRESHOLD)
-                {
-                    for(i = 0;i < todo;i++)
-                        SamplesOut[c][index+i] += gain*late[i][l];
-                }
-            }
-        }
+        MixVerbOutput(State->Early.CurrentGain, State->Early.PanGain, fade,
+                      early, todo, SamplesOut, index, NumChannels);
+        MixVerbOutput(State->Late.CurrentGain, State->Late.PanGain, fade,
+                      late, todo, SamplesOut, index, NumChannels);
 
+        fade -= minu(fade, todo);
         index += todo;
     }
 }
 
-static ALvoid ALreverbState_processEax(ALreverbState *State, ALuint SamplesToDo, const ALfloat *restrict SamplesIn, ALfloat (*restrict SamplesOut)[BUFFERSIZE], ALuint NumChannels)
+static ALvoid ALreverbState_processEax(ALreverbState *State, const ReverbParams *params, ALuint SamplesToDo, const ALfloat *restrict SamplesIn, ALfloat (*restrict SamplesOut)[BUFFERSIZE], ALuint NumChannels)
 {
     ALfloat (*restrict early)[4] = State->EarlySamples;
     ALfloat (*restrict late)[4] = State->ReverbSamples;
-    ALuint index, c, i, l;
-    ALfloat gain;
+    ALuint fade = params ? SamplesToDo : 0;
+    ALuint index;
 
     /* Process reverb for these samples. */
     for(index = 0;index < SamplesToDo;)
     {
         ALuint todo = minu(SamplesToDo-index, MAX_UPDATE_SAMPLES);
 
+        if(fade > 0)
+            StepReverbCoeffs(State, params, (ALfloat)todo / (ALfloat)fade);
         EAXVerbPass(State, todo, &SamplesIn[index], early, late);
 
-        for(l = 0;l < 4;l++)
-        {
-            for(c = 0;c < NumChannels;c++)
-            {
-                gain = State->Early.PanGain[l][c];
-                if(fabsf(gain) > GAIN_SILENCE_THRESHOLD)
-                {
-                    for(i = 0;i < todo;i++)
-                        SamplesOut[c][index+i] += gain*early[i][l];
-                }
-                gain = State->Late.PanGain[l][c];
-                if(fabsf(gain) > GAIN_SILENCE_THRESHOLD)
-                {
-                    for(i = 0;i < todo;i++)
-                        SamplesOut[c][index+i] += gain*late[i][l];
-                }
-            }
-        }
+        MixVerbOutput(State->Early.CurrentGain, State->Early.PanGain, fade,
+                      early, todo, SamplesOut, index, NumChannels);
+        MixVerbOutput(State->Late.CurrentGain, State->Late.PanGain, fade,
+                      late, todo, SamplesOut, index, NumChannels);
 
+        fade -= minu(fade, todo);
         index += todo;
     }
 }
 
 static ALvoid ALreverbState_process(ALreverbState *State, ALuint SamplesToDo, const ALfloat (*restrict SamplesIn)[BUFFERSIZE], ALfloat (*restrict SamplesOut)[BUFFERSIZE], ALuint NumChannels)
 {
-    NumChannels += State->ExtraChannels;
+    const ReverbParams *params = ApplyReverbParams(State);
+
     if(State->IsEax)
-        ALreverbState_processEax(State, SamplesToDo, SamplesIn[0], SamplesOut, NumChannels);
+        ALreverbState_processEax(State, params, SamplesToDo, SamplesIn[0], SamplesOut, NumChannels);
     else
-        ALreverbState_processStandard(State, SamplesToDo, SamplesIn[0], SamplesOut, NumChannels);
+        ALreverbState_processStandard(State, params, SamplesToDo, SamplesIn[0], SamplesOut, NumChannels);
 }
 
 
@@ -1392,6 +1561,26 @@ typedef struct ALreverbStateFactory {
     DERIVE_FROM_TYPE(ALeffectStateFactory);
 } ALreverbStateFactory;
 
+static inline ReverbLinesFunc SelectEarlyReflection(void)
+{
+#ifdef HAVE_SSE
+    if((CPUCapFlags&CPU_CAP_SSE))
+        return EarlyReflection_SSE;
+#endif
+
+    return EarlyReflection_C;
+}
+
+static inline ReverbLinesFunc SelectLateReverb(void)
+{
+#ifdef HAVE_SSE
+    if((CPUCapFlags&CPU_CAP_SSE))
+        return LateReverb_SSE;
+#endif
+
+    return LateReverb_C;
+}
+
 static ALeffectState *ALreverbStateFactory_create(ALreverbStateFactory* UNUSED(factory))
 {
     ALreverbState *state;
@@ -1402,7 +1591,6 @@ static ALeffectState *ALreverbStateFactory_create(ALreverbStateFactory* UNUSED(f
     SET_VTABLE2(ALreverbState, ALeffectState, state);
 
     state->IsEax = AL_FALSE;
-    state->ExtraChannels = 0;
 
     state->TotalSamples = 0;
     state->SampleBuffer = NULL;
@@ -1465,6 +1653,8 @@ static ALeffectState *ALreverbStateFactory_create(ALreverbStateFactory* UNUSED(f
             state->Late.PanGain[l][index] = 0.0f;
         }
     }
+    memset(state->Early.CurrentGain, 0, sizeof(state->Early.CurrentGain));
+    memset(state->Late.CurrentGain, 0, sizeof(state->Late.CurrentGain));
 
     state->Echo.DensityGain = 0.0f;
     state->Echo.Delay.Mask = 0;
@@ -1480,7 +1670,20 @@ static ALeffectState *ALreverbStateFactory_create(ALreverbStateFactory* UNUSED(f
     state->Echo.LpSample = 0.0f;
     state->Echo.MixCoeff = 0.0f;
 
+    state->Decim.Factor = 1;
+    for(index = 0;index < MAX_LATE_DECIMATION*LATE_DECIM_TAPS;index++)
+        state->Decim.Coeffs[index] = 0.0f;
+
     state->Offset = 0;
+    state->LateOffset = 0;
+
+    memset(state->Params, 0, sizeof(state->Params));
+    state->NextParams = 0;
+    state->MixParams = 1;
+    ATOMIC_INIT(&state->PendingParams, 2);
+
+    state->EarlyReflection = SelectEarlyReflection();
+    state->LateReverb = SelectLateReverb();
 
     return STATIC_CAST(ALeffectState, state);
 }
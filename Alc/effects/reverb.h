@@ -0,0 +1,264 @@
+#ifndef REVERB_H
+#define REVERB_H
+
+#include "alMain.h"
+#include "alu.h"
+#include "alAuxEffectSlot.h"
+#include "alFilter.h"
+
+/* This is the maximum number of samples processed for each inner loop
+ * iteration. */
+#define MAX_UPDATE_SAMPLES  256
+
+/* The late reverb and echo can optionally run at a reduced rate, decimated
+ * from the initial delay line and interpolated back up for output. These are
+ * the largest rate divisor, and the filter taps used for each output phase.
+ */
+#define MAX_LATE_DECIMATION  4
+#define LATE_DECIM_TAPS      8
+
+typedef struct DelayLine
+{
+    // The delay lines use sample lengths that are powers of 2 to allow the
+    // use of bit-masking instead of a modulus for wrapping.
+    ALuint   Mask;
+    ALfloat *Line;
+} DelayLine;
+
+/* Parameters calculated by an update, for the mixer to pick up at the start
+ * of its next process call. The offsets and taps are stepped to, while the
+ * coefficients and gains are faded to over the processed samples.
+ */
+typedef struct ReverbParams {
+    ALboolean IsEax;
+
+    // Only the coefficients of these are used, not the history.
+    ALfilterState LpFilter;
+    ALfilterState HpFilter;
+
+    struct {
+        ALuint    Range;
+        ALfloat   Depth;
+    } Mod;
+
+    ALuint DelayTap[2];
+
+    struct {
+        ALfloat Coeff[4];
+        ALfloat PanGain[4][MAX_OUTPUT_CHANNELS*2];
+    } Early;
+
+    ALuint DecoTap[3];
+
+    struct {
+        ALfloat Gain;
+        ALfloat DensityGain;
+        ALfloat ApFeedCoeff;
+        ALfloat MixCoeff;
+        ALfloat ApCoeff[4];
+        ALfloat Coeff[4];
+        ALuint  Offset[4];
+        ALfloat LpCoeff[4];
+        ALfloat PanGain[4][MAX_OUTPUT_CHANNELS*2];
+    } Late;
+
+    struct {
+        ALfloat DensityGain;
+        ALfloat Coeff;
+        ALfloat ApFeedCoeff;
+        ALfloat ApCoeff;
+        ALuint  Offset;
+        ALfloat LpCoeff;
+        ALfloat MixCoeff;
+    } Echo;
+} ReverbParams;
+
+/* Set in PendingParams when it holds parameters the mixer hasn't read. */
+#define REVERB_PARAMS_FRESH  4
+
+struct ALreverbState;
+
+/* Processes 'todo' samples through a set of four lines, writing the output of
+ * each line to 'out'. */
+typedef ALvoid (*ReverbLinesFunc)(struct ALreverbState *State, ALuint todo,
+                                  ALfloat (*restrict out)[4]);
+
+typedef struct ALreverbState {
+    DERIVE_FROM_TYPE(ALeffectState);
+
+    ALboolean IsEax;
+
+    // All delay lines are allocated as a single buffer to reduce memory
+    // fragmentation and management code.
+    ALfloat  *SampleBuffer;
+    ALuint    TotalSamples;
+
+    // Master effect filters
+    ALfilterState LpFilter;
+    ALfilterState HpFilter; // EAX only
+
+    struct {
+        // Modulator delay line.
+        DelayLine Delay;
+
+        // The vibrato time is tracked with an index over a modulus-wrapped
+        // range (in samples).
+        ALuint    Index;
+        ALuint    Range;
+
+        // The depth of frequency change (also in samples) and its filter.
+        ALfloat   Depth;
+        ALfloat   Coeff;
+        ALfloat   Filter;
+    } Mod; // EAX only
+
+    // Initial effect delay.
+    DelayLine Delay;
+    // The tap points for the initial delay.  First tap goes to early
+    // reflections, the last to late reverb.
+    ALuint    DelayTap[2];
+
+    struct {
+        // Early reflections are done with 4 delay lines.
+        alignas(16) ALfloat Coeff[4];
+        DelayLine Delay[4];
+        ALuint    Offset[4];
+
+        // The gain for each output channel based on 3D panning.
+        // NOTE: With certain output modes, we may be rendering to the dry
+        // buffer and the "real" buffer. The two combined may be using more
+        // than the max output channels, so we need some extra for the real
+        // output too.
+        ALfloat PanGain[4][MAX_OUTPUT_CHANNELS*2];
+        // The gains currently applied, which fade to PanGain after an update.
+        ALfloat CurrentGain[4][MAX_OUTPUT_CHANNELS*2];
+    } Early;
+
+    // Decorrelator delay line.
+    DelayLine Decorrelator;
+    // There are actually 4 decorrelator taps, but the first occurs at the
+    // initial sample.
+    ALuint    DecoTap[3];
+
+    struct {
+        // Output gain for late reverb.
+        ALfloat   Gain;
+
+        // Attenuation to compensate for the modal density and decay rate of
+        // the late lines.
+        ALfloat   DensityGain;
+
+        // The feed-back and feed-forward all-pass coefficient.
+        ALfloat   ApFeedCoeff;
+
+        // Mixing matrix coefficient.
+        ALfloat   MixCoeff;
+
+        // Late reverb has 4 parallel all-pass filters.
+        alignas(16) ALfloat ApCoeff[4];
+        DelayLine ApDelay[4];
+        ALuint    ApOffset[4];
+
+        // In addition to 4 cyclical delay lines.
+        alignas(16) ALfloat Coeff[4];
+        DelayLine Delay[4];
+        ALuint    Offset[4];
+
+        // The cyclical delay lines are 1-pole low-pass filtered.
+        alignas(16) ALfloat LpCoeff[4];
+        alignas(16) ALfloat LpSample[4];
+
+        // The gain for each output channel based on 3D panning.
+        // NOTE: Add some extra in case (see note about early pan).
+        ALfloat PanGain[4][MAX_OUTPUT_CHANNELS*2];
+        ALfloat CurrentGain[4][MAX_OUTPUT_CHANNELS*2];
+    } Late;
+
+    struct {
+        // Attenuation to compensate for the modal density and decay rate of
+        // the echo line.
+        ALfloat   DensityGain;
+
+        // Echo delay and all-pass lines.
+        DelayLine Delay;
+        DelayLine ApDelay;
+
+        ALfloat   Coeff;
+        ALfloat   ApFeedCoeff;
+        ALfloat   ApCoeff;
+
+        ALuint    Offset;
+        ALuint    ApOffset;
+
+        // The echo line is 1-pole low-pass filtered.
+        ALfloat   LpCoeff;
+        ALfloat   LpSample;
+
+        // Echo mixing coefficient.
+        ALfloat   MixCoeff;
+    } Echo; // EAX only
+
+    struct {
+        // Rate divisor for the late reverb and echo (1, 2, or 4).
+        ALuint    Factor;
+
+        // Low-pass prototype shared by the decimator and interpolator, with
+        // Factor*LATE_DECIM_TAPS coefficients.
+        ALfloat   Coeffs[MAX_LATE_DECIMATION*LATE_DECIM_TAPS];
+        // The same, split into one set of taps per interpolator phase.
+        ALfloat   InterpCoeffs[MAX_LATE_DECIMATION][LATE_DECIM_TAPS];
+
+        // Decimated input for the late reverb and echo.
+        ALfloat   Input[MAX_UPDATE_SAMPLES];
+
+        // Reduced-rate late output, preceded by the last LATE_DECIM_TAPS
+        // frames of the previous update for the interpolator.
+        alignas(16) ALfloat Output[LATE_DECIM_TAPS+MAX_UPDATE_SAMPLES][4];
+    } Decim;
+
+    /* The parameters are triple-buffered, like a voice's targets. An update
+     * calculates into NextParams and swaps it into PendingParams with
+     * REVERB_PARAMS_FRESH set, taking back the buffer that was there. The
+     * mixer swaps a fresh PendingParams with the buffer it last read from,
+     * MixParams. So updates can run on another thread while the mixer
+     * processes, without the device lock.
+     */
+    ReverbParams Params[3];
+    ALuint NextParams;
+    ALuint MixParams;
+    ATOMIC(ALuint) PendingParams;
+
+    // The current read offset for all delay lines.
+    ALuint Offset;
+    // The read offset for the late reverb and echo lines, which only differs
+    // from the above when decimating.
+    ALuint LateOffset;
+
+    /* Runs the early reflection and late reverb lines, picked for the CPU. */
+    ReverbLinesFunc EarlyReflection;
+    ReverbLinesFunc LateReverb;
+
+    /* Temporary storage used when processing. */
+    alignas(16) ALfloat ReverbSamples[MAX_UPDATE_SAMPLES][4];
+    alignas(16) ALfloat EarlySamples[MAX_UPDATE_SAMPLES][4];
+} ALreverbState;
+
+// Basic delay line input/output routines.
+inline ALfloat DelayLineOut(DelayLine *Delay, ALuint offset)
+{
+    return Delay->Line[offset&Delay->Mask];
+}
+
+inline ALvoid DelayLineIn(DelayLine *Delay, ALuint offset, ALfloat in)
+{
+    Delay->Line[offset&Delay->Mask] = in;
+}
+
+
+ALvoid EarlyReflection_C(ALreverbState *State, ALuint todo, ALfloat (*restrict out)[4]);
+ALvoid LateReverb_C(ALreverbState *State, ALuint todo, ALfloat (*restrict out)[4]);
+
+ALvoid EarlyReflection_SSE(ALreverbState *State, ALuint todo, ALfloat (*restrict out)[4]);
+ALvoid LateReverb_SSE(ALreverbState *State, ALuint todo, ALfloat (*restrict out)[4]);
+
+#endif /* REVERB_H */
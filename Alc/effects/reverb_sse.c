@@ -0,0 +1,267 @@
+#include "config.h"
+
+#include <string.h>
+#include <xmmintrin.h>
+
+#include "alMain.h"
+#include "alu.h"
+#include "reverb.h"
+
+
+/* Rather than reading and writing each line a sample at a time, these work on
+ * chunks no longer than the shortest delay of the lines involved. Everything a
+ * chunk reads was then written before it started, so the lines can be copied
+ * out in bulk, processed with the four lines in a vector, and copied back.
+ */
+
+static inline ALvoid DelayLineRead(const DelayLine *Delay, ALuint offset,
+                                   ALfloat *restrict dst, ALuint count)
+{
+    ALuint first;
+
+    offset &= Delay->Mask;
+    first = minu(count, Delay->Mask+1 - offset);
+    memcpy(dst, &Delay->Line[offset], first*sizeof(ALfloat));
+    memcpy(dst+first, Delay->Line, (count-first)*sizeof(ALfloat));
+}
+
+static inline ALvoid DelayLineWrite(DelayLine *Delay, ALuint offset,
+                                    const ALfloat *restrict src, ALuint count)
+{
+    ALuint first;
+
+    offset &= Delay->Mask;
+    first = minu(count, Delay->Mask+1 - offset);
+    memcpy(&Delay->Line[offset], src, first*sizeof(ALfloat));
+    memcpy(Delay->Line, src+first, (count-first)*sizeof(ALfloat));
+}
+
+static inline ALuint MinDelay4(const ALuint *delays)
+{
+    return maxu(minu(minu(delays[0], delays[1]), minu(delays[2], delays[3])), 1);
+}
+
+
+ALvoid EarlyReflection_SSE(ALreverbState *State, ALuint todo, ALfloat (*restrict out)[4])
+{
+    alignas(16) ALfloat lines[4][MAX_UPDATE_SAMPLES];
+    alignas(16) ALfloat input[MAX_UPDATE_SAMPLES];
+    const ALuint limit = MinDelay4(State->Early.Offset);
+    const __m128 half4 = _mm_set1_ps(0.5f);
+    ALuint base, count, offset, i, l;
+
+    for(base = 0;base < todo;base += count)
+    {
+        count = minu(todo-base, limit);
+        offset = State->Offset + base;
+
+        for(l = 0;l < 4;l++)
+            DelayLineRead(&State->Early.Delay[l], offset-State->Early.Offset[l],
+                          lines[l], count);
+        DelayLineRead(&State->Delay, offset-State->DelayTap[0], input, count);
+
+        /* With each line in its own array, four samples of the junction (see
+         * EarlyReflection_C) can be done at once.
+         */
+        for(i = 0;count-i > 3;i += 4)
+        {
+            __m128 d0 = _mm_mul_ps(_mm_load_ps(&lines[0][i]), _mm_set1_ps(State->Early.Coeff[0]));
+            __m128 d1 = _mm_mul_ps(_mm_load_ps(&lines[1][i]), _mm_set1_ps(State->Early.Coeff[1]));
+            __m128 d2 = _mm_mul_ps(_mm_load_ps(&lines[2][i]), _mm_set1_ps(State->Early.Coeff[2]));
+            __m128 d3 = _mm_mul_ps(_mm_load_ps(&lines[3][i]), _mm_set1_ps(State->Early.Coeff[3]));
+            __m128 v;
+
+            v = _mm_add_ps(_mm_add_ps(_mm_add_ps(d0, d1), d2), d3);
+            v = _mm_add_ps(_mm_mul_ps(v, half4), _mm_load_ps(&input[i]));
+
+            d0 = _mm_sub_ps(v, d0);
+            d1 = _mm_sub_ps(v, d1);
+            d2 = _mm_sub_ps(v, d2);
+            d3 = _mm_sub_ps(v, d3);
+            _mm_store_ps(&lines[0][i], d0);
+            _mm_store_ps(&lines[1][i], d1);
+            _mm_store_ps(&lines[2][i], d2);
+            _mm_store_ps(&lines[3][i], d3);
+
+            _MM_TRANSPOSE4_PS(d0, d1, d2, d3);
+            _mm_store_ps(out[base+i  ], _mm_mul_ps(d0, half4));
+            _mm_store_ps(out[base+i+1], _mm_mul_ps(d1, half4));
+            _mm_store_ps(out[base+i+2], _mm_mul_ps(d2, half4));
+            _mm_store_ps(out[base+i+3], _mm_mul_ps(d3, half4));
+        }
+        for(;i < count;i++)
+        {
+            ALfloat d[4], v;
+
+            for(l = 0;l < 4;l++)
+                d[l] = lines[l][i] * State->Early.Coeff[l];
+            v = (d[0] + d[1] + d[2] + d[3]) * 0.5f;
+            v += input[i];
+            for(l = 0;l < 4;l++)
+            {
+                lines[l][i] = v - d[l];
+                out[base+i][l] = lines[l][i] * 0.5f;
+            }
+        }
+
+        for(l = 0;l < 4;l++)
+            DelayLineWrite(&State->Early.Delay[l], offset, lines[l], count);
+    }
+}
+
+
+typedef struct LateParams {
+    __m128 LpCoeff;
+    __m128 ApCoeff;
+    __m128 ApFeedCoeff;
+    __m128 MixCoeff;
+    __m128 Gain;
+} LateParams;
+
+/* Processes one sample of the late reverb network, given the four lines'
+ * input (decorrelated input plus decayed delay line output) and all-pass
+ * delay output. Returns the mixed result to re-feed the delay lines, and
+ * gives the all-pass delay input in 'apin' and the output in 'out'.
+ */
+static inline __m128 LateStep(const LateParams *params, __m128 *restrict lpsample,
+                              __m128 in, __m128 ap, __m128 *restrict apin,
+                              __m128 *restrict out)
+{
+    /* Signs of the mixing matrix terms, for each shuffle of the inputs. */
+    const __m128 sign1 = _mm_setr_ps( 0.0f, -0.0f,  0.0f, -0.0f);
+    const __m128 sign2 = _mm_setr_ps(-0.0f,  0.0f, -0.0f, -0.0f);
+    const __m128 sign3 = _mm_setr_ps( 0.0f,  0.0f,  0.0f, -0.0f);
+    __m128 d, feed, mix;
+
+    // Low-pass filter each line, then cycle the feed-back from line 0 to 1 to
+    // 3 to 2 and back to 0.
+    *lpsample = _mm_add_ps(in, _mm_mul_ps(_mm_sub_ps(*lpsample, in), params->LpCoeff));
+    d = _mm_shuffle_ps(*lpsample, *lpsample, _MM_SHUFFLE(1, 3, 0, 2));
+
+    // Run each line through its all-pass filter.
+    feed = _mm_mul_ps(params->ApFeedCoeff, d);
+    *apin = _mm_add_ps(_mm_mul_ps(params->ApFeedCoeff, _mm_sub_ps(ap, feed)), d);
+    d = _mm_sub_ps(_mm_mul_ps(params->ApCoeff, ap), feed);
+
+    /* Apply the mixing matrix (see LateReverb_C). Each line gets the other
+     * three, with signs:
+     *   f[0] = d[0] + y*( d[1] - d[2] + d[3])
+     *   f[1] = d[1] + y*(-d[0] + d[2] + d[3])
+     *   f[2] = d[2] + y*( d[0] - d[1] + d[3])
+     *   f[3] = d[3] + y*(-d[0] - d[1] - d[2])
+     */
+    mix = _mm_add_ps(
+        _mm_xor_ps(_mm_shuffle_ps(d, d, _MM_SHUFFLE(0, 0, 0, 1)), sign1),
+        _mm_xor_ps(_mm_shuffle_ps(d, d, _MM_SHUFFLE(1, 1, 2, 2)), sign2)
+    );
+    mix = _mm_add_ps(mix,
+        _mm_xor_ps(_mm_shuffle_ps(d, d, _MM_SHUFFLE(2, 3, 3, 3)), sign3)
+    );
+    d = _mm_add_ps(d, _mm_mul_ps(params->MixCoeff, mix));
+
+    *out = _mm_mul_ps(params->Gain, d);
+    return d;
+}
+
+ALvoid LateReverb_SSE(ALreverbState *State, ALuint todo, ALfloat (*restrict out)[4])
+{
+    alignas(16) ALfloat lines[4][MAX_UPDATE_SAMPLES];
+    alignas(16) ALfloat aplines[4][MAX_UPDATE_SAMPLES];
+    alignas(16) ALfloat deco[4][MAX_UPDATE_SAMPLES];
+    const ALuint limit = minu(MinDelay4(State->Late.Offset), MinDelay4(State->Late.ApOffset));
+    LateParams params;
+    __m128 lpsample;
+    ALuint base, count, offset, i, l;
+
+    params.LpCoeff = _mm_load_ps(State->Late.LpCoeff);
+    params.ApCoeff = _mm_load_ps(State->Late.ApCoeff);
+    params.ApFeedCoeff = _mm_set1_ps(State->Late.ApFeedCoeff);
+    params.MixCoeff = _mm_set1_ps(State->Late.MixCoeff);
+    params.Gain = _mm_set1_ps(State->Late.Gain);
+    lpsample = _mm_load_ps(State->Late.LpSample);
+
+    for(base = 0;base < todo;base += count)
+    {
+        count = minu(todo-base, limit);
+        offset = State->LateOffset + base;
+
+        /* Obtain four decorrelated input samples, and add the decayed results
+         * of the cyclical delay lines.
+         */
+        DelayLineRead(&State->Decorrelator, offset, deco[0], count);
+        for(l = 1;l < 4;l++)
+            DelayLineRead(&State->Decorrelator, offset-State->DecoTap[l-1], deco[l], count);
+        for(l = 0;l < 4;l++)
+        {
+            const __m128 coeff = _mm_set1_ps(State->Late.Coeff[l]);
+
+            DelayLineRead(&State->Late.Delay[l], offset-State->Late.Offset[l], lines[l], count);
+            DelayLineRead(&State->Late.ApDelay[l], offset-State->Late.ApOffset[l], aplines[l],
+                          count);
+            for(i = 0;count-i > 3;i += 4)
+                _mm_store_ps(&deco[l][i], _mm_add_ps(_mm_load_ps(&deco[l][i]),
+                    _mm_mul_ps(_mm_load_ps(&lines[l][i]), coeff)
+                ));
+            for(;i < count;i++)
+                deco[l][i] += lines[l][i] * State->Late.Coeff[l];
+        }
+
+        /* The low-pass filters carry over from one sample to the next, so the
+         * rest goes a sample at a time with the lines in a vector. Samples
+         * are transposed in and out four at a time.
+         */
+        for(i = 0;count-i > 3;i += 4)
+        {
+            __m128 in0 = _mm_load_ps(&deco[0][i]), in1 = _mm_load_ps(&deco[1][i]);
+            __m128 in2 = _mm_load_ps(&deco[2][i]), in3 = _mm_load_ps(&deco[3][i]);
+            __m128 ap0 = _mm_load_ps(&aplines[0][i]), ap1 = _mm_load_ps(&aplines[1][i]);
+            __m128 ap2 = _mm_load_ps(&aplines[2][i]), ap3 = _mm_load_ps(&aplines[3][i]);
+            __m128 o;
+
+            _MM_TRANSPOSE4_PS(in0, in1, in2, in3);
+            _MM_TRANSPOSE4_PS(ap0, ap1, ap2, ap3);
+
+            in0 = LateStep(&params, &lpsample, in0, ap0, &ap0, &o);
+            _mm_store_ps(out[base+i  ], o);
+            in1 = LateStep(&params, &lpsample, in1, ap1, &ap1, &o);
+            _mm_store_ps(out[base+i+1], o);
+            in2 = LateStep(&params, &lpsample, in2, ap2, &ap2, &o);
+            _mm_store_ps(out[base+i+2], o);
+            in3 = LateStep(&params, &lpsample, in3, ap3, &ap3, &o);
+            _mm_store_ps(out[base+i+3], o);
+
+            _MM_TRANSPOSE4_PS(in0, in1, in2, in3);
+            _MM_TRANSPOSE4_PS(ap0, ap1, ap2, ap3);
+            _mm_store_ps(&lines[0][i], in0); _mm_store_ps(&lines[1][i], in1);
+            _mm_store_ps(&lines[2][i], in2); _mm_store_ps(&lines[3][i], in3);
+            _mm_store_ps(&aplines[0][i], ap0); _mm_store_ps(&aplines[1][i], ap1);
+            _mm_store_ps(&aplines[2][i], ap2); _mm_store_ps(&aplines[3][i], ap3);
+        }
+        for(;i < count;i++)
+        {
+            alignas(16) ALfloat f[4], ap[4];
+            __m128 in4, ap4, o;
+
+            in4 = _mm_setr_ps(deco[0][i], deco[1][i], deco[2][i], deco[3][i]);
+            ap4 = _mm_setr_ps(aplines[0][i], aplines[1][i], aplines[2][i], aplines[3][i]);
+            in4 = LateStep(&params, &lpsample, in4, ap4, &ap4, &o);
+            _mm_store_ps(out[base+i], o);
+
+            _mm_store_ps(f, in4);
+            _mm_store_ps(ap, ap4);
+            for(l = 0;l < 4;l++)
+            {
+                lines[l][i] = f[l];
+                aplines[l][i] = ap[l];
+            }
+        }
+
+        // Re-feed the cyclical delay lines and all-pass filters.
+        for(l = 0;l < 4;l++)
+        {
+            DelayLineWrite(&State->Late.Delay[l], offset, lines[l], count);
+            DelayLineWrite(&State->Late.ApDelay[l], offset, aplines[l], count);
+        }
+    }
+    _mm_store_ps(State->Late.LpSample, lpsample);
+}
@@ -0,0 +1,10 @@
+#include "config.h"
+
+#include "AL/al.h"
+#include "alu.h"
+#include "align.h"
+
+/* The sinc4 and sinc8 coefficient tables are generated by firgen at build
+ * time.
+ */
+#include "fir_tables.h"
@@ -0,0 +1,193 @@
+#include "config.h"
+
+#include <math.h>
+
+#include "alu.h"
+#include "limiter.h"
+#include "mixer_defs.h"
+
+#include "almalloc.h"
+
+
+static inline LimiterPeaksFunc SelectLimiterPeaks(void)
+{
+#ifdef HAVE_SSE
+    if((CPUCapFlags&CPU_CAP_SSE))
+        return LimiterPeaks_SSE;
+#endif
+
+    return LimiterPeaks_C;
+}
+
+static inline LimiterHoldFunc SelectLimiterHold(void)
+{
+#ifdef HAVE_SSE
+    if((CPUCapFlags&CPU_CAP_SSE))
+        return LimiterHold_SSE;
+#endif
+
+    return LimiterHold_C;
+}
+
+
+Limiter *CreateLimiter(ALuint numchans, ALuint frequency, ALfloat lookahead,
+                       ALfloat release, ALfloat ceiling)
+{
+    Limiter *limiter;
+    ALuint length, i;
+    size_t size;
+
+    length = maxu((ALuint)(lookahead*frequency + 0.5f), 1);
+
+    /* The window covers the look-ahead plus the current sample, and each
+     * channel gets a delay line the length of the look-ahead.
+     */
+    size = sizeof(*limiter) + sizeof(ALfloat)*((length+1) + (length+2) +
+                                               length + numchans*length);
+    limiter = al_calloc(16, size);
+    if(!limiter) return NULL;
+
+    limiter->NumChans = numchans;
+    limiter->Lookahead = length;
+
+    limiter->Ceiling = ceiling;
+    limiter->ReleaseCoeff = (release > 0.0f) ? expf(-1.0f / (release*frequency)) : 0.0f;
+
+    limiter->Peaks = (ALfloat*)(limiter+1);
+    limiter->Suffix = limiter->Peaks + length+1;
+    limiter->BlockPos = 0;
+    limiter->BlockMax = 0.0f;
+
+    limiter->GainHistory = limiter->Suffix + length+2;
+    for(i = 0;i < length;i++)
+        limiter->GainHistory[i] = 1.0f;
+    limiter->GainPos = 0;
+    limiter->GainSum = length;
+
+    limiter->Envelope = 1.0f;
+
+    limiter->Delay = limiter->GainHistory + length;
+    limiter->DelayPos = 0;
+
+    ATOMIC_INIT(&limiter->GainReduction, 0);
+
+    limiter->FindPeaks = SelectLimiterPeaks();
+    limiter->HoldPeaks = SelectLimiterHold();
+
+    return limiter;
+}
+
+
+/* Replaces the peaks with the largest peak over the window ending at each
+ * one. */
+static void SlidingMax(Limiter *limiter, ALfloat *restrict peaks, ALuint todo)
+{
+    const ALuint window = limiter->Lookahead + 1;
+    ALfloat *restrict blockpeaks = limiter->Peaks;
+    ALfloat *restrict suffix = limiter->Suffix;
+    ALuint base, pos, seg, i;
+    ALfloat blockmax;
+
+    pos = limiter->BlockPos;
+    blockmax = limiter->BlockMax;
+    for(base = 0;base < todo;base += seg)
+    {
+        seg = minu(todo-base, window-pos);
+
+        for(i = 0;i < seg;i++)
+        {
+            ALfloat peak = peaks[base+i];
+            blockpeaks[pos+i] = peak;
+            blockmax = maxf(blockmax, peak);
+            peaks[base+i] = blockmax;
+        }
+        /* The rest of the window is at and after the same position in the
+         * previous block. */
+        limiter->HoldPeaks(&peaks[base], &suffix[pos+1], seg);
+
+        pos += seg;
+        if(pos == window)
+        {
+            suffix[window] = 0.0f;
+            for(i = window;i > 0;i--)
+                suffix[i-1] = maxf(blockpeaks[i-1], suffix[i]);
+            pos = 0;
+            blockmax = 0.0f;
+        }
+    }
+    limiter->BlockPos = pos;
+    limiter->BlockMax = blockmax;
+}
+
+void ApplyLimiter(Limiter *limiter, ALfloat (*restrict buffer)[BUFFERSIZE],
+                  ALuint SamplesToDo)
+{
+    const ALuint length = limiter->Lookahead;
+    const ALfloat ceiling = limiter->Ceiling;
+    const ALfloat release = limiter->ReleaseCoeff;
+    ALfloat *restrict gains = limiter->Gains;
+    ALfloat *restrict history = limiter->GainHistory;
+    ALfloat env, mingain;
+    ALuint gainpos, c, i;
+    ALdouble sum;
+
+    limiter->FindPeaks(gains, buffer, limiter->NumChans, SamplesToDo);
+    SlidingMax(limiter, gains, SamplesToDo);
+
+    /* Average the gains needed for the held peaks over the look-ahead. Each
+     * average includes the gain for the peak that's about to be output, so
+     * it can't be louder than that, and any increase is then slowed by the
+     * release.
+     */
+    env = limiter->Envelope;
+    mingain = 1.0f;
+    sum = limiter->GainSum;
+    gainpos = limiter->GainPos;
+    for(i = 0;i < SamplesToDo;i++)
+    {
+        ALfloat gain = ceiling / maxf(gains[i], ceiling);
+        ALfloat avg;
+
+        sum += (ALdouble)gain - history[gainpos];
+        history[gainpos] = gain;
+        if(++gainpos == length) gainpos = 0;
+
+        avg = (ALfloat)(sum / length);
+        if(avg < env)
+            env = avg;
+        else
+            env = avg + (env-avg)*release;
+        gains[i] = env;
+        mingain = minf(mingain, env);
+    }
+    limiter->Envelope = env;
+    limiter->GainSum = sum;
+    limiter->GainPos = gainpos;
+
+    /* Apply the gains to the delayed input. */
+    for(c = 0;c < limiter->NumChans;c++)
+    {
+        ALfloat *restrict delay = limiter->Delay + c*length;
+        ALfloat *restrict samples = buffer[c];
+        ALuint pos = limiter->DelayPos;
+        ALuint base, todo;
+
+        for(base = 0;base < SamplesToDo;base += todo)
+        {
+            todo = minu(SamplesToDo-base, length-pos);
+            for(i = 0;i < todo;i++)
+            {
+                ALfloat s = delay[pos+i];
+                delay[pos+i] = samples[base+i];
+                samples[base+i] = s * gains[base+i];
+            }
+            pos += todo;
+            if(pos == length) pos = 0;
+        }
+    }
+    limiter->DelayPos = (limiter->DelayPos + SamplesToDo) % length;
+
+    mingain = maxf(mingain, GAIN_SILENCE_THRESHOLD);
+    ATOMIC_STORE(&limiter->GainReduction,
+                 (mingain < 1.0f) ? fastf2u(log10f(mingain)*-2000.0f + 0.5f) : 0);
+}
@@ -0,0 +1,77 @@
+#ifndef LIMITER_H
+#define LIMITER_H
+
+#include "AL/al.h"
+
+#include "alMain.h"
+#include "atomic.h"
+
+/* Finds the largest absolute sample over all channels, for each sample
+ * position. */
+typedef void (*LimiterPeaksFunc)(ALfloat *restrict dst,
+                                 ALfloat (*restrict src)[BUFFERSIZE],
+                                 ALuint numchans, ALuint todo);
+/* Replaces each dst value with the larger of it and the matching src value. */
+typedef void (*LimiterHoldFunc)(ALfloat *restrict dst, const ALfloat *restrict src,
+                                ALuint todo);
+
+/* A look-ahead peak limiter, with the gain linked over all channels. The
+ * output is delayed by the look-ahead length, so the gain can be brought down
+ * over that many samples before a peak reaches the output:
+ *
+ * The largest peak over the look-ahead window (plus the current sample) is
+ * found with a van Herk/Gil-Werman sliding max. The input is split into
+ * blocks the size of the window, and each window is covered by the running
+ * (prefix) max of the current block and the suffix max of the previous one.
+ *
+ * The gain needed to keep that peak under the ceiling is then averaged over
+ * the look-ahead length, which smooths the attack into a ramp while still
+ * reaching the needed gain by the time the peak is output. Increases in gain
+ * are slowed further by the release.
+ */
+typedef struct Limiter {
+    ALuint NumChans;
+    ALuint Lookahead;
+
+    ALfloat Ceiling;
+    ALfloat ReleaseCoeff;
+
+    /* Sliding max state. Peaks holds the current block's input peaks, and
+     * Suffix holds the previous block's suffix maxes (with an extra 0 at the
+     * end for a window that doesn't reach into it). */
+    ALfloat *Peaks;
+    ALfloat *Suffix;
+    ALuint BlockPos;
+    ALfloat BlockMax;
+
+    /* History of the last Lookahead gains, and their sum. */
+    ALfloat *GainHistory;
+    ALuint GainPos;
+    ALdouble GainSum;
+
+    /* The gain currently applied, after the release. */
+    ALfloat Envelope;
+
+    /* Delay lines for each channel's input, Lookahead samples long. */
+    ALfloat *Delay;
+    ALuint DelayPos;
+
+    /* The largest gain reduction during the last update, in millibels. */
+    ATOMIC(ALuint) GainReduction;
+
+    LimiterPeaksFunc FindPeaks;
+    LimiterHoldFunc HoldPeaks;
+
+    alignas(16) ALfloat Gains[BUFFERSIZE];
+} Limiter;
+
+/* Creates a limiter for numchans channels. The look-ahead and release are in
+ * seconds, and the ceiling is a linear amplitude. Free it with al_free. */
+Limiter *CreateLimiter(ALuint numchans, ALuint frequency, ALfloat lookahead,
+                       ALfloat release, ALfloat ceiling);
+
+/* Limits the samples in the buffer in place, delayed by the look-ahead. */
+void ApplyLimiter(Limiter *limiter, ALfloat (*restrict buffer)[BUFFERSIZE],
+                  ALuint SamplesToDo);
+
+#endif /* LIMITER_H */
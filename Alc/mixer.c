@@ -43,18 +43,8 @@ static_assert((INT_MAX>>FRACTIONBITS)/MAX_PITCH > BUFFERSIZE,
 
 extern inline void InitiatePositionArrays(ALuint frac, ALuint increment, ALuint *frac_arr, ALuint *pos_arr, ALuint size);
 
-alignas(16) union ResamplerCoeffs ResampleCoeffs;
-
-
-enum Resampler {
-    PointResampler,
-    LinearResampler,
-    FIR4Resampler,
-    FIR8Resampler,
-    BSincResampler,
-
-    ResamplerDefault = LinearResampler
-};
+enum Resampler ResamplerDefault = LinearResampler;
+ALboolean ResamplerLOD = AL_FALSE;
 
 /* FIR8 requires 3 extra samples before the current position, and 4 after. */
 static_assert(MAX_PRE_SAMPLES >= 3, "MAX_PRE_SAMPLES must be at least 3!");
@@ -63,7 +53,7 @@ static_assert(MAX_POST_SAMPLES >= 4, "MAX_POST_SAMPLES must be at least 4!");
 
 static HrtfMixerFunc MixHrtfSamples = MixHrtf_C;
 static MixerFunc MixSamples = Mix_C;
-static ResamplerFunc ResampleSamples = Resample_point32_C;
+static PolyphaseFunc ResamplePolyphase = Resample_polyphase32_C;
 
 static inline HrtfMixerFunc SelectHrtfMixer(void)
 {
@@ -93,7 +83,17 @@ static inline MixerFunc SelectMixer(void)
     return Mix_C;
 }
 
-static inline ResamplerFunc SelectResampler(enum Resampler resampler)
+static inline PolyphaseFunc SelectPolyphaseResampler(void)
+{
+#ifdef HAVE_SSE
+    if((CPUCapFlags&CPU_CAP_SSE))
+        return Resample_polyphase32_SSE;
+#endif
+
+    return Resample_polyphase32_C;
+}
+
+ResamplerFunc SelectResampler(enum Resampler resampler)
 {
     switch(resampler)
     {
@@ -129,7 +129,9 @@ static inline ResamplerFunc SelectResampler(enum Resampler resampler)
                 return Resample_fir8_32_SSE3;
 #endif
             return Resample_fir8_32_C;
-        case BSincResampler:
+        case BSinc8Resampler:
+        case BSinc12Resampler:
+        case BSinc24Resampler:
 #ifdef HAVE_SSE
             if((CPUCapFlags&CPU_CAP_SSE))
                 return Resample_bsinc32_SSE;
@@ -141,146 +143,46 @@ static inline ResamplerFunc SelectResampler(enum Resampler resampler)
 }
 
 
-/* The sinc resampler makes use of a Kaiser window to limit the needed sample
- * points to 4 and 8, respectively.
- */
-
-#ifndef M_PI
-#define M_PI                         (3.14159265358979323846)
-#endif
-static inline double Sinc(double x)
-{
-    if(x == 0.0) return 1.0;
-    return sin(x*M_PI) / (x*M_PI);
-}
-
-/* The zero-order modified Bessel function of the first kind, used for the
- * Kaiser window.
- *
- *   I_0(x) = sum_{k=0}^inf (1 / k!)^2 (x / 2)^(2 k)
- *          = sum_{k=0}^inf ((x / 2)^k / k!)^2
- */
-static double BesselI_0(double x)
-{
-    double term, sum, x2, y, last_sum;
-    int k;
-
-    /* Start at k=1 since k=0 is trivial. */
-    term = 1.0;
-    sum = 1.0;
-    x2 = x / 2.0;
-    k = 1;
-
-    /* Let the integration converge until the term of the sum is no longer
-     * significant.
-     */
-    do {
-        y = x2 / k;
-        k ++;
-        last_sum = sum;
-        term *= y * y;
-        sum += term;
-    } while(sum != last_sum);
-    return sum;
-}
-
-/* Calculate a Kaiser window from the given beta value and a normalized k
- * [-1, 1].
- *
- *   w(k) = { I_0(B sqrt(1 - k^2)) / I_0(B),  -1 <= k <= 1
- *          { 0,                              elsewhere.
- *
- * Where k can be calculated as:
- *
- *   k = i / l,         where -l <= i <= l.
- *
- * or:
- *
- *   k = 2 i / M - 1,   where 0 <= i <= M.
- */
-static inline double Kaiser(double b, double k)
-{
-    if(k <= -1.0 || k >= 1.0) return 0.0;
-    return BesselI_0(b * sqrt(1.0 - (k*k))) / BesselI_0(b);
-}
-
-static inline double CalcKaiserBeta(double rejection)
-{
-    if(rejection > 50.0)
-        return 0.1102 * (rejection - 8.7);
-    if(rejection >= 21.0)
-        return (0.5842 * pow(rejection - 21.0, 0.4)) +
-               (0.07886 * (rejection - 21.0));
-    return 0.0;
-}
-
-static float SincKaiser(double r, double x)
-{
-    /* Limit rippling to -60dB. */
-    return (float)(Kaiser(CalcKaiserBeta(60.0), x / r) * Sinc(x));
-}
-
-
 void aluInitMixer(void)
 {
-    enum Resampler resampler = ResamplerDefault;
     const char *str;
-    ALuint i;
 
     if(ConfigValueStr(NULL, NULL, "resampler", &str))
     {
         if(strcasecmp(str, "point") == 0 || strcasecmp(str, "none") == 0)
-            resampler = PointResampler;
+            ResamplerDefault = PointResampler;
         else if(strcasecmp(str, "linear") == 0)
-            resampler = LinearResampler;
+            ResamplerDefault = LinearResampler;
         else if(strcasecmp(str, "sinc4") == 0)
-            resampler = FIR4Resampler;
+            ResamplerDefault = FIR4Resampler;
         else if(strcasecmp(str, "sinc8") == 0)
-            resampler = FIR8Resampler;
-        else if(strcasecmp(str, "bsinc") == 0)
-            resampler = BSincResampler;
+            ResamplerDefault = FIR8Resampler;
+        else if(strcasecmp(str, "bsinc8") == 0)
+            ResamplerDefault = BSinc8Resampler;
+        else if(strcasecmp(str, "bsinc") == 0 || strcasecmp(str, "bsinc12") == 0)
+            ResamplerDefault = BSinc12Resampler;
+        else if(strcasecmp(str, "bsinc24") == 0)
+            ResamplerDefault = BSinc24Resampler;
         else if(strcasecmp(str, "cubic") == 0)
         {
             WARN("Resampler option \"cubic\" is deprecated, using sinc4\n");
-            resampler = FIR4Resampler;
+            ResamplerDefault = FIR4Resampler;
         }
         else
         {
             char *end;
             long n = strtol(str, &end, 0);
             if(*end == '\0' && (n == PointResampler || n == LinearResampler || n == FIR4Resampler))
-                resampler = n;
+                ResamplerDefault = n;
             else
                 WARN("Invalid resampler: %s\n", str);
         }
     }
-
-    if(resampler == FIR8Resampler)
-        for(i = 0;i < FRACTIONONE;i++)
-        {
-            ALdouble mu = (ALdouble)i / FRACTIONONE;
-            ResampleCoeffs.FIR8[i][0] = SincKaiser(4.0, mu - -3.0);
-            ResampleCoeffs.FIR8[i][1] = SincKaiser(4.0, mu - -2.0);
-            ResampleCoeffs.FIR8[i][2] = SincKaiser(4.0, mu - -1.0);
-            ResampleCoeffs.FIR8[i][3] = SincKaiser(4.0, mu -  0.0);
-            ResampleCoeffs.FIR8[i][4] = SincKaiser(4.0, mu -  1.0);
-            ResampleCoeffs.FIR8[i][5] = SincKaiser(4.0, mu -  2.0);
-            ResampleCoeffs.FIR8[i][6] = SincKaiser(4.0, mu -  3.0);
-            ResampleCoeffs.FIR8[i][7] = SincKaiser(4.0, mu -  4.0);
-        }
-    else if(resampler == FIR4Resampler)
-        for(i = 0;i < FRACTIONONE;i++)
-        {
-            ALdouble mu = (ALdouble)i / FRACTIONONE;
-            ResampleCoeffs.FIR4[i][0] = SincKaiser(2.0, mu - -1.0);
-            ResampleCoeffs.FIR4[i][1] = SincKaiser(2.0, mu -  0.0);
-            ResampleCoeffs.FIR4[i][2] = SincKaiser(2.0, mu -  1.0);
-            ResampleCoeffs.FIR4[i][3] = SincKaiser(2.0, mu -  2.0);
-        }
+    ResamplerLOD = GetConfigValueBool(NULL, NULL, "resampler-lod", AL_FALSE);
 
     MixHrtfSamples = SelectHrtfMixer();
     MixSamples = SelectMixer();
-    ResampleSamples = SelectResampler(resampler);
+    ResamplePolyphase = SelectPolyphaseResampler();
 }
 
 
@@ -371,10 +273,12 @@ static const ALfloat *DoFilters(ALfilterState *lpfilter, ALfilterState *hpfilter
 ALvoid MixSource(ALvoice *voice, ALsource *Source, ALCdevice *Device, ALuint SamplesToDo)
 {
     ResamplerFunc Resample;
+    const PolyphaseBank *Polyphase;
     ALbufferlistitem *BufferListItem;
     ALuint DataPosInt, DataPosFrac;
     ALboolean Looping;
     ALuint increment;
+    ALuint PolyStep, Phase;
     ALenum State;
     ALuint OutPos;
     ALuint NumChannels;
@@ -392,15 +296,21 @@ ALvoid MixSource(ALvoice *voice, ALsource *Source, ALCdevice *Device, ALuint Sam
     NumChannels    = Source->NumChannels;
     SampleSize     = Source->SampleSize;
     increment      = voice->Step;
+    Polyphase      = voice->Polyphase;
+
+    /* A filter bank steps through its phases, 1/Phases of a sample each. */
+    PolyStep = (Polyphase ? Polyphase->IntStep*Polyphase->Phases + Polyphase->FracStep : 0);
+    Phase = 0;
 
     IrSize = (Device->Hrtf ? GetHrtfIrSize(Device->Hrtf) : 0);
 
     Resample = ((increment == FRACTIONONE && DataPosFrac == 0) ?
-                Resample_copy32_C : ResampleSamples);
+                Resample_copy32_C : voice->Resampler);
 
     OutPos = 0;
     do {
         ALuint SrcBufferSize, DstBufferSize;
+        ALuint SrcAdvance, NewPosFrac;
         ALuint Counter;
         ALfloat Delta;
 
@@ -415,22 +325,48 @@ ALvoid MixSource(ALvoice *voice, ALsource *Source, ALCdevice *Device, ALuint Sam
             Delta = 1.0f / (ALfloat)Counter;
         }
 
-        /* Figure out how many buffer samples will be needed */
-        DataSize64  = SamplesToDo-OutPos;
-        DataSize64 *= increment;
-        DataSize64 += DataPosFrac+FRACTIONMASK;
-        DataSize64 >>= FRACTIONBITS;
-        DataSize64 += MAX_POST_SAMPLES+MAX_PRE_SAMPLES;
-
-        SrcBufferSize = (ALuint)mini64(DataSize64, BUFFERSIZE);
-
-        /* Figure out how many samples we can actually mix from this. */
-        DataSize64  = SrcBufferSize;
-        DataSize64 -= MAX_POST_SAMPLES+MAX_PRE_SAMPLES;
-        DataSize64 <<= FRACTIONBITS;
-        DataSize64 -= DataPosFrac;
-
-        DstBufferSize = (ALuint)((DataSize64+(increment-1)) / increment);
+        if(!Polyphase)
+        {
+            /* Figure out how many buffer samples will be needed */
+            DataSize64  = SamplesToDo-OutPos;
+            DataSize64 *= increment;
+            DataSize64 += DataPosFrac+FRACTIONMASK;
+            DataSize64 >>= FRACTIONBITS;
+            DataSize64 += MAX_POST_SAMPLES+MAX_PRE_SAMPLES;
+
+            SrcBufferSize = (ALuint)mini64(DataSize64, BUFFERSIZE);
+
+            /* Figure out how many samples we can actually mix from this. */
+            DataSize64  = SrcBufferSize;
+            DataSize64 -= MAX_POST_SAMPLES+MAX_PRE_SAMPLES;
+            DataSize64 <<= FRACTIONBITS;
+            DataSize64 -= DataPosFrac;
+
+            DstBufferSize = (ALuint)((DataSize64+(increment-1)) / increment);
+        }
+        else
+        {
+            /* The fractional position was stored rounded down from the phase,
+             * so rounding up gets the phase back. */
+            Phase = (ALuint)(((ALuint64)DataPosFrac*Polyphase->Phases + FRACTIONMASK) >>
+                             FRACTIONBITS);
+            Phase = minu(Phase, Polyphase->Phases-1);
+
+            DataSize64  = SamplesToDo-OutPos;
+            DataSize64 *= PolyStep;
+            DataSize64 += Phase + Polyphase->Phases-1;
+            DataSize64 /= Polyphase->Phases;
+            DataSize64 += MAX_POST_SAMPLES+MAX_PRE_SAMPLES;
+
+            SrcBufferSize = (ALuint)mini64(DataSize64, BUFFERSIZE);
+
+            DataSize64  = SrcBufferSize;
+            DataSize64 -= MAX_POST_SAMPLES+MAX_PRE_SAMPLES;
+            DataSize64 *= Polyphase->Phases;
+            DataSize64 -= Phase;
+
+            DstBufferSize = (ALuint)((DataSize64+(PolyStep-1)) / PolyStep);
+        }
         DstBufferSize = minu(DstBufferSize, (SamplesToDo-OutPos));
 
         /* Some mixers like having a multiple of 4, so try to give that unless
@@ -438,6 +374,19 @@ ALvoid MixSource(ALvoice *voice, ALsource *Source, ALCdevice *Device, ALuint Sam
         if(OutPos+DstBufferSize < SamplesToDo)
             DstBufferSize &= ~3;
 
+        /* Work out where the source will be after this many samples. */
+        if(!Polyphase)
+        {
+            SrcAdvance = (increment*DstBufferSize + DataPosFrac)>>FRACTIONBITS;
+            NewPosFrac = (increment*DstBufferSize + DataPosFrac)&FRACTIONMASK;
+        }
+        else
+        {
+            SrcAdvance = (PolyStep*DstBufferSize + Phase) / Polyphase->Phases;
+            NewPosFrac = (PolyStep*DstBufferSize + Phase) % Polyphase->Phases;
+            NewPosFrac = (ALuint)(((ALuint64)NewPosFrac<<FRACTIONBITS) / Polyphase->Phases);
+        }
+
         for(chan = 0;chan < NumChannels;chan++)
         {
             const ALfloat *ResampledData;
@@ -530,7 +479,7 @@ ALvoid MixSource(ALvoice *voice, ALsource *Source, ALCdevice *Device, ALuint Sam
                             SrcDataSize += DataSize;
                         }
                     }
-                    tmpiter = tmpiter->next;
+                    tmpiter = ATOMIC_LOAD(&tmpiter->next);
                     if(!tmpiter && Looping)
                         tmpiter = ATOMIC_LOAD(&Source->queue);
                     else if(!tmpiter)
@@ -542,16 +491,20 @@ ALvoid MixSource(ALvoice *voice, ALsource *Source, ALCdevice *Device, ALuint Sam
             }
 
             /* Store the last source samples used for next time. */
-            memcpy(voice->PrevSamples[chan],
-                &SrcData[(increment*DstBufferSize + DataPosFrac)>>FRACTIONBITS],
-                MAX_PRE_SAMPLES*sizeof(ALfloat)
-            );
+            memcpy(voice->PrevSamples[chan], &SrcData[SrcAdvance],
+                   MAX_PRE_SAMPLES*sizeof(ALfloat));
 
             /* Now resample, then filter and mix to the appropriate outputs. */
-            ResampledData = Resample(&voice->SincState,
-                &SrcData[MAX_PRE_SAMPLES], DataPosFrac, increment,
-                Device->ResampledData, DstBufferSize
-            );
+            if(Polyphase)
+                ResampledData = ResamplePolyphase(Polyphase,
+                    &SrcData[MAX_PRE_SAMPLES], Phase,
+                    Device->ResampledData, DstBufferSize
+                );
+            else
+                ResampledData = Resample(&voice->SincState,
+                    &SrcData[MAX_PRE_SAMPLES], DataPosFrac, increment,
+                    Device->ResampledData, DstBufferSize
+                );
             {
                 DirectParams *parms = &voice->Direct;
                 const ALfloat *samples;
@@ -697,9 +650,8 @@ ALvoid MixSource(ALvoice *voice, ALsource *Source, ALCdevice *Device, ALuint Sam
             }
         }
         /* Update positions */
-        DataPosFrac += increment*DstBufferSize;
-        DataPosInt  += DataPosFrac>>FRACTIONBITS;
-        DataPosFrac &= FRACTIONMASK;
+        DataPosInt  += SrcAdvance;
+        DataPosFrac  = NewPosFrac;
 
         OutPos += DstBufferSize;
         voice->Offset += DstBufferSize;
@@ -731,7 +683,7 @@ ALvoid MixSource(ALvoice *voice, ALsource *Source, ALCdevice *Device, ALuint Sam
             if(DataSize > DataPosInt)
                 break;
 
-            if(!(BufferListItem=BufferListItem->next))
+            if(!(BufferListItem=ATOMIC_LOAD(&BufferListItem->next)))
             {
                 if(Looping)
                     BufferListItem = ATOMIC_LOAD(&Source->queue);
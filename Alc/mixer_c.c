@@ -6,6 +6,8 @@
 #include "alu.h"
 #include "alSource.h"
 #include "alAuxEffectSlot.h"
+#include "alFilter.h"
+#include "bformatdec.h"
 
 
 static inline ALfloat point32(const ALfloat *vals, ALuint UNUSED(frac))
@@ -92,6 +94,34 @@ const ALfloat *Resample_bsinc32_C(const BsincState *state, const ALfloat *src, A
     return dst;
 }
 
+const ALfloat *Resample_polyphase32_C(const PolyphaseBank *bank, const ALfloat *src,
+                                      ALuint phase, ALfloat *restrict dst, ALuint dstlen)
+{
+    const ALfloat *fil;
+    ALuint j, i;
+    ALfloat r;
+
+    src += bank->Offset;
+    for(i = 0;i < dstlen;i++)
+    {
+        fil = &bank->Coeffs[phase*bank->Taps];
+
+        r = 0.0f;
+        for(j = 0;j < bank->Taps;j++)
+            r += fil[j] * src[j];
+        dst[i] = r;
+
+        src   += bank->IntStep;
+        phase += bank->FracStep;
+        if(phase >= bank->Phases)
+        {
+            phase -= bank->Phases;
+            src++;
+        }
+    }
+    return dst;
+}
+
 
 void ALfilterState_processC(ALfilterState *filter, ALfloat *restrict dst, const ALfloat *src, ALuint numsamples)
 {
@@ -167,3 +197,338 @@ void Mix_C(const ALfloat *data, ALuint OutChans, ALfloat (*restrict OutBuffer)[B
             OutBuffer[c][OutPos+pos] += data[pos]*gain;
     }
 }
+
+
+/* Clamps the distance for the clamped distance models, returning the model to
+ * calculate the attenuation with. A clamped model with the max distance below
+ * the reference distance doesn't attenuate.
+ */
+static inline enum DistanceModel ClampDistance(enum DistanceModel model, ALfloat *dist,
+                                               ALfloat mindist, ALfloat maxdist)
+{
+    switch(model)
+    {
+        case InverseDistanceClamped:
+        case LinearDistanceClamped:
+        case ExponentDistanceClamped:
+            *dist = clampf(*dist, mindist, maxdist);
+            if(maxdist < mindist)
+                return DisableDistance;
+            return (model == InverseDistanceClamped) ? InverseDistance :
+                   (model == LinearDistanceClamped) ? LinearDistance : ExponentDistance;
+
+        case DisableDistance:
+            *dist = mindist;
+            break;
+
+        case InverseDistance:
+        case LinearDistance:
+        case ExponentDistance:
+            break;
+    }
+    return model;
+}
+
+static inline ALfloat CalcAttenuation(enum DistanceModel model, ALfloat dist, ALfloat mindist,
+                                      ALfloat maxdist, ALfloat rolloff)
+{
+    switch(model)
+    {
+        case InverseDistance:
+            if(mindist > 0.0f)
+            {
+                dist = lerp(mindist, dist, rolloff);
+                if(dist > 0.0f) return mindist / dist;
+            }
+            break;
+
+        case LinearDistance:
+            if(maxdist != mindist)
+                return maxf(1.0f - (rolloff*(dist-mindist)/(maxdist - mindist)), 0.0f);
+            break;
+
+        case ExponentDistance:
+            if(dist > 0.0f && mindist > 0.0f)
+                return powf(dist/mindist, -rolloff);
+            break;
+
+        case InverseDistanceClamped:
+        case LinearDistanceClamped:
+        case ExponentDistanceClamped:
+        case DisableDistance:
+            break;
+    }
+    return 1.0f;
+}
+
+/* Calculates the distance attenuation, air absorption, cone, Doppler, and
+ * direction outputs from the geometry outputs. */
+static void CalcSourceAttenuation_C(SourceGeometry *geom, ALsizei count)
+{
+    const ALsizei NumSends = geom->NumSends;
+    ALsizei i, s;
+
+    for(i = 0;i < count;i++)
+    {
+        const ALfloat mindist = geom->RefDistance[i];
+        const ALfloat maxdist = geom->MaxDistance[i];
+        ALfloat dist = geom->Distance[i];
+        ALfloat attn, angle, scale;
+        enum DistanceModel model;
+
+        /* Distance attenuation, for the dry path and each send. */
+        model = ClampDistance(geom->DistanceModel[i], &dist, mindist, maxdist);
+        attn = CalcAttenuation(model, dist, mindist, maxdist, geom->Rolloff[i]);
+        geom->Attenuation[i] = attn;
+        for(s = 0;s < NumSends;s++)
+            geom->RoomAttenuation[s][i] = CalcAttenuation(model, dist, mindist, maxdist,
+                                                          geom->RoomRolloff[s][i]);
+
+        /* Distance-based air absorption. */
+        geom->AirAbsorptionHF[i] = 1.0f;
+        for(s = 0;s < NumSends;s++)
+            geom->RoomAirAbsorptionHF[s][i] = 1.0f;
+        if(geom->AirAbsorption[i] > 0.0f && dist > mindist)
+        {
+            ALfloat meters = (dist-mindist) * geom->AirAbsorption[i];
+            geom->AirAbsorptionHF[i] = powf(AIRABSORBGAINHF, meters);
+            for(s = 0;s < NumSends;s++)
+                geom->RoomAirAbsorptionHF[s][i] = powf(geom->RoomAirAbsorption[s][i], meters);
+        }
+
+        /* The initial decay of each send's reverb, over the apparent distance
+         * given by the dry path's attenuation. */
+        for(s = 0;s < NumSends;s++)
+        {
+            ALfloat apparentdist = 1.0f/maxf(attn, 0.00001f) - 1.0f;
+            geom->WetDecay[s][i] = 1.0f;
+            if(geom->DecayDistance[s][i] > 0.0f)
+                geom->WetDecay[s][i] = powf(0.001f/*-60dB*/, apparentdist/geom->DecayDistance[s][i]);
+        }
+
+        /* Directional soundcones. */
+        angle = RAD2DEG(acosf(geom->DirDot[i]) * ConeScale) * 2.0f;
+        if(angle > geom->InnerAngle[i] && angle <= geom->OuterAngle[i])
+        {
+            scale = (angle-geom->InnerAngle[i]) / (geom->OuterAngle[i]-geom->InnerAngle[i]);
+            geom->ConeGain[i] = lerp(1.0f, geom->OuterGain[i], scale);
+            geom->ConeGainHF[i] = lerp(1.0f, geom->OuterGainHF[i], scale);
+        }
+        else if(angle > geom->OuterAngle[i])
+        {
+            geom->ConeGain[i] = geom->OuterGain[i];
+            geom->ConeGainHF[i] = geom->OuterGainHF[i];
+        }
+        else
+        {
+            geom->ConeGain[i] = 1.0f;
+            geom->ConeGainHF[i] = 1.0f;
+        }
+
+        /* Velocity-based Doppler effect. */
+        geom->DopplerShift[i] = 1.0f;
+        if(geom->DopplerFactor[i] > 0.0f)
+        {
+            ALfloat doppler = geom->DopplerFactor[i];
+            ALfloat sos = geom->SpeedOfSound;
+            ALfloat vss, vls;
+
+            if(sos < 1.0f)
+            {
+                doppler *= 1.0f/sos;
+                sos = 1.0f;
+            }
+            vss = geom->VelDot[i] * doppler;
+            vls = geom->ListenerVelDot[i] * doppler;
+            geom->DopplerShift[i] = clampf(sos-vls, 1.0f, sos*2.0f - 1.0f) /
+                                    clampf(sos-vss, 1.0f, sos*2.0f - 1.0f);
+        }
+
+        /* Elevation and azimuth of the source, only when it's not at the
+         * listener. This prevents +0 and -0 Z from producing inconsistent
+         * panning. Also, clamp Y in case FP precision errors cause it to land
+         * outside of -1..+1. */
+        geom->Elevation[i] = 0.0f;
+        geom->Azimuth[i] = 0.0f;
+        if(geom->Distance[i] > FLT_EPSILON)
+        {
+            geom->Elevation[i] = asinf(clampf(-geom->ToListenerY[i], -1.0f, 1.0f));
+            geom->Azimuth[i] = atan2f(-geom->ToListenerX[i], geom->ToListenerZ[i]*ZScale);
+        }
+    }
+}
+
+void CalcSourceGeometry_C(SourceGeometry *geom, ALsizei count)
+{
+    const ALfloat (*rot)[3] = geom->Rotation;
+    const ALfloat *lvel = geom->ListenerVel;
+    ALsizei i;
+
+    for(i = 0;i < count;i++)
+    {
+        ALfloat px = geom->PosX[i], py = geom->PosY[i], pz = geom->PosZ[i];
+        ALfloat vx = geom->VelX[i], vy = geom->VelY[i], vz = geom->VelZ[i];
+        ALfloat dx = geom->DirX[i], dy = geom->DirY[i], dz = geom->DirZ[i];
+        ALfloat tx, ty, tz, vel[3], dir[3], len;
+
+        tx = -(px*rot[0][0] + py*rot[1][0] + pz*rot[2][0]);
+        ty = -(px*rot[0][1] + py*rot[1][1] + pz*rot[2][1]);
+        tz = -(px*rot[0][2] + py*rot[1][2] + pz*rot[2][2]);
+        vel[0] = vx*rot[0][0] + vy*rot[1][0] + vz*rot[2][0];
+        vel[1] = vx*rot[0][1] + vy*rot[1][1] + vz*rot[2][1];
+        vel[2] = vx*rot[0][2] + vy*rot[1][2] + vz*rot[2][2];
+        dir[0] = dx*rot[0][0] + dy*rot[1][0] + dz*rot[2][0];
+        dir[1] = dx*rot[0][1] + dy*rot[1][1] + dz*rot[2][1];
+        dir[2] = dx*rot[0][2] + dy*rot[1][2] + dz*rot[2][2];
+
+        len = sqrtf(dir[0]*dir[0] + dir[1]*dir[1] + dir[2]*dir[2]);
+        if(len > 0.0f)
+        {
+            dir[0] /= len;
+            dir[1] /= len;
+            dir[2] /= len;
+        }
+
+        len = sqrtf(tx*tx + ty*ty + tz*tz);
+        if(len > 0.0f)
+        {
+            tx /= len;
+            ty /= len;
+            tz /= len;
+        }
+
+        geom->ToListenerX[i] = tx;
+        geom->ToListenerY[i] = ty;
+        geom->ToListenerZ[i] = tz;
+        geom->Distance[i] = len;
+        geom->DirDot[i] = dir[0]*tx + dir[1]*ty + dir[2]*tz;
+        geom->VelDot[i] = vel[0]*tx + vel[1]*ty + vel[2]*tz;
+        geom->ListenerVelDot[i] = lvel[0]*tx + lvel[1]*ty + lvel[2]*tz;
+    }
+
+    CalcSourceAttenuation_C(geom, count);
+}
+
+
+void MulAccSpectra_C(ALfloat *restrict accr, ALfloat *restrict acci,
+                     const ALfloat *xr, const ALfloat *xi,
+                     const ALfloat *hr, const ALfloat *hi, ALuint count)
+{
+    ALuint i;
+    for(i = 0;i < count;i++)
+    {
+        accr[i] += xr[i]*hr[i] - xi[i]*hi[i];
+        acci[i] += xr[i]*hi[i] + xi[i]*hr[i];
+    }
+}
+
+
+void FilterLanes_C(const ALfilterState *filters, ALfilterLanes *lanes, ALuint numfilters,
+                   ALuint numchans, ALfloat *const *dst, const ALfloat *const *src,
+                   ALuint numsamples)
+{
+    ALuint c, f, i;
+
+    for(c = 0;c < numchans;c++)
+    {
+        const ALfloat *input = src[c];
+        ALfloat *output = dst[c];
+
+        for(f = 0;f < numfilters;f++)
+        {
+            const ALfloat b0 = filters[f].input_gain;
+            const ALfloat b1 = filters[f].b1;
+            const ALfloat b2 = filters[f].b2;
+            const ALfloat a1 = filters[f].a1;
+            const ALfloat a2 = filters[f].a2;
+            ALfloat z1 = lanes[f].z1[c];
+            ALfloat z2 = lanes[f].z2[c];
+
+            for(i = 0;i < numsamples;i++)
+            {
+                const ALfloat x = input[i];
+                const ALfloat y = x*b0 + z1;
+                z1 = x*b1 - y*a1 + z2;
+                z2 = x*b2 - y*a2;
+                output[i] = y;
+            }
+            lanes[f].z1[c] = z1;
+            lanes[f].z2[c] = z2;
+
+            /* Following filters run in place on the output. */
+            input = output;
+        }
+    }
+}
+
+void BandSplit_C(BandSplitter *splitter, ALuint numchans, ALfloat *const *hpout,
+                 ALfloat *const *lpout, const ALfloat *const *input, ALuint count)
+{
+    ALfloat coeff, d, x;
+    ALfloat z1, z2;
+    ALuint c, i;
+
+    for(c = 0;c < numchans;c++)
+    {
+        const ALfloat *in = input[c];
+        ALfloat *restrict lp = lpout[c];
+        ALfloat *restrict hp = hpout[c];
+
+        coeff = splitter->coeff*0.5f + 0.5f;
+        z1 = splitter->lp_z1[c];
+        z2 = splitter->lp_z2[c];
+        for(i = 0;i < count;i++)
+        {
+            x = in[i];
+
+            d = (x - z1) * coeff;
+            x = z1 + d;
+            z1 = x + d;
+
+            d = (x - z2) * coeff;
+            x = z2 + d;
+            z2 = x + d;
+
+            lp[i] = x;
+        }
+        splitter->lp_z1[c] = z1;
+        splitter->lp_z2[c] = z2;
+
+        coeff = splitter->coeff;
+        z1 = splitter->hp_z1[c];
+        for(i = 0;i < count;i++)
+        {
+            x = in[i];
+
+            d = x - coeff*z1;
+            x = z1 + coeff*d;
+            z1 = d;
+
+            hp[i] = x - lp[i];
+        }
+        splitter->hp_z1[c] = z1;
+    }
+}
+
+
+void LimiterPeaks_C(ALfloat *restrict dst, ALfloat (*restrict src)[BUFFERSIZE],
+                    ALuint numchans, ALuint todo)
+{
+    ALuint c, i;
+
+    for(i = 0;i < todo;i++)
+        dst[i] = fabsf(src[0][i]);
+    for(c = 1;c < numchans;c++)
+    {
+        for(i = 0;i < todo;i++)
+            dst[i] = maxf(dst[i], fabsf(src[c][i]));
+    }
+}
+
+void LimiterHold_C(ALfloat *restrict dst, const ALfloat *restrict src, ALuint todo)
+{
+    ALuint i;
+
+    for(i = 0;i < todo;i++)
+        dst[i] = maxf(dst[i], src[i]);
+}
@@ -11,6 +11,10 @@ struct MixGains;
 struct MixHrtfParams;
 struct HrtfState;
 
+struct ALfilterState;
+struct ALfilterLanes;
+struct BandSplitter;
+
 /* C resamplers */
 const ALfloat *Resample_copy32_C(const BsincState *state, const ALfloat *src, ALuint frac, ALuint increment, ALfloat *restrict dst, ALuint dstlen);
 const ALfloat *Resample_point32_C(const BsincState *state, const ALfloat *src, ALuint frac, ALuint increment, ALfloat *restrict dst, ALuint dstlen);
@@ -18,6 +22,7 @@ const ALfloat *Resample_lerp32_C(const BsincState *state, const ALfloat *src, AL
 const ALfloat *Resample_fir4_32_C(const BsincState *state, const ALfloat *src, ALuint frac, ALuint increment, ALfloat *restrict dst, ALuint dstlen);
 const ALfloat *Resample_fir8_32_C(const BsincState *state, const ALfloat *src, ALuint frac, ALuint increment, ALfloat *restrict dst, ALuint dstlen);
 const ALfloat *Resample_bsinc32_C(const BsincState *state, const ALfloat *src, ALuint frac, ALuint increment, ALfloat *restrict dst, ALuint dstlen);
+const ALfloat *Resample_polyphase32_C(const PolyphaseBank *bank, const ALfloat *src, ALuint phase, ALfloat *restrict dst, ALuint dstlen);
 
 
 /* C mixers */
@@ -28,6 +33,26 @@ void MixHrtf_C(ALfloat (*restrict OutBuffer)[BUFFERSIZE], ALuint lidx, ALuint ri
 void Mix_C(const ALfloat *data, ALuint OutChans, ALfloat (*restrict OutBuffer)[BUFFERSIZE],
            struct MixGains *Gains, ALuint Counter, ALuint OutPos, ALuint BufferSize);
 
+/* C source geometry */
+void CalcSourceGeometry_C(SourceGeometry *geom, ALsizei count);
+
+/* C convolution */
+void MulAccSpectra_C(ALfloat *restrict accr, ALfloat *restrict acci,
+                     const ALfloat *xr, const ALfloat *xi,
+                     const ALfloat *hr, const ALfloat *hi, ALuint count);
+
+/* C lane filters */
+void FilterLanes_C(const struct ALfilterState *filters, struct ALfilterLanes *lanes,
+                   ALuint numfilters, ALuint numchans, ALfloat *const *dst,
+                   const ALfloat *const *src, ALuint numsamples);
+void BandSplit_C(struct BandSplitter *splitter, ALuint numchans, ALfloat *const *hpout,
+                 ALfloat *const *lpout, const ALfloat *const *input, ALuint count);
+
+/* C limiter */
+void LimiterPeaks_C(ALfloat *restrict dst, ALfloat (*restrict src)[BUFFERSIZE],
+                    ALuint numchans, ALuint todo);
+void LimiterHold_C(ALfloat *restrict dst, const ALfloat *restrict src, ALuint todo);
+
 /* SSE mixers */
 void MixHrtf_SSE(ALfloat (*restrict OutBuffer)[BUFFERSIZE], ALuint lidx, ALuint ridx,
                  const ALfloat *data, ALuint Counter, ALuint Offset, ALuint OutPos,
@@ -36,6 +61,23 @@ void MixHrtf_SSE(ALfloat (*restrict OutBuffer)[BUFFERSIZE], ALuint lidx, ALuint
 void Mix_SSE(const ALfloat *data, ALuint OutChans, ALfloat (*restrict OutBuffer)[BUFFERSIZE],
              struct MixGains *Gains, ALuint Counter, ALuint OutPos, ALuint BufferSize);
 
+/* SSE convolution */
+void MulAccSpectra_SSE(ALfloat *restrict accr, ALfloat *restrict acci,
+                       const ALfloat *xr, const ALfloat *xi,
+                       const ALfloat *hr, const ALfloat *hi, ALuint count);
+
+/* SSE lane filters */
+void FilterLanes_SSE(const struct ALfilterState *filters, struct ALfilterLanes *lanes,
+                     ALuint numfilters, ALuint numchans, ALfloat *const *dst,
+                     const ALfloat *const *src, ALuint numsamples);
+void BandSplit_SSE(struct BandSplitter *splitter, ALuint numchans, ALfloat *const *hpout,
+                   ALfloat *const *lpout, const ALfloat *const *input, ALuint count);
+
+/* SSE limiter */
+void LimiterPeaks_SSE(ALfloat *restrict dst, ALfloat (*restrict src)[BUFFERSIZE],
+                      ALuint numchans, ALuint todo);
+void LimiterHold_SSE(ALfloat *restrict dst, const ALfloat *restrict src, ALuint todo);
+
 /* SSE resamplers */
 inline void InitiatePositionArrays(ALuint frac, ALuint increment, ALuint *frac_arr, ALuint *pos_arr, ALuint size)
 {
@@ -53,9 +95,23 @@ inline void InitiatePositionArrays(ALuint frac, ALuint increment, ALuint *frac_a
 
 const ALfloat *Resample_bsinc32_SSE(const BsincState *state, const ALfloat *src, ALuint frac,
                                     ALuint increment, ALfloat *restrict dst, ALuint dstlen);
+const ALfloat *Resample_polyphase32_SSE(const PolyphaseBank *bank, const ALfloat *src,
+                                        ALuint phase, ALfloat *restrict dst, ALuint dstlen);
 
 const ALfloat *Resample_lerp32_SSE2(const BsincState *state, const ALfloat *src, ALuint frac, ALuint increment,
                                     ALfloat *restrict dst, ALuint numsamples);
+
+/* SSE2 output conversion, for 2, 6, or 8 channels */
+void WriteFloat_SSE2(ALfloat (*restrict src)[BUFFERSIZE], ALvoid *dst, ALuint todo,
+                     ALuint numchans);
+void WriteInt_SSE2(ALfloat (*restrict src)[BUFFERSIZE], ALvoid *dst, ALuint todo,
+                   ALuint numchans);
+void WriteShort_SSE2(ALfloat (*restrict src)[BUFFERSIZE], ALvoid *dst, ALuint todo,
+                     ALuint numchans, ALuint *restrict dither);
+
+/* SSE2 source geometry */
+void CalcSourceGeometry_SSE2(SourceGeometry *geom, ALsizei count);
+
 const ALfloat *Resample_lerp32_SSE41(const BsincState *state, const ALfloat *src, ALuint frac, ALuint increment,
                                      ALfloat *restrict dst, ALuint numsamples);
 
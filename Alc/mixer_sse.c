@@ -9,6 +9,8 @@
 
 #include "alSource.h"
 #include "alAuxEffectSlot.h"
+#include "alFilter.h"
+#include "bformatdec.h"
 #include "mixer_defs.h"
 
 
@@ -70,6 +72,59 @@ const ALfloat *Resample_bsinc32_SSE(const BsincState *state, const ALfloat *src,
     return dst;
 }
 
+static inline __m128 polyphase_dot(const ALfloat *fil, const ALfloat *src, ALuint m)
+{
+    __m128 r4 = _mm_mul_ps(_mm_load_ps(fil), _mm_loadu_ps(src));
+    ALuint j;
+    for(j = 4;j < m;j+=4)
+        r4 = _mm_add_ps(r4, _mm_mul_ps(_mm_load_ps(&fil[j]), _mm_loadu_ps(&src[j])));
+    return r4;
+}
+
+const ALfloat *Resample_polyphase32_SSE(const PolyphaseBank *bank, const ALfloat *src,
+                                        ALuint phase, ALfloat *restrict dst, ALuint dstlen)
+{
+    const ALuint m = bank->Taps;
+    __m128 r0, r1, r2, r3;
+    ALuint i;
+
+#define NEXT_PHASE() do {                                                     \
+    src   += bank->IntStep;                                                   \
+    phase += bank->FracStep;                                                  \
+    if(phase >= bank->Phases)                                                 \
+    {                                                                         \
+        phase -= bank->Phases;                                                \
+        src++;                                                                \
+    }                                                                         \
+} while(0)
+    src += bank->Offset;
+    /* Do four outputs at a time, so their sums can be finished together. */
+    for(i = 0;dstlen-i > 3;i += 4)
+    {
+        r0 = polyphase_dot(&bank->Coeffs[phase*m], src, m);
+        NEXT_PHASE();
+        r1 = polyphase_dot(&bank->Coeffs[phase*m], src, m);
+        NEXT_PHASE();
+        r2 = polyphase_dot(&bank->Coeffs[phase*m], src, m);
+        NEXT_PHASE();
+        r3 = polyphase_dot(&bank->Coeffs[phase*m], src, m);
+        NEXT_PHASE();
+
+        _MM_TRANSPOSE4_PS(r0, r1, r2, r3);
+        _mm_storeu_ps(&dst[i], _mm_add_ps(_mm_add_ps(r0, r1), _mm_add_ps(r2, r3)));
+    }
+    for(;i < dstlen;i++)
+    {
+        r0 = polyphase_dot(&bank->Coeffs[phase*m], src, m);
+        r0 = _mm_add_ps(r0, _mm_shuffle_ps(r0, r0, _MM_SHUFFLE(0, 1, 2, 3)));
+        r0 = _mm_add_ps(r0, _mm_movehl_ps(r0, r0));
+        dst[i] = _mm_cvtss_f32(r0);
+        NEXT_PHASE();
+    }
+#undef NEXT_PHASE
+    return dst;
+}
+
 
 static inline void ApplyCoeffsStep(ALuint Offset, ALfloat (*restrict Values)[2],
                                    const ALuint IrSize,
@@ -260,3 +315,207 @@ void Mix_SSE(const ALfloat *data, ALuint OutChans, ALfloat (*restrict OutBuffer)
             OutBuffer[c][OutPos+pos] += data[pos]*gain;
     }
 }
+
+
+void MulAccSpectra_SSE(ALfloat *restrict accr, ALfloat *restrict acci,
+                       const ALfloat *xr, const ALfloat *xi,
+                       const ALfloat *hr, const ALfloat *hi, ALuint count)
+{
+    ALuint i;
+    for(i = 0;i < count;i += 4)
+    {
+        const __m128 xr4 = _mm_load_ps(&xr[i]);
+        const __m128 xi4 = _mm_load_ps(&xi[i]);
+        const __m128 hr4 = _mm_load_ps(&hr[i]);
+        const __m128 hi4 = _mm_load_ps(&hi[i]);
+        __m128 r4 = _mm_sub_ps(_mm_mul_ps(xr4, hr4), _mm_mul_ps(xi4, hi4));
+        __m128 i4 = _mm_add_ps(_mm_mul_ps(xr4, hi4), _mm_mul_ps(xi4, hr4));
+        _mm_store_ps(&accr[i], _mm_add_ps(_mm_load_ps(&accr[i]), r4));
+        _mm_store_ps(&acci[i], _mm_add_ps(_mm_load_ps(&acci[i]), i4));
+    }
+}
+
+
+/* The lane filters work on chunks of interleaved frames, with one channel per
+ * vector element, so each sample of every channel can be filtered at once with
+ * the filter history kept in registers.
+ */
+#define LANE_CHUNK_SIZE 128
+
+static inline void InterleaveLanes(ALfloat (*restrict frames)[4], const ALfloat *const *src,
+                                   ALuint numchans, ALuint offset, ALuint todo)
+{
+    ALuint c, i = 0;
+
+    if(numchans == 4)
+    {
+        for(;todo-i > 3;i += 4)
+        {
+            __m128 s0 = _mm_loadu_ps(&src[0][offset+i]);
+            __m128 s1 = _mm_loadu_ps(&src[1][offset+i]);
+            __m128 s2 = _mm_loadu_ps(&src[2][offset+i]);
+            __m128 s3 = _mm_loadu_ps(&src[3][offset+i]);
+            _MM_TRANSPOSE4_PS(s0, s1, s2, s3);
+            _mm_store_ps(frames[i  ], s0);
+            _mm_store_ps(frames[i+1], s1);
+            _mm_store_ps(frames[i+2], s2);
+            _mm_store_ps(frames[i+3], s3);
+        }
+    }
+    /* Unused channels are filtered as silence. */
+    for(;i < todo;i++)
+    {
+        for(c = 0;c < numchans;c++)
+            frames[i][c] = src[c][offset+i];
+        for(;c < 4;c++)
+            frames[i][c] = 0.0f;
+    }
+}
+
+static inline void DeinterleaveLanes(ALfloat *const *dst, const ALfloat (*restrict frames)[4],
+                                     ALuint numchans, ALuint offset, ALuint todo)
+{
+    ALuint c, i = 0;
+
+    if(numchans == 4)
+    {
+        for(;todo-i > 3;i += 4)
+        {
+            __m128 s0 = _mm_load_ps(frames[i  ]);
+            __m128 s1 = _mm_load_ps(frames[i+1]);
+            __m128 s2 = _mm_load_ps(frames[i+2]);
+            __m128 s3 = _mm_load_ps(frames[i+3]);
+            _MM_TRANSPOSE4_PS(s0, s1, s2, s3);
+            _mm_storeu_ps(&dst[0][offset+i], s0);
+            _mm_storeu_ps(&dst[1][offset+i], s1);
+            _mm_storeu_ps(&dst[2][offset+i], s2);
+            _mm_storeu_ps(&dst[3][offset+i], s3);
+        }
+    }
+    for(;i < todo;i++)
+    {
+        for(c = 0;c < numchans;c++)
+            dst[c][offset+i] = frames[i][c];
+    }
+}
+
+void FilterLanes_SSE(const ALfilterState *filters, ALfilterLanes *lanes, ALuint numfilters,
+                     ALuint numchans, ALfloat *const *dst, const ALfloat *const *src,
+                     ALuint numsamples)
+{
+    alignas(16) ALfloat frames[LANE_CHUNK_SIZE][4];
+    ALuint base, todo, f, i;
+
+    for(base = 0;base < numsamples;base += todo)
+    {
+        todo = minu(numsamples-base, LANE_CHUNK_SIZE);
+        InterleaveLanes(frames, src, numchans, base, todo);
+
+        for(f = 0;f < numfilters;f++)
+        {
+            const __m128 b0 = _mm_set1_ps(filters[f].input_gain);
+            const __m128 b1 = _mm_set1_ps(filters[f].b1);
+            const __m128 b2 = _mm_set1_ps(filters[f].b2);
+            const __m128 a1 = _mm_set1_ps(filters[f].a1);
+            const __m128 a2 = _mm_set1_ps(filters[f].a2);
+            __m128 z1 = _mm_load_ps(lanes[f].z1);
+            __m128 z2 = _mm_load_ps(lanes[f].z2);
+
+            for(i = 0;i < todo;i++)
+            {
+                const __m128 x = _mm_load_ps(frames[i]);
+                const __m128 y = _mm_add_ps(_mm_mul_ps(x, b0), z1);
+                z1 = _mm_add_ps(_mm_sub_ps(_mm_mul_ps(x, b1), _mm_mul_ps(y, a1)), z2);
+                z2 = _mm_sub_ps(_mm_mul_ps(x, b2), _mm_mul_ps(y, a2));
+                _mm_store_ps(frames[i], y);
+            }
+            _mm_store_ps(lanes[f].z1, z1);
+            _mm_store_ps(lanes[f].z2, z2);
+        }
+
+        DeinterleaveLanes(dst, (const ALfloat(*)[4])frames, numchans, base, todo);
+    }
+}
+
+void BandSplit_SSE(BandSplitter *splitter, ALuint numchans, ALfloat *const *hpout,
+                   ALfloat *const *lpout, const ALfloat *const *input, ALuint count)
+{
+    alignas(16) ALfloat frames[LANE_CHUNK_SIZE][4];
+    alignas(16) ALfloat lpframes[LANE_CHUNK_SIZE][4];
+    const __m128 lpcoeff = _mm_set1_ps(splitter->coeff*0.5f + 0.5f);
+    const __m128 apcoeff = _mm_set1_ps(splitter->coeff);
+    __m128 lp_z1 = _mm_load_ps(splitter->lp_z1);
+    __m128 lp_z2 = _mm_load_ps(splitter->lp_z2);
+    __m128 hp_z1 = _mm_load_ps(splitter->hp_z1);
+    ALuint base, todo, i;
+
+    for(base = 0;base < count;base += todo)
+    {
+        todo = minu(count-base, LANE_CHUNK_SIZE);
+        InterleaveLanes(frames, input, numchans, base, todo);
+
+        for(i = 0;i < todo;i++)
+        {
+            const __m128 x = _mm_load_ps(frames[i]);
+            __m128 d, lp, ap;
+
+            d = _mm_mul_ps(_mm_sub_ps(x, lp_z1), lpcoeff);
+            lp = _mm_add_ps(lp_z1, d);
+            lp_z1 = _mm_add_ps(lp, d);
+
+            d = _mm_mul_ps(_mm_sub_ps(lp, lp_z2), lpcoeff);
+            lp = _mm_add_ps(lp_z2, d);
+            lp_z2 = _mm_add_ps(lp, d);
+
+            d = _mm_sub_ps(x, _mm_mul_ps(apcoeff, hp_z1));
+            ap = _mm_add_ps(hp_z1, _mm_mul_ps(apcoeff, d));
+            hp_z1 = d;
+
+            _mm_store_ps(lpframes[i], lp);
+            _mm_store_ps(frames[i], _mm_sub_ps(ap, lp));
+        }
+
+        DeinterleaveLanes(lpout, (const ALfloat(*)[4])lpframes, numchans, base, todo);
+        DeinterleaveLanes(hpout, (const ALfloat(*)[4])frames, numchans, base, todo);
+    }
+    _mm_store_ps(splitter->lp_z1, lp_z1);
+    _mm_store_ps(splitter->lp_z2, lp_z2);
+    _mm_store_ps(splitter->hp_z1, hp_z1);
+}
+
+
+void LimiterPeaks_SSE(ALfloat *restrict dst, ALfloat (*restrict src)[BUFFERSIZE],
+                      ALuint numchans, ALuint todo)
+{
+    const __m128 signbit = _mm_set1_ps(-0.0f);
+    ALuint c, i;
+
+    /* The output buffers are aligned, and the update size is normally a
+     * multiple of 4. */
+    for(i = 0;todo-i > 3;i += 4)
+    {
+        __m128 peak = _mm_andnot_ps(signbit, _mm_load_ps(&src[0][i]));
+        for(c = 1;c < numchans;c++)
+            peak = _mm_max_ps(peak, _mm_andnot_ps(signbit, _mm_load_ps(&src[c][i])));
+        _mm_store_ps(&dst[i], peak);
+    }
+    for(;i < todo;i++)
+    {
+        ALfloat peak = fabsf(src[0][i]);
+        for(c = 1;c < numchans;c++)
+            peak = maxf(peak, fabsf(src[c][i]));
+        dst[i] = peak;
+    }
+}
+
+void LimiterHold_SSE(ALfloat *restrict dst, const ALfloat *restrict src, ALuint todo)
+{
+    ALuint i;
+
+    /* The source is offset within the previous block, so it may not be
+     * aligned. */
+    for(i = 0;todo-i > 3;i += 4)
+        _mm_storeu_ps(&dst[i], _mm_max_ps(_mm_loadu_ps(&dst[i]), _mm_loadu_ps(&src[i])));
+    for(;i < todo;i++)
+        dst[i] = maxf(dst[i], src[i]);
+}
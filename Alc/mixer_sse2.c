@@ -20,6 +20,9 @@
 
 #include "config.h"
 
+#include <string.h>
+#include <math.h>
+#include <float.h>
 #include <xmmintrin.h>
 #include <emmintrin.h>
 
@@ -79,3 +82,610 @@ const ALfloat *Resample_lerp32_SSE2(const BsincState* UNUSED(state), const ALflo
     }
     return dst;
 }
+
+
+/* The output conversions below handle stereo, 5.1, and 7.1 (2, 6, and 8
+ * channels), converting 4 samples of each channel at a time and interleaving
+ * them into 4 output frames.
+ */
+#define MAX_WRITE_CHANNELS 8
+
+/* Loads the next 4 samples of each channel, padding with silence after the
+ * end. */
+static inline void LoadSamples4(__m128 *restrict vals, ALfloat (*restrict src)[BUFFERSIZE],
+                                ALuint numchans, ALuint base, ALuint todo)
+{
+    ALuint c;
+
+    if(todo == 4)
+    {
+        for(c = 0;c < numchans;c++)
+            vals[c] = _mm_load_ps(&src[c][base]);
+    }
+    else
+    {
+        alignas(16) ALfloat tmp[4];
+        for(c = 0;c < numchans;c++)
+        {
+            tmp[0] = tmp[1] = tmp[2] = tmp[3] = 0.0f;
+            memcpy(tmp, &src[c][base], todo*sizeof(ALfloat));
+            vals[c] = _mm_load_ps(tmp);
+        }
+    }
+}
+
+/* Clamps to [-1, +1], with NaN becoming 0, the same as aluClampf. */
+static inline __m128 ClampSamples4(__m128 vals)
+{
+    vals = _mm_and_ps(vals, _mm_cmpord_ps(vals, vals));
+    return _mm_min_ps(_mm_max_ps(vals, _mm_set1_ps(-1.0f)), _mm_set1_ps(1.0f));
+}
+
+/* Interleaves 4 32-bit values from each channel into 4 frames. */
+static inline void StoreFrames32(ALfloat *restrict dst, __m128 *restrict vals, ALuint numchans)
+{
+    __m128 lo, hi;
+
+    if(numchans == 2)
+    {
+        _mm_storeu_ps(dst,   _mm_unpacklo_ps(vals[0], vals[1]));
+        _mm_storeu_ps(dst+4, _mm_unpackhi_ps(vals[0], vals[1]));
+        return;
+    }
+
+    _MM_TRANSPOSE4_PS(vals[0], vals[1], vals[2], vals[3]);
+    if(numchans == 8)
+    {
+        _MM_TRANSPOSE4_PS(vals[4], vals[5], vals[6], vals[7]);
+        _mm_storeu_ps(dst,    vals[0]); _mm_storeu_ps(dst+4,  vals[4]);
+        _mm_storeu_ps(dst+8,  vals[1]); _mm_storeu_ps(dst+12, vals[5]);
+        _mm_storeu_ps(dst+16, vals[2]); _mm_storeu_ps(dst+20, vals[6]);
+        _mm_storeu_ps(dst+24, vals[3]); _mm_storeu_ps(dst+28, vals[7]);
+        return;
+    }
+
+    lo = _mm_unpacklo_ps(vals[4], vals[5]);
+    hi = _mm_unpackhi_ps(vals[4], vals[5]);
+    _mm_storeu_ps(dst,    vals[0]); _mm_storel_pi((__m64*)(dst+4),  lo);
+    _mm_storeu_ps(dst+6,  vals[1]); _mm_storeh_pi((__m64*)(dst+10), lo);
+    _mm_storeu_ps(dst+12, vals[2]); _mm_storel_pi((__m64*)(dst+16), hi);
+    _mm_storeu_ps(dst+18, vals[3]); _mm_storeh_pi((__m64*)(dst+22), hi);
+}
+
+/* Interleaves 4 32-bit integers from each channel into 4 frames of 16-bit
+ * values. */
+static inline void StoreFrames16(ALshort *restrict dst, __m128i *restrict vals, ALuint numchans)
+{
+    __m128 t0, t1, t2, t3;
+    __m128i a, b, p;
+    ALint tmp;
+
+    if(numchans == 2)
+    {
+        _mm_storeu_si128((__m128i*)dst, _mm_packs_epi32(
+            _mm_unpacklo_epi32(vals[0], vals[1]), _mm_unpackhi_epi32(vals[0], vals[1])
+        ));
+        return;
+    }
+
+    t0 = _mm_castsi128_ps(vals[0]); t1 = _mm_castsi128_ps(vals[1]);
+    t2 = _mm_castsi128_ps(vals[2]); t3 = _mm_castsi128_ps(vals[3]);
+    _MM_TRANSPOSE4_PS(t0, t1, t2, t3);
+    if(numchans == 8)
+    {
+        __m128 t4 = _mm_castsi128_ps(vals[4]), t5 = _mm_castsi128_ps(vals[5]);
+        __m128 t6 = _mm_castsi128_ps(vals[6]), t7 = _mm_castsi128_ps(vals[7]);
+        _MM_TRANSPOSE4_PS(t4, t5, t6, t7);
+        _mm_storeu_si128((__m128i*)dst,
+            _mm_packs_epi32(_mm_castps_si128(t0), _mm_castps_si128(t4)));
+        _mm_storeu_si128((__m128i*)(dst+8),
+            _mm_packs_epi32(_mm_castps_si128(t1), _mm_castps_si128(t5)));
+        _mm_storeu_si128((__m128i*)(dst+16),
+            _mm_packs_epi32(_mm_castps_si128(t2), _mm_castps_si128(t6)));
+        _mm_storeu_si128((__m128i*)(dst+24),
+            _mm_packs_epi32(_mm_castps_si128(t3), _mm_castps_si128(t7)));
+        return;
+    }
+
+    /* Each 5.1 frame is the first four channels, then the last two. */
+    a = _mm_packs_epi32(_mm_castps_si128(t0), _mm_castps_si128(t1));
+    b = _mm_packs_epi32(_mm_castps_si128(t2), _mm_castps_si128(t3));
+    p = _mm_packs_epi32(_mm_unpacklo_epi32(vals[4], vals[5]),
+                        _mm_unpackhi_epi32(vals[4], vals[5]));
+    _mm_storel_epi64((__m128i*)dst, a);
+    tmp = _mm_cvtsi128_si32(p);
+    memcpy(dst+4, &tmp, sizeof(tmp));
+    _mm_storel_epi64((__m128i*)(dst+6), _mm_unpackhi_epi64(a, a));
+    tmp = _mm_cvtsi128_si32(_mm_srli_si128(p, 4));
+    memcpy(dst+10, &tmp, sizeof(tmp));
+    _mm_storel_epi64((__m128i*)(dst+12), b);
+    tmp = _mm_cvtsi128_si32(_mm_srli_si128(p, 8));
+    memcpy(dst+16, &tmp, sizeof(tmp));
+    _mm_storel_epi64((__m128i*)(dst+18), _mm_unpackhi_epi64(b, b));
+    tmp = _mm_cvtsi128_si32(_mm_srli_si128(p, 12));
+    memcpy(dst+22, &tmp, sizeof(tmp));
+}
+
+/* Generates TPDF dither noise of +/-1 LSB for 4 samples, from 4 xorshift
+ * generators. This must match aluDither4. */
+static inline __m128 Dither4(__m128i *restrict seed)
+{
+    const __m128i lomask = _mm_set1_epi32(0xffff);
+    __m128i x = *seed;
+
+    x = _mm_xor_si128(x, _mm_slli_epi32(x, 13));
+    x = _mm_xor_si128(x, _mm_srli_epi32(x, 17));
+    x = _mm_xor_si128(x, _mm_slli_epi32(x, 5));
+    *seed = x;
+
+    return _mm_mul_ps(_mm_sub_ps(_mm_cvtepi32_ps(_mm_and_si128(x, lomask)),
+                                 _mm_cvtepi32_ps(_mm_srli_epi32(x, 16))),
+                      _mm_set1_ps(1.0f/65536.0f));
+}
+
+
+void WriteFloat_SSE2(ALfloat (*restrict src)[BUFFERSIZE], ALvoid *dst, ALuint todo,
+                     ALuint numchans)
+{
+    ALfloat *restrict out = dst;
+    __m128 vals[MAX_WRITE_CHANNELS];
+    ALuint base, rem;
+
+    for(base = 0;base < todo;base += rem)
+    {
+        rem = minu(todo-base, 4);
+        LoadSamples4(vals, src, numchans, base, rem);
+        if(rem == 4)
+            StoreFrames32(out + base*numchans, vals, numchans);
+        else
+        {
+            alignas(16) ALfloat tmp[4*MAX_WRITE_CHANNELS];
+            StoreFrames32(tmp, vals, numchans);
+            memcpy(out + base*numchans, tmp, rem*numchans*sizeof(ALfloat));
+        }
+    }
+}
+
+void WriteInt_SSE2(ALfloat (*restrict src)[BUFFERSIZE], ALvoid *dst, ALuint todo,
+                   ALuint numchans)
+{
+    const __m128 scale = _mm_set1_ps(16777215.0f);
+    ALint *restrict out = dst;
+    __m128 vals[MAX_WRITE_CHANNELS];
+    ALuint base, rem, c;
+
+    for(base = 0;base < todo;base += rem)
+    {
+        rem = minu(todo-base, 4);
+        LoadSamples4(vals, src, numchans, base, rem);
+        for(c = 0;c < numchans;c++)
+        {
+            __m128i ivals = _mm_cvtps_epi32(_mm_mul_ps(ClampSamples4(vals[c]), scale));
+            vals[c] = _mm_castsi128_ps(_mm_slli_epi32(ivals, 7));
+        }
+        if(rem == 4)
+            StoreFrames32((ALfloat*)(out + base*numchans), vals, numchans);
+        else
+        {
+            alignas(16) ALint tmp[4*MAX_WRITE_CHANNELS];
+            StoreFrames32((ALfloat*)tmp, vals, numchans);
+            memcpy(out + base*numchans, tmp, rem*numchans*sizeof(ALint));
+        }
+    }
+}
+
+void WriteShort_SSE2(ALfloat (*restrict src)[BUFFERSIZE], ALvoid *dst, ALuint todo,
+                     ALuint numchans, ALuint *restrict dither)
+{
+    const __m128 scale = _mm_set1_ps(32767.0f);
+    const __m128 half = _mm_set1_ps(0.5f);
+    ALshort *restrict out = dst;
+    __m128 vals[MAX_WRITE_CHANNELS];
+    __m128i ivals[MAX_WRITE_CHANNELS];
+    __m128i seed = _mm_setzero_si128();
+    ALuint base, rem, c;
+
+    if(dither)
+        seed = _mm_loadu_si128((const __m128i*)dither);
+    for(base = 0;base < todo;base += rem)
+    {
+        rem = minu(todo-base, 4);
+        LoadSamples4(vals, src, numchans, base, rem);
+        if(!dither)
+        {
+            for(c = 0;c < numchans;c++)
+                ivals[c] = _mm_cvtps_epi32(_mm_mul_ps(ClampSamples4(vals[c]), scale));
+        }
+        else for(c = 0;c < numchans;c++)
+        {
+            /* Round the dithered value to the nearest integer (rounding
+             * halves up). The conversion may round toward 0, so step back
+             * any result that rounded up. Saturation while packing keeps it
+             * in range.
+             */
+            __m128 v = _mm_add_ps(_mm_mul_ps(ClampSamples4(vals[c]), scale), Dither4(&seed));
+            __m128i i;
+            v = _mm_add_ps(v, half);
+            i = _mm_cvtps_epi32(v);
+            ivals[c] = _mm_add_epi32(i, _mm_castps_si128(_mm_cmpgt_ps(_mm_cvtepi32_ps(i), v)));
+        }
+        if(rem == 4)
+            StoreFrames16(out + base*numchans, ivals, numchans);
+        else
+        {
+            alignas(16) ALshort tmp[4*MAX_WRITE_CHANNELS];
+            StoreFrames16(tmp, ivals, numchans);
+            memcpy(out + base*numchans, tmp, rem*numchans*sizeof(ALshort));
+        }
+    }
+    if(dither)
+        _mm_storeu_si128((__m128i*)dither, seed);
+}
+
+
+#define SELECT4(mask, a, b) _mm_or_ps(_mm_and_ps(mask, a), _mm_andnot_ps(mask, b))
+
+/* Approximations of the math functions the source attenuation needs. Exp2 and
+ * Log2 are accurate to about 1e-7 relative, and the angles to about 1e-7
+ * radians. Exp2(0) and Log2(1) are exact, so no-op gains stay at exactly 1.
+ */
+static inline __m128 Floor_SSE2(__m128 x)
+{
+    /* Truncate, then step down the lanes that rounded up (negative values). */
+    __m128i i = _mm_cvttps_epi32(x);
+    i = _mm_add_epi32(i, _mm_castps_si128(_mm_cmpgt_ps(_mm_cvtepi32_ps(i), x)));
+    return _mm_cvtepi32_ps(i);
+}
+
+static inline __m128 Exp2_SSE2(__m128 x)
+{
+    __m128 n, f, p;
+
+    /* Split into an integer and a fraction within -0.5...+0.5, for a
+     * polynomial to approximate 2^f with. */
+    x = _mm_min_ps(_mm_max_ps(x, _mm_set1_ps(-126.0f)), _mm_set1_ps(126.0f));
+    n = Floor_SSE2(_mm_add_ps(x, _mm_set1_ps(0.5f)));
+    f = _mm_sub_ps(x, n);
+
+    p =                   _mm_set1_ps(1.535336188319500e-4f);
+    p = _mm_add_ps(_mm_mul_ps(p, f), _mm_set1_ps(1.339887440266574e-3f));
+    p = _mm_add_ps(_mm_mul_ps(p, f), _mm_set1_ps(9.618437357674640e-3f));
+    p = _mm_add_ps(_mm_mul_ps(p, f), _mm_set1_ps(5.550332471162809e-2f));
+    p = _mm_add_ps(_mm_mul_ps(p, f), _mm_set1_ps(2.402264791363012e-1f));
+    p = _mm_add_ps(_mm_mul_ps(p, f), _mm_set1_ps(6.931472028550421e-1f));
+    p = _mm_add_ps(_mm_mul_ps(p, f), _mm_set1_ps(1.0f));
+
+    /* Scale by 2^n, built directly as a float's exponent. */
+    return _mm_mul_ps(p, _mm_castsi128_ps(_mm_slli_epi32(
+        _mm_add_epi32(_mm_cvttps_epi32(n), _mm_set1_epi32(127)), 23
+    )));
+}
+
+/* Only valid for positive, normal values. */
+static inline __m128 Log2_SSE2(__m128 x)
+{
+    const __m128i bits = _mm_castps_si128(x);
+    __m128i e;
+    __m128 m, big, t, t2, p;
+
+    /* Split into the exponent and the mantissa, with the mantissa kept within
+     * sqrt(0.5)...sqrt(2) so the series below converges quickly. */
+    e = _mm_sub_epi32(_mm_srli_epi32(bits, 23), _mm_set1_epi32(127));
+    m = _mm_castsi128_ps(_mm_or_si128(_mm_and_si128(bits, _mm_set1_epi32(0x007fffff)),
+                                      _mm_set1_epi32(0x3f800000)));
+    big = _mm_cmpgt_ps(m, _mm_set1_ps(1.41421356f));
+    m = _mm_sub_ps(m, _mm_and_ps(big, _mm_mul_ps(m, _mm_set1_ps(0.5f))));
+    e = _mm_sub_epi32(e, _mm_castps_si128(big));
+
+    /* log2(m) = 2/ln(2) * atanh((m-1)/(m+1)) */
+    t = _mm_div_ps(_mm_sub_ps(m, _mm_set1_ps(1.0f)), _mm_add_ps(m, _mm_set1_ps(1.0f)));
+    t2 = _mm_mul_ps(t, t);
+    p =                   _mm_set1_ps(0.3205988980f);
+    p = _mm_add_ps(_mm_mul_ps(p, t2), _mm_set1_ps(0.4121985831f));
+    p = _mm_add_ps(_mm_mul_ps(p, t2), _mm_set1_ps(0.5770780164f));
+    p = _mm_add_ps(_mm_mul_ps(p, t2), _mm_set1_ps(0.9617966939f));
+    p = _mm_add_ps(_mm_mul_ps(p, t2), _mm_set1_ps(2.8853900818f));
+
+    return _mm_add_ps(_mm_cvtepi32_ps(e), _mm_mul_ps(p, t));
+}
+
+static inline __m128 Acos_SSE2(__m128 x)
+{
+    const __m128 signmask = _mm_castsi128_ps(_mm_set1_epi32(0x80000000));
+    __m128 ax, neg, p;
+
+    x = _mm_min_ps(_mm_max_ps(x, _mm_set1_ps(-1.0f)), _mm_set1_ps(1.0f));
+    ax = _mm_andnot_ps(signmask, x);
+    neg = _mm_cmplt_ps(x, _mm_setzero_ps());
+
+    /* Abramowitz and Stegun 4.4.46, for 0 <= x <= 1. */
+    p =                   _mm_set1_ps(-0.0012624911f);
+    p = _mm_add_ps(_mm_mul_ps(p, ax), _mm_set1_ps(0.0066700901f));
+    p = _mm_add_ps(_mm_mul_ps(p, ax), _mm_set1_ps(-0.0170881256f));
+    p = _mm_add_ps(_mm_mul_ps(p, ax), _mm_set1_ps(0.0308918810f));
+    p = _mm_add_ps(_mm_mul_ps(p, ax), _mm_set1_ps(-0.0501743046f));
+    p = _mm_add_ps(_mm_mul_ps(p, ax), _mm_set1_ps(0.0889789874f));
+    p = _mm_add_ps(_mm_mul_ps(p, ax), _mm_set1_ps(-0.2145988016f));
+    p = _mm_add_ps(_mm_mul_ps(p, ax), _mm_set1_ps(1.5707963050f));
+    p = _mm_mul_ps(p, _mm_sqrt_ps(_mm_sub_ps(_mm_set1_ps(1.0f), ax)));
+
+    /* acos(-x) = pi - acos(x) */
+    return SELECT4(neg, _mm_sub_ps(_mm_set1_ps(F_PI), p), p);
+}
+
+static inline __m128 Atan2_SSE2(__m128 y, __m128 x)
+{
+    const __m128 signmask = _mm_castsi128_ps(_mm_set1_epi32(0x80000000));
+    const __m128 ax = _mm_andnot_ps(signmask, x);
+    const __m128 ay = _mm_andnot_ps(signmask, y);
+    const __m128 swap = _mm_cmpgt_ps(ay, ax);
+    __m128 mx, a, big, z, z2, p, r;
+
+    /* Get atan(a) for a = min/max of |x| and |y|, in 0...1. Over tan(pi/8),
+     * reduce it with atan(a) = pi/4 + atan((a-1)/(a+1)). */
+    mx = _mm_max_ps(ax, ay);
+    mx = SELECT4(_mm_cmpgt_ps(mx, _mm_setzero_ps()), mx, _mm_set1_ps(1.0f));
+    a = _mm_div_ps(_mm_min_ps(ax, ay), mx);
+    big = _mm_cmpgt_ps(a, _mm_set1_ps(0.4142135624f));
+    z = SELECT4(big, _mm_div_ps(_mm_sub_ps(a, _mm_set1_ps(1.0f)), _mm_add_ps(a, _mm_set1_ps(1.0f))), a);
+
+    z2 = _mm_mul_ps(z, z);
+    p =                   _mm_set1_ps(8.05374449538e-2f);
+    p = _mm_add_ps(_mm_mul_ps(p, z2), _mm_set1_ps(-1.38776856032e-1f));
+    p = _mm_add_ps(_mm_mul_ps(p, z2), _mm_set1_ps(1.99777106478e-1f));
+    p = _mm_add_ps(_mm_mul_ps(p, z2), _mm_set1_ps(-3.33329491539e-1f));
+    r = _mm_add_ps(_mm_mul_ps(_mm_mul_ps(p, z2), z), z);
+    r = _mm_add_ps(r, _mm_and_ps(big, _mm_set1_ps(F_PI/4.0f)));
+
+    /* Unfold to the full circle. */
+    r = SELECT4(swap, _mm_sub_ps(_mm_set1_ps(F_PI_2), r), r);
+    r = SELECT4(_mm_cmplt_ps(x, _mm_setzero_ps()), _mm_sub_ps(_mm_set1_ps(F_PI), r), r);
+    return _mm_or_ps(r, _mm_and_ps(signmask, y));
+}
+
+
+/* Distance attenuation for the lanes using each model, given log2 of the
+ * distance over the reference distance for the exponent model. Lanes using no
+ * model get 1.
+ */
+static inline __m128 CalcAttenuation_SSE2(__m128 inverse, __m128 linear, __m128 exponent,
+                                          __m128 dist, __m128 mindist, __m128 maxdist,
+                                          __m128 logdist, __m128 rolloff)
+{
+    const __m128 zero4 = _mm_setzero_ps();
+    const __m128 one4 = _mm_set1_ps(1.0f);
+    __m128 attn, mask, d;
+
+    /* Inverse: mindist / lerp(mindist, dist, rolloff) */
+    d = _mm_add_ps(mindist, _mm_mul_ps(_mm_sub_ps(dist, mindist), rolloff));
+    mask = _mm_and_ps(inverse, _mm_and_ps(_mm_cmpgt_ps(mindist, zero4), _mm_cmpgt_ps(d, zero4)));
+    attn = SELECT4(mask, _mm_div_ps(mindist, d), one4);
+
+    /* Linear: 1 - rolloff*(dist-mindist)/(maxdist-mindist), down to 0 */
+    d = _mm_div_ps(_mm_mul_ps(rolloff, _mm_sub_ps(dist, mindist)), _mm_sub_ps(maxdist, mindist));
+    d = _mm_max_ps(_mm_sub_ps(one4, d), zero4);
+    mask = _mm_and_ps(linear, _mm_cmpneq_ps(maxdist, mindist));
+    attn = SELECT4(mask, d, attn);
+
+    /* Exponent: (dist/mindist)^-rolloff */
+    d = Exp2_SSE2(_mm_mul_ps(_mm_sub_ps(zero4, rolloff), logdist));
+    mask = _mm_and_ps(exponent, _mm_and_ps(_mm_cmpgt_ps(dist, zero4), _mm_cmpgt_ps(mindist, zero4)));
+    return SELECT4(mask, d, attn);
+}
+
+/* Calculates the distance attenuation, air absorption, cone, Doppler, and
+ * direction outputs from the geometry outputs, like CalcSourceAttenuation_C.
+ */
+static void CalcSourceAttenuation_SSE2(SourceGeometry *geom, ALsizei count)
+{
+    const ALsizei NumSends = geom->NumSends;
+    const __m128 zero4 = _mm_setzero_ps();
+    const __m128 one4 = _mm_set1_ps(1.0f);
+    const __m128 airlog4 = _mm_set1_ps(log2f(AIRABSORBGAINHF));
+    const __m128 decaylog4 = _mm_set1_ps(log2f(0.001f)/*-60dB*/);
+    const __m128 conescale4 = _mm_set1_ps(RAD2DEG(ConeScale) * 2.0f);
+    const __m128 zscale4 = _mm_set1_ps(ZScale);
+    ALfloat sos = geom->SpeedOfSound;
+    ALfloat dopplerscale = 1.0f;
+    __m128 sos4, soslimit4;
+    ALsizei i, s;
+
+    if(sos < 1.0f)
+    {
+        dopplerscale = 1.0f/sos;
+        sos = 1.0f;
+    }
+    sos4 = _mm_set1_ps(sos);
+    soslimit4 = _mm_set1_ps(sos*2.0f - 1.0f);
+
+#define MODEL_MASK(m) _mm_castsi128_ps(_mm_cmpeq_epi32(model4, _mm_set1_epi32(m)))
+    for(i = 0;i < count;i += 4)
+    {
+        const __m128i model4 = _mm_load_si128((const __m128i*)&geom->DistanceModel[i]);
+        const __m128 mindist = _mm_load_ps(&geom->RefDistance[i]);
+        const __m128 maxdist = _mm_load_ps(&geom->MaxDistance[i]);
+        const __m128 srcdist = _mm_load_ps(&geom->Distance[i]);
+        __m128 inverse, linear, exponent, clamped, noattn;
+        __m128 dist, logdist, attn, mask, meters, apparent;
+        __m128 angle, inner, outer, scale, inrange, beyond, gain;
+        __m128 doppler, vss, vls, shift, x, y;
+
+        /* Sort the lanes by distance model, and clamp the distance for the
+         * clamped models. A clamped model with the max distance below the
+         * reference distance doesn't attenuate. */
+        clamped = _mm_or_ps(_mm_or_ps(MODEL_MASK(InverseDistanceClamped),
+                                      MODEL_MASK(LinearDistanceClamped)),
+                            MODEL_MASK(ExponentDistanceClamped));
+        noattn = _mm_andnot_ps(_mm_and_ps(clamped, _mm_cmplt_ps(maxdist, mindist)),
+                               _mm_castsi128_ps(_mm_set1_epi32(-1)));
+        inverse = _mm_and_ps(noattn, _mm_or_ps(MODEL_MASK(InverseDistanceClamped),
+                                               MODEL_MASK(InverseDistance)));
+        linear = _mm_and_ps(noattn, _mm_or_ps(MODEL_MASK(LinearDistanceClamped),
+                                              MODEL_MASK(LinearDistance)));
+        exponent = _mm_and_ps(noattn, _mm_or_ps(MODEL_MASK(ExponentDistanceClamped),
+                                                MODEL_MASK(ExponentDistance)));
+        dist = SELECT4(clamped, _mm_min_ps(maxdist, _mm_max_ps(mindist, srcdist)), srcdist);
+        dist = SELECT4(MODEL_MASK(DisableDistance), mindist, dist);
+
+        /* Distance attenuation, for the dry path and each send. */
+        logdist = Log2_SSE2(_mm_div_ps(dist, mindist));
+        attn = CalcAttenuation_SSE2(inverse, linear, exponent, dist, mindist, maxdist, logdist,
+                                    _mm_load_ps(&geom->Rolloff[i]));
+        _mm_store_ps(&geom->Attenuation[i], attn);
+        for(s = 0;s < NumSends;s++)
+            _mm_store_ps(&geom->RoomAttenuation[s][i], CalcAttenuation_SSE2(
+                inverse, linear, exponent, dist, mindist, maxdist, logdist,
+                _mm_load_ps(&geom->RoomRolloff[s][i])
+            ));
+
+        /* Distance-based air absorption. */
+        meters = _mm_load_ps(&geom->AirAbsorption[i]);
+        mask = _mm_and_ps(_mm_cmpgt_ps(meters, zero4), _mm_cmpgt_ps(dist, mindist));
+        meters = _mm_mul_ps(_mm_sub_ps(dist, mindist), meters);
+        _mm_store_ps(&geom->AirAbsorptionHF[i],
+                     SELECT4(mask, Exp2_SSE2(_mm_mul_ps(meters, airlog4)), one4));
+        for(s = 0;s < NumSends;s++)
+        {
+            x = Log2_SSE2(_mm_load_ps(&geom->RoomAirAbsorption[s][i]));
+            _mm_store_ps(&geom->RoomAirAbsorptionHF[s][i],
+                         SELECT4(mask, Exp2_SSE2(_mm_mul_ps(meters, x)), one4));
+        }
+
+        /* The initial decay of each send's reverb, over the apparent distance
+         * given by the dry path's attenuation. */
+        apparent = _mm_sub_ps(_mm_div_ps(one4, _mm_max_ps(attn, _mm_set1_ps(0.00001f))), one4);
+        for(s = 0;s < NumSends;s++)
+        {
+            x = _mm_load_ps(&geom->DecayDistance[s][i]);
+            mask = _mm_cmpgt_ps(x, zero4);
+            x = Exp2_SSE2(_mm_mul_ps(_mm_div_ps(apparent, SELECT4(mask, x, one4)), decaylog4));
+            _mm_store_ps(&geom->WetDecay[s][i], SELECT4(mask, x, one4));
+        }
+
+        /* Directional soundcones. */
+        angle = _mm_mul_ps(Acos_SSE2(_mm_load_ps(&geom->DirDot[i])), conescale4);
+        inner = _mm_load_ps(&geom->InnerAngle[i]);
+        outer = _mm_load_ps(&geom->OuterAngle[i]);
+        inrange = _mm_and_ps(_mm_cmpgt_ps(angle, inner), _mm_cmple_ps(angle, outer));
+        beyond = _mm_cmpgt_ps(angle, outer);
+        scale = _mm_div_ps(_mm_sub_ps(angle, inner), _mm_sub_ps(outer, inner));
+
+        gain = _mm_load_ps(&geom->OuterGain[i]);
+        x = _mm_add_ps(one4, _mm_mul_ps(_mm_sub_ps(gain, one4), scale));
+        _mm_store_ps(&geom->ConeGain[i], SELECT4(inrange, x, SELECT4(beyond, gain, one4)));
+        gain = _mm_load_ps(&geom->OuterGainHF[i]);
+        x = _mm_add_ps(one4, _mm_mul_ps(_mm_sub_ps(gain, one4), scale));
+        _mm_store_ps(&geom->ConeGainHF[i], SELECT4(inrange, x, SELECT4(beyond, gain, one4)));
+
+        /* Velocity-based Doppler effect. */
+        doppler = _mm_load_ps(&geom->DopplerFactor[i]);
+        mask = _mm_cmpgt_ps(doppler, zero4);
+        doppler = _mm_mul_ps(doppler, _mm_set1_ps(dopplerscale));
+        vss = _mm_mul_ps(_mm_load_ps(&geom->VelDot[i]), doppler);
+        vls = _mm_mul_ps(_mm_load_ps(&geom->ListenerVelDot[i]), doppler);
+        vss = _mm_min_ps(soslimit4, _mm_max_ps(one4, _mm_sub_ps(sos4, vss)));
+        vls = _mm_min_ps(soslimit4, _mm_max_ps(one4, _mm_sub_ps(sos4, vls)));
+        shift = _mm_div_ps(vls, vss);
+        _mm_store_ps(&geom->DopplerShift[i], SELECT4(mask, shift, one4));
+
+        /* Elevation and azimuth of the source, only when it's not at the
+         * listener. */
+        mask = _mm_cmpgt_ps(srcdist, _mm_set1_ps(FLT_EPSILON));
+        y = _mm_sub_ps(zero4, _mm_load_ps(&geom->ToListenerY[i]));
+        y = _mm_min_ps(_mm_max_ps(y, _mm_set1_ps(-1.0f)), one4);
+        y = _mm_sub_ps(_mm_set1_ps(F_PI_2), Acos_SSE2(y));
+        _mm_store_ps(&geom->Elevation[i], _mm_and_ps(mask, y));
+        x = _mm_mul_ps(_mm_load_ps(&geom->ToListenerZ[i]), zscale4);
+        y = _mm_sub_ps(zero4, _mm_load_ps(&geom->ToListenerX[i]));
+        _mm_store_ps(&geom->Azimuth[i], _mm_and_ps(mask, Atan2_SSE2(y, x)));
+    }
+#undef MODEL_MASK
+}
+
+/* Normalizes the vector in x/y/z, returning its original length. Zero-length
+ * vectors are left as they are. */
+static inline __m128 Normalize3_SSE2(__m128 *x, __m128 *y, __m128 *z)
+{
+    const __m128 zero4 = _mm_setzero_ps();
+    __m128 len4, inv4, mask4;
+
+    len4 = _mm_add_ps(_mm_add_ps(_mm_mul_ps(*x, *x), _mm_mul_ps(*y, *y)),
+                      _mm_mul_ps(*z, *z));
+    len4 = _mm_sqrt_ps(len4);
+    mask4 = _mm_cmpgt_ps(len4, zero4);
+    /* Use a divisor of 1 where the length is 0. */
+    inv4 = _mm_or_ps(_mm_and_ps(mask4, len4), _mm_andnot_ps(mask4, _mm_set1_ps(1.0f)));
+    inv4 = _mm_div_ps(_mm_set1_ps(1.0f), inv4);
+
+    *x = _mm_mul_ps(*x, inv4);
+    *y = _mm_mul_ps(*y, inv4);
+    *z = _mm_mul_ps(*z, inv4);
+    return len4;
+}
+
+void CalcSourceGeometry_SSE2(SourceGeometry *geom, ALsizei count)
+{
+    const __m128 r00 = _mm_set1_ps(geom->Rotation[0][0]);
+    const __m128 r01 = _mm_set1_ps(geom->Rotation[0][1]);
+    const __m128 r02 = _mm_set1_ps(geom->Rotation[0][2]);
+    const __m128 r10 = _mm_set1_ps(geom->Rotation[1][0]);
+    const __m128 r11 = _mm_set1_ps(geom->Rotation[1][1]);
+    const __m128 r12 = _mm_set1_ps(geom->Rotation[1][2]);
+    const __m128 r20 = _mm_set1_ps(geom->Rotation[2][0]);
+    const __m128 r21 = _mm_set1_ps(geom->Rotation[2][1]);
+    const __m128 r22 = _mm_set1_ps(geom->Rotation[2][2]);
+    const __m128 lv0 = _mm_set1_ps(geom->ListenerVel[0]);
+    const __m128 lv1 = _mm_set1_ps(geom->ListenerVel[1]);
+    const __m128 lv2 = _mm_set1_ps(geom->ListenerVel[2]);
+    const __m128 zero4 = _mm_setzero_ps();
+    ALsizei i;
+
+#define TRANSFORM(x, y, z, r0, r1, r2)                                        \
+    _mm_add_ps(_mm_add_ps(_mm_mul_ps(x, r0), _mm_mul_ps(y, r1)), _mm_mul_ps(z, r2))
+#define DOT3(x0, y0, z0, x1, y1, z1)                                          \
+    _mm_add_ps(_mm_add_ps(_mm_mul_ps(x0, x1), _mm_mul_ps(y0, y1)), _mm_mul_ps(z0, z1))
+
+    for(i = 0;i < count;i += 4)
+    {
+        __m128 x4 = _mm_load_ps(&geom->PosX[i]);
+        __m128 y4 = _mm_load_ps(&geom->PosY[i]);
+        __m128 z4 = _mm_load_ps(&geom->PosZ[i]);
+        __m128 tx, ty, tz, vx, vy, vz, dx, dy, dz, dist;
+
+        tx = _mm_sub_ps(zero4, TRANSFORM(x4, y4, z4, r00, r10, r20));
+        ty = _mm_sub_ps(zero4, TRANSFORM(x4, y4, z4, r01, r11, r21));
+        tz = _mm_sub_ps(zero4, TRANSFORM(x4, y4, z4, r02, r12, r22));
+
+        x4 = _mm_load_ps(&geom->VelX[i]);
+        y4 = _mm_load_ps(&geom->VelY[i]);
+        z4 = _mm_load_ps(&geom->VelZ[i]);
+        vx = TRANSFORM(x4, y4, z4, r00, r10, r20);
+        vy = TRANSFORM(x4, y4, z4, r01, r11, r21);
+        vz = TRANSFORM(x4, y4, z4, r02, r12, r22);
+
+        x4 = _mm_load_ps(&geom->DirX[i]);
+        y4 = _mm_load_ps(&geom->DirY[i]);
+        z4 = _mm_load_ps(&geom->DirZ[i]);
+        dx = TRANSFORM(x4, y4, z4, r00, r10, r20);
+        dy = TRANSFORM(x4, y4, z4, r01, r11, r21);
+        dz = TRANSFORM(x4, y4, z4, r02, r12, r22);
+
+        Normalize3_SSE2(&dx, &dy, &dz);
+        dist = Normalize3_SSE2(&tx, &ty, &tz);
+
+        _mm_store_ps(&geom->ToListenerX[i], tx);
+        _mm_store_ps(&geom->ToListenerY[i], ty);
+        _mm_store_ps(&geom->ToListenerZ[i], tz);
+        _mm_store_ps(&geom->Distance[i], dist);
+        _mm_store_ps(&geom->DirDot[i], DOT3(dx, dy, dz, tx, ty, tz));
+        _mm_store_ps(&geom->VelDot[i], DOT3(vx, vy, vz, tx, ty, tz));
+        _mm_store_ps(&geom->ListenerVelDot[i], DOT3(lv0, lv1, lv2, tx, ty, tz));
+    }
+
+#undef DOT3
+#undef TRANSFORM
+
+    CalcSourceAttenuation_SSE2(geom, count);
+}
+
+#undef SELECT4
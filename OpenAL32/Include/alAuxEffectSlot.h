@@ -12,12 +12,20 @@ extern "C" {
 
 struct ALeffectStateVtable;
 struct ALeffectslot;
+struct ALbuffer;
 
 typedef struct ALeffectState {
     const struct ALeffectStateVtable *vtbl;
 
     ALfloat (*OutBuffer)[BUFFERSIZE];
     ALuint OutChannels;
+
+    /* Number of samples the effect may keep producing output for after its
+     * input goes silent, set by each update. Once the slot's input has been
+     * silent for this long, processing is skipped until new input arrives.
+     * ~0u means the output may never decay (e.g. 100% feedback).
+     */
+    ALuint TailLength;
 } ALeffectState;
 
 struct ALeffectStateVtable {
@@ -77,9 +85,31 @@ typedef struct ALeffectslot {
     volatile ALfloat   Gain;
     volatile ALboolean AuxSendAuto;
 
+    /* Buffer holding the impulse response for convolution effects. Only
+     * changed with the device locked, along with the effect state's IR.
+     */
+    struct ALbuffer *Buffer;
+
+    /* Slot the effect's output is mixed into instead of the device output,
+     * and the parameters for mixing into its wet buffer. Only changed with
+     * the device locked, and the effect state updated right after. Slots are
+     * kept ordered in the context's ActiveAuxSlots so each one is processed
+     * before its target.
+     */
+    struct ALeffectslot *Target;
+    MixParams TargetOut;
+
     ATOMIC(ALenum) NeedsUpdate;
     ALeffectState *EffectState;
 
+    /* Mixer-only silence tracking. WetCleared is the number of leading
+     * samples in WetBuffer already known to be zero, and TailRemaining is
+     * the number of samples the effect still needs to be processed for since
+     * the last non-silent input.
+     */
+    ALuint WetCleared;
+    ALuint TailRemaining;
+
     RefCount ref;
 
     /* Self ID */
@@ -101,9 +131,17 @@ typedef struct ALeffectslot {
 } ALeffectslot;
 
 inline struct ALeffectslot *LookupEffectSlot(ALCcontext *context, ALuint id)
-{ return (struct ALeffectslot*)LookupUIntMapKey(&context->EffectSlotMap, id); }
+{ return (struct ALeffectslot*)LookupHandleMapKey(&context->EffectSlotMap, id); }
 inline struct ALeffectslot *RemoveEffectSlot(ALCcontext *context, ALuint id)
-{ return (struct ALeffectslot*)RemoveUIntMapKey(&context->EffectSlotMap, id); }
+{ return (struct ALeffectslot*)RemoveHandleMapKey(&context->EffectSlotMap, id); }
+
+/* Gets the outputs an effect in the slot mixes to, in place of the device's
+ * Dry and FOAOut, which are the target slot's wet buffer if it has one.
+ */
+inline const MixParams *GetEffectSlotDryOut(const ALCdevice *device, const ALeffectslot *slot)
+{ return slot->Target ? &slot->TargetOut : &device->Dry; }
+inline const MixParams *GetEffectSlotFOAOut(const ALCdevice *device, const ALeffectslot *slot)
+{ return slot->Target ? &slot->TargetOut : &device->FOAOut; }
 
 ALenum InitEffectSlot(ALeffectslot *slot);
 ALvoid ReleaseALAuxiliaryEffectSlots(ALCcontext *Context);
@@ -121,6 +159,16 @@ ALeffectStateFactory *ALflangerStateFactory_getFactory(void);
 ALeffectStateFactory *ALmodulatorStateFactory_getFactory(void);
 
 ALeffectStateFactory *ALdedicatedStateFactory_getFactory(void);
+ALeffectStateFactory *ALconvolutionStateFactory_getFactory(void);
+
+/* Impulse responses for the convolution effect. Loading one takes a while, so
+ * it's done without the device lock, then swapped into a convolution effect
+ * state with the lock held.
+ */
+typedef struct ALconvolutionIR ALconvolutionIR;
+ALconvolutionIR *ALconvolutionIR_create(const ALCdevice *device, struct ALbuffer *buffer);
+void ALconvolutionIR_delete(ALconvolutionIR *ir);
+ALconvolutionIR *ALconvolutionState_exchangeIR(ALeffectState *state, ALconvolutionIR *ir);
 
 
 ALenum InitializeEffect(ALCdevice *Device, ALeffectslot *EffectSlot, ALeffect *effect);
@@ -21,6 +21,7 @@ enum {
     FLANGER,
     MODULATOR,
     DEDICATED,
+    CONVOLUTION,
 
     MAX_EFFECTS
 };
@@ -61,6 +62,7 @@ extern const struct ALeffectVtable ALflanger_vtable;
 extern const struct ALeffectVtable ALmodulator_vtable;
 extern const struct ALeffectVtable ALnull_vtable;
 extern const struct ALeffectVtable ALdedicated_vtable;
+extern const struct ALeffectVtable ALconvolution_vtable;
 
 
 typedef union ALeffectProps {
@@ -177,9 +179,9 @@ typedef struct ALeffect {
 } ALeffect;
 
 inline struct ALeffect *LookupEffect(ALCdevice *device, ALuint id)
-{ return (struct ALeffect*)LookupUIntMapKey(&device->EffectMap, id); }
+{ return (struct ALeffect*)LookupHandleMapKey(&device->EffectMap, id); }
 inline struct ALeffect *RemoveEffect(ALCdevice *device, ALuint id)
-{ return (struct ALeffect*)RemoveUIntMapKey(&device->EffectMap, id); }
+{ return (struct ALeffect*)RemoveHandleMapKey(&device->EffectMap, id); }
 
 inline ALboolean IsReverbEffect(ALenum type)
 { return type == AL_EFFECT_REVERB || type == AL_EFFECT_EAXREVERB; }
@@ -78,6 +78,20 @@ inline void ALfilterState_clear(ALfilterState *filter)
 }
 
 void ALfilterState_setParams(ALfilterState *filter, ALfilterType type, ALfloat gain, ALfloat freq_mult, ALfloat rcpQ);
+/* Copies the coefficients from another filter, leaving the history alone. */
+inline void ALfilterState_copyParams(ALfilterState *restrict dst, const ALfilterState *restrict src)
+{
+    dst->a1 = src->a1;
+    dst->a2 = src->a2;
+    dst->b1 = src->b1;
+    dst->b2 = src->b2;
+    dst->input_gain = src->input_gain;
+    dst->process = src->process;
+}
+/* Estimates how many samples the filter's impulse response takes to decay
+ * below -100dB, from its pole radius. Returns ~0u for unstable filters.
+ */
+ALuint ALfilterState_calcTailLength(const ALfilterState *filter);
 
 inline ALfloat ALfilterState_processSingle(ALfilterState *filter, ALfloat sample)
 {
@@ -117,6 +131,39 @@ inline void ALfilterState_processPassthru(ALfilterState *filter, const ALfloat *
 }
 
 
+/* The number of channels filtered in lockstep by the lane filter functions,
+ * matching the SIMD vector width. */
+#define MAX_FILTER_LANES 4
+
+/* History for running one filter's coefficients over MAX_FILTER_LANES
+ * channels at once. Lane filtering uses the transposed direct form II, which
+ * only needs two state values per channel, taking the coefficients from an
+ * ALfilterState (whose own history is unused).
+ */
+typedef struct ALfilterLanes {
+    alignas(16) ALfloat z1[MAX_FILTER_LANES];
+    alignas(16) ALfloat z2[MAX_FILTER_LANES];
+} ALfilterLanes;
+
+inline void ALfilterLanes_clear(ALfilterLanes *lanes)
+{
+    ALuint i;
+    for(i = 0;i < MAX_FILTER_LANES;i++)
+    {
+        lanes->z1[i] = 0.0f;
+        lanes->z2[i] = 0.0f;
+    }
+}
+
+/* Runs numchans (up to MAX_FILTER_LANES) channels through a series of
+ * numfilters filters, each with its own lane history. The output may be the
+ * same as the input. */
+typedef void (*FilterLanesFunc)(const ALfilterState *filters, ALfilterLanes *lanes,
+                                ALuint numfilters, ALuint numchans,
+                                ALfloat *const *dst, const ALfloat *const *src,
+                                ALuint numsamples);
+
+
 typedef struct ALfilter {
     // Filter type (AL_FILTER_NULL, ...)
     ALenum type;
@@ -152,9 +199,9 @@ typedef struct ALfilter {
 #define ALfilter_GetParamfv(x, c, p, v) ((x)->GetParamfv((x),(c),(p),(v)))
 
 inline struct ALfilter *LookupFilter(ALCdevice *device, ALuint id)
-{ return (struct ALfilter*)LookupUIntMapKey(&device->FilterMap, id); }
+{ return (struct ALfilter*)LookupHandleMapKey(&device->FilterMap, id); }
 inline struct ALfilter *RemoveFilter(ALCdevice *device, ALuint id)
-{ return (struct ALfilter*)RemoveUIntMapKey(&device->FilterMap, id); }
+{ return (struct ALfilter*)RemoveHandleMapKey(&device->FilterMap, id); }
 
 ALvoid ReleaseALFilters(ALCdevice *device);
 
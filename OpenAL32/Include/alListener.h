@@ -19,7 +19,17 @@ typedef struct ALlistener {
     struct {
         aluMatrixd Matrix;
         aluVector  Velocity;
+        /* The position the matrix was built with. */
+        ALdouble   Position[3];
     } Params;
+
+    /* Properties as of the last update, to check changes against. */
+    struct {
+        ALfloat Position[3];
+        ALfloat Forward[3];
+        ALfloat Up[3];
+        ALfloat Gain;
+    } Used;
 } ALlistener;
 
 #ifdef __cplusplus
@@ -34,6 +34,8 @@
 #include "align.h"
 #include "atomic.h"
 #include "uintmap.h"
+#include "handlemap.h"
+#include "objpool.h"
 #include "vector.h"
 #include "alstring.h"
 #include "almalloc.h"
@@ -216,6 +218,7 @@ extern "C" {
 #endif
 
 struct Hrtf;
+struct PolyphaseBank;
 
 
 #define DEFAULT_OUTPUT_RATE  (44100)
@@ -442,6 +445,36 @@ typedef struct HrtfParams {
  */
 #define BUFFERSIZE (2048u)
 
+/* The most fixed-ratio resampler filter banks a device keeps, for the
+ * different source rates and resamplers in use. */
+#define MAX_POLYPHASE_BANKS 16
+
+/* The most threads a device can use to process effect slots, besides the
+ * mixer thread. */
+#define MAX_EFFECT_THREADS 8
+
+/* The most auxiliary sends a source can have. */
+#define MAX_SENDS 4
+
+/* Describes a set of channels to mix into: the device's dry or first-order
+ * output, or an effect slot's wet buffer.
+ */
+typedef struct MixParams {
+    union {
+        /* Ambisonic coefficients for mixing to the buffer. */
+        ChannelConfig Coeffs[MAX_OUTPUT_CHANNELS];
+        /* Coefficient channel mapping for mixing to the buffer. */
+        BFChannelConfig Map[MAX_OUTPUT_CHANNELS];
+    } Ambi;
+    /* Number of coefficients in each ChannelConfig to mix together (4 for
+     * first-order, 9 for second-order, etc), or 0 to use the channel mapping.
+     */
+    ALuint CoeffCount;
+
+    ALfloat (*Buffer)[BUFFERSIZE];
+    ALuint NumChannels;
+} MixParams;
+
 struct ALCdevice_struct
 {
     RefCount ref;
@@ -470,13 +503,16 @@ struct ALCdevice_struct
     ALuint  NumAuxSends;
 
     // Map of Buffers for this device
-    UIntMap BufferMap;
+    HandleMap BufferMap;
+    ObjectPool BufferPool;
 
     // Map of Effects for this device
-    UIntMap EffectMap;
+    HandleMap EffectMap;
+    ObjectPool EffectPool;
 
     // Map of Filters for this device
-    UIntMap FilterMap;
+    HandleMap FilterMap;
+    ObjectPool FilterPool;
 
     /* HRTF filter tables */
     vector_HrtfEntry Hrtf_List;
@@ -498,6 +534,13 @@ struct ALCdevice_struct
     // Stereo-to-binaural filter
     struct bs2b *Bs2b;
 
+    /* Look-ahead limiter for the real output, if enabled. */
+    struct Limiter *Limiter;
+
+    /* Dither for 16-bit output, with the state of the generators. */
+    ALboolean Dither;
+    ALuint DitherSeed[4];
+
     /* Rendering mode. */
     enum RenderMode Render_Mode;
 
@@ -512,36 +555,15 @@ struct ALCdevice_struct
     alignas(16) ALfloat ResampledData[BUFFERSIZE];
     alignas(16) ALfloat FilteredData[BUFFERSIZE];
 
-    /* The "dry" path corresponds to the main output. */
-    struct {
-        union {
-            /* Ambisonic coefficients for mixing to the dry buffer. */
-            ChannelConfig Coeffs[MAX_OUTPUT_CHANNELS];
-            /* Coefficient channel mapping for mixing to the dry buffer. */
-            BFChannelConfig Map[MAX_OUTPUT_CHANNELS];
-        } Ambi;
-        /* Number of coefficients in each ChannelConfig to mix together (4 for
-         * first-order, 9 for second-order, etc).
-         */
-        ALuint CoeffCount;
-
-        /* Dry buffer will be aliased by the virtual or real output. */
-        ALfloat (*Buffer)[BUFFERSIZE];
-        ALuint NumChannels;
-    } Dry;
-
-    /* First-order ambisonics output, to be upsampled to the dry buffer if different. */
-    struct {
-        union {
-            ChannelConfig Coeffs[MAX_OUTPUT_CHANNELS];
-            BFChannelConfig Map[MAX_OUTPUT_CHANNELS];
-        } Ambi;
-        /* Will only be 4 or 0. */
-        ALuint CoeffCount;
+    /* The "dry" path corresponds to the main output. Dry buffer will be
+     * aliased by the virtual or real output.
+     */
+    MixParams Dry;
 
-        ALfloat (*Buffer)[BUFFERSIZE];
-        ALuint NumChannels;
-    } FOAOut;
+    /* First-order ambisonics output, to be upsampled to the dry buffer if
+     * different. CoeffCount will only be 4 or 0.
+     */
+    MixParams FOAOut;
 
     /* Virtual output, to be post-processed to the real output. */
     struct {
@@ -563,6 +585,42 @@ struct ALCdevice_struct
      */
     RefCount MixCount;
 
+    /* Thread calculating source updates off the mixer thread, if enabled. The
+     * mixer bumps UpdateRequests after each mix to have the thread calculate
+     * the next targets while the device is waiting for more output.
+     *
+     * The thread holds UpdateCalcLock, rather than the backend lock, while it
+     * calculates, so the mixer isn't held up by it. ALCdevice_Lock takes it
+     * too, keeping the source and listener properties steady for the thread.
+     */
+    ALboolean UpdateThreadActive;
+    althrd_t UpdateThread;
+    almtx_t UpdateLock;
+    alcnd_t UpdateCond;
+    almtx_t UpdateCalcLock;
+    RefCount UpdateRequests;
+    ATOMIC(ALenum) UpdateThreadKill;
+
+    /* Threads processing independent effect slots alongside the mixer, if
+     * enabled. Each slot given to them renders into its own job buffer, which
+     * the mixer sums into the slot's output in order once they're all done.
+     */
+    ALuint NumEffectThreads;
+    althrd_t EffectThreads[MAX_EFFECT_THREADS];
+    almtx_t EffectLock;
+    alcnd_t EffectCond;
+    alcnd_t EffectDoneCond;
+    struct ALeffectJob *EffectJobs;
+    ALuint EffectJobMax;
+    ALuint EffectJobCount;
+    ALuint EffectJobNext;
+    ALuint EffectJobsDone;
+    ALuint EffectSamplesToDo;
+    ATOMIC(ALenum) EffectThreadKill;
+
+    /* Fixed-ratio resampler coefficients, created as sources need them. */
+    ATOMIC(struct PolyphaseBank*) PolyphaseBanks[MAX_POLYPHASE_BANKS];
+
     /* Default effect slot */
     struct ALeffectslot *DefaultSlot;
 
@@ -600,6 +658,9 @@ struct ALCdevice_struct
 /* Must be less than 15 characters (16 including terminating null) for
  * compatibility with pthread_setname_np limitations. */
 #define MIXER_THREAD_NAME "alsoft-mixer"
+#define UPDATE_THREAD_NAME "alsoft-update"
+#define EFFECT_THREAD_NAME "alsoft-effect"
+#define CONVOLVE_THREAD_NAME "alsoft-convolve"
 
 #define RECORD_THREAD_NAME "alsoft-record"
 
@@ -610,13 +671,35 @@ struct ALCcontext_struct
 
     struct ALlistener *Listener;
 
-    UIntMap SourceMap;
-    UIntMap EffectSlotMap;
+    HandleMap SourceMap;
+    HandleMap EffectSlotMap;
+
+    /* Storage for sources, their buffer queue items, and effect slots. */
+    ObjectPool SourcePool;
+    ObjectPool BufferListPool;
+    ObjectPool EffectSlotPool;
+    /* Buffer queue items unqueued while the mixer may still be using them. */
+    ATOMIC(struct ALbufferlistitem*) RetiredBufferLists;
 
     ATOMIC(ALenum) LastError;
 
     ATOMIC(ALenum) UpdateSources;
 
+    /* Changes to source and listener positions, orientations, gains, and
+     * pitches no larger than these, compared to the values last used for an
+     * update, don't trigger another update. 0 disables the check.
+     */
+    struct {
+        ALfloat Position;
+        ALfloat Orientation;
+        ALfloat Gain;
+        ALfloat Pitch;
+    } UpdateEpsilon;
+    /* Number of source updates calculated, and of property changes that were
+     * too small to need one. */
+    RefCount UpdatesPerformed;
+    RefCount UpdatesSkipped;
+
     volatile enum DistanceModel DistanceModel;
     volatile ALboolean SourceDistanceModel;
 
@@ -641,6 +724,7 @@ struct ALCcontext_struct
 };
 
 ALCcontext *GetContextRef(void);
+void ReleaseContextRef(ALCcontext *context);
 
 void ALCcontext_IncRef(ALCcontext *context);
 void ALCcontext_DecRef(ALCcontext *context);
@@ -650,6 +734,8 @@ void AppendCaptureDeviceList(const ALCchar *name);
 
 void ALCdevice_Lock(ALCdevice *device);
 void ALCdevice_Unlock(ALCdevice *device);
+/* Returns the output latency in nanoseconds. Caller must lock the device. */
+ALint64 ALCdevice_GetLatency(ALCdevice *device);
 
 void ALCcontext_DeferUpdates(ALCcontext *context);
 void ALCcontext_ProcessUpdates(ALCcontext *context);
@@ -660,6 +746,29 @@ inline void LockContext(ALCcontext *context)
 inline void UnlockContext(ALCcontext *context)
 { ALCdevice_Unlock(context->Device); }
 
+/* Checks if a property changed enough from the value last used for an update
+ * to need another one, counting it as skipped if not.
+ */
+inline ALboolean ExceedsUpdateEpsilon(ALCcontext *context, ALfloat epsilon, ALfloat used, ALfloat value)
+{
+    if(!(epsilon > 0.0f) || fabsf(value-used) > epsilon)
+        return AL_TRUE;
+    IncrementRef(&context->UpdatesSkipped);
+    return AL_FALSE;
+}
+
+/* As above, for vectors, using the distance between them. */
+inline ALboolean ExceedsUpdateEpsilon3(ALCcontext *context, ALfloat epsilon, const ALfloat used[3], const ALfloat values[3])
+{
+    ALfloat dx = values[0] - used[0];
+    ALfloat dy = values[1] - used[1];
+    ALfloat dz = values[2] - used[2];
+    if(!(epsilon > 0.0f) || dx*dx + dy*dy + dz*dz > epsilon*epsilon)
+        return AL_TRUE;
+    IncrementRef(&context->UpdatesSkipped);
+    return AL_FALSE;
+}
+
 
 typedef struct {
 #ifdef HAVE_FENV_H
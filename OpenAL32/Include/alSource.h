@@ -1,11 +1,10 @@
 #ifndef _AL_SOURCE_H_
 #define _AL_SOURCE_H_
 
-#define MAX_SENDS                 4
-
 #include "alMain.h"
 #include "alu.h"
 #include "hrtf.h"
+#include "alBuffer.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -15,20 +14,107 @@ struct ALbuffer;
 struct ALsource;
 
 
+/* The buffer queue is a singly linked list, which the mixer walks without
+ * holding any lock. Items are only ever appended at the tail, and only items
+ * behind the source's current_buffer are removed from the head. A mix that
+ * started while the source was looping can still wrap back to removed items,
+ * so they're retired to the context, tagged with the device's MixCount, and
+ * only freed once that mix is done.
+ */
 typedef struct ALbufferlistitem {
     struct ALbuffer *buffer;
-    struct ALbufferlistitem *volatile next;
+    ATOMIC(struct ALbufferlistitem*) next;
+
+    /* Only used by the first item of a retired run. The run's last item still
+     * links into the live queue, so it's tracked separately. */
+    struct ALbufferlistitem *RetireTail;
+    struct ALbufferlistitem *RetireNext;
+    ALuint RetireEpoch;
 } ALbufferlistitem;
 
 
+/* Mixing targets calculated from the source properties. These mirror the
+ * voice's own target parameters, and are copied over by the mixer when it
+ * picks them up.
+ */
+typedef struct ALvoiceTargets {
+    ALint Step;
+    enum Resampler Resampler;
+    /* Set when the step is a fixed ratio with a polyphase filter bank. */
+    const PolyphaseBank *Polyphase;
+    ALboolean IsHrtf;
+    /* Only set for the bsinc resampler. */
+    BsincState SincState;
+
+    /* Number of input channels with targets set. */
+    ALuint NumChannels;
+
+    struct {
+        ALfloat (*OutBuffer)[BUFFERSIZE];
+        ALuint OutChannels;
+
+        struct {
+            enum ActiveFilters ActiveType;
+            ALfilterState LowPass;
+            ALfilterState HighPass;
+        } Filters[MAX_INPUT_CHANNELS];
+
+        struct {
+            HrtfParams Target;
+        } Hrtf[MAX_INPUT_CHANNELS];
+
+        struct {
+            ALfloat Target[MAX_OUTPUT_CHANNELS];
+        } Gains[MAX_INPUT_CHANNELS];
+    } Direct;
+
+    struct {
+        ALfloat (*OutBuffer)[BUFFERSIZE];
+        ALuint OutChannels;
+
+        struct {
+            enum ActiveFilters ActiveType;
+            ALfilterState LowPass;
+            ALfilterState HighPass;
+        } Filters[MAX_INPUT_CHANNELS];
+
+        struct {
+            ALfloat Target[MAX_OUTPUT_CHANNELS];
+        } Gains[MAX_INPUT_CHANNELS];
+    } Send[MAX_SENDS];
+} ALvoiceTargets;
+
+/* Set in a voice's PendingTargets when it holds targets the mixer hasn't read. */
+#define VOICE_TARGETS_FRESH  4
+
+
 typedef struct ALvoice {
     struct ALsource *volatile Source;
 
     /** Method to update mixing parameters. */
     ALvoid (*Update)(struct ALvoice *self, const struct ALsource *source, const ALCcontext *context);
 
+    /* The voice has three target buffers, allocated together in TargetStore.
+     * Update calculates into NextTargets and swaps it into PendingTargets
+     * with VOICE_TARGETS_FRESH set, taking back the buffer that was there.
+     * The mixer swaps a fresh PendingTargets with the buffer it last read
+     * from, MixTargets. Neither side needs the device lock to do this, since
+     * each always holds a buffer the other can't touch.
+     */
+    ALvoiceTargets *TargetStore;
+    ALuint NextTargets;
+    ALuint MixTargets;
+    ATOMIC(ALuint) PendingTargets;
+
+    /* Resampler quality steps dropped by the last update, for the LOD. */
+    ALuint LODSteps;
+
     /** Current target parameters used for mixing. */
     ALint Step;
+    ResamplerFunc Resampler;
+
+    /* Fixed-ratio filter bank used in place of the resampler, if any. */
+    const PolyphaseBank *Polyphase;
 
     /* If not 'moving', gain/coefficients are set directly without fading. */
     ALboolean Moving;
@@ -66,6 +152,7 @@ typedef struct ALsource {
     volatile ALboolean Looping;
     volatile enum DistanceModel DistanceModel;
     volatile ALboolean DirectChannels;
+    volatile enum Resampler Resampler;
 
     volatile ALboolean DryGainHFAuto;
     volatile ALboolean WetGainAuto;
@@ -113,6 +200,10 @@ typedef struct ALsource {
     /** Current buffer sample info. */
     ALuint NumChannels;
     ALuint SampleSize;
+    /* Format info of the queued buffers, cached so the mixer doesn't need to
+     * walk the queue to find it. */
+    ALuint Frequency;
+    enum FmtChannels FmtChannels;
 
     /** Direct filter and auxiliary send info. */
     struct {
@@ -134,19 +225,28 @@ typedef struct ALsource {
     /** Source needs to update its mixing parameters. */
     ATOMIC(ALenum) NeedsUpdate;
 
+    /* Properties as of the last update, to check changes against. */
+    struct {
+        ALfloat Position[3];
+        ALfloat Direction[3];
+        ALfloat Gain;
+        ALfloat Pitch;
+    } Used;
+
     /** Self ID */
     ALuint id;
 } ALsource;
 
 inline struct ALsource *LookupSource(ALCcontext *context, ALuint id)
-{ return (struct ALsource*)LookupUIntMapKey(&context->SourceMap, id); }
+{ return (struct ALsource*)LookupHandleMapKey(&context->SourceMap, id); }
 inline struct ALsource *RemoveSource(ALCcontext *context, ALuint id)
-{ return (struct ALsource*)RemoveUIntMapKey(&context->SourceMap, id); }
+{ return (struct ALsource*)RemoveHandleMapKey(&context->SourceMap, id); }
 
 ALvoid SetSourceState(ALsource *Source, ALCcontext *Context, ALenum state);
 ALboolean ApplyOffset(ALsource *Source);
 
 ALvoid ReleaseALSources(ALCcontext *Context);
+ALvoid ReleaseRetiredBufferLists(ALCcontext *Context);
 
 #ifdef __cplusplus
 }
@@ -23,10 +23,10 @@
 #define MAX_PITCH  (255)
 
 /* Maximum number of buffer samples before the current pos needed for resampling. */
-#define MAX_PRE_SAMPLES 12
+#define MAX_PRE_SAMPLES 24
 
 /* Maximum number of buffer samples after the current pos needed for resampling. */
-#define MAX_POST_SAMPLES 12
+#define MAX_POST_SAMPLES 24
 
 
 #ifdef __cplusplus
@@ -60,6 +60,22 @@ typedef struct BsincState {
     } coeffs[BSINC_PHASE_COUNT];
 } BsincState;
 
+/* A table of filter coefficients and deltas generated by bsincgen, along with
+ * the per-scale coefficient counts and offsets to find them in it.
+ */
+typedef struct BsincTable {
+    ALfloat scaleBase, scaleRange;
+    ALuint m[BSINC_SCALE_COUNT];
+    ALuint to[4][BSINC_SCALE_COUNT];
+    ALuint tm[2][BSINC_SCALE_COUNT];
+    const ALfloat *Tab;
+} BsincTable;
+
+/* 8-point/40dB, 12-point/60dB, and 24-point/90dB tables. */
+extern const BsincTable bsinc8;
+extern const BsincTable bsinc12;
+extern const BsincTable bsinc24;
+
 
 typedef union aluVector {
     alignas(16) ALfloat v[4];
@@ -186,10 +202,54 @@ typedef struct SendParams {
 } SendParams;
 
 
+enum Resampler {
+    PointResampler,
+    LinearResampler,
+    FIR4Resampler,
+    FIR8Resampler,
+    BSinc8Resampler,
+    BSinc12Resampler,
+    BSinc24Resampler,
+
+    ResamplerMax = BSinc24Resampler
+};
+
+/* The resampler new sources start with, from the 'resampler' config option. */
+extern enum Resampler ResamplerDefault;
+/* Lower the resampler quality of sources as they get quieter with distance. */
+extern ALboolean ResamplerLOD;
+
 typedef const ALfloat* (*ResamplerFunc)(const BsincState *state,
     const ALfloat *src, ALuint frac, ALuint increment, ALfloat *restrict dst, ALuint dstlen
 );
 
+/* The most output phases a fixed-ratio resampler will cycle through. */
+#define MAX_POLYPHASE_PHASES 512
+
+/* Filter coefficients for resampling at a fixed rational ratio, with one row
+ * of Taps coefficients for each output phase. Playing at this ratio only ever
+ * lands on these phases, so the resampler can step through the rows instead
+ * of interpolating coefficients from the fractional position.
+ */
+typedef struct PolyphaseBank {
+    enum Resampler Resampler;
+    ALuint SrcRate, DstRate;
+
+    /* The ratio reduces to IntStep + FracStep/Phases source samples for each
+     * output sample. */
+    ALuint Phases;
+    ALuint IntStep, FracStep;
+
+    ALuint Taps;
+    ALint Offset; /* Offset of the first tap from the current sample. */
+
+    alignas(16) ALfloat Coeffs[];
+} PolyphaseBank;
+
+typedef const ALfloat* (*PolyphaseFunc)(const PolyphaseBank *bank,
+    const ALfloat *src, ALuint phase, ALfloat *restrict dst, ALuint dstlen
+);
+
 typedef void (*MixerFunc)(const ALfloat *data, ALuint OutChans,
                           ALfloat (*restrict OutBuffer)[BUFFERSIZE], struct MixGains *Gains,
                           ALuint Counter, ALuint OutPos, ALuint BufferSize);
@@ -199,6 +259,99 @@ typedef void (*HrtfMixerFunc)(ALfloat (*restrict OutBuffer)[BUFFERSIZE], ALuint
                               HrtfState *hrtfstate, ALuint BufferSize);
 
 
+/* Number of sources whose geometry is calculated together in one batch. Must
+ * be a multiple of 4.
+ */
+#define SOURCE_GEOMETRY_BATCH 64
+
+/* Source vectors and distance properties for a batch of sources, stored as
+ * separate arrays per component so they can be processed several sources at a
+ * time. The input positions are already offset by the listener position
+ * (which is done in double precision, so large world coordinates don't lose
+ * precision), and the inputs are transformed by Rotation to get them relative
+ * to the listener.
+ */
+typedef struct SourceGeometry {
+    ALfloat Rotation[3][3];
+    ALfloat ListenerVel[3];
+    /* The context's speed of sound, scaled by its Doppler velocity. */
+    ALfloat SpeedOfSound;
+    ALsizei NumSends;
+
+    /* Inputs */
+    alignas(16) ALfloat PosX[SOURCE_GEOMETRY_BATCH];
+    alignas(16) ALfloat PosY[SOURCE_GEOMETRY_BATCH];
+    alignas(16) ALfloat PosZ[SOURCE_GEOMETRY_BATCH];
+    alignas(16) ALfloat VelX[SOURCE_GEOMETRY_BATCH];
+    alignas(16) ALfloat VelY[SOURCE_GEOMETRY_BATCH];
+    alignas(16) ALfloat VelZ[SOURCE_GEOMETRY_BATCH];
+    alignas(16) ALfloat DirX[SOURCE_GEOMETRY_BATCH];
+    alignas(16) ALfloat DirY[SOURCE_GEOMETRY_BATCH];
+    alignas(16) ALfloat DirZ[SOURCE_GEOMETRY_BATCH];
+
+    /* The distance model in effect for each source, and its parameters.
+     * AirAbsorption is the source's air absorption factor scaled by the
+     * listener's meters per unit, and DopplerFactor is the source's Doppler
+     * factor scaled by the context's.
+     */
+    alignas(16) ALint   DistanceModel[SOURCE_GEOMETRY_BATCH];
+    alignas(16) ALfloat RefDistance[SOURCE_GEOMETRY_BATCH];
+    alignas(16) ALfloat MaxDistance[SOURCE_GEOMETRY_BATCH];
+    alignas(16) ALfloat Rolloff[SOURCE_GEOMETRY_BATCH];
+    alignas(16) ALfloat AirAbsorption[SOURCE_GEOMETRY_BATCH];
+    alignas(16) ALfloat InnerAngle[SOURCE_GEOMETRY_BATCH];
+    alignas(16) ALfloat OuterAngle[SOURCE_GEOMETRY_BATCH];
+    alignas(16) ALfloat OuterGain[SOURCE_GEOMETRY_BATCH];
+    alignas(16) ALfloat OuterGainHF[SOURCE_GEOMETRY_BATCH];
+    alignas(16) ALfloat DopplerFactor[SOURCE_GEOMETRY_BATCH];
+    /* The rolloff, air absorption gain, and reverb decay distance of each
+     * send, as given by the effect slot it feeds. */
+    alignas(16) ALfloat RoomRolloff[MAX_SENDS][SOURCE_GEOMETRY_BATCH];
+    alignas(16) ALfloat RoomAirAbsorption[MAX_SENDS][SOURCE_GEOMETRY_BATCH];
+    alignas(16) ALfloat DecayDistance[MAX_SENDS][SOURCE_GEOMETRY_BATCH];
+
+    /* Outputs. ToListener is the normalized source-to-listener vector, and
+     * the dot products are of it with the normalized source direction, the
+     * source velocity, and the listener velocity.
+     */
+    alignas(16) ALfloat ToListenerX[SOURCE_GEOMETRY_BATCH];
+    alignas(16) ALfloat ToListenerY[SOURCE_GEOMETRY_BATCH];
+    alignas(16) ALfloat ToListenerZ[SOURCE_GEOMETRY_BATCH];
+    alignas(16) ALfloat Distance[SOURCE_GEOMETRY_BATCH];
+    alignas(16) ALfloat DirDot[SOURCE_GEOMETRY_BATCH];
+    alignas(16) ALfloat VelDot[SOURCE_GEOMETRY_BATCH];
+    alignas(16) ALfloat ListenerVelDot[SOURCE_GEOMETRY_BATCH];
+
+    /* The distance attenuation and air absorption HF gain of the dry path and
+     * each send, the decay of each send's reverb over the dry path's apparent
+     * distance, the cone's gain and HF gain, the Doppler pitch shift, and the
+     * elevation and azimuth of the source relative to the listener.
+     */
+    alignas(16) ALfloat Attenuation[SOURCE_GEOMETRY_BATCH];
+    alignas(16) ALfloat AirAbsorptionHF[SOURCE_GEOMETRY_BATCH];
+    alignas(16) ALfloat RoomAttenuation[MAX_SENDS][SOURCE_GEOMETRY_BATCH];
+    alignas(16) ALfloat RoomAirAbsorptionHF[MAX_SENDS][SOURCE_GEOMETRY_BATCH];
+    alignas(16) ALfloat WetDecay[MAX_SENDS][SOURCE_GEOMETRY_BATCH];
+    alignas(16) ALfloat ConeGain[SOURCE_GEOMETRY_BATCH];
+    alignas(16) ALfloat ConeGainHF[SOURCE_GEOMETRY_BATCH];
+    alignas(16) ALfloat DopplerShift[SOURCE_GEOMETRY_BATCH];
+    alignas(16) ALfloat Elevation[SOURCE_GEOMETRY_BATCH];
+    alignas(16) ALfloat Azimuth[SOURCE_GEOMETRY_BATCH];
+} SourceGeometry;
+
+/* Calculates the outputs for the first 'count' sources of the batch. 'count'
+ * is rounded up to a multiple of 4, so unused inputs up to there must be
+ * valid (e.g. zero). */
+typedef void (*GeometryFunc)(SourceGeometry *geom, ALsizei count);
+
+/* Multiplies the complex spectra x and h (as separate real and imaginary
+ * arrays), adding the result to acc. The arrays are 16-byte aligned, and
+ * 'count' is a multiple of 4. */
+typedef void (*SpectraMulAccFunc)(ALfloat *restrict accr, ALfloat *restrict acci,
+                                  const ALfloat *xr, const ALfloat *xi,
+                                  const ALfloat *hr, const ALfloat *hi, ALuint count);
+
+
 #define GAIN_SILENCE_THRESHOLD  (0.00001f) /* -100dB */
 
 #define SPEEDOFSOUNDMETRESPERSEC  (343.3f)
@@ -252,13 +405,11 @@ inline ALuint64 clampu64(ALuint64 val, ALuint64 min, ALuint64 max)
 { return minu64(max, maxu64(min, val)); }
 
 
-union ResamplerCoeffs {
-    ALfloat FIR4[FRACTIONONE][4];
-    ALfloat FIR8[FRACTIONONE][8];
+struct ResamplerCoeffs {
+    alignas(16) ALfloat FIR4[FRACTIONONE][4];
+    alignas(16) ALfloat FIR8[FRACTIONONE][8];
 };
-extern alignas(16) union ResamplerCoeffs ResampleCoeffs;
-
-extern alignas(16) const ALfloat bsincTab[18840];
+extern alignas(16) const struct ResamplerCoeffs ResampleCoeffs;
 
 
 inline ALfloat lerp(ALfloat val1, ALfloat val2, ALfloat mu)
@@ -287,6 +438,14 @@ enum HrtfRequestMode {
 
 void aluInitMixer(void);
 
+ResamplerFunc SelectResampler(enum Resampler resampler);
+
+/* Creates the fixed-ratio filter banks a source may use at the device's
+ * current rate. The mixer only looks banks up, so they have to be made ahead
+ * of time. Caller must lock the device. */
+void aluPreparePolyphaseBanks(ALCdevice *device, const struct ALsource *source);
+void aluFreePolyphaseBanks(ALCdevice *device);
+
 /* aluInitRenderer
  *
  * Set up the appropriate panning method and mixing method given the device
@@ -373,6 +532,9 @@ void ComputeFirstOrderGainsBF(const BFChannelConfig *chanmap, ALuint numchans, c
 
 
 ALvoid UpdateContextSources(ALCcontext *context);
+/* Calculates the initial targets for a voice that was just started. Caller
+ * must lock the device. */
+ALvoid aluStartVoice(ALCcontext *context, struct ALvoice *voice);
 
 ALvoid CalcSourceParams(struct ALvoice *voice, const struct ALsource *source, const ALCcontext *ALContext);
 ALvoid CalcNonAttnSourceParams(struct ALvoice *voice, const struct ALsource *source, const ALCcontext *ALContext);
@@ -380,6 +542,14 @@ ALvoid CalcNonAttnSourceParams(struct ALvoice *voice, const struct ALsource *sou
 ALvoid MixSource(struct ALvoice *voice, struct ALsource *source, ALCdevice *Device, ALuint SamplesToDo);
 
 ALvoid aluMixData(ALCdevice *device, ALvoid *buffer, ALsizei size);
+/* Starts and stops the device's update thread, which calculates source
+ * updates between mixes. */
+void aluStartUpdateThread(ALCdevice *device);
+void aluStopUpdateThread(ALCdevice *device);
+/* Starts and stops the device's effect threads, which process independent
+ * effect slots in parallel. */
+void aluStartEffectThreads(ALCdevice *device, ALuint count);
+void aluStopEffectThreads(ALCdevice *device);
 /* Caller must lock the device. */
 ALvoid aluHandleDisconnect(ALCdevice *device);
 
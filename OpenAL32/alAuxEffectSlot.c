@@ -21,6 +21,7 @@
 #include "config.h"
 
 #include <stdlib.h>
+#include <string.h>
 #include <math.h>
 
 #include "AL/al.h"
@@ -30,15 +31,28 @@
 #include "alThunk.h"
 #include "alError.h"
 #include "alSource.h"
+#include "alBuffer.h"
 
 #include "almalloc.h"
 
 
 extern inline struct ALeffectslot *LookupEffectSlot(ALCcontext *context, ALuint id);
 extern inline struct ALeffectslot *RemoveEffectSlot(ALCcontext *context, ALuint id);
+extern inline const MixParams *GetEffectSlotDryOut(const ALCdevice *device, const ALeffectslot *slot);
+extern inline const MixParams *GetEffectSlotFOAOut(const ALCdevice *device, const ALeffectslot *slot);
 
 static ALenum AddEffectSlotArray(ALCcontext *Context, ALeffectslot **start, ALsizei count);
 static void RemoveEffectSlotArray(ALCcontext *Context, const ALeffectslot *slot);
+static void SortEffectSlotArray(ALCcontext *context);
+
+
+static inline ALuint GetEffectSlotDepth(const ALeffectslot *slot)
+{
+    ALuint depth = 0;
+    while((slot=slot->Target) != NULL)
+        depth++;
+    return depth;
+}
 
 
 static UIntMap EffectStateFactoryMap;
@@ -54,13 +68,21 @@ static inline ALeffectStateFactory *getFactoryByType(ALenum type)
 AL_API ALvoid AL_APIENTRY alGenAuxiliaryEffectSlots(ALsizei n, ALuint *effectslots)
 {
     ALCcontext *context;
-    VECTOR(ALeffectslot*) slotvec;
-    ALsizei cur;
-    ALenum err;
 
     context = GetContextRef();
     if(!context) return;
 
+    alGenAuxiliaryEffectSlotsDirect(context, n, effectslots);
+
+    ReleaseContextRef(context);
+}
+
+AL_API ALvoid AL_APIENTRY alGenAuxiliaryEffectSlotsDirect(ALCcontext *context, ALsizei n, ALuint *effectslots)
+{
+    VECTOR(ALeffectslot*) slotvec;
+    ALsizei cur;
+    ALenum err;
+
     VECTOR_INIT(slotvec);
 
     if(!(n >= 0))
@@ -70,25 +92,25 @@ AL_API ALvoid AL_APIENTRY alGenAuxiliaryEffectSlots(ALsizei n, ALuint *effectslo
 
     for(cur = 0;cur < n;cur++)
     {
-        ALeffectslot *slot = al_calloc(16, sizeof(ALeffectslot));
+        ALeffectslot *slot = ObjectPoolAlloc(&context->EffectSlotPool);
         err = AL_OUT_OF_MEMORY;
         if(!slot || (err=InitEffectSlot(slot)) != AL_NO_ERROR)
         {
-            al_free(slot);
-            alDeleteAuxiliaryEffectSlots(cur, effectslots);
+            ObjectPoolFree(&context->EffectSlotPool, slot);
+            alDeleteAuxiliaryEffectSlotsDirect(context, cur, effectslots);
             SET_ERROR_AND_GOTO(context, err, done);
         }
 
         err = NewThunkEntry(&slot->id);
         if(err == AL_NO_ERROR)
-            err = InsertUIntMapEntry(&context->EffectSlotMap, slot->id, slot);
+            err = InsertHandleMapEntry(&context->EffectSlotMap, slot->id, slot);
         if(err != AL_NO_ERROR)
         {
             FreeThunkEntry(slot->id);
             DELETE_OBJ(slot->EffectState);
-            al_free(slot);
+            ObjectPoolFree(&context->EffectSlotPool, slot);
 
-            alDeleteAuxiliaryEffectSlots(cur, effectslots);
+            alDeleteAuxiliaryEffectSlotsDirect(context, cur, effectslots);
             SET_ERROR_AND_GOTO(context, err, done);
         }
 
@@ -101,25 +123,31 @@ AL_API ALvoid AL_APIENTRY alGenAuxiliaryEffectSlots(ALsizei n, ALuint *effectslo
     err = AddEffectSlotArray(context, VECTOR_BEGIN(slotvec), n);
     if(err != AL_NO_ERROR)
     {
-        alDeleteAuxiliaryEffectSlots(cur, effectslots);
+        alDeleteAuxiliaryEffectSlotsDirect(context, cur, effectslots);
         SET_ERROR_AND_GOTO(context, err, done);
     }
 
 done:
     VECTOR_DEINIT(slotvec);
-
-    ALCcontext_DecRef(context);
 }
 
 AL_API ALvoid AL_APIENTRY alDeleteAuxiliaryEffectSlots(ALsizei n, const ALuint *effectslots)
 {
     ALCcontext *context;
-    ALeffectslot *slot;
-    ALsizei i;
 
     context = GetContextRef();
     if(!context) return;
 
+    alDeleteAuxiliaryEffectSlotsDirect(context, n, effectslots);
+
+    ReleaseContextRef(context);
+}
+
+AL_API ALvoid AL_APIENTRY alDeleteAuxiliaryEffectSlotsDirect(ALCcontext *context, ALsizei n, const ALuint *effectslots)
+{
+    ALeffectslot *slot;
+    ALsizei i;
+
     if(!(n >= 0))
         SET_ERROR_AND_GOTO(context, AL_INVALID_VALUE, done);
     for(i = 0;i < n;i++)
@@ -139,41 +167,63 @@ AL_API ALvoid AL_APIENTRY alDeleteAuxiliaryEffectSlots(ALsizei n, const ALuint *
 
         RemoveEffectSlotArray(context, slot);
         DELETE_OBJ(slot->EffectState);
+        if(slot->Buffer)
+            DecrementRef(&slot->Buffer->ref);
+        if(slot->Target)
+            DecrementRef(&slot->Target->ref);
 
-        memset(slot, 0, sizeof(*slot));
-        al_free(slot);
+        ObjectPoolFree(&context->EffectSlotPool, slot);
     }
 
 done:
-    ALCcontext_DecRef(context);
+    return;
 }
 
 AL_API ALboolean AL_APIENTRY alIsAuxiliaryEffectSlot(ALuint effectslot)
 {
     ALCcontext *context;
-    ALboolean  ret;
+    ALboolean ret;
 
     context = GetContextRef();
     if(!context) return AL_FALSE;
 
-    ret = (LookupEffectSlot(context, effectslot) ? AL_TRUE : AL_FALSE);
+    ret = alIsAuxiliaryEffectSlotDirect(context, effectslot);
 
-    ALCcontext_DecRef(context);
+    ReleaseContextRef(context);
+    return ret;
+}
+
+AL_API ALboolean AL_APIENTRY alIsAuxiliaryEffectSlotDirect(ALCcontext *context, ALuint effectslot)
+{
+    ALboolean  ret;
+
+    ret = (LookupEffectSlot(context, effectslot) ? AL_TRUE : AL_FALSE);
 
     return ret;
 }
 
 AL_API ALvoid AL_APIENTRY alAuxiliaryEffectSloti(ALuint effectslot, ALenum param, ALint value)
 {
-    ALCdevice *device;
     ALCcontext *context;
-    ALeffectslot *slot;
-    ALeffect *effect = NULL;
-    ALenum err;
 
     context = GetContextRef();
     if(!context) return;
 
+    alAuxiliaryEffectSlotiDirect(context, effectslot, param, value);
+
+    ReleaseContextRef(context);
+}
+
+AL_API ALvoid AL_APIENTRY alAuxiliaryEffectSlotiDirect(ALCcontext *context, ALuint effectslot, ALenum param, ALint value)
+{
+    ALCdevice *device;
+    ALeffectslot *slot, *target, *iter;
+    ALeffect *effect = NULL;
+    ALbuffer *buffer = NULL;
+    ALconvolutionIR *ir = NULL;
+    FPUCtl oldMode;
+    ALenum err;
+
     device = context->Device;
     if((slot=LookupEffectSlot(context, effectslot)) == NULL)
         SET_ERROR_AND_GOTO(context, AL_INVALID_NAME, done);
@@ -198,29 +248,115 @@ AL_API ALvoid AL_APIENTRY alAuxiliaryEffectSloti(ALuint effectslot, ALenum param
         ATOMIC_STORE(&context->UpdateSources, AL_TRUE);
         break;
 
+    case AL_BUFFER:
+        buffer = (value ? LookupBuffer(device, value) : NULL);
+        if(!(value == 0 || buffer != NULL))
+            SET_ERROR_AND_GOTO(context, AL_INVALID_VALUE, done);
+        if(buffer && !(buffer->FmtChannels == FmtMono ||
+                       buffer->FmtChannels == FmtBFormat2D ||
+                       buffer->FmtChannels == FmtBFormat3D))
+            SET_ERROR_AND_GOTO(context, AL_INVALID_VALUE, done);
+
+        if(buffer) IncrementRef(&buffer->ref);
+        SetMixerFPUMode(&oldMode);
+        while(1)
+        {
+            /* Loading the IR resamples and transforms it, so it's done before
+             * locking the device. It's loaded again if the device was reset
+             * to another rate in the mean time. */
+            ALuint frequency = device->Frequency;
+            if(buffer && slot->EffectType == AL_EFFECT_CONVOLUTION_REVERB_SOFTX)
+                ir = ALconvolutionIR_create(device, buffer);
+            ALCdevice_Lock(device);
+            if(device->Frequency == frequency)
+                break;
+            ALCdevice_Unlock(device);
+            ALconvolutionIR_delete(ir);
+            ir = NULL;
+        }
+        buffer = ExchangePtr((XchgPtr*)&slot->Buffer, buffer);
+        if(slot->EffectType == AL_EFFECT_CONVOLUTION_REVERB_SOFTX)
+            ir = ALconvolutionState_exchangeIR(slot->EffectState, ir);
+        ATOMIC_STORE(&slot->NeedsUpdate, AL_FALSE);
+        V(slot->EffectState,update)(device, slot);
+        ALCdevice_Unlock(device);
+        RestoreFPUMode(&oldMode);
+        /* The old IR may still refer to the old buffer, so it goes first. */
+        ALconvolutionIR_delete(ir);
+        if(buffer) DecrementRef(&buffer->ref);
+        break;
+
+    case AL_EFFECTSLOT_TARGET_SOFT:
+        target = (value ? LookupEffectSlot(context, value) : NULL);
+        if(!(value == 0 || target != NULL))
+            SET_ERROR_AND_GOTO(context, AL_INVALID_VALUE, done);
+
+        if(target) IncrementRef(&target->ref);
+        SetMixerFPUMode(&oldMode);
+        ALCdevice_Lock(device);
+        /* The target can't feed back into this slot. This is checked with the
+         * device locked, so no other slot's target can change before this
+         * one is set. */
+        for(iter = target;iter != NULL;iter = iter->Target)
+        {
+            if(iter == slot)
+            {
+                ALCdevice_Unlock(device);
+                RestoreFPUMode(&oldMode);
+                DecrementRef(&target->ref);
+                SET_ERROR_AND_GOTO(context, AL_INVALID_OPERATION, done);
+            }
+        }
+        target = ExchangePtr((XchgPtr*)&slot->Target, target);
+        if(slot->Target)
+        {
+            ALuint i;
+            for(i = 0;i < slot->Target->NumChannels;i++)
+                slot->TargetOut.Ambi.Map[i] = slot->Target->ChanMap[i];
+            slot->TargetOut.CoeffCount = 0;
+            slot->TargetOut.Buffer = slot->Target->WetBuffer;
+            slot->TargetOut.NumChannels = slot->Target->NumChannels;
+        }
+        SortEffectSlotArray(context);
+        ATOMIC_STORE(&slot->NeedsUpdate, AL_FALSE);
+        V(slot->EffectState,update)(device, slot);
+        ALCdevice_Unlock(device);
+        RestoreFPUMode(&oldMode);
+        if(target) DecrementRef(&target->ref);
+        break;
+
     default:
         SET_ERROR_AND_GOTO(context, AL_INVALID_ENUM, done);
     }
 
 done:
-    ALCcontext_DecRef(context);
+    return;
 }
 
 AL_API ALvoid AL_APIENTRY alAuxiliaryEffectSlotiv(ALuint effectslot, ALenum param, const ALint *values)
 {
     ALCcontext *context;
 
+    context = GetContextRef();
+    if(!context) return;
+
+    alAuxiliaryEffectSlotivDirect(context, effectslot, param, values);
+
+    ReleaseContextRef(context);
+}
+
+AL_API ALvoid AL_APIENTRY alAuxiliaryEffectSlotivDirect(ALCcontext *context, ALuint effectslot, ALenum param, const ALint *values)
+{
     switch(param)
     {
     case AL_EFFECTSLOT_EFFECT:
     case AL_EFFECTSLOT_AUXILIARY_SEND_AUTO:
-        alAuxiliaryEffectSloti(effectslot, param, values[0]);
+    case AL_EFFECTSLOT_TARGET_SOFT:
+    case AL_BUFFER:
+        alAuxiliaryEffectSlotiDirect(context, effectslot, param, values[0]);
         return;
     }
 
-    context = GetContextRef();
-    if(!context) return;
-
     if(LookupEffectSlot(context, effectslot) == NULL)
         SET_ERROR_AND_GOTO(context, AL_INVALID_NAME, done);
     switch(param)
@@ -230,17 +366,25 @@ AL_API ALvoid AL_APIENTRY alAuxiliaryEffectSlotiv(ALuint effectslot, ALenum para
     }
 
 done:
-    ALCcontext_DecRef(context);
+    return;
 }
 
 AL_API ALvoid AL_APIENTRY alAuxiliaryEffectSlotf(ALuint effectslot, ALenum param, ALfloat value)
 {
     ALCcontext *context;
-    ALeffectslot *slot;
 
     context = GetContextRef();
     if(!context) return;
 
+    alAuxiliaryEffectSlotfDirect(context, effectslot, param, value);
+
+    ReleaseContextRef(context);
+}
+
+AL_API ALvoid AL_APIENTRY alAuxiliaryEffectSlotfDirect(ALCcontext *context, ALuint effectslot, ALenum param, ALfloat value)
+{
+    ALeffectslot *slot;
+
     if((slot=LookupEffectSlot(context, effectslot)) == NULL)
         SET_ERROR_AND_GOTO(context, AL_INVALID_NAME, done);
     switch(param)
@@ -258,23 +402,30 @@ AL_API ALvoid AL_APIENTRY alAuxiliaryEffectSlotf(ALuint effectslot, ALenum param
     }
 
 done:
-    ALCcontext_DecRef(context);
+    return;
 }
 
 AL_API ALvoid AL_APIENTRY alAuxiliaryEffectSlotfv(ALuint effectslot, ALenum param, const ALfloat *values)
 {
     ALCcontext *context;
 
+    context = GetContextRef();
+    if(!context) return;
+
+    alAuxiliaryEffectSlotfvDirect(context, effectslot, param, values);
+
+    ReleaseContextRef(context);
+}
+
+AL_API ALvoid AL_APIENTRY alAuxiliaryEffectSlotfvDirect(ALCcontext *context, ALuint effectslot, ALenum param, const ALfloat *values)
+{
     switch(param)
     {
     case AL_EFFECTSLOT_GAIN:
-        alAuxiliaryEffectSlotf(effectslot, param, values[0]);
+        alAuxiliaryEffectSlotfDirect(context, effectslot, param, values[0]);
         return;
     }
 
-    context = GetContextRef();
-    if(!context) return;
-
     if(LookupEffectSlot(context, effectslot) == NULL)
         SET_ERROR_AND_GOTO(context, AL_INVALID_NAME, done);
     switch(param)
@@ -284,17 +435,25 @@ AL_API ALvoid AL_APIENTRY alAuxiliaryEffectSlotfv(ALuint effectslot, ALenum para
     }
 
 done:
-    ALCcontext_DecRef(context);
+    return;
 }
 
 AL_API ALvoid AL_APIENTRY alGetAuxiliaryEffectSloti(ALuint effectslot, ALenum param, ALint *value)
 {
     ALCcontext *context;
-    ALeffectslot *slot;
 
     context = GetContextRef();
     if(!context) return;
 
+    alGetAuxiliaryEffectSlotiDirect(context, effectslot, param, value);
+
+    ReleaseContextRef(context);
+}
+
+AL_API ALvoid AL_APIENTRY alGetAuxiliaryEffectSlotiDirect(ALCcontext *context, ALuint effectslot, ALenum param, ALint *value)
+{
+    ALeffectslot *slot;
+
     if((slot=LookupEffectSlot(context, effectslot)) == NULL)
         SET_ERROR_AND_GOTO(context, AL_INVALID_NAME, done);
     switch(param)
@@ -303,29 +462,46 @@ AL_API ALvoid AL_APIENTRY alGetAuxiliaryEffectSloti(ALuint effectslot, ALenum pa
         *value = slot->AuxSendAuto;
         break;
 
+    case AL_BUFFER:
+        *value = (slot->Buffer ? slot->Buffer->id : 0);
+        break;
+
+    case AL_EFFECTSLOT_TARGET_SOFT:
+        *value = (slot->Target ? slot->Target->id : 0);
+        break;
+
     default:
         SET_ERROR_AND_GOTO(context, AL_INVALID_ENUM, done);
     }
 
 done:
-    ALCcontext_DecRef(context);
+    return;
 }
 
 AL_API ALvoid AL_APIENTRY alGetAuxiliaryEffectSlotiv(ALuint effectslot, ALenum param, ALint *values)
 {
     ALCcontext *context;
 
+    context = GetContextRef();
+    if(!context) return;
+
+    alGetAuxiliaryEffectSlotivDirect(context, effectslot, param, values);
+
+    ReleaseContextRef(context);
+}
+
+AL_API ALvoid AL_APIENTRY alGetAuxiliaryEffectSlotivDirect(ALCcontext *context, ALuint effectslot, ALenum param, ALint *values)
+{
     switch(param)
     {
     case AL_EFFECTSLOT_EFFECT:
     case AL_EFFECTSLOT_AUXILIARY_SEND_AUTO:
-        alGetAuxiliaryEffectSloti(effectslot, param, values);
+    case AL_EFFECTSLOT_TARGET_SOFT:
+    case AL_BUFFER:
+        alGetAuxiliaryEffectSlotiDirect(context, effectslot, param, values);
         return;
     }
 
-    context = GetContextRef();
-    if(!context) return;
-
     if(LookupEffectSlot(context, effectslot) == NULL)
         SET_ERROR_AND_GOTO(context, AL_INVALID_NAME, done);
     switch(param)
@@ -335,17 +511,25 @@ AL_API ALvoid AL_APIENTRY alGetAuxiliaryEffectSlotiv(ALuint effectslot, ALenum p
     }
 
 done:
-    ALCcontext_DecRef(context);
+    return;
 }
 
 AL_API ALvoid AL_APIENTRY alGetAuxiliaryEffectSlotf(ALuint effectslot, ALenum param, ALfloat *value)
 {
     ALCcontext *context;
-    ALeffectslot *slot;
 
     context = GetContextRef();
     if(!context) return;
 
+    alGetAuxiliaryEffectSlotfDirect(context, effectslot, param, value);
+
+    ReleaseContextRef(context);
+}
+
+AL_API ALvoid AL_APIENTRY alGetAuxiliaryEffectSlotfDirect(ALCcontext *context, ALuint effectslot, ALenum param, ALfloat *value)
+{
+    ALeffectslot *slot;
+
     if((slot=LookupEffectSlot(context, effectslot)) == NULL)
         SET_ERROR_AND_GOTO(context, AL_INVALID_NAME, done);
     switch(param)
@@ -359,23 +543,30 @@ AL_API ALvoid AL_APIENTRY alGetAuxiliaryEffectSlotf(ALuint effectslot, ALenum pa
     }
 
 done:
-    ALCcontext_DecRef(context);
+    return;
 }
 
 AL_API ALvoid AL_APIENTRY alGetAuxiliaryEffectSlotfv(ALuint effectslot, ALenum param, ALfloat *values)
 {
     ALCcontext *context;
 
+    context = GetContextRef();
+    if(!context) return;
+
+    alGetAuxiliaryEffectSlotfvDirect(context, effectslot, param, values);
+
+    ReleaseContextRef(context);
+}
+
+AL_API ALvoid AL_APIENTRY alGetAuxiliaryEffectSlotfvDirect(ALCcontext *context, ALuint effectslot, ALenum param, ALfloat *values)
+{
     switch(param)
     {
     case AL_EFFECTSLOT_GAIN:
-        alGetAuxiliaryEffectSlotf(effectslot, param, values);
+        alGetAuxiliaryEffectSlotfDirect(context, effectslot, param, values);
         return;
     }
 
-    context = GetContextRef();
-    if(!context) return;
-
     if(LookupEffectSlot(context, effectslot) == NULL)
         SET_ERROR_AND_GOTO(context, AL_INVALID_NAME, done);
     switch(param)
@@ -385,7 +576,7 @@ AL_API ALvoid AL_APIENTRY alGetAuxiliaryEffectSlotfv(ALuint effectslot, ALenum p
     }
 
 done:
-    ALCcontext_DecRef(context);
+    return;
 }
 
 
@@ -410,13 +601,36 @@ static void RemoveEffectSlotArray(ALCcontext *context, const ALeffectslot *slot)
     VECTOR_FIND_IF(iter, ALeffectslot*, context->ActiveAuxSlots, MATCH_SLOT);
     if(iter != VECTOR_END(context->ActiveAuxSlots))
     {
-        *iter = VECTOR_BACK(context->ActiveAuxSlots);
+        /* Keep the order, so slots stay ahead of their targets. */
+        memmove(iter, iter+1, (VECTOR_END(context->ActiveAuxSlots)-(iter+1))*sizeof(*iter));
         VECTOR_POP_BACK(context->ActiveAuxSlots);
     }
 #undef MATCH_SLOT
     UnlockContext(context);
 }
 
+/* Orders the active slots so that each one comes before the slot it targets,
+ * by how many slots its output goes through before reaching the device. The
+ * targets are known to not have cycles. Must be called with the context
+ * locked.
+ */
+static void SortEffectSlotArray(ALCcontext *context)
+{
+    ALeffectslot **slots = VECTOR_BEGIN(context->ActiveAuxSlots);
+    ALsizei count = (ALsizei)VECTOR_SIZE(context->ActiveAuxSlots);
+    ALsizei i, j;
+
+    for(i = 1;i < count;i++)
+    {
+        ALeffectslot *slot = slots[i];
+        ALuint depth = GetEffectSlotDepth(slot);
+
+        for(j = i;j > 0 && GetEffectSlotDepth(slots[j-1]) < depth;j--)
+            slots[j] = slots[j-1];
+        slots[j] = slot;
+    }
+}
+
 
 void InitEffectFactoryMap(void)
 {
@@ -435,6 +649,7 @@ void InitEffectFactoryMap(void)
     InsertUIntMapEntry(&EffectStateFactoryMap, AL_EFFECT_RING_MODULATOR, ALmodulatorStateFactory_getFactory);
     InsertUIntMapEntry(&EffectStateFactoryMap, AL_EFFECT_DEDICATED_DIALOGUE, ALdedicatedStateFactory_getFactory);
     InsertUIntMapEntry(&EffectStateFactoryMap, AL_EFFECT_DEDICATED_LOW_FREQUENCY_EFFECT, ALdedicatedStateFactory_getFactory);
+    InsertUIntMapEntry(&EffectStateFactoryMap, AL_EFFECT_CONVOLUTION_REVERB_SOFTX, ALconvolutionStateFactory_getFactory);
 }
 
 void DeinitEffectFactoryMap(void)
@@ -465,6 +680,11 @@ ALenum InitializeEffect(ALCdevice *Device, ALeffectslot *EffectSlot, ALeffect *e
 
         SetMixerFPUMode(&oldMode);
 
+        /* The new state isn't in use yet, so it can load the slot's IR
+         * without the device lock. */
+        if(newtype == AL_EFFECT_CONVOLUTION_REVERB_SOFTX && EffectSlot->Buffer)
+            ALconvolutionState_exchangeIR(State, ALconvolutionIR_create(Device, EffectSlot->Buffer));
+
         ALCdevice_Lock(Device);
         State->OutBuffer = Device->Dry.Buffer;
         State->OutChannels = Device->Dry.NumChannels;
@@ -528,7 +748,11 @@ ALenum InitEffectSlot(ALeffectslot *slot)
 
     slot->Gain = 1.0;
     slot->AuxSendAuto = AL_TRUE;
+    slot->Buffer = NULL;
+    slot->Target = NULL;
     ATOMIC_INIT(&slot->NeedsUpdate, AL_FALSE);
+    slot->WetCleared = 0;
+    slot->TailRemaining = 0;
     for(c = 0;c < 1;c++)
     {
         for(i = 0;i < BUFFERSIZE;i++)
@@ -542,15 +766,19 @@ ALenum InitEffectSlot(ALeffectslot *slot)
 ALvoid ReleaseALAuxiliaryEffectSlots(ALCcontext *Context)
 {
     ALsizei pos;
-    for(pos = 0;pos < Context->EffectSlotMap.size;pos++)
+    for(pos = 0;pos < GetHandleMapCapacity(&Context->EffectSlotMap);pos++)
     {
-        ALeffectslot *temp = Context->EffectSlotMap.array[pos].value;
-        Context->EffectSlotMap.array[pos].value = NULL;
+        ALeffectslot *temp = LookupHandleMapIndex(&Context->EffectSlotMap, pos);
+        if(!temp) continue;
+        RemoveEffectSlot(Context, temp->id);
 
         DELETE_OBJ(temp->EffectState);
+        if(temp->Buffer)
+            DecrementRef(&temp->Buffer->ref);
+        if(temp->Target)
+            DecrementRef(&temp->Target->ref);
 
         FreeThunkEntry(temp->id);
-        memset(temp, 0, sizeof(ALeffectslot));
-        al_free(temp);
+        ObjectPoolFree(&Context->EffectSlotPool, temp);
     }
 }
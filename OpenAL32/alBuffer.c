@@ -51,11 +51,19 @@ static ALboolean SanitizeAlignment(enum UserFmtType type, ALsizei *align);
 AL_API ALvoid AL_APIENTRY alGenBuffers(ALsizei n, ALuint *buffers)
 {
     ALCcontext *context;
-    ALsizei cur = 0;
 
     context = GetContextRef();
     if(!context) return;
 
+    alGenBuffersDirect(context, n, buffers);
+
+    ReleaseContextRef(context);
+}
+
+AL_API ALvoid AL_APIENTRY alGenBuffersDirect(ALCcontext *context, ALsizei n, ALuint *buffers)
+{
+    ALsizei cur = 0;
+
     if(!(n >= 0))
         SET_ERROR_AND_GOTO(context, AL_INVALID_VALUE, done);
 
@@ -64,7 +72,7 @@ AL_API ALvoid AL_APIENTRY alGenBuffers(ALsizei n, ALuint *buffers)
         ALbuffer *buffer = NewBuffer(context);
         if(!buffer)
         {
-            alDeleteBuffers(cur, buffers);
+            alDeleteBuffersDirect(context, cur, buffers);
             break;
         }
 
@@ -72,19 +80,27 @@ AL_API ALvoid AL_APIENTRY alGenBuffers(ALsizei n, ALuint *buffers)
     }
 
 done:
-    ALCcontext_DecRef(context);
+    return;
 }
 
 AL_API ALvoid AL_APIENTRY alDeleteBuffers(ALsizei n, const ALuint *buffers)
 {
-    ALCdevice *device;
     ALCcontext *context;
-    ALbuffer *ALBuf;
-    ALsizei i;
 
     context = GetContextRef();
     if(!context) return;
 
+    alDeleteBuffersDirect(context, n, buffers);
+
+    ReleaseContextRef(context);
+}
+
+AL_API ALvoid AL_APIENTRY alDeleteBuffersDirect(ALCcontext *context, ALsizei n, const ALuint *buffers)
+{
+    ALCdevice *device;
+    ALbuffer *ALBuf;
+    ALsizei i;
+
     if(!(n >= 0))
         SET_ERROR_AND_GOTO(context, AL_INVALID_VALUE, done);
 
@@ -108,7 +124,7 @@ AL_API ALvoid AL_APIENTRY alDeleteBuffers(ALsizei n, const ALuint *buffers)
     }
 
 done:
-    ALCcontext_DecRef(context);
+    return;
 }
 
 AL_API ALboolean AL_APIENTRY alIsBuffer(ALuint buffer)
@@ -119,30 +135,46 @@ AL_API ALboolean AL_APIENTRY alIsBuffer(ALuint buffer)
     context = GetContextRef();
     if(!context) return AL_FALSE;
 
+    ret = alIsBufferDirect(context, buffer);
+
+    ReleaseContextRef(context);
+    return ret;
+}
+
+AL_API ALboolean AL_APIENTRY alIsBufferDirect(ALCcontext *context, ALuint buffer)
+{
+    ALboolean ret;
+
     ret = ((!buffer || LookupBuffer(context->Device, buffer)) ?
            AL_TRUE : AL_FALSE);
 
-    ALCcontext_DecRef(context);
-
     return ret;
 }
 
 
 AL_API ALvoid AL_APIENTRY alBufferData(ALuint buffer, ALenum format, const ALvoid *data, ALsizei size, ALsizei freq)
+{
+    ALCcontext *context;
+
+    context = GetContextRef();
+    if(!context) return;
+
+    alBufferDataDirect(context, buffer, format, data, size, freq);
+
+    ReleaseContextRef(context);
+}
+
+AL_API ALvoid AL_APIENTRY alBufferDataDirect(ALCcontext *context, ALuint buffer, ALenum format, const ALvoid *data, ALsizei size, ALsizei freq)
 {
     enum UserFmtChannels srcchannels;
     enum UserFmtType srctype;
     ALCdevice *device;
-    ALCcontext *context;
     ALbuffer *albuf;
     ALenum newformat = AL_NONE;
     ALuint framesize;
     ALsizei align;
     ALenum err;
 
-    context = GetContextRef();
-    if(!context) return;
-
     device = context->Device;
     if((albuf=LookupBuffer(device, buffer)) == NULL)
         SET_ERROR_AND_GOTO(context, AL_INVALID_NAME, done);
@@ -272,24 +304,32 @@ AL_API ALvoid AL_APIENTRY alBufferData(ALuint buffer, ALenum format, const ALvoi
     }
 
 done:
-    ALCcontext_DecRef(context);
+    return;
 }
 
 AL_API ALvoid AL_APIENTRY alBufferSubDataSOFT(ALuint buffer, ALenum format, const ALvoid *data, ALsizei offset, ALsizei length)
+{
+    ALCcontext *context;
+
+    context = GetContextRef();
+    if(!context) return;
+
+    alBufferSubDataDirectSOFT(context, buffer, format, data, offset, length);
+
+    ReleaseContextRef(context);
+}
+
+AL_API ALvoid AL_APIENTRY alBufferSubDataDirectSOFT(ALCcontext *context, ALuint buffer, ALenum format, const ALvoid *data, ALsizei offset, ALsizei length)
 {
     enum UserFmtChannels srcchannels;
     enum UserFmtType srctype;
     ALCdevice *device;
-    ALCcontext *context;
     ALbuffer *albuf;
     ALuint byte_align;
     ALuint channels;
     ALuint bytes;
     ALsizei align;
 
-    context = GetContextRef();
-    if(!context) return;
-
     device = context->Device;
     if((albuf=LookupBuffer(device, buffer)) == NULL)
         SET_ERROR_AND_GOTO(context, AL_INVALID_NAME, done);
@@ -351,7 +391,7 @@ AL_API ALvoid AL_APIENTRY alBufferSubDataSOFT(ALuint buffer, ALenum format, cons
     WriteUnlock(&albuf->lock);
 
 done:
-    ALCcontext_DecRef(context);
+    return;
 }
 
 
@@ -359,15 +399,25 @@ AL_API void AL_APIENTRY alBufferSamplesSOFT(ALuint buffer,
   ALuint samplerate, ALenum internalformat, ALsizei samples,
   ALenum channels, ALenum type, const ALvoid *data)
 {
-    ALCdevice *device;
     ALCcontext *context;
-    ALbuffer *albuf;
-    ALsizei align;
-    ALenum err;
 
     context = GetContextRef();
     if(!context) return;
 
+    alBufferSamplesDirectSOFT(context, buffer, samplerate, internalformat, samples, channels, type, data);
+
+    ReleaseContextRef(context);
+}
+
+AL_API void AL_APIENTRY alBufferSamplesDirectSOFT(ALCcontext *context, ALuint buffer,
+  ALuint samplerate, ALenum internalformat, ALsizei samples,
+  ALenum channels, ALenum type, const ALvoid *data)
+{
+    ALCdevice *device;
+    ALbuffer *albuf;
+    ALsizei align;
+    ALenum err;
+
     device = context->Device;
     if((albuf=LookupBuffer(device, buffer)) == NULL)
         SET_ERROR_AND_GOTO(context, AL_INVALID_NAME, done);
@@ -388,21 +438,31 @@ AL_API void AL_APIENTRY alBufferSamplesSOFT(ALuint buffer,
         SET_ERROR_AND_GOTO(context, err, done);
 
 done:
-    ALCcontext_DecRef(context);
+    return;
 }
 
 AL_API void AL_APIENTRY alBufferSubSamplesSOFT(ALuint buffer,
   ALsizei offset, ALsizei samples,
   ALenum channels, ALenum type, const ALvoid *data)
 {
-    ALCdevice *device;
     ALCcontext *context;
-    ALbuffer *albuf;
-    ALsizei align;
 
     context = GetContextRef();
     if(!context) return;
 
+    alBufferSubSamplesDirectSOFT(context, buffer, offset, samples, channels, type, data);
+
+    ReleaseContextRef(context);
+}
+
+AL_API void AL_APIENTRY alBufferSubSamplesDirectSOFT(ALCcontext *context, ALuint buffer,
+  ALsizei offset, ALsizei samples,
+  ALenum channels, ALenum type, const ALvoid *data)
+{
+    ALCdevice *device;
+    ALbuffer *albuf;
+    ALsizei align;
+
     device = context->Device;
     if((albuf=LookupBuffer(device, buffer)) == NULL)
         SET_ERROR_AND_GOTO(context, AL_INVALID_NAME, done);
@@ -441,21 +501,31 @@ AL_API void AL_APIENTRY alBufferSubSamplesSOFT(ALuint buffer,
     WriteUnlock(&albuf->lock);
 
 done:
-    ALCcontext_DecRef(context);
+    return;
 }
 
 AL_API void AL_APIENTRY alGetBufferSamplesSOFT(ALuint buffer,
   ALsizei offset, ALsizei samples,
   ALenum channels, ALenum type, ALvoid *data)
 {
-    ALCdevice *device;
     ALCcontext *context;
-    ALbuffer *albuf;
-    ALsizei align;
 
     context = GetContextRef();
     if(!context) return;
 
+    alGetBufferSamplesDirectSOFT(context, buffer, offset, samples, channels, type, data);
+
+    ReleaseContextRef(context);
+}
+
+AL_API void AL_APIENTRY alGetBufferSamplesDirectSOFT(ALCcontext *context, ALuint buffer,
+  ALsizei offset, ALsizei samples,
+  ALenum channels, ALenum type, ALvoid *data)
+{
+    ALCdevice *device;
+    ALbuffer *albuf;
+    ALsizei align;
+
     device = context->Device;
     if((albuf=LookupBuffer(device, buffer)) == NULL)
         SET_ERROR_AND_GOTO(context, AL_INVALID_NAME, done);
@@ -494,35 +564,51 @@ AL_API void AL_APIENTRY alGetBufferSamplesSOFT(ALuint buffer,
     ReadUnlock(&albuf->lock);
 
 done:
-    ALCcontext_DecRef(context);
+    return;
 }
 
 AL_API ALboolean AL_APIENTRY alIsBufferFormatSupportedSOFT(ALenum format)
 {
-    enum FmtChannels dstchannels;
-    enum FmtType dsttype;
     ALCcontext *context;
     ALboolean ret;
 
     context = GetContextRef();
     if(!context) return AL_FALSE;
 
-    ret = DecomposeFormat(format, &dstchannels, &dsttype);
+    ret = alIsBufferFormatSupportedDirectSOFT(context, format);
 
-    ALCcontext_DecRef(context);
+    ReleaseContextRef(context);
+    return ret;
+}
+
+AL_API ALboolean AL_APIENTRY alIsBufferFormatSupportedDirectSOFT(ALCcontext *UNUSED(context), ALenum format)
+{
+    enum FmtChannels dstchannels;
+    enum FmtType dsttype;
+    ALboolean ret;
+
+    ret = DecomposeFormat(format, &dstchannels, &dsttype);
 
     return ret;
 }
 
 
-AL_API void AL_APIENTRY alBufferf(ALuint buffer, ALenum param, ALfloat UNUSED(value))
+AL_API void AL_APIENTRY alBufferf(ALuint buffer, ALenum param, ALfloat value)
 {
-    ALCdevice *device;
     ALCcontext *context;
 
     context = GetContextRef();
     if(!context) return;
 
+    alBufferfDirect(context, buffer, param, value);
+
+    ReleaseContextRef(context);
+}
+
+AL_API void AL_APIENTRY alBufferfDirect(ALCcontext *context, ALuint buffer, ALenum param, ALfloat UNUSED(value))
+{
+    ALCdevice *device;
+
     device = context->Device;
     if(LookupBuffer(device, buffer) == NULL)
         SET_ERROR_AND_GOTO(context, AL_INVALID_NAME, done);
@@ -534,18 +620,26 @@ AL_API void AL_APIENTRY alBufferf(ALuint buffer, ALenum param, ALfloat UNUSED(va
     }
 
 done:
-    ALCcontext_DecRef(context);
+    return;
 }
 
 
-AL_API void AL_APIENTRY alBuffer3f(ALuint buffer, ALenum param, ALfloat UNUSED(value1), ALfloat UNUSED(value2), ALfloat UNUSED(value3))
+AL_API void AL_APIENTRY alBuffer3f(ALuint buffer, ALenum param, ALfloat value1, ALfloat value2, ALfloat value3)
 {
-    ALCdevice *device;
     ALCcontext *context;
 
     context = GetContextRef();
     if(!context) return;
 
+    alBuffer3fDirect(context, buffer, param, value1, value2, value3);
+
+    ReleaseContextRef(context);
+}
+
+AL_API void AL_APIENTRY alBuffer3fDirect(ALCcontext *context, ALuint buffer, ALenum param, ALfloat UNUSED(value1), ALfloat UNUSED(value2), ALfloat UNUSED(value3))
+{
+    ALCdevice *device;
+
     device = context->Device;
     if(LookupBuffer(device, buffer) == NULL)
         SET_ERROR_AND_GOTO(context, AL_INVALID_NAME, done);
@@ -557,18 +651,26 @@ AL_API void AL_APIENTRY alBuffer3f(ALuint buffer, ALenum param, ALfloat UNUSED(v
     }
 
 done:
-    ALCcontext_DecRef(context);
+    return;
 }
 
 
 AL_API void AL_APIENTRY alBufferfv(ALuint buffer, ALenum param, const ALfloat *values)
 {
-    ALCdevice *device;
     ALCcontext *context;
 
     context = GetContextRef();
     if(!context) return;
 
+    alBufferfvDirect(context, buffer, param, values);
+
+    ReleaseContextRef(context);
+}
+
+AL_API void AL_APIENTRY alBufferfvDirect(ALCcontext *context, ALuint buffer, ALenum param, const ALfloat *values)
+{
+    ALCdevice *device;
+
     device = context->Device;
     if(LookupBuffer(device, buffer) == NULL)
         SET_ERROR_AND_GOTO(context, AL_INVALID_NAME, done);
@@ -582,19 +684,27 @@ AL_API void AL_APIENTRY alBufferfv(ALuint buffer, ALenum param, const ALfloat *v
     }
 
 done:
-    ALCcontext_DecRef(context);
+    return;
 }
 
 
 AL_API void AL_APIENTRY alBufferi(ALuint buffer, ALenum param, ALint value)
 {
-    ALCdevice *device;
     ALCcontext *context;
-    ALbuffer *albuf;
 
     context = GetContextRef();
     if(!context) return;
 
+    alBufferiDirect(context, buffer, param, value);
+
+    ReleaseContextRef(context);
+}
+
+AL_API void AL_APIENTRY alBufferiDirect(ALCcontext *context, ALuint buffer, ALenum param, ALint value)
+{
+    ALCdevice *device;
+    ALbuffer *albuf;
+
     device = context->Device;
     if((albuf=LookupBuffer(device, buffer)) == NULL)
         SET_ERROR_AND_GOTO(context, AL_INVALID_NAME, done);
@@ -618,18 +728,26 @@ AL_API void AL_APIENTRY alBufferi(ALuint buffer, ALenum param, ALint value)
     }
 
 done:
-    ALCcontext_DecRef(context);
+    return;
 }
 
 
-AL_API void AL_APIENTRY alBuffer3i(ALuint buffer, ALenum param, ALint UNUSED(value1), ALint UNUSED(value2), ALint UNUSED(value3))
+AL_API void AL_APIENTRY alBuffer3i(ALuint buffer, ALenum param, ALint value1, ALint value2, ALint value3)
 {
-    ALCdevice *device;
     ALCcontext *context;
 
     context = GetContextRef();
     if(!context) return;
 
+    alBuffer3iDirect(context, buffer, param, value1, value2, value3);
+
+    ReleaseContextRef(context);
+}
+
+AL_API void AL_APIENTRY alBuffer3iDirect(ALCcontext *context, ALuint buffer, ALenum param, ALint UNUSED(value1), ALint UNUSED(value2), ALint UNUSED(value3))
+{
+    ALCdevice *device;
+
     device = context->Device;
     if(LookupBuffer(device, buffer) == NULL)
         SET_ERROR_AND_GOTO(context, AL_INVALID_NAME, done);
@@ -641,14 +759,25 @@ AL_API void AL_APIENTRY alBuffer3i(ALuint buffer, ALenum param, ALint UNUSED(val
     }
 
 done:
-    ALCcontext_DecRef(context);
+    return;
 }
 
 
 AL_API void AL_APIENTRY alBufferiv(ALuint buffer, ALenum param, const ALint *values)
 {
-    ALCdevice *device;
     ALCcontext *context;
+
+    context = GetContextRef();
+    if(!context) return;
+
+    alBufferivDirect(context, buffer, param, values);
+
+    ReleaseContextRef(context);
+}
+
+AL_API void AL_APIENTRY alBufferivDirect(ALCcontext *context, ALuint buffer, ALenum param, const ALint *values)
+{
+    ALCdevice *device;
     ALbuffer *albuf;
 
     if(values)
@@ -657,14 +786,11 @@ AL_API void AL_APIENTRY alBufferiv(ALuint buffer, ALenum param, const ALint *val
         {
             case AL_UNPACK_BLOCK_ALIGNMENT_SOFT:
             case AL_PACK_BLOCK_ALIGNMENT_SOFT:
-                alBufferi(buffer, param, values[0]);
+                alBufferiDirect(context, buffer, param, values[0]);
                 return;
         }
     }
 
-    context = GetContextRef();
-    if(!context) return;
-
     device = context->Device;
     if((albuf=LookupBuffer(device, buffer)) == NULL)
         SET_ERROR_AND_GOTO(context, AL_INVALID_NAME, done);
@@ -697,19 +823,27 @@ AL_API void AL_APIENTRY alBufferiv(ALuint buffer, ALenum param, const ALint *val
     }
 
 done:
-    ALCcontext_DecRef(context);
+    return;
 }
 
 
 AL_API ALvoid AL_APIENTRY alGetBufferf(ALuint buffer, ALenum param, ALfloat *value)
 {
-    ALCdevice *device;
     ALCcontext *context;
-    ALbuffer *albuf;
 
     context = GetContextRef();
     if(!context) return;
 
+    alGetBufferfDirect(context, buffer, param, value);
+
+    ReleaseContextRef(context);
+}
+
+AL_API ALvoid AL_APIENTRY alGetBufferfDirect(ALCcontext *context, ALuint buffer, ALenum param, ALfloat *value)
+{
+    ALCdevice *device;
+    ALbuffer *albuf;
+
     device = context->Device;
     if((albuf=LookupBuffer(device, buffer)) == NULL)
         SET_ERROR_AND_GOTO(context, AL_INVALID_NAME, done);
@@ -732,18 +866,26 @@ AL_API ALvoid AL_APIENTRY alGetBufferf(ALuint buffer, ALenum param, ALfloat *val
     }
 
 done:
-    ALCcontext_DecRef(context);
+    return;
 }
 
 
 AL_API void AL_APIENTRY alGetBuffer3f(ALuint buffer, ALenum param, ALfloat *value1, ALfloat *value2, ALfloat *value3)
 {
-    ALCdevice *device;
     ALCcontext *context;
 
     context = GetContextRef();
     if(!context) return;
 
+    alGetBuffer3fDirect(context, buffer, param, value1, value2, value3);
+
+    ReleaseContextRef(context);
+}
+
+AL_API void AL_APIENTRY alGetBuffer3fDirect(ALCcontext *context, ALuint buffer, ALenum param, ALfloat *value1, ALfloat *value2, ALfloat *value3)
+{
+    ALCdevice *device;
+
     device = context->Device;
     if(LookupBuffer(device, buffer) == NULL)
         SET_ERROR_AND_GOTO(context, AL_INVALID_NAME, done);
@@ -757,25 +899,33 @@ AL_API void AL_APIENTRY alGetBuffer3f(ALuint buffer, ALenum param, ALfloat *valu
     }
 
 done:
-    ALCcontext_DecRef(context);
+    return;
 }
 
 
 AL_API void AL_APIENTRY alGetBufferfv(ALuint buffer, ALenum param, ALfloat *values)
 {
-    ALCdevice *device;
     ALCcontext *context;
 
+    context = GetContextRef();
+    if(!context) return;
+
+    alGetBufferfvDirect(context, buffer, param, values);
+
+    ReleaseContextRef(context);
+}
+
+AL_API void AL_APIENTRY alGetBufferfvDirect(ALCcontext *context, ALuint buffer, ALenum param, ALfloat *values)
+{
+    ALCdevice *device;
+
     switch(param)
     {
     case AL_SEC_LENGTH_SOFT:
-        alGetBufferf(buffer, param, values);
+        alGetBufferfDirect(context, buffer, param, values);
         return;
     }
 
-    context = GetContextRef();
-    if(!context) return;
-
     device = context->Device;
     if(LookupBuffer(device, buffer) == NULL)
         SET_ERROR_AND_GOTO(context, AL_INVALID_NAME, done);
@@ -789,19 +939,27 @@ AL_API void AL_APIENTRY alGetBufferfv(ALuint buffer, ALenum param, ALfloat *valu
     }
 
 done:
-    ALCcontext_DecRef(context);
+    return;
 }
 
 
 AL_API ALvoid AL_APIENTRY alGetBufferi(ALuint buffer, ALenum param, ALint *value)
 {
-    ALCdevice *device;
     ALCcontext *context;
-    ALbuffer *albuf;
 
     context = GetContextRef();
     if(!context) return;
 
+    alGetBufferiDirect(context, buffer, param, value);
+
+    ReleaseContextRef(context);
+}
+
+AL_API ALvoid AL_APIENTRY alGetBufferiDirect(ALCcontext *context, ALuint buffer, ALenum param, ALint *value)
+{
+    ALCdevice *device;
+    ALbuffer *albuf;
+
     device = context->Device;
     if((albuf=LookupBuffer(device, buffer)) == NULL)
         SET_ERROR_AND_GOTO(context, AL_INVALID_NAME, done);
@@ -854,18 +1012,26 @@ AL_API ALvoid AL_APIENTRY alGetBufferi(ALuint buffer, ALenum param, ALint *value
     }
 
 done:
-    ALCcontext_DecRef(context);
+    return;
 }
 
 
 AL_API void AL_APIENTRY alGetBuffer3i(ALuint buffer, ALenum param, ALint *value1, ALint *value2, ALint *value3)
 {
-    ALCdevice *device;
     ALCcontext *context;
 
     context = GetContextRef();
     if(!context) return;
 
+    alGetBuffer3iDirect(context, buffer, param, value1, value2, value3);
+
+    ReleaseContextRef(context);
+}
+
+AL_API void AL_APIENTRY alGetBuffer3iDirect(ALCcontext *context, ALuint buffer, ALenum param, ALint *value1, ALint *value2, ALint *value3)
+{
+    ALCdevice *device;
+
     device = context->Device;
     if(LookupBuffer(device, buffer) == NULL)
         SET_ERROR_AND_GOTO(context, AL_INVALID_NAME, done);
@@ -879,14 +1045,25 @@ AL_API void AL_APIENTRY alGetBuffer3i(ALuint buffer, ALenum param, ALint *value1
     }
 
 done:
-    ALCcontext_DecRef(context);
+    return;
 }
 
 
 AL_API void AL_APIENTRY alGetBufferiv(ALuint buffer, ALenum param, ALint *values)
 {
-    ALCdevice *device;
     ALCcontext *context;
+
+    context = GetContextRef();
+    if(!context) return;
+
+    alGetBufferivDirect(context, buffer, param, values);
+
+    ReleaseContextRef(context);
+}
+
+AL_API void AL_APIENTRY alGetBufferivDirect(ALCcontext *context, ALuint buffer, ALenum param, ALint *values)
+{
+    ALCdevice *device;
     ALbuffer   *albuf;
 
     switch(param)
@@ -900,13 +1077,10 @@ AL_API void AL_APIENTRY alGetBufferiv(ALuint buffer, ALenum param, ALint *values
     case AL_SAMPLE_LENGTH_SOFT:
     case AL_UNPACK_BLOCK_ALIGNMENT_SOFT:
     case AL_PACK_BLOCK_ALIGNMENT_SOFT:
-        alGetBufferi(buffer, param, values);
+        alGetBufferiDirect(context, buffer, param, values);
         return;
     }
 
-    context = GetContextRef();
-    if(!context) return;
-
     device = context->Device;
     if((albuf=LookupBuffer(device, buffer)) == NULL)
         SET_ERROR_AND_GOTO(context, AL_INVALID_NAME, done);
@@ -927,7 +1101,7 @@ AL_API void AL_APIENTRY alGetBufferiv(ALuint buffer, ALenum param, ALint *values
     }
 
 done:
-    ALCcontext_DecRef(context);
+    return;
 }
 
 
@@ -1305,19 +1479,18 @@ ALbuffer *NewBuffer(ALCcontext *context)
     ALbuffer *buffer;
     ALenum err;
 
-    buffer = calloc(1, sizeof(ALbuffer));
+    buffer = ObjectPoolAlloc(&device->BufferPool);
     if(!buffer)
         SET_ERROR_AND_RETURN_VALUE(context, AL_OUT_OF_MEMORY, NULL);
     RWLockInit(&buffer->lock);
 
     err = NewThunkEntry(&buffer->id);
     if(err == AL_NO_ERROR)
-        err = InsertUIntMapEntry(&device->BufferMap, buffer->id, buffer);
+        err = InsertHandleMapEntry(&device->BufferMap, buffer->id, buffer);
     if(err != AL_NO_ERROR)
     {
         FreeThunkEntry(buffer->id);
-        memset(buffer, 0, sizeof(ALbuffer));
-        free(buffer);
+        ObjectPoolFree(&device->BufferPool, buffer);
 
         SET_ERROR_AND_RETURN_VALUE(context, err, NULL);
     }
@@ -1332,8 +1505,7 @@ void DeleteBuffer(ALCdevice *device, ALbuffer *buffer)
 
     free(buffer->data);
 
-    memset(buffer, 0, sizeof(*buffer));
-    free(buffer);
+    ObjectPoolFree(&device->BufferPool, buffer);
 }
 
 
@@ -1345,15 +1517,15 @@ void DeleteBuffer(ALCdevice *device, ALbuffer *buffer)
 ALvoid ReleaseALBuffers(ALCdevice *device)
 {
     ALsizei i;
-    for(i = 0;i < device->BufferMap.size;i++)
+    for(i = 0;i < GetHandleMapCapacity(&device->BufferMap);i++)
     {
-        ALbuffer *temp = device->BufferMap.array[i].value;
-        device->BufferMap.array[i].value = NULL;
+        ALbuffer *temp = LookupHandleMapIndex(&device->BufferMap, i);
+        if(!temp) continue;
+        RemoveBuffer(device, temp->id);
 
         free(temp->data);
 
         FreeThunkEntry(temp->id);
-        memset(temp, 0, sizeof(ALbuffer));
-        free(temp);
+        ObjectPoolFree(&device->BufferPool, temp);
     }
 }
@@ -43,38 +43,45 @@ static void InitEffectParams(ALeffect *effect, ALenum type);
 
 AL_API ALvoid AL_APIENTRY alGenEffects(ALsizei n, ALuint *effects)
 {
-    ALCdevice *device;
     ALCcontext *context;
-    ALsizei cur;
 
     context = GetContextRef();
     if(!context) return;
 
+    alGenEffectsDirect(context, n, effects);
+
+    ReleaseContextRef(context);
+}
+
+AL_API ALvoid AL_APIENTRY alGenEffectsDirect(ALCcontext *context, ALsizei n, ALuint *effects)
+{
+    ALCdevice *device;
+    ALsizei cur;
+
     if(!(n >= 0))
         SET_ERROR_AND_GOTO(context, AL_INVALID_VALUE, done);
 
     device = context->Device;
     for(cur = 0;cur < n;cur++)
     {
-        ALeffect *effect = calloc(1, sizeof(ALeffect));
+        ALeffect *effect = ObjectPoolAlloc(&device->EffectPool);
         ALenum err = AL_OUT_OF_MEMORY;
         if(!effect || (err=InitEffect(effect)) != AL_NO_ERROR)
         {
-            free(effect);
-            alDeleteEffects(cur, effects);
+            ObjectPoolFree(&device->EffectPool, effect);
+            alDeleteEffectsDirect(context, cur, effects);
             SET_ERROR_AND_GOTO(context, err, done);
         }
 
         err = NewThunkEntry(&effect->id);
         if(err == AL_NO_ERROR)
-            err = InsertUIntMapEntry(&device->EffectMap, effect->id, effect);
+            err = InsertHandleMapEntry(&device->EffectMap, effect->id, effect);
         if(err != AL_NO_ERROR)
         {
             FreeThunkEntry(effect->id);
-            memset(effect, 0, sizeof(ALeffect));
-            free(effect);
+            ObjectPoolFree(&device->EffectPool, effect);
 
-            alDeleteEffects(cur, effects);
+            alDeleteEffectsDirect(context, cur, effects);
             SET_ERROR_AND_GOTO(context, err, done);
         }
 
@@ -82,19 +89,27 @@ AL_API ALvoid AL_APIENTRY alGenEffects(ALsizei n, ALuint *effects)
     }
 
 done:
-    ALCcontext_DecRef(context);
+    return;
 }
 
 AL_API ALvoid AL_APIENTRY alDeleteEffects(ALsizei n, const ALuint *effects)
 {
-    ALCdevice *device;
     ALCcontext *context;
-    ALeffect *effect;
-    ALsizei i;
 
     context = GetContextRef();
     if(!context) return;
 
+    alDeleteEffectsDirect(context, n, effects);
+
+    ReleaseContextRef(context);
+}
+
+AL_API ALvoid AL_APIENTRY alDeleteEffectsDirect(ALCcontext *context, ALsizei n, const ALuint *effects)
+{
+    ALCdevice *device;
+    ALeffect *effect;
+    ALsizei i;
+
     if(!(n >= 0))
         SET_ERROR_AND_GOTO(context, AL_INVALID_VALUE, done);
 
@@ -110,39 +125,54 @@ AL_API ALvoid AL_APIENTRY alDeleteEffects(ALsizei n, const ALuint *effects)
             continue;
         FreeThunkEntry(effect->id);
 
-        memset(effect, 0, sizeof(*effect));
-        free(effect);
+        ObjectPoolFree(&device->EffectPool, effect);
     }
 
 done:
-    ALCcontext_DecRef(context);
+    return;
 }
 
 AL_API ALboolean AL_APIENTRY alIsEffect(ALuint effect)
 {
     ALCcontext *Context;
-    ALboolean  result;
+    ALboolean ret;
 
     Context = GetContextRef();
     if(!Context) return AL_FALSE;
 
+    ret = alIsEffectDirect(Context, effect);
+
+    ReleaseContextRef(Context);
+    return ret;
+}
+
+AL_API ALboolean AL_APIENTRY alIsEffectDirect(ALCcontext *Context, ALuint effect)
+{
+    ALboolean  result;
+
     result = ((!effect || LookupEffect(Context->Device, effect)) ?
               AL_TRUE : AL_FALSE);
 
-    ALCcontext_DecRef(Context);
-
     return result;
 }
 
 AL_API ALvoid AL_APIENTRY alEffecti(ALuint effect, ALenum param, ALint value)
 {
     ALCcontext *Context;
-    ALCdevice  *Device;
-    ALeffect   *ALEffect;
 
     Context = GetContextRef();
     if(!Context) return;
 
+    alEffectiDirect(Context, effect, param, value);
+
+    ReleaseContextRef(Context);
+}
+
+AL_API ALvoid AL_APIENTRY alEffectiDirect(ALCcontext *Context, ALuint effect, ALenum param, ALint value)
+{
+    ALCdevice  *Device;
+    ALeffect   *ALEffect;
+
     Device = Context->Device;
     if((ALEffect=LookupEffect(Device, effect)) == NULL)
         alSetError(Context, AL_INVALID_NAME);
@@ -170,26 +200,32 @@ AL_API ALvoid AL_APIENTRY alEffecti(ALuint effect, ALenum param, ALint value)
             V(ALEffect,setParami)(Context, param, value);
         }
     }
-
-    ALCcontext_DecRef(Context);
 }
 
 AL_API ALvoid AL_APIENTRY alEffectiv(ALuint effect, ALenum param, const ALint *values)
 {
     ALCcontext *Context;
+
+    Context = GetContextRef();
+    if(!Context) return;
+
+    alEffectivDirect(Context, effect, param, values);
+
+    ReleaseContextRef(Context);
+}
+
+AL_API ALvoid AL_APIENTRY alEffectivDirect(ALCcontext *Context, ALuint effect, ALenum param, const ALint *values)
+{
     ALCdevice  *Device;
     ALeffect   *ALEffect;
 
     switch(param)
     {
         case AL_EFFECT_TYPE:
-            alEffecti(effect, param, values[0]);
+            alEffectiDirect(Context, effect, param, values[0]);
             return;
     }
 
-    Context = GetContextRef();
-    if(!Context) return;
-
     Device = Context->Device;
     if((ALEffect=LookupEffect(Device, effect)) == NULL)
         alSetError(Context, AL_INVALID_NAME);
@@ -198,19 +234,25 @@ AL_API ALvoid AL_APIENTRY alEffectiv(ALuint effect, ALenum param, const ALint *v
         /* Call the appropriate handler */
         V(ALEffect,setParamiv)(Context, param, values);
     }
-
-    ALCcontext_DecRef(Context);
 }
 
 AL_API ALvoid AL_APIENTRY alEffectf(ALuint effect, ALenum param, ALfloat value)
 {
     ALCcontext *Context;
-    ALCdevice  *Device;
-    ALeffect   *ALEffect;
 
     Context = GetContextRef();
     if(!Context) return;
 
+    alEffectfDirect(Context, effect, param, value);
+
+    ReleaseContextRef(Context);
+}
+
+AL_API ALvoid AL_APIENTRY alEffectfDirect(ALCcontext *Context, ALuint effect, ALenum param, ALfloat value)
+{
+    ALCdevice  *Device;
+    ALeffect   *ALEffect;
+
     Device = Context->Device;
     if((ALEffect=LookupEffect(Device, effect)) == NULL)
         alSetError(Context, AL_INVALID_NAME);
@@ -219,19 +261,25 @@ AL_API ALvoid AL_APIENTRY alEffectf(ALuint effect, ALenum param, ALfloat value)
         /* Call the appropriate handler */
         V(ALEffect,setParamf)(Context, param, value);
     }
-
-    ALCcontext_DecRef(Context);
 }
 
 AL_API ALvoid AL_APIENTRY alEffectfv(ALuint effect, ALenum param, const ALfloat *values)
 {
     ALCcontext *Context;
-    ALCdevice  *Device;
-    ALeffect   *ALEffect;
 
     Context = GetContextRef();
     if(!Context) return;
 
+    alEffectfvDirect(Context, effect, param, values);
+
+    ReleaseContextRef(Context);
+}
+
+AL_API ALvoid AL_APIENTRY alEffectfvDirect(ALCcontext *Context, ALuint effect, ALenum param, const ALfloat *values)
+{
+    ALCdevice  *Device;
+    ALeffect   *ALEffect;
+
     Device = Context->Device;
     if((ALEffect=LookupEffect(Device, effect)) == NULL)
         alSetError(Context, AL_INVALID_NAME);
@@ -240,19 +288,25 @@ AL_API ALvoid AL_APIENTRY alEffectfv(ALuint effect, ALenum param, const ALfloat
         /* Call the appropriate handler */
         V(ALEffect,setParamfv)(Context, param, values);
     }
-
-    ALCcontext_DecRef(Context);
 }
 
 AL_API ALvoid AL_APIENTRY alGetEffecti(ALuint effect, ALenum param, ALint *value)
 {
     ALCcontext *Context;
-    ALCdevice  *Device;
-    ALeffect   *ALEffect;
 
     Context = GetContextRef();
     if(!Context) return;
 
+    alGetEffectiDirect(Context, effect, param, value);
+
+    ReleaseContextRef(Context);
+}
+
+AL_API ALvoid AL_APIENTRY alGetEffectiDirect(ALCcontext *Context, ALuint effect, ALenum param, ALint *value)
+{
+    ALCdevice  *Device;
+    ALeffect   *ALEffect;
+
     Device = Context->Device;
     if((ALEffect=LookupEffect(Device, effect)) == NULL)
         alSetError(Context, AL_INVALID_NAME);
@@ -266,26 +320,32 @@ AL_API ALvoid AL_APIENTRY alGetEffecti(ALuint effect, ALenum param, ALint *value
             V(ALEffect,getParami)(Context, param, value);
         }
     }
-
-    ALCcontext_DecRef(Context);
 }
 
 AL_API ALvoid AL_APIENTRY alGetEffectiv(ALuint effect, ALenum param, ALint *values)
 {
     ALCcontext *Context;
+
+    Context = GetContextRef();
+    if(!Context) return;
+
+    alGetEffectivDirect(Context, effect, param, values);
+
+    ReleaseContextRef(Context);
+}
+
+AL_API ALvoid AL_APIENTRY alGetEffectivDirect(ALCcontext *Context, ALuint effect, ALenum param, ALint *values)
+{
     ALCdevice  *Device;
     ALeffect   *ALEffect;
 
     switch(param)
     {
         case AL_EFFECT_TYPE:
-            alGetEffecti(effect, param, values);
+            alGetEffectiDirect(Context, effect, param, values);
             return;
     }
 
-    Context = GetContextRef();
-    if(!Context) return;
-
     Device = Context->Device;
     if((ALEffect=LookupEffect(Device, effect)) == NULL)
         alSetError(Context, AL_INVALID_NAME);
@@ -294,19 +354,25 @@ AL_API ALvoid AL_APIENTRY alGetEffectiv(ALuint effect, ALenum param, ALint *valu
         /* Call the appropriate handler */
         V(ALEffect,getParamiv)(Context, param, values);
     }
-
-    ALCcontext_DecRef(Context);
 }
 
 AL_API ALvoid AL_APIENTRY alGetEffectf(ALuint effect, ALenum param, ALfloat *value)
 {
     ALCcontext *Context;
-    ALCdevice  *Device;
-    ALeffect   *ALEffect;
 
     Context = GetContextRef();
     if(!Context) return;
 
+    alGetEffectfDirect(Context, effect, param, value);
+
+    ReleaseContextRef(Context);
+}
+
+AL_API ALvoid AL_APIENTRY alGetEffectfDirect(ALCcontext *Context, ALuint effect, ALenum param, ALfloat *value)
+{
+    ALCdevice  *Device;
+    ALeffect   *ALEffect;
+
     Device = Context->Device;
     if((ALEffect=LookupEffect(Device, effect)) == NULL)
         alSetError(Context, AL_INVALID_NAME);
@@ -315,19 +381,25 @@ AL_API ALvoid AL_APIENTRY alGetEffectf(ALuint effect, ALenum param, ALfloat *val
         /* Call the appropriate handler */
         V(ALEffect,getParamf)(Context, param, value);
     }
-
-    ALCcontext_DecRef(Context);
 }
 
 AL_API ALvoid AL_APIENTRY alGetEffectfv(ALuint effect, ALenum param, ALfloat *values)
 {
     ALCcontext *Context;
-    ALCdevice  *Device;
-    ALeffect   *ALEffect;
 
     Context = GetContextRef();
     if(!Context) return;
 
+    alGetEffectfvDirect(Context, effect, param, values);
+
+    ReleaseContextRef(Context);
+}
+
+AL_API ALvoid AL_APIENTRY alGetEffectfvDirect(ALCcontext *Context, ALuint effect, ALenum param, ALfloat *values)
+{
+    ALCdevice  *Device;
+    ALeffect   *ALEffect;
+
     Device = Context->Device;
     if((ALEffect=LookupEffect(Device, effect)) == NULL)
         alSetError(Context, AL_INVALID_NAME);
@@ -336,8 +408,6 @@ AL_API ALvoid AL_APIENTRY alGetEffectfv(ALuint effect, ALenum param, ALfloat *va
         /* Call the appropriate handler */
         V(ALEffect,getParamfv)(Context, param, values);
     }
-
-    ALCcontext_DecRef(Context);
 }
 
 
@@ -350,15 +420,15 @@ ALenum InitEffect(ALeffect *effect)
 ALvoid ReleaseALEffects(ALCdevice *device)
 {
     ALsizei i;
-    for(i = 0;i < device->EffectMap.size;i++)
+    for(i = 0;i < GetHandleMapCapacity(&device->EffectMap);i++)
     {
-        ALeffect *temp = device->EffectMap.array[i].value;
-        device->EffectMap.array[i].value = NULL;
+        ALeffect *temp = LookupHandleMapIndex(&device->EffectMap, i);
+        if(!temp) continue;
+        RemoveEffect(device, temp->id);
 
         // Release effect structure
         FreeThunkEntry(temp->id);
-        memset(temp, 0, sizeof(ALeffect));
-        free(temp);
+        ObjectPoolFree(&device->EffectPool, temp);
     }
 }
 
@@ -496,6 +566,9 @@ static void InitEffectParams(ALeffect *effect, ALenum type)
         effect->Props.Dedicated.Gain = 1.0f;
         SET_VTABLE1(ALdedicated, effect);
         break;
+    case AL_EFFECT_CONVOLUTION_REVERB_SOFTX:
+        SET_VTABLE1(ALconvolution, effect);
+        break;
     default:
         SET_VTABLE1(ALnull, effect);
         break;
@@ -69,9 +69,14 @@ AL_API ALenum AL_APIENTRY alGetError(void)
         return AL_INVALID_OPERATION;
     }
 
-    errorCode = ATOMIC_EXCHANGE(ALenum, &Context->LastError, AL_NO_ERROR);
+    errorCode = alGetErrorDirect(Context);
 
-    ALCcontext_DecRef(Context);
+    ReleaseContextRef(Context);
 
     return errorCode;
 }
+
+AL_API ALenum AL_APIENTRY alGetErrorDirect(ALCcontext *Context)
+{
+    return ATOMIC_EXCHANGE(ALenum, &Context->LastError, AL_NO_ERROR);
+}
@@ -50,20 +50,31 @@ const struct EffectList EffectList[] = {
     { "modulator",  MODULATOR,  "AL_EFFECT_RING_MODULATOR", AL_EFFECT_RING_MODULATOR },
     { "dedicated",  DEDICATED,  "AL_EFFECT_DEDICATED_LOW_FREQUENCY_EFFECT", AL_EFFECT_DEDICATED_LOW_FREQUENCY_EFFECT },
     { "dedicated",  DEDICATED,  "AL_EFFECT_DEDICATED_DIALOGUE", AL_EFFECT_DEDICATED_DIALOGUE },
+    { "convolution", CONVOLUTION, "AL_EFFECT_CONVOLUTION_REVERB_SOFTX", AL_EFFECT_CONVOLUTION_REVERB_SOFTX },
     { NULL, 0, NULL, (ALenum)0 }
 };
 
 
 AL_API ALboolean AL_APIENTRY alIsExtensionPresent(const ALchar *extName)
 {
-    ALboolean ret = AL_FALSE;
     ALCcontext *context;
-    const char *ptr;
-    size_t len;
+    ALboolean ret;
 
     context = GetContextRef();
     if(!context) return AL_FALSE;
 
+    ret = alIsExtensionPresentDirect(context, extName);
+
+    ReleaseContextRef(context);
+    return ret;
+}
+
+AL_API ALboolean AL_APIENTRY alIsExtensionPresentDirect(ALCcontext *context, const ALchar *extName)
+{
+    ALboolean ret = AL_FALSE;
+    const char *ptr;
+    size_t len;
+
     if(!(extName))
         SET_ERROR_AND_GOTO(context, AL_INVALID_VALUE, done);
 
@@ -86,7 +97,6 @@ AL_API ALboolean AL_APIENTRY alIsExtensionPresent(const ALchar *extName)
     }
 
 done:
-    ALCcontext_DecRef(context);
     return ret;
 }
 
@@ -98,9 +108,19 @@ AL_API ALvoid* AL_APIENTRY alGetProcAddress(const ALchar *funcName)
     return alcGetProcAddress(NULL, funcName);
 }
 
+AL_API ALvoid* AL_APIENTRY alGetProcAddressDirect(ALCcontext *UNUSED(context), const ALchar *funcName)
+{
+    return alGetProcAddress(funcName);
+}
+
 AL_API ALenum AL_APIENTRY alGetEnumValue(const ALchar *enumName)
 {
     if(!enumName)
         return (ALenum)0;
     return alcGetEnumValue(NULL, enumName);
 }
+
+AL_API ALenum AL_APIENTRY alGetEnumValueDirect(ALCcontext *UNUSED(context), const ALchar *enumName)
+{
+    return alGetEnumValue(enumName);
+}
@@ -32,7 +32,9 @@
 extern inline struct ALfilter *LookupFilter(ALCdevice *device, ALuint id);
 extern inline struct ALfilter *RemoveFilter(ALCdevice *device, ALuint id);
 extern inline void ALfilterState_clear(ALfilterState *filter);
+extern inline void ALfilterState_copyParams(ALfilterState *restrict dst, const ALfilterState *restrict src);
 extern inline void ALfilterState_processPassthru(ALfilterState *filter, const ALfloat *src, ALuint numsamples);
+extern inline void ALfilterLanes_clear(ALfilterLanes *lanes);
 extern inline ALfloat ALfilterState_processSingle(ALfilterState *filter, ALfloat sample);
 extern inline ALfloat calc_rcpQ_from_slope(ALfloat gain, ALfloat slope);
 extern inline ALfloat calc_rcpQ_from_bandwidth(ALfloat freq_mult, ALfloat bandwidth);
@@ -42,38 +44,45 @@ static void InitFilterParams(ALfilter *filter, ALenum type);
 
 AL_API ALvoid AL_APIENTRY alGenFilters(ALsizei n, ALuint *filters)
 {
-    ALCdevice *device;
     ALCcontext *context;
-    ALsizei cur = 0;
-    ALenum err;
 
     context = GetContextRef();
     if(!context) return;
 
+    alGenFiltersDirect(context, n, filters);
+
+    ReleaseContextRef(context);
+}
+
+AL_API ALvoid AL_APIENTRY alGenFiltersDirect(ALCcontext *context, ALsizei n, ALuint *filters)
+{
+    ALCdevice *device;
+    ALsizei cur = 0;
+    ALenum err;
+
     if(!(n >= 0))
         SET_ERROR_AND_GOTO(context, AL_INVALID_VALUE, done);
 
     device = context->Device;
     for(cur = 0;cur < n;cur++)
     {
-        ALfilter *filter = calloc(1, sizeof(ALfilter));
+        ALfilter *filter = ObjectPoolAlloc(&device->FilterPool);
         if(!filter)
         {
-            alDeleteFilters(cur, filters);
+            alDeleteFiltersDirect(context, cur, filters);
             SET_ERROR_AND_GOTO(context, AL_OUT_OF_MEMORY, done);
         }
         InitFilterParams(filter, AL_FILTER_NULL);
 
         err = NewThunkEntry(&filter->id);
         if(err == AL_NO_ERROR)
-            err = InsertUIntMapEntry(&device->FilterMap, filter->id, filter);
+            err = InsertHandleMapEntry(&device->FilterMap, filter->id, filter);
         if(err != AL_NO_ERROR)
         {
             FreeThunkEntry(filter->id);
-            memset(filter, 0, sizeof(ALfilter));
-            free(filter);
+            ObjectPoolFree(&device->FilterPool, filter);
 
-            alDeleteFilters(cur, filters);
+            alDeleteFiltersDirect(context, cur, filters);
             SET_ERROR_AND_GOTO(context, err, done);
         }
 
@@ -81,19 +90,27 @@ AL_API ALvoid AL_APIENTRY alGenFilters(ALsizei n, ALuint *filters)
     }
 
 done:
-    ALCcontext_DecRef(context);
+    return;
 }
 
 AL_API ALvoid AL_APIENTRY alDeleteFilters(ALsizei n, const ALuint *filters)
 {
-    ALCdevice *device;
     ALCcontext *context;
-    ALfilter *filter;
-    ALsizei i;
 
     context = GetContextRef();
     if(!context) return;
 
+    alDeleteFiltersDirect(context, n, filters);
+
+    ReleaseContextRef(context);
+}
+
+AL_API ALvoid AL_APIENTRY alDeleteFiltersDirect(ALCcontext *context, ALsizei n, const ALuint *filters)
+{
+    ALCdevice *device;
+    ALfilter *filter;
+    ALsizei i;
+
     if(!(n >= 0))
         SET_ERROR_AND_GOTO(context, AL_INVALID_VALUE, done);
 
@@ -109,39 +126,54 @@ AL_API ALvoid AL_APIENTRY alDeleteFilters(ALsizei n, const ALuint *filters)
             continue;
         FreeThunkEntry(filter->id);
 
-        memset(filter, 0, sizeof(*filter));
-        free(filter);
+        ObjectPoolFree(&device->FilterPool, filter);
     }
 
 done:
-    ALCcontext_DecRef(context);
+    return;
 }
 
 AL_API ALboolean AL_APIENTRY alIsFilter(ALuint filter)
 {
     ALCcontext *Context;
-    ALboolean  result;
+    ALboolean ret;
 
     Context = GetContextRef();
     if(!Context) return AL_FALSE;
 
+    ret = alIsFilterDirect(Context, filter);
+
+    ReleaseContextRef(Context);
+    return ret;
+}
+
+AL_API ALboolean AL_APIENTRY alIsFilterDirect(ALCcontext *Context, ALuint filter)
+{
+    ALboolean  result;
+
     result = ((!filter || LookupFilter(Context->Device, filter)) ?
               AL_TRUE : AL_FALSE);
 
-    ALCcontext_DecRef(Context);
-
     return result;
 }
 
 AL_API ALvoid AL_APIENTRY alFilteri(ALuint filter, ALenum param, ALint value)
 {
     ALCcontext *Context;
-    ALCdevice  *Device;
-    ALfilter   *ALFilter;
 
     Context = GetContextRef();
     if(!Context) return;
 
+    alFilteriDirect(Context, filter, param, value);
+
+    ReleaseContextRef(Context);
+}
+
+AL_API ALvoid AL_APIENTRY alFilteriDirect(ALCcontext *Context, ALuint filter, ALenum param, ALint value)
+{
+    ALCdevice  *Device;
+    ALfilter   *ALFilter;
+
     Device = Context->Device;
     if((ALFilter=LookupFilter(Device, filter)) == NULL)
         alSetError(Context, AL_INVALID_NAME);
@@ -161,26 +193,32 @@ AL_API ALvoid AL_APIENTRY alFilteri(ALuint filter, ALenum param, ALint value)
             ALfilter_SetParami(ALFilter, Context, param, value);
         }
     }
-
-    ALCcontext_DecRef(Context);
 }
 
 AL_API ALvoid AL_APIENTRY alFilteriv(ALuint filter, ALenum param, const ALint *values)
 {
     ALCcontext *Context;
+
+    Context = GetContextRef();
+    if(!Context) return;
+
+    alFilterivDirect(Context, filter, param, values);
+
+    ReleaseContextRef(Context);
+}
+
+AL_API ALvoid AL_APIENTRY alFilterivDirect(ALCcontext *Context, ALuint filter, ALenum param, const ALint *values)
+{
     ALCdevice  *Device;
     ALfilter   *ALFilter;
 
     switch(param)
     {
         case AL_FILTER_TYPE:
-            alFilteri(filter, param, values[0]);
+            alFilteriDirect(Context, filter, param, values[0]);
             return;
     }
 
-    Context = GetContextRef();
-    if(!Context) return;
-
     Device = Context->Device;
     if((ALFilter=LookupFilter(Device, filter)) == NULL)
         alSetError(Context, AL_INVALID_NAME);
@@ -189,19 +227,25 @@ AL_API ALvoid AL_APIENTRY alFilteriv(ALuint filter, ALenum param, const ALint *v
         /* Call the appropriate handler */
         ALfilter_SetParamiv(ALFilter, Context, param, values);
     }
-
-    ALCcontext_DecRef(Context);
 }
 
 AL_API ALvoid AL_APIENTRY alFilterf(ALuint filter, ALenum param, ALfloat value)
 {
     ALCcontext *Context;
-    ALCdevice  *Device;
-    ALfilter   *ALFilter;
 
     Context = GetContextRef();
     if(!Context) return;
 
+    alFilterfDirect(Context, filter, param, value);
+
+    ReleaseContextRef(Context);
+}
+
+AL_API ALvoid AL_APIENTRY alFilterfDirect(ALCcontext *Context, ALuint filter, ALenum param, ALfloat value)
+{
+    ALCdevice  *Device;
+    ALfilter   *ALFilter;
+
     Device = Context->Device;
     if((ALFilter=LookupFilter(Device, filter)) == NULL)
         alSetError(Context, AL_INVALID_NAME);
@@ -210,19 +254,25 @@ AL_API ALvoid AL_APIENTRY alFilterf(ALuint filter, ALenum param, ALfloat value)
         /* Call the appropriate handler */
         ALfilter_SetParamf(ALFilter, Context, param, value);
     }
-
-    ALCcontext_DecRef(Context);
 }
 
 AL_API ALvoid AL_APIENTRY alFilterfv(ALuint filter, ALenum param, const ALfloat *values)
 {
     ALCcontext *Context;
-    ALCdevice  *Device;
-    ALfilter   *ALFilter;
 
     Context = GetContextRef();
     if(!Context) return;
 
+    alFilterfvDirect(Context, filter, param, values);
+
+    ReleaseContextRef(Context);
+}
+
+AL_API ALvoid AL_APIENTRY alFilterfvDirect(ALCcontext *Context, ALuint filter, ALenum param, const ALfloat *values)
+{
+    ALCdevice  *Device;
+    ALfilter   *ALFilter;
+
     Device = Context->Device;
     if((ALFilter=LookupFilter(Device, filter)) == NULL)
         alSetError(Context, AL_INVALID_NAME);
@@ -231,19 +281,25 @@ AL_API ALvoid AL_APIENTRY alFilterfv(ALuint filter, ALenum param, const ALfloat
         /* Call the appropriate handler */
         ALfilter_SetParamfv(ALFilter, Context, param, values);
     }
-
-    ALCcontext_DecRef(Context);
 }
 
 AL_API ALvoid AL_APIENTRY alGetFilteri(ALuint filter, ALenum param, ALint *value)
 {
     ALCcontext *Context;
-    ALCdevice  *Device;
-    ALfilter   *ALFilter;
 
     Context = GetContextRef();
     if(!Context) return;
 
+    alGetFilteriDirect(Context, filter, param, value);
+
+    ReleaseContextRef(Context);
+}
+
+AL_API ALvoid AL_APIENTRY alGetFilteriDirect(ALCcontext *Context, ALuint filter, ALenum param, ALint *value)
+{
+    ALCdevice  *Device;
+    ALfilter   *ALFilter;
+
     Device = Context->Device;
     if((ALFilter=LookupFilter(Device, filter)) == NULL)
         alSetError(Context, AL_INVALID_NAME);
@@ -257,26 +313,32 @@ AL_API ALvoid AL_APIENTRY alGetFilteri(ALuint filter, ALenum param, ALint *value
             ALfilter_GetParami(ALFilter, Context, param, value);
         }
     }
-
-    ALCcontext_DecRef(Context);
 }
 
 AL_API ALvoid AL_APIENTRY alGetFilteriv(ALuint filter, ALenum param, ALint *values)
 {
     ALCcontext *Context;
+
+    Context = GetContextRef();
+    if(!Context) return;
+
+    alGetFilterivDirect(Context, filter, param, values);
+
+    ReleaseContextRef(Context);
+}
+
+AL_API ALvoid AL_APIENTRY alGetFilterivDirect(ALCcontext *Context, ALuint filter, ALenum param, ALint *values)
+{
     ALCdevice  *Device;
     ALfilter   *ALFilter;
 
     switch(param)
     {
         case AL_FILTER_TYPE:
-            alGetFilteri(filter, param, values);
+            alGetFilteriDirect(Context, filter, param, values);
             return;
     }
 
-    Context = GetContextRef();
-    if(!Context) return;
-
     Device = Context->Device;
     if((ALFilter=LookupFilter(Device, filter)) == NULL)
         alSetError(Context, AL_INVALID_NAME);
@@ -285,19 +347,25 @@ AL_API ALvoid AL_APIENTRY alGetFilteriv(ALuint filter, ALenum param, ALint *valu
         /* Call the appropriate handler */
         ALfilter_GetParamiv(ALFilter, Context, param, values);
     }
-
-    ALCcontext_DecRef(Context);
 }
 
 AL_API ALvoid AL_APIENTRY alGetFilterf(ALuint filter, ALenum param, ALfloat *value)
 {
     ALCcontext *Context;
-    ALCdevice  *Device;
-    ALfilter   *ALFilter;
 
     Context = GetContextRef();
     if(!Context) return;
 
+    alGetFilterfDirect(Context, filter, param, value);
+
+    ReleaseContextRef(Context);
+}
+
+AL_API ALvoid AL_APIENTRY alGetFilterfDirect(ALCcontext *Context, ALuint filter, ALenum param, ALfloat *value)
+{
+    ALCdevice  *Device;
+    ALfilter   *ALFilter;
+
     Device = Context->Device;
     if((ALFilter=LookupFilter(Device, filter)) == NULL)
         alSetError(Context, AL_INVALID_NAME);
@@ -306,19 +374,25 @@ AL_API ALvoid AL_APIENTRY alGetFilterf(ALuint filter, ALenum param, ALfloat *val
         /* Call the appropriate handler */
         ALfilter_GetParamf(ALFilter, Context, param, value);
     }
-
-    ALCcontext_DecRef(Context);
 }
 
 AL_API ALvoid AL_APIENTRY alGetFilterfv(ALuint filter, ALenum param, ALfloat *values)
 {
     ALCcontext *Context;
-    ALCdevice  *Device;
-    ALfilter   *ALFilter;
 
     Context = GetContextRef();
     if(!Context) return;
 
+    alGetFilterfvDirect(Context, filter, param, values);
+
+    ReleaseContextRef(Context);
+}
+
+AL_API ALvoid AL_APIENTRY alGetFilterfvDirect(ALCcontext *Context, ALuint filter, ALenum param, ALfloat *values)
+{
+    ALCdevice  *Device;
+    ALfilter   *ALFilter;
+
     Device = Context->Device;
     if((ALFilter=LookupFilter(Device, filter)) == NULL)
         alSetError(Context, AL_INVALID_NAME);
@@ -327,8 +401,6 @@ AL_API ALvoid AL_APIENTRY alGetFilterfv(ALuint filter, ALenum param, ALfloat *va
         /* Call the appropriate handler */
         ALfilter_GetParamfv(ALFilter, Context, param, values);
     }
-
-    ALCcontext_DecRef(Context);
 }
 
 
@@ -413,6 +485,28 @@ void ALfilterState_setParams(ALfilterState *filter, ALfilterType type, ALfloat g
     filter->process = ALfilterState_processC;
 }
 
+ALuint ALfilterState_calcTailLength(const ALfilterState *filter)
+{
+    ALfloat disc, r;
+    ALdouble len;
+
+    /* Get the largest pole radius, from z^2 + a1*z + a2. */
+    disc = filter->a1*filter->a1 - 4.0f*filter->a2;
+    if(disc < 0.0f)
+        r = sqrtf(filter->a2);
+    else
+        r = (fabsf(filter->a1) + sqrtf(disc)) * 0.5f;
+    if(!(r < 1.0f)) return ~0u;
+    if(!(r > GAIN_SILENCE_THRESHOLD)) return 2;
+
+    /* Double the time for the response to decay by -100dB, to account for the
+     * filter's gain and coincident poles, plus the feed-forward taps.
+     */
+    len = log(GAIN_SILENCE_THRESHOLD) / log(r) * 2.0 + 2.0;
+    if(len >= (ALdouble)(~0u)) return ~0u;
+    return (ALuint)len;
+}
+
 
 static void lp_SetParami(ALfilter *UNUSED(filter), ALCcontext *context, ALenum UNUSED(param), ALint UNUSED(val))
 { SET_ERROR_AND_RETURN(context, AL_INVALID_ENUM); }
@@ -611,15 +705,15 @@ static void null_GetParamfv(ALfilter *UNUSED(filter), ALCcontext *context, ALenu
 ALvoid ReleaseALFilters(ALCdevice *device)
 {
     ALsizei i;
-    for(i = 0;i < device->FilterMap.size;i++)
+    for(i = 0;i < GetHandleMapCapacity(&device->FilterMap);i++)
     {
-        ALfilter *temp = device->FilterMap.array[i].value;
-        device->FilterMap.array[i].value = NULL;
+        ALfilter *temp = LookupHandleMapIndex(&device->FilterMap, i);
+        if(!temp) continue;
+        RemoveFilter(device, temp->id);
 
         // Release filter structure
         FreeThunkEntry(temp->id);
-        memset(temp, 0, sizeof(ALfilter));
-        free(temp);
+        ObjectPoolFree(&device->FilterPool, temp);
     }
 }
 
@@ -26,6 +26,30 @@
 #include "alListener.h"
 #include "alSource.h"
 
+
+/* Checks if a new orientation is far enough from the one last used to be worth
+ * updating for, counting it once if neither vector is.
+ */
+static ALboolean OrientationExceedsEpsilon(ALCcontext *context, const ALfloat values[6])
+{
+    ALfloat epsilon = context->UpdateEpsilon.Orientation;
+    const ALlistener *listener = context->Listener;
+    ALfloat dist2[2] = { 0.0f, 0.0f };
+    ALsizei i;
+
+    if(!(epsilon > 0.0f))
+        return AL_TRUE;
+    for(i = 0;i < 3;i++)
+    {
+        dist2[0] += (values[i]-listener->Used.Forward[i]) * (values[i]-listener->Used.Forward[i]);
+        dist2[1] += (values[3+i]-listener->Used.Up[i]) * (values[3+i]-listener->Used.Up[i]);
+    }
+    if(dist2[0] > epsilon*epsilon || dist2[1] > epsilon*epsilon)
+        return AL_TRUE;
+    IncrementRef(&context->UpdatesSkipped);
+    return AL_FALSE;
+}
+
 AL_API ALvoid AL_APIENTRY alListenerf(ALenum param, ALfloat value)
 {
     ALCcontext *context;
@@ -33,6 +57,13 @@ AL_API ALvoid AL_APIENTRY alListenerf(ALenum param, ALfloat value)
     context = GetContextRef();
     if(!context) return;
 
+    alListenerfDirect(context, param, value);
+
+    ReleaseContextRef(context);
+}
+
+AL_API ALvoid AL_APIENTRY alListenerfDirect(ALCcontext *context, ALenum param, ALfloat value)
+{
     switch(param)
     {
     case AL_GAIN:
@@ -40,7 +71,9 @@ AL_API ALvoid AL_APIENTRY alListenerf(ALenum param, ALfloat value)
             SET_ERROR_AND_GOTO(context, AL_INVALID_VALUE, done);
 
         context->Listener->Gain = value;
-        ATOMIC_STORE(&context->UpdateSources, AL_TRUE);
+        if(ExceedsUpdateEpsilon(context, context->UpdateEpsilon.Gain,
+                                context->Listener->Used.Gain, value))
+            ATOMIC_STORE(&context->UpdateSources, AL_TRUE);
         break;
 
     case AL_METERS_PER_UNIT:
@@ -56,7 +89,7 @@ AL_API ALvoid AL_APIENTRY alListenerf(ALenum param, ALfloat value)
     }
 
 done:
-    ALCcontext_DecRef(context);
+    return;
 }
 
 
@@ -67,6 +100,13 @@ AL_API ALvoid AL_APIENTRY alListener3f(ALenum param, ALfloat value1, ALfloat val
     context = GetContextRef();
     if(!context) return;
 
+    alListener3fDirect(context, param, value1, value2, value3);
+
+    ReleaseContextRef(context);
+}
+
+AL_API ALvoid AL_APIENTRY alListener3fDirect(ALCcontext *context, ALenum param, ALfloat value1, ALfloat value2, ALfloat value3)
+{
     switch(param)
     {
     case AL_POSITION:
@@ -75,7 +115,9 @@ AL_API ALvoid AL_APIENTRY alListener3f(ALenum param, ALfloat value1, ALfloat val
 
         LockContext(context);
         aluVectorSet(&context->Listener->Position, value1, value2, value3, 1.0f);
-        ATOMIC_STORE(&context->UpdateSources, AL_TRUE);
+        if(ExceedsUpdateEpsilon3(context, context->UpdateEpsilon.Position,
+                                 context->Listener->Used.Position, context->Listener->Position.v))
+            ATOMIC_STORE(&context->UpdateSources, AL_TRUE);
         UnlockContext(context);
         break;
 
@@ -94,7 +136,7 @@ AL_API ALvoid AL_APIENTRY alListener3f(ALenum param, ALfloat value1, ALfloat val
     }
 
 done:
-    ALCcontext_DecRef(context);
+    return;
 }
 
 
@@ -102,25 +144,32 @@ AL_API ALvoid AL_APIENTRY alListenerfv(ALenum param, const ALfloat *values)
 {
     ALCcontext *context;
 
+    context = GetContextRef();
+    if(!context) return;
+
+    alListenerfvDirect(context, param, values);
+
+    ReleaseContextRef(context);
+}
+
+AL_API ALvoid AL_APIENTRY alListenerfvDirect(ALCcontext *context, ALenum param, const ALfloat *values)
+{
     if(values)
     {
         switch(param)
         {
         case AL_GAIN:
         case AL_METERS_PER_UNIT:
-            alListenerf(param, values[0]);
+            alListenerfDirect(context, param, values[0]);
             return;
 
         case AL_POSITION:
         case AL_VELOCITY:
-            alListener3f(param, values[0], values[1], values[2]);
+            alListener3fDirect(context, param, values[0], values[1], values[2]);
             return;
         }
     }
 
-    context = GetContextRef();
-    if(!context) return;
-
     if(!(values))
         SET_ERROR_AND_GOTO(context, AL_INVALID_VALUE, done);
     switch(param)
@@ -138,7 +187,8 @@ AL_API ALvoid AL_APIENTRY alListenerfv(ALenum param, const ALfloat *values)
         context->Listener->Up[0] = values[3];
         context->Listener->Up[1] = values[4];
         context->Listener->Up[2] = values[5];
-        ATOMIC_STORE(&context->UpdateSources, AL_TRUE);
+        if(OrientationExceedsEpsilon(context, values))
+            ATOMIC_STORE(&context->UpdateSources, AL_TRUE);
         UnlockContext(context);
         break;
 
@@ -147,17 +197,24 @@ AL_API ALvoid AL_APIENTRY alListenerfv(ALenum param, const ALfloat *values)
     }
 
 done:
-    ALCcontext_DecRef(context);
+    return;
 }
 
 
-AL_API ALvoid AL_APIENTRY alListeneri(ALenum param, ALint UNUSED(value))
+AL_API ALvoid AL_APIENTRY alListeneri(ALenum param, ALint value)
 {
     ALCcontext *context;
 
     context = GetContextRef();
     if(!context) return;
 
+    alListeneriDirect(context, param, value);
+
+    ReleaseContextRef(context);
+}
+
+AL_API ALvoid AL_APIENTRY alListeneriDirect(ALCcontext *context, ALenum param, ALint UNUSED(value))
+{
     switch(param)
     {
     default:
@@ -165,7 +222,7 @@ AL_API ALvoid AL_APIENTRY alListeneri(ALenum param, ALint UNUSED(value))
     }
 
 done:
-    ALCcontext_DecRef(context);
+    return;
 }
 
 
@@ -173,17 +230,24 @@ AL_API void AL_APIENTRY alListener3i(ALenum param, ALint value1, ALint value2, A
 {
     ALCcontext *context;
 
+    context = GetContextRef();
+    if(!context) return;
+
+    alListener3iDirect(context, param, value1, value2, value3);
+
+    ReleaseContextRef(context);
+}
+
+AL_API void AL_APIENTRY alListener3iDirect(ALCcontext *context, ALenum param, ALint value1, ALint value2, ALint value3)
+{
     switch(param)
     {
     case AL_POSITION:
     case AL_VELOCITY:
-        alListener3f(param, (ALfloat)value1, (ALfloat)value2, (ALfloat)value3);
+        alListener3fDirect(context, param, (ALfloat)value1, (ALfloat)value2, (ALfloat)value3);
         return;
     }
 
-    context = GetContextRef();
-    if(!context) return;
-
     switch(param)
     {
     default:
@@ -191,7 +255,7 @@ AL_API void AL_APIENTRY alListener3i(ALenum param, ALint value1, ALint value2, A
     }
 
 done:
-    ALCcontext_DecRef(context);
+    return;
 }
 
 
@@ -199,6 +263,16 @@ AL_API void AL_APIENTRY alListeneriv(ALenum param, const ALint *values)
 {
     ALCcontext *context;
 
+    context = GetContextRef();
+    if(!context) return;
+
+    alListenerivDirect(context, param, values);
+
+    ReleaseContextRef(context);
+}
+
+AL_API void AL_APIENTRY alListenerivDirect(ALCcontext *context, ALenum param, const ALint *values)
+{
     if(values)
     {
         ALfloat fvals[6];
@@ -206,7 +280,7 @@ AL_API void AL_APIENTRY alListeneriv(ALenum param, const ALint *values)
         {
         case AL_POSITION:
         case AL_VELOCITY:
-            alListener3f(param, (ALfloat)values[0], (ALfloat)values[1], (ALfloat)values[2]);
+            alListener3fDirect(context, param, (ALfloat)values[0], (ALfloat)values[1], (ALfloat)values[2]);
             return;
 
         case AL_ORIENTATION:
@@ -216,14 +290,11 @@ AL_API void AL_APIENTRY alListeneriv(ALenum param, const ALint *values)
             fvals[3] = (ALfloat)values[3];
             fvals[4] = (ALfloat)values[4];
             fvals[5] = (ALfloat)values[5];
-            alListenerfv(param, fvals);
+            alListenerfvDirect(context, param, fvals);
             return;
         }
     }
 
-    context = GetContextRef();
-    if(!context) return;
-
     if(!(values))
         SET_ERROR_AND_GOTO(context, AL_INVALID_VALUE, done);
     switch(param)
@@ -233,7 +304,7 @@ AL_API void AL_APIENTRY alListeneriv(ALenum param, const ALint *values)
     }
 
 done:
-    ALCcontext_DecRef(context);
+    return;
 }
 
 
@@ -244,6 +315,13 @@ AL_API ALvoid AL_APIENTRY alGetListenerf(ALenum param, ALfloat *value)
     context = GetContextRef();
     if(!context) return;
 
+    alGetListenerfDirect(context, param, value);
+
+    ReleaseContextRef(context);
+}
+
+AL_API ALvoid AL_APIENTRY alGetListenerfDirect(ALCcontext *context, ALenum param, ALfloat *value)
+{
     if(!(value))
         SET_ERROR_AND_GOTO(context, AL_INVALID_VALUE, done);
     switch(param)
@@ -261,7 +339,7 @@ AL_API ALvoid AL_APIENTRY alGetListenerf(ALenum param, ALfloat *value)
     }
 
 done:
-    ALCcontext_DecRef(context);
+    return;
 }
 
 
@@ -272,6 +350,13 @@ AL_API ALvoid AL_APIENTRY alGetListener3f(ALenum param, ALfloat *value1, ALfloat
     context = GetContextRef();
     if(!context) return;
 
+    alGetListener3fDirect(context, param, value1, value2, value3);
+
+    ReleaseContextRef(context);
+}
+
+AL_API ALvoid AL_APIENTRY alGetListener3fDirect(ALCcontext *context, ALenum param, ALfloat *value1, ALfloat *value2, ALfloat *value3)
+{
     if(!(value1 && value2 && value3))
         SET_ERROR_AND_GOTO(context, AL_INVALID_VALUE, done);
     switch(param)
@@ -297,7 +382,7 @@ AL_API ALvoid AL_APIENTRY alGetListener3f(ALenum param, ALfloat *value1, ALfloat
     }
 
 done:
-    ALCcontext_DecRef(context);
+    return;
 }
 
 
@@ -305,22 +390,29 @@ AL_API ALvoid AL_APIENTRY alGetListenerfv(ALenum param, ALfloat *values)
 {
     ALCcontext *context;
 
+    context = GetContextRef();
+    if(!context) return;
+
+    alGetListenerfvDirect(context, param, values);
+
+    ReleaseContextRef(context);
+}
+
+AL_API ALvoid AL_APIENTRY alGetListenerfvDirect(ALCcontext *context, ALenum param, ALfloat *values)
+{
     switch(param)
     {
     case AL_GAIN:
     case AL_METERS_PER_UNIT:
-        alGetListenerf(param, values);
+        alGetListenerfDirect(context, param, values);
         return;
 
     case AL_POSITION:
     case AL_VELOCITY:
-        alGetListener3f(param, values+0, values+1, values+2);
+        alGetListener3fDirect(context, param, values+0, values+1, values+2);
         return;
     }
 
-    context = GetContextRef();
-    if(!context) return;
-
     if(!(values))
         SET_ERROR_AND_GOTO(context, AL_INVALID_VALUE, done);
     switch(param)
@@ -342,7 +434,7 @@ AL_API ALvoid AL_APIENTRY alGetListenerfv(ALenum param, ALfloat *values)
     }
 
 done:
-    ALCcontext_DecRef(context);
+    return;
 }
 
 
@@ -353,6 +445,13 @@ AL_API ALvoid AL_APIENTRY alGetListeneri(ALenum param, ALint *value)
     context = GetContextRef();
     if(!context) return;
 
+    alGetListeneriDirect(context, param, value);
+
+    ReleaseContextRef(context);
+}
+
+AL_API ALvoid AL_APIENTRY alGetListeneriDirect(ALCcontext *context, ALenum param, ALint *value)
+{
     if(!(value))
         SET_ERROR_AND_GOTO(context, AL_INVALID_VALUE, done);
     switch(param)
@@ -362,7 +461,7 @@ AL_API ALvoid AL_APIENTRY alGetListeneri(ALenum param, ALint *value)
     }
 
 done:
-    ALCcontext_DecRef(context);
+    return;
 }
 
 
@@ -373,6 +472,13 @@ AL_API void AL_APIENTRY alGetListener3i(ALenum param, ALint *value1, ALint *valu
     context = GetContextRef();
     if(!context) return;
 
+    alGetListener3iDirect(context, param, value1, value2, value3);
+
+    ReleaseContextRef(context);
+}
+
+AL_API void AL_APIENTRY alGetListener3iDirect(ALCcontext *context, ALenum param, ALint *value1, ALint *value2, ALint *value3)
+{
     if(!(value1 && value2 && value3))
         SET_ERROR_AND_GOTO(context, AL_INVALID_VALUE, done);
     switch (param)
@@ -398,7 +504,7 @@ AL_API void AL_APIENTRY alGetListener3i(ALenum param, ALint *value1, ALint *valu
     }
 
 done:
-    ALCcontext_DecRef(context);
+    return;
 }
 
 
@@ -406,17 +512,24 @@ AL_API void AL_APIENTRY alGetListeneriv(ALenum param, ALint* values)
 {
     ALCcontext *context;
 
+    context = GetContextRef();
+    if(!context) return;
+
+    alGetListenerivDirect(context, param, values);
+
+    ReleaseContextRef(context);
+}
+
+AL_API void AL_APIENTRY alGetListenerivDirect(ALCcontext *context, ALenum param, ALint* values)
+{
     switch(param)
     {
     case AL_POSITION:
     case AL_VELOCITY:
-        alGetListener3i(param, values+0, values+1, values+2);
+        alGetListener3iDirect(context, param, values+0, values+1, values+2);
         return;
     }
 
-    context = GetContextRef();
-    if(!context) return;
-
     if(!(values))
         SET_ERROR_AND_GOTO(context, AL_INVALID_VALUE, done);
     switch(param)
@@ -438,5 +551,5 @@ AL_API void AL_APIENTRY alGetListeneriv(ALenum param, ALint* values)
     }
 
 done:
-    ALCcontext_DecRef(context);
+    return;
 }
@@ -47,7 +47,8 @@ static ALvoid InitSourceParams(ALsource *Source);
 static ALint64 GetSourceSampleOffset(ALsource *Source);
 static ALdouble GetSourceSecOffset(ALsource *Source);
 static ALdouble GetSourceOffset(ALsource *Source, ALenum name);
-static ALboolean GetSampleOffset(ALsource *Source, ALuint *offset, ALuint *frac);
+static ALboolean GetSampleOffset(ALsource *Source, ALenum type, ALdouble value, ALuint *offset, ALuint *frac);
+static ALbufferlistitem *FindBufferOffset(ALsource *Source, ALuint *offset);
 
 typedef enum SourceProp {
     srcPitch = AL_PITCH,
@@ -90,6 +91,9 @@ typedef enum SourceProp {
     /* AL_SOFT_direct_channels */
     srcDirectChannelsSOFT = AL_DIRECT_CHANNELS_SOFT,
 
+    /* AL_SOFTX_source_resampler */
+    srcResamplerSOFTX = AL_SOURCE_RESAMPLER_SOFTX,
+
     /* AL_EXT_source_distance_model */
     srcDistanceModel = AL_DISTANCE_MODEL,
 
@@ -111,6 +115,13 @@ typedef enum SourceProp {
     srcOrientation = AL_ORIENTATION,
 } SourceProp;
 
+static_assert(PointResampler == AL_POINT_RESAMPLER_SOFTX && BSinc24Resampler == AL_BSINC24_RESAMPLER_SOFTX,
+              "Resampler enums don't match AL_SOFTX_source_resampler");
+
+static ALenum CheckSourcefv(ALsource *Source, ALCcontext *Context, SourceProp prop, const ALfloat *values);
+static ALenum CheckSourceiv(ALsource *Source, ALCcontext *Context, SourceProp prop, const ALint *values);
+static ALboolean ApplySourcefv(ALsource *Source, ALCcontext *Context, SourceProp prop, const ALfloat *values);
+static ALboolean ApplySourceiv(ALsource *Source, ALCcontext *Context, SourceProp prop, const ALint *values);
 static ALboolean SetSourcefv(ALsource *Source, ALCcontext *Context, SourceProp prop, const ALfloat *values);
 static ALboolean SetSourceiv(ALsource *Source, ALCcontext *Context, SourceProp prop, const ALint *values);
 static ALboolean SetSourcei64v(ALsource *Source, ALCcontext *Context, SourceProp prop, const ALint64SOFT *values);
@@ -146,6 +157,7 @@ static ALint FloatValsByProp(ALenum prop)
         case AL_AUXILIARY_SEND_FILTER_GAIN_AUTO:
         case AL_AUXILIARY_SEND_FILTER_GAINHF_AUTO:
         case AL_DIRECT_CHANNELS_SOFT:
+        case AL_SOURCE_RESAMPLER_SOFTX:
         case AL_DISTANCE_MODEL:
         case AL_SOURCE_RELATIVE:
         case AL_LOOPING:
@@ -209,6 +221,7 @@ static ALint DoubleValsByProp(ALenum prop)
         case AL_AUXILIARY_SEND_FILTER_GAIN_AUTO:
         case AL_AUXILIARY_SEND_FILTER_GAINHF_AUTO:
         case AL_DIRECT_CHANNELS_SOFT:
+        case AL_SOURCE_RESAMPLER_SOFTX:
         case AL_DISTANCE_MODEL:
         case AL_SOURCE_RELATIVE:
         case AL_LOOPING:
@@ -271,6 +284,7 @@ static ALint IntValsByProp(ALenum prop)
         case AL_AUXILIARY_SEND_FILTER_GAIN_AUTO:
         case AL_AUXILIARY_SEND_FILTER_GAINHF_AUTO:
         case AL_DIRECT_CHANNELS_SOFT:
+        case AL_SOURCE_RESAMPLER_SOFTX:
         case AL_DISTANCE_MODEL:
         case AL_SOURCE_RELATIVE:
         case AL_LOOPING:
@@ -331,6 +345,7 @@ static ALint Int64ValsByProp(ALenum prop)
         case AL_AUXILIARY_SEND_FILTER_GAIN_AUTO:
         case AL_AUXILIARY_SEND_FILTER_GAINHF_AUTO:
         case AL_DIRECT_CHANNELS_SOFT:
+        case AL_SOURCE_RESAMPLER_SOFTX:
         case AL_DISTANCE_MODEL:
         case AL_SOURCE_RELATIVE:
         case AL_LOOPING:
@@ -372,7 +387,36 @@ static ALint Int64ValsByProp(ALenum prop)
         SET_ERROR_AND_RETURN_VALUE(Context, AL_INVALID_VALUE, AL_FALSE);      \
 } while(0)
 
-static ALboolean SetSourcefv(ALsource *Source, ALCcontext *Context, SourceProp prop, const ALfloat *values)
+/* Checks that an offset would land within the source's queue. Only a playing
+ * or paused source applies a new offset right away, so only those need to be
+ * checked against the queue length.
+ */
+static ALboolean CheckSourceOffset(ALsource *Source, ALCcontext *Context, ALenum type, ALdouble offset)
+{
+    ALboolean ret = AL_TRUE;
+
+    LockContext(Context);
+    if((Source->state == AL_PLAYING || Source->state == AL_PAUSED) &&
+       !Context->DeferUpdates)
+    {
+        ALuint pos, frac;
+
+        ReadLock(&Source->queue_lock);
+        ret = GetSampleOffset(Source, type, offset, &pos, &frac) &&
+              FindBufferOffset(Source, &pos) != NULL;
+        ReadUnlock(&Source->queue_lock);
+    }
+    UnlockContext(Context);
+
+    return ret;
+}
+
+/* Checks the values for a property, without setting anything. Returns the
+ * error setting it would raise, or AL_NO_ERROR. Properties that refer to other
+ * objects are checked again when set, since the objects may be deleted in
+ * between.
+ */
+static ALenum CheckSourcefv(ALsource *Source, ALCcontext *Context, SourceProp prop, const ALfloat *values)
 {
     ALint ival;
 
@@ -383,102 +427,159 @@ static ALboolean SetSourcefv(ALsource *Source, ALCcontext *Context, SourceProp p
         case AL_SEC_LENGTH_SOFT:
         case AL_SEC_OFFSET_LATENCY_SOFT:
             /* Query only */
-            SET_ERROR_AND_RETURN_VALUE(Context, AL_INVALID_OPERATION, AL_FALSE);
+            return AL_INVALID_OPERATION;
 
         case AL_PITCH:
-            CHECKVAL(*values >= 0.0f);
+        case AL_GAIN:
+        case AL_MAX_DISTANCE:
+        case AL_ROLLOFF_FACTOR:
+        case AL_REFERENCE_DISTANCE:
+            return (*values >= 0.0f) ? AL_NO_ERROR : AL_INVALID_VALUE;
+
+        case AL_CONE_INNER_ANGLE:
+        case AL_CONE_OUTER_ANGLE:
+            return (*values >= 0.0f && *values <= 360.0f) ? AL_NO_ERROR : AL_INVALID_VALUE;
+
+        case AL_MIN_GAIN:
+        case AL_MAX_GAIN:
+        case AL_CONE_OUTER_GAIN:
+        case AL_CONE_OUTER_GAINHF:
+        case AL_DOPPLER_FACTOR:
+            return (*values >= 0.0f && *values <= 1.0f) ? AL_NO_ERROR : AL_INVALID_VALUE;
+
+        case AL_AIR_ABSORPTION_FACTOR:
+        case AL_ROOM_ROLLOFF_FACTOR:
+            return (*values >= 0.0f && *values <= 10.0f) ? AL_NO_ERROR : AL_INVALID_VALUE;
+
+        case AL_SEC_OFFSET:
+        case AL_SAMPLE_OFFSET:
+        case AL_BYTE_OFFSET:
+            if(!(*values >= 0.0f) || !CheckSourceOffset(Source, Context, prop, *values))
+                return AL_INVALID_VALUE;
+            return AL_NO_ERROR;
+
+        case AL_SOURCE_RADIUS:
+            return (*values >= 0.0f && isfinite(*values)) ? AL_NO_ERROR : AL_INVALID_VALUE;
+
+        case AL_STEREO_ANGLES:
+            return (isfinite(values[0]) && isfinite(values[1])) ? AL_NO_ERROR : AL_INVALID_VALUE;
+
+        case AL_POSITION:
+        case AL_VELOCITY:
+        case AL_DIRECTION:
+            return (isfinite(values[0]) && isfinite(values[1]) && isfinite(values[2])) ?
+                   AL_NO_ERROR : AL_INVALID_VALUE;
+
+        case AL_ORIENTATION:
+            return (isfinite(values[0]) && isfinite(values[1]) && isfinite(values[2]) &&
+                    isfinite(values[3]) && isfinite(values[4]) && isfinite(values[5])) ?
+                   AL_NO_ERROR : AL_INVALID_VALUE;
+
+
+        case AL_SOURCE_RELATIVE:
+        case AL_LOOPING:
+        case AL_SOURCE_STATE:
+        case AL_SOURCE_TYPE:
+        case AL_DISTANCE_MODEL:
+        case AL_DIRECT_FILTER_GAINHF_AUTO:
+        case AL_AUXILIARY_SEND_FILTER_GAIN_AUTO:
+        case AL_AUXILIARY_SEND_FILTER_GAINHF_AUTO:
+        case AL_DIRECT_CHANNELS_SOFT:
+        case AL_SOURCE_RESAMPLER_SOFTX:
+            ival = (ALint)values[0];
+            return CheckSourceiv(Source, Context, prop, &ival);
+
+        case AL_BUFFERS_QUEUED:
+        case AL_BUFFERS_PROCESSED:
+            ival = (ALint)((ALuint)values[0]);
+            return CheckSourceiv(Source, Context, prop, &ival);
+
+        case AL_BUFFER:
+        case AL_DIRECT_FILTER:
+        case AL_AUXILIARY_SEND_FILTER:
+        case AL_SAMPLE_OFFSET_LATENCY_SOFT:
+            break;
+    }
+
+    ERR("Unexpected property: 0x%04x\n", prop);
+    return AL_INVALID_ENUM;
+}
 
+/* Sets a property with values that passed CheckSourcefv. */
+static ALboolean ApplySourcefv(ALsource *Source, ALCcontext *Context, SourceProp prop, const ALfloat *values)
+{
+    ALint ival;
+
+    switch(prop)
+    {
+        case AL_PITCH:
             Source->Pitch = *values;
-            ATOMIC_STORE(&Source->NeedsUpdate, AL_TRUE);
+            if(ExceedsUpdateEpsilon(Context, Context->UpdateEpsilon.Pitch, Source->Used.Pitch, *values))
+                ATOMIC_STORE(&Source->NeedsUpdate, AL_TRUE);
             return AL_TRUE;
 
         case AL_CONE_INNER_ANGLE:
-            CHECKVAL(*values >= 0.0f && *values <= 360.0f);
-
             Source->InnerAngle = *values;
             ATOMIC_STORE(&Source->NeedsUpdate, AL_TRUE);
             return AL_TRUE;
 
         case AL_CONE_OUTER_ANGLE:
-            CHECKVAL(*values >= 0.0f && *values <= 360.0f);
-
             Source->OuterAngle = *values;
             ATOMIC_STORE(&Source->NeedsUpdate, AL_TRUE);
             return AL_TRUE;
 
         case AL_GAIN:
-            CHECKVAL(*values >= 0.0f);
-
             Source->Gain = *values;
-            ATOMIC_STORE(&Source->NeedsUpdate, AL_TRUE);
+            if(ExceedsUpdateEpsilon(Context, Context->UpdateEpsilon.Gain, Source->Used.Gain, *values))
+                ATOMIC_STORE(&Source->NeedsUpdate, AL_TRUE);
             return AL_TRUE;
 
         case AL_MAX_DISTANCE:
-            CHECKVAL(*values >= 0.0f);
-
             Source->MaxDistance = *values;
             ATOMIC_STORE(&Source->NeedsUpdate, AL_TRUE);
             return AL_TRUE;
 
         case AL_ROLLOFF_FACTOR:
-            CHECKVAL(*values >= 0.0f);
-
             Source->RollOffFactor = *values;
             ATOMIC_STORE(&Source->NeedsUpdate, AL_TRUE);
             return AL_TRUE;
 
         case AL_REFERENCE_DISTANCE:
-            CHECKVAL(*values >= 0.0f);
-
             Source->RefDistance = *values;
             ATOMIC_STORE(&Source->NeedsUpdate, AL_TRUE);
             return AL_TRUE;
 
         case AL_MIN_GAIN:
-            CHECKVAL(*values >= 0.0f && *values <= 1.0f);
-
             Source->MinGain = *values;
             ATOMIC_STORE(&Source->NeedsUpdate, AL_TRUE);
             return AL_TRUE;
 
         case AL_MAX_GAIN:
-            CHECKVAL(*values >= 0.0f && *values <= 1.0f);
-
             Source->MaxGain = *values;
             ATOMIC_STORE(&Source->NeedsUpdate, AL_TRUE);
             return AL_TRUE;
 
         case AL_CONE_OUTER_GAIN:
-            CHECKVAL(*values >= 0.0f && *values <= 1.0f);
-
             Source->OuterGain = *values;
             ATOMIC_STORE(&Source->NeedsUpdate, AL_TRUE);
             return AL_TRUE;
 
         case AL_CONE_OUTER_GAINHF:
-            CHECKVAL(*values >= 0.0f && *values <= 1.0f);
-
             Source->OuterGainHF = *values;
             ATOMIC_STORE(&Source->NeedsUpdate, AL_TRUE);
             return AL_TRUE;
 
         case AL_AIR_ABSORPTION_FACTOR:
-            CHECKVAL(*values >= 0.0f && *values <= 10.0f);
-
             Source->AirAbsorptionFactor = *values;
             ATOMIC_STORE(&Source->NeedsUpdate, AL_TRUE);
             return AL_TRUE;
 
         case AL_ROOM_ROLLOFF_FACTOR:
-            CHECKVAL(*values >= 0.0f && *values <= 10.0f);
-
             Source->RoomRolloffFactor = *values;
             ATOMIC_STORE(&Source->NeedsUpdate, AL_TRUE);
             return AL_TRUE;
 
         case AL_DOPPLER_FACTOR:
-            CHECKVAL(*values >= 0.0f && *values <= 1.0f);
-
             Source->DopplerFactor = *values;
             ATOMIC_STORE(&Source->NeedsUpdate, AL_TRUE);
             return AL_TRUE;
@@ -486,8 +587,6 @@ static ALboolean SetSourcefv(ALsource *Source, ALCcontext *Context, SourceProp p
         case AL_SEC_OFFSET:
         case AL_SAMPLE_OFFSET:
         case AL_BYTE_OFFSET:
-            CHECKVAL(*values >= 0.0f);
-
             LockContext(Context);
             Source->OffsetType = prop;
             Source->Offset = *values;
@@ -508,15 +607,11 @@ static ALboolean SetSourcefv(ALsource *Source, ALCcontext *Context, SourceProp p
             return AL_TRUE;
 
         case AL_SOURCE_RADIUS:
-            CHECKVAL(*values >= 0.0f && isfinite(*values));
-
             Source->Radius = *values;
             ATOMIC_STORE(&Source->NeedsUpdate, AL_TRUE);
             return AL_TRUE;
 
         case AL_STEREO_ANGLES:
-            CHECKVAL(isfinite(values[0]) && isfinite(values[1]));
-
             LockContext(Context);
             Source->StereoPan[0] = values[0];
             Source->StereoPan[1] = values[1];
@@ -526,17 +621,14 @@ static ALboolean SetSourcefv(ALsource *Source, ALCcontext *Context, SourceProp p
 
 
         case AL_POSITION:
-            CHECKVAL(isfinite(values[0]) && isfinite(values[1]) && isfinite(values[2]));
-
             LockContext(Context);
             aluVectorSet(&Source->Position, values[0], values[1], values[2], 1.0f);
             UnlockContext(Context);
-            ATOMIC_STORE(&Source->NeedsUpdate, AL_TRUE);
+            if(ExceedsUpdateEpsilon3(Context, Context->UpdateEpsilon.Position, Source->Used.Position, values))
+                ATOMIC_STORE(&Source->NeedsUpdate, AL_TRUE);
             return AL_TRUE;
 
         case AL_VELOCITY:
-            CHECKVAL(isfinite(values[0]) && isfinite(values[1]) && isfinite(values[2]));
-
             LockContext(Context);
             aluVectorSet(&Source->Velocity, values[0], values[1], values[2], 0.0f);
             UnlockContext(Context);
@@ -544,18 +636,14 @@ static ALboolean SetSourcefv(ALsource *Source, ALCcontext *Context, SourceProp p
             return AL_TRUE;
 
         case AL_DIRECTION:
-            CHECKVAL(isfinite(values[0]) && isfinite(values[1]) && isfinite(values[2]));
-
             LockContext(Context);
             aluVectorSet(&Source->Direction, values[0], values[1], values[2], 0.0f);
             UnlockContext(Context);
-            ATOMIC_STORE(&Source->NeedsUpdate, AL_TRUE);
+            if(ExceedsUpdateEpsilon3(Context, Context->UpdateEpsilon.Orientation, Source->Used.Direction, values))
+                ATOMIC_STORE(&Source->NeedsUpdate, AL_TRUE);
             return AL_TRUE;
 
         case AL_ORIENTATION:
-            CHECKVAL(isfinite(values[0]) && isfinite(values[1]) && isfinite(values[2]) &&
-                     isfinite(values[3]) && isfinite(values[4]) && isfinite(values[5]));
-
             LockContext(Context);
             Source->Orientation[0][0] = values[0];
             Source->Orientation[0][1] = values[1];
@@ -577,14 +665,16 @@ static ALboolean SetSourcefv(ALsource *Source, ALCcontext *Context, SourceProp p
         case AL_AUXILIARY_SEND_FILTER_GAIN_AUTO:
         case AL_AUXILIARY_SEND_FILTER_GAINHF_AUTO:
         case AL_DIRECT_CHANNELS_SOFT:
+        case AL_SOURCE_RESAMPLER_SOFTX:
             ival = (ALint)values[0];
-            return SetSourceiv(Source, Context, prop, &ival);
+            return ApplySourceiv(Source, Context, prop, &ival);
 
+        case AL_BYTE_LENGTH_SOFT:
+        case AL_SAMPLE_LENGTH_SOFT:
+        case AL_SEC_LENGTH_SOFT:
+        case AL_SEC_OFFSET_LATENCY_SOFT:
         case AL_BUFFERS_QUEUED:
         case AL_BUFFERS_PROCESSED:
-            ival = (ALint)((ALuint)values[0]);
-            return SetSourceiv(Source, Context, prop, &ival);
-
         case AL_BUFFER:
         case AL_DIRECT_FILTER:
         case AL_AUXILIARY_SEND_FILTER:
@@ -596,14 +686,19 @@ static ALboolean SetSourcefv(ALsource *Source, ALCcontext *Context, SourceProp p
     SET_ERROR_AND_RETURN_VALUE(Context, AL_INVALID_ENUM, AL_FALSE);
 }
 
-static ALboolean SetSourceiv(ALsource *Source, ALCcontext *Context, SourceProp prop, const ALint *values)
+static ALboolean SetSourcefv(ALsource *Source, ALCcontext *Context, SourceProp prop, const ALfloat *values)
+{
+    ALenum err;
+
+    if((err=CheckSourcefv(Source, Context, prop, values)) != AL_NO_ERROR)
+        SET_ERROR_AND_RETURN_VALUE(Context, err, AL_FALSE);
+    return ApplySourcefv(Source, Context, prop, values);
+}
+
+
+static ALenum CheckSourceiv(ALsource *Source, ALCcontext *Context, SourceProp prop, const ALint *values)
 {
     ALCdevice *device = Context->Device;
-    ALbuffer  *buffer = NULL;
-    ALfilter  *filter = NULL;
-    ALeffectslot *slot = NULL;
-    ALbufferlistitem *oldlist;
-    ALbufferlistitem *newlist;
     ALfloat fvals[6];
 
     switch(prop)
@@ -616,18 +711,116 @@ static ALboolean SetSourceiv(ALsource *Source, ALCcontext *Context, SourceProp p
         case AL_SAMPLE_LENGTH_SOFT:
         case AL_SEC_LENGTH_SOFT:
             /* Query only */
-            SET_ERROR_AND_RETURN_VALUE(Context, AL_INVALID_OPERATION, AL_FALSE);
+            return AL_INVALID_OPERATION;
 
         case AL_SOURCE_RELATIVE:
-            CHECKVAL(*values == AL_FALSE || *values == AL_TRUE);
+        case AL_LOOPING:
+        case AL_DIRECT_FILTER_GAINHF_AUTO:
+        case AL_AUXILIARY_SEND_FILTER_GAIN_AUTO:
+        case AL_AUXILIARY_SEND_FILTER_GAINHF_AUTO:
+        case AL_DIRECT_CHANNELS_SOFT:
+            return (*values == AL_FALSE || *values == AL_TRUE) ? AL_NO_ERROR : AL_INVALID_VALUE;
+
+        case AL_BUFFER:
+            return (*values == 0 || LookupBuffer(device, *values) != NULL) ?
+                   AL_NO_ERROR : AL_INVALID_VALUE;
+
+        case AL_SEC_OFFSET:
+        case AL_SAMPLE_OFFSET:
+        case AL_BYTE_OFFSET:
+            if(!(*values >= 0) || !CheckSourceOffset(Source, Context, prop, *values))
+                return AL_INVALID_VALUE;
+            return AL_NO_ERROR;
+
+        case AL_DIRECT_FILTER:
+            return (*values == 0 || LookupFilter(device, *values) != NULL) ?
+                   AL_NO_ERROR : AL_INVALID_VALUE;
+
+        case AL_SOURCE_RESAMPLER_SOFTX:
+            return (*values >= 0 && *values <= ResamplerMax) ? AL_NO_ERROR : AL_INVALID_VALUE;
+
+        case AL_DISTANCE_MODEL:
+            return (*values == AL_NONE ||
+                    *values == AL_INVERSE_DISTANCE ||
+                    *values == AL_INVERSE_DISTANCE_CLAMPED ||
+                    *values == AL_LINEAR_DISTANCE ||
+                    *values == AL_LINEAR_DISTANCE_CLAMPED ||
+                    *values == AL_EXPONENT_DISTANCE ||
+                    *values == AL_EXPONENT_DISTANCE_CLAMPED) ? AL_NO_ERROR : AL_INVALID_VALUE;
+
+        case AL_AUXILIARY_SEND_FILTER:
+            /* The slot and filter are looked up, and checked, with the
+             * context locked when set. */
+            return AL_NO_ERROR;
+
+
+        /* 1x float */
+        case AL_CONE_INNER_ANGLE:
+        case AL_CONE_OUTER_ANGLE:
+        case AL_PITCH:
+        case AL_GAIN:
+        case AL_MIN_GAIN:
+        case AL_MAX_GAIN:
+        case AL_REFERENCE_DISTANCE:
+        case AL_ROLLOFF_FACTOR:
+        case AL_CONE_OUTER_GAIN:
+        case AL_MAX_DISTANCE:
+        case AL_DOPPLER_FACTOR:
+        case AL_CONE_OUTER_GAINHF:
+        case AL_AIR_ABSORPTION_FACTOR:
+        case AL_ROOM_ROLLOFF_FACTOR:
+        case AL_SOURCE_RADIUS:
+            fvals[0] = (ALfloat)*values;
+            return CheckSourcefv(Source, Context, (int)prop, fvals);
+
+        /* 3x float */
+        case AL_POSITION:
+        case AL_VELOCITY:
+        case AL_DIRECTION:
+            fvals[0] = (ALfloat)values[0];
+            fvals[1] = (ALfloat)values[1];
+            fvals[2] = (ALfloat)values[2];
+            return CheckSourcefv(Source, Context, (int)prop, fvals);
+
+        /* 6x float */
+        case AL_ORIENTATION:
+            fvals[0] = (ALfloat)values[0];
+            fvals[1] = (ALfloat)values[1];
+            fvals[2] = (ALfloat)values[2];
+            fvals[3] = (ALfloat)values[3];
+            fvals[4] = (ALfloat)values[4];
+            fvals[5] = (ALfloat)values[5];
+            return CheckSourcefv(Source, Context, (int)prop, fvals);
+
+        case AL_SAMPLE_OFFSET_LATENCY_SOFT:
+        case AL_SEC_OFFSET_LATENCY_SOFT:
+        case AL_STEREO_ANGLES:
+            break;
+    }
+
+    ERR("Unexpected property: 0x%04x\n", prop);
+    return AL_INVALID_ENUM;
+}
+
+/* Sets a property with values that passed CheckSourceiv. */
+static ALboolean ApplySourceiv(ALsource *Source, ALCcontext *Context, SourceProp prop, const ALint *values)
+{
+    ALCdevice *device = Context->Device;
+    ALbuffer  *buffer = NULL;
+    ALfilter  *filter = NULL;
+    ALeffectslot *slot = NULL;
+    ALbufferlistitem *oldlist;
+    ALbufferlistitem *newlist;
+    ALfloat fvals[6];
 
+    switch(prop)
+    {
+        case AL_SOURCE_RELATIVE:
             Source->HeadRelative = (ALboolean)*values;
             ATOMIC_STORE(&Source->NeedsUpdate, AL_TRUE);
             return AL_TRUE;
 
         case AL_LOOPING:
-            CHECKVAL(*values == AL_FALSE || *values == AL_TRUE);
-
             Source->Looping = (ALboolean)*values;
             return AL_TRUE;
 
@@ -644,9 +837,14 @@ static ALboolean SetSourceiv(ALsource *Source, ALCcontext *Context, SourceProp p
             if(buffer != NULL)
             {
                 /* Add the selected buffer to a one-item queue */
-                newlist = malloc(sizeof(ALbufferlistitem));
+                newlist = ObjectPoolAlloc(&Context->BufferListPool);
+                if(!newlist)
+                {
+                    WriteUnlock(&Source->queue_lock);
+                    SET_ERROR_AND_RETURN_VALUE(Context, AL_OUT_OF_MEMORY, AL_FALSE);
+                }
                 newlist->buffer = buffer;
-                newlist->next = NULL;
+                ATOMIC_INIT(&newlist->next, NULL);
                 IncrementRef(&buffer->ref);
 
                 /* Source is now Static */
@@ -655,6 +853,8 @@ static ALboolean SetSourceiv(ALsource *Source, ALCcontext *Context, SourceProp p
                 ReadLock(&buffer->lock);
                 Source->NumChannels = ChannelsFromFmt(buffer->FmtChannels);
                 Source->SampleSize  = BytesFromFmt(buffer->FmtType);
+                Source->Frequency   = buffer->Frequency;
+                Source->FmtChannels = buffer->FmtChannels;
                 ReadUnlock(&buffer->lock);
             }
             else
@@ -671,19 +871,17 @@ static ALboolean SetSourceiv(ALsource *Source, ALCcontext *Context, SourceProp p
             while(oldlist != NULL)
             {
                 ALbufferlistitem *temp = oldlist;
-                oldlist = temp->next;
+                oldlist = ATOMIC_LOAD(&temp->next);
 
                 if(temp->buffer)
                     DecrementRef(&temp->buffer->ref);
-                free(temp);
+                ObjectPoolFree(&Context->BufferListPool, temp);
             }
             return AL_TRUE;
 
         case AL_SEC_OFFSET:
         case AL_SAMPLE_OFFSET:
         case AL_BYTE_OFFSET:
-            CHECKVAL(*values >= 0);
-
             LockContext(Context);
             Source->OffsetType = prop;
             Source->Offset = *values;
@@ -728,42 +926,34 @@ static ALboolean SetSourceiv(ALsource *Source, ALCcontext *Context, SourceProp p
             return AL_TRUE;
 
         case AL_DIRECT_FILTER_GAINHF_AUTO:
-            CHECKVAL(*values == AL_FALSE || *values == AL_TRUE);
-
             Source->DryGainHFAuto = *values;
             ATOMIC_STORE(&Source->NeedsUpdate, AL_TRUE);
             return AL_TRUE;
 
         case AL_AUXILIARY_SEND_FILTER_GAIN_AUTO:
-            CHECKVAL(*values == AL_FALSE || *values == AL_TRUE);
-
             Source->WetGainAuto = *values;
             ATOMIC_STORE(&Source->NeedsUpdate, AL_TRUE);
             return AL_TRUE;
 
         case AL_AUXILIARY_SEND_FILTER_GAINHF_AUTO:
-            CHECKVAL(*values == AL_FALSE || *values == AL_TRUE);
-
             Source->WetGainHFAuto = *values;
             ATOMIC_STORE(&Source->NeedsUpdate, AL_TRUE);
             return AL_TRUE;
 
         case AL_DIRECT_CHANNELS_SOFT:
-            CHECKVAL(*values == AL_FALSE || *values == AL_TRUE);
-
             Source->DirectChannels = *values;
             ATOMIC_STORE(&Source->NeedsUpdate, AL_TRUE);
             return AL_TRUE;
 
-        case AL_DISTANCE_MODEL:
-            CHECKVAL(*values == AL_NONE ||
-                     *values == AL_INVERSE_DISTANCE ||
-                     *values == AL_INVERSE_DISTANCE_CLAMPED ||
-                     *values == AL_LINEAR_DISTANCE ||
-                     *values == AL_LINEAR_DISTANCE_CLAMPED ||
-                     *values == AL_EXPONENT_DISTANCE ||
-                     *values == AL_EXPONENT_DISTANCE_CLAMPED);
+        case AL_SOURCE_RESAMPLER_SOFTX:
+            Source->Resampler = *values;
+            LockContext(Context);
+            aluPreparePolyphaseBanks(Context->Device, Source);
+            UnlockContext(Context);
+            ATOMIC_STORE(&Source->NeedsUpdate, AL_TRUE);
+            return AL_TRUE;
 
+        case AL_DISTANCE_MODEL:
             Source->DistanceModel = *values;
             if(Context->SourceDistanceModel)
                 ATOMIC_STORE(&Source->NeedsUpdate, AL_TRUE);
@@ -824,7 +1014,7 @@ static ALboolean SetSourceiv(ALsource *Source, ALCcontext *Context, SourceProp p
         case AL_ROOM_ROLLOFF_FACTOR:
         case AL_SOURCE_RADIUS:
             fvals[0] = (ALfloat)*values;
-            return SetSourcefv(Source, Context, (int)prop, fvals);
+            return ApplySourcefv(Source, Context, (int)prop, fvals);
 
         /* 3x float */
         case AL_POSITION:
@@ -833,7 +1023,7 @@ static ALboolean SetSourceiv(ALsource *Source, ALCcontext *Context, SourceProp p
             fvals[0] = (ALfloat)values[0];
             fvals[1] = (ALfloat)values[1];
             fvals[2] = (ALfloat)values[2];
-            return SetSourcefv(Source, Context, (int)prop, fvals);
+            return ApplySourcefv(Source, Context, (int)prop, fvals);
 
         /* 6x float */
         case AL_ORIENTATION:
@@ -843,8 +1033,15 @@ static ALboolean SetSourceiv(ALsource *Source, ALCcontext *Context, SourceProp p
             fvals[3] = (ALfloat)values[3];
             fvals[4] = (ALfloat)values[4];
             fvals[5] = (ALfloat)values[5];
-            return SetSourcefv(Source, Context, (int)prop, fvals);
+            return ApplySourcefv(Source, Context, (int)prop, fvals);
 
+        case AL_SOURCE_STATE:
+        case AL_SOURCE_TYPE:
+        case AL_BUFFERS_QUEUED:
+        case AL_BUFFERS_PROCESSED:
+        case AL_BYTE_LENGTH_SOFT:
+        case AL_SAMPLE_LENGTH_SOFT:
+        case AL_SEC_LENGTH_SOFT:
         case AL_SAMPLE_OFFSET_LATENCY_SOFT:
         case AL_SEC_OFFSET_LATENCY_SOFT:
         case AL_STEREO_ANGLES:
@@ -855,6 +1052,15 @@ static ALboolean SetSourceiv(ALsource *Source, ALCcontext *Context, SourceProp p
     SET_ERROR_AND_RETURN_VALUE(Context, AL_INVALID_ENUM, AL_FALSE);
 }
 
+static ALboolean SetSourceiv(ALsource *Source, ALCcontext *Context, SourceProp prop, const ALint *values)
+{
+    ALenum err;
+
+    if((err=CheckSourceiv(Source, Context, prop, values)) != AL_NO_ERROR)
+        SET_ERROR_AND_RETURN_VALUE(Context, err, AL_FALSE);
+    return ApplySourceiv(Source, Context, prop, values);
+}
+
 static ALboolean SetSourcei64v(ALsource *Source, ALCcontext *Context, SourceProp prop, const ALint64SOFT *values)
 {
     ALfloat fvals[6];
@@ -884,6 +1090,7 @@ static ALboolean SetSourcei64v(ALsource *Source, ALCcontext *Context, SourceProp
         case AL_AUXILIARY_SEND_FILTER_GAIN_AUTO:
         case AL_AUXILIARY_SEND_FILTER_GAINHF_AUTO:
         case AL_DIRECT_CHANNELS_SOFT:
+        case AL_SOURCE_RESAMPLER_SOFTX:
         case AL_DISTANCE_MODEL:
             CHECKVAL(*values <= INT_MAX && *values >= INT_MIN);
 
@@ -1047,7 +1254,7 @@ static ALboolean GetSourcedv(ALsource *Source, ALCcontext *Context, SourceProp p
                         freq = buffer->Frequency;
                         length += buffer->SampleLen;
                     }
-                } while((BufferList=BufferList->next) != NULL);
+                } while((BufferList=ATOMIC_LOAD(&BufferList->next)) != NULL);
                 *values = (ALdouble)length / (ALdouble)freq;
             }
             ReadUnlock(&Source->queue_lock);
@@ -1067,7 +1274,7 @@ static ALboolean GetSourcedv(ALsource *Source, ALCcontext *Context, SourceProp p
         case AL_SEC_OFFSET_LATENCY_SOFT:
             LockContext(Context);
             values[0] = GetSourceSecOffset(Source);
-            values[1] = (ALdouble)(V0(device->Backend,getLatency)()) /
+            values[1] = (ALdouble)ALCdevice_GetLatency(device) /
                         1000000000.0;
             UnlockContext(Context);
             return AL_TRUE;
@@ -1118,6 +1325,7 @@ static ALboolean GetSourcedv(ALsource *Source, ALCcontext *Context, SourceProp p
         case AL_AUXILIARY_SEND_FILTER_GAIN_AUTO:
         case AL_AUXILIARY_SEND_FILTER_GAINHF_AUTO:
         case AL_DIRECT_CHANNELS_SOFT:
+        case AL_SOURCE_RESAMPLER_SOFTX:
         case AL_BYTE_LENGTH_SOFT:
         case AL_SAMPLE_LENGTH_SOFT:
         case AL_DISTANCE_MODEL:
@@ -1197,7 +1405,7 @@ static ALboolean GetSourceiv(ALsource *Source, ALCcontext *Context, SourceProp p
 
                         length += buffer->SampleLen / sample_align * byte_align;
                     }
-                } while((BufferList=BufferList->next) != NULL);
+                } while((BufferList=ATOMIC_LOAD(&BufferList->next)) != NULL);
                 *values = length;
             }
             ReadUnlock(&Source->queue_lock);
@@ -1213,7 +1421,7 @@ static ALboolean GetSourceiv(ALsource *Source, ALCcontext *Context, SourceProp p
                 do {
                     ALbuffer *buffer = BufferList->buffer;
                     if(buffer) length += buffer->SampleLen;
-                } while((BufferList=BufferList->next) != NULL);
+                } while((BufferList=ATOMIC_LOAD(&BufferList->next)) != NULL);
                 *values = length;
             }
             ReadUnlock(&Source->queue_lock);
@@ -1228,7 +1436,7 @@ static ALboolean GetSourceiv(ALsource *Source, ALCcontext *Context, SourceProp p
                 ALsizei count = 0;
                 do {
                     ++count;
-                } while((BufferList=BufferList->next) != NULL);
+                } while((BufferList=ATOMIC_LOAD(&BufferList->next)) != NULL);
                 *values = count;
             }
             ReadUnlock(&Source->queue_lock);
@@ -1250,7 +1458,7 @@ static ALboolean GetSourceiv(ALsource *Source, ALCcontext *Context, SourceProp p
                 while(BufferList && BufferList != Current)
                 {
                     played++;
-                    BufferList = BufferList->next;
+                    BufferList = ATOMIC_LOAD(&BufferList->next);
                 }
                 *values = played;
             }
@@ -1277,6 +1485,10 @@ static ALboolean GetSourceiv(ALsource *Source, ALCcontext *Context, SourceProp p
             *values = Source->DirectChannels;
             return AL_TRUE;
 
+        case AL_SOURCE_RESAMPLER_SOFTX:
+            *values = Source->Resampler;
+            return AL_TRUE;
+
         case AL_DISTANCE_MODEL:
             *values = Source->DistanceModel;
             return AL_TRUE;
@@ -1358,7 +1570,7 @@ static ALboolean GetSourcei64v(ALsource *Source, ALCcontext *Context, SourceProp
         case AL_SAMPLE_OFFSET_LATENCY_SOFT:
             LockContext(Context);
             values[0] = GetSourceSampleOffset(Source);
-            values[1] = V0(device->Backend,getLatency)();
+            values[1] = ALCdevice_GetLatency(device);
             UnlockContext(Context);
             return AL_TRUE;
 
@@ -1424,6 +1636,7 @@ static ALboolean GetSourcei64v(ALsource *Source, ALCcontext *Context, SourceProp
         case AL_AUXILIARY_SEND_FILTER_GAIN_AUTO:
         case AL_AUXILIARY_SEND_FILTER_GAINHF_AUTO:
         case AL_DIRECT_CHANNELS_SOFT:
+        case AL_SOURCE_RESAMPLER_SOFTX:
         case AL_DISTANCE_MODEL:
             if((err=GetSourceiv(Source, Context, prop, ivals)) != AL_FALSE)
                 *values = ivals[0];
@@ -1460,34 +1673,41 @@ static ALboolean GetSourcei64v(ALsource *Source, ALCcontext *Context, SourceProp
 AL_API ALvoid AL_APIENTRY alGenSources(ALsizei n, ALuint *sources)
 {
     ALCcontext *context;
-    ALsizei cur = 0;
-    ALenum err;
 
     context = GetContextRef();
     if(!context) return;
 
+    alGenSourcesDirect(context, n, sources);
+
+    ReleaseContextRef(context);
+}
+
+AL_API ALvoid AL_APIENTRY alGenSourcesDirect(ALCcontext *context, ALsizei n, ALuint *sources)
+{
+    ALsizei cur = 0;
+    ALenum err;
+
     if(!(n >= 0))
         SET_ERROR_AND_GOTO(context, AL_INVALID_VALUE, done);
     for(cur = 0;cur < n;cur++)
     {
-        ALsource *source = al_calloc(16, sizeof(ALsource));
+        ALsource *source = ObjectPoolAlloc(&context->SourcePool);
         if(!source)
         {
-            alDeleteSources(cur, sources);
+            alDeleteSourcesDirect(context, cur, sources);
             SET_ERROR_AND_GOTO(context, AL_OUT_OF_MEMORY, done);
         }
         InitSourceParams(source);
 
         err = NewThunkEntry(&source->id);
         if(err == AL_NO_ERROR)
-            err = InsertUIntMapEntry(&context->SourceMap, source->id, source);
+            err = InsertHandleMapEntry(&context->SourceMap, source->id, source);
         if(err != AL_NO_ERROR)
         {
             FreeThunkEntry(source->id);
-            memset(source, 0, sizeof(ALsource));
-            al_free(source);
+            ObjectPoolFree(&context->SourcePool, source);
 
-            alDeleteSources(cur, sources);
+            alDeleteSourcesDirect(context, cur, sources);
             SET_ERROR_AND_GOTO(context, err, done);
         }
 
@@ -1495,20 +1715,28 @@ AL_API ALvoid AL_APIENTRY alGenSources(ALsizei n, ALuint *sources)
     }
 
 done:
-    ALCcontext_DecRef(context);
+    return;
 }
 
 
 AL_API ALvoid AL_APIENTRY alDeleteSources(ALsizei n, const ALuint *sources)
 {
     ALCcontext *context;
-    ALbufferlistitem *BufferList;
-    ALsource *Source;
-    ALsizei i, j;
 
     context = GetContextRef();
     if(!context) return;
 
+    alDeleteSourcesDirect(context, n, sources);
+
+    ReleaseContextRef(context);
+}
+
+AL_API ALvoid AL_APIENTRY alDeleteSourcesDirect(ALCcontext *context, ALsizei n, const ALuint *sources)
+{
+    ALbufferlistitem *BufferList;
+    ALsource *Source;
+    ALsizei i, j;
+
     if(!(n >= 0))
         SET_ERROR_AND_GOTO(context, AL_INVALID_VALUE, done);
 
@@ -1541,10 +1769,10 @@ AL_API ALvoid AL_APIENTRY alDeleteSources(ALsizei n, const ALuint *sources)
         BufferList = ATOMIC_EXCHANGE(ALbufferlistitem*, &Source->queue, NULL);
         while(BufferList != NULL)
         {
-            ALbufferlistitem *next = BufferList->next;
+            ALbufferlistitem *next = ATOMIC_LOAD(&BufferList->next);
             if(BufferList->buffer != NULL)
                 DecrementRef(&BufferList->buffer->ref);
-            free(BufferList);
+            ObjectPoolFree(&context->BufferListPool, BufferList);
             BufferList = next;
         }
 
@@ -1555,12 +1783,11 @@ AL_API ALvoid AL_APIENTRY alDeleteSources(ALsizei n, const ALuint *sources)
             Source->Send[j].Slot = NULL;
         }
 
-        memset(Source, 0, sizeof(*Source));
-        al_free(Source);
+        ObjectPoolFree(&context->SourcePool, Source);
     }
 
 done:
-    ALCcontext_DecRef(context);
+    return;
 }
 
 
@@ -1572,9 +1799,17 @@ AL_API ALboolean AL_APIENTRY alIsSource(ALuint source)
     context = GetContextRef();
     if(!context) return AL_FALSE;
 
-    ret = (LookupSource(context, source) ? AL_TRUE : AL_FALSE);
-
-    ALCcontext_DecRef(context);
+    ret = alIsSourceDirect(context, source);
+
+    ReleaseContextRef(context);
+    return ret;
+}
+
+AL_API ALboolean AL_APIENTRY alIsSourceDirect(ALCcontext *context, ALuint source)
+{
+    ALboolean ret;
+
+    ret = (LookupSource(context, source) ? AL_TRUE : AL_FALSE);
 
     return ret;
 }
@@ -1583,29 +1818,43 @@ AL_API ALboolean AL_APIENTRY alIsSource(ALuint source)
 AL_API ALvoid AL_APIENTRY alSourcef(ALuint source, ALenum param, ALfloat value)
 {
     ALCcontext *Context;
-    ALsource   *Source;
 
     Context = GetContextRef();
     if(!Context) return;
 
+    alSourcefDirect(Context, source, param, value);
+
+    ReleaseContextRef(Context);
+}
+
+AL_API ALvoid AL_APIENTRY alSourcefDirect(ALCcontext *Context, ALuint source, ALenum param, ALfloat value)
+{
+    ALsource   *Source;
+
     if((Source=LookupSource(Context, source)) == NULL)
         alSetError(Context, AL_INVALID_NAME);
     else if(!(FloatValsByProp(param) == 1))
         alSetError(Context, AL_INVALID_ENUM);
     else
         SetSourcefv(Source, Context, param, &value);
-
-    ALCcontext_DecRef(Context);
 }
 
 AL_API ALvoid AL_APIENTRY alSource3f(ALuint source, ALenum param, ALfloat value1, ALfloat value2, ALfloat value3)
 {
     ALCcontext *Context;
-    ALsource   *Source;
 
     Context = GetContextRef();
     if(!Context) return;
 
+    alSource3fDirect(Context, source, param, value1, value2, value3);
+
+    ReleaseContextRef(Context);
+}
+
+AL_API ALvoid AL_APIENTRY alSource3fDirect(ALCcontext *Context, ALuint source, ALenum param, ALfloat value1, ALfloat value2, ALfloat value3)
+{
+    ALsource   *Source;
+
     if((Source=LookupSource(Context, source)) == NULL)
         alSetError(Context, AL_INVALID_NAME);
     else if(!(FloatValsByProp(param) == 3))
@@ -1615,18 +1864,24 @@ AL_API ALvoid AL_APIENTRY alSource3f(ALuint source, ALenum param, ALfloat value1
         ALfloat fvals[3] = { value1, value2, value3 };
         SetSourcefv(Source, Context, param, fvals);
     }
-
-    ALCcontext_DecRef(Context);
 }
 
 AL_API ALvoid AL_APIENTRY alSourcefv(ALuint source, ALenum param, const ALfloat *values)
 {
     ALCcontext *Context;
-    ALsource   *Source;
 
     Context = GetContextRef();
     if(!Context) return;
 
+    alSourcefvDirect(Context, source, param, values);
+
+    ReleaseContextRef(Context);
+}
+
+AL_API ALvoid AL_APIENTRY alSourcefvDirect(ALCcontext *Context, ALuint source, ALenum param, const ALfloat *values)
+{
+    ALsource   *Source;
+
     if((Source=LookupSource(Context, source)) == NULL)
         alSetError(Context, AL_INVALID_NAME);
     else if(!values)
@@ -1635,19 +1890,94 @@ AL_API ALvoid AL_APIENTRY alSourcefv(ALuint source, ALenum param, const ALfloat
         alSetError(Context, AL_INVALID_ENUM);
     else
         SetSourcefv(Source, Context, param, values);
+}
+
+
+AL_API void AL_APIENTRY alSourceBatchfvSOFT(ALsizei count, const ALuint *sources, const ALenum *params, const ALfloat *values)
+{
+    ALCcontext *context;
+
+    context = GetContextRef();
+    if(!context) return;
+
+    alSourceBatchfvDirectSOFT(context, count, sources, params, values);
 
-    ALCcontext_DecRef(Context);
+    ReleaseContextRef(context);
+}
+
+/* Sets 'count' source properties, where each source ID in 'sources' is paired
+ * with the property in 'params'. The values for each property are packed one
+ * after another in 'values', with each property taking as many values as it
+ * would with alSourcefv. Source IDs, properties, and values are all checked
+ * before any are set, so an error leaves every source unchanged. Each change
+ * flags its source for an update as it's set, and the context is flagged once
+ * at the end, so the next update recalculates every source in the batch.
+ */
+AL_API void AL_APIENTRY alSourceBatchfvDirectSOFT(ALCcontext *context, ALsizei count, const ALuint *sources, const ALenum *params, const ALfloat *values)
+{
+    ALsource *stacksources[64];
+    ALsource **batch = stacksources;
+    const ALfloat *vals;
+    ALenum err;
+    ALsizei i;
+
+    if(!(count >= 0))
+        SET_ERROR_AND_GOTO(context, AL_INVALID_VALUE, done);
+    if(count == 0)
+        goto done;
+    if(!sources || !params || !values)
+        SET_ERROR_AND_GOTO(context, AL_INVALID_VALUE, done);
+
+    if((size_t)count > COUNTOF(stacksources))
+    {
+        batch = al_malloc(16, count * sizeof(batch[0]));
+        if(!batch)
+            SET_ERROR_AND_GOTO(context, AL_OUT_OF_MEMORY, done);
+    }
+
+    /* Look up each source once, and check everything before setting any. */
+    vals = values;
+    for(i = 0;i < count;i++)
+    {
+        if((batch[i]=LookupSource(context, sources[i])) == NULL)
+            SET_ERROR_AND_GOTO(context, AL_INVALID_NAME, done);
+        if(!(FloatValsByProp(params[i]) > 0))
+            SET_ERROR_AND_GOTO(context, AL_INVALID_ENUM, done);
+        if((err=CheckSourcefv(batch[i], context, params[i], vals)) != AL_NO_ERROR)
+            SET_ERROR_AND_GOTO(context, err, done);
+        vals += FloatValsByProp(params[i]);
+    }
+
+    for(i = 0;i < count;i++)
+    {
+        if(!ApplySourcefv(batch[i], context, params[i], values))
+            break;
+        values += FloatValsByProp(params[i]);
+    }
+    ATOMIC_STORE(&context->UpdateSources, AL_TRUE);
+
+done:
+    if(batch != stacksources)
+        al_free(batch);
 }
 
 
 AL_API ALvoid AL_APIENTRY alSourcedSOFT(ALuint source, ALenum param, ALdouble value)
 {
     ALCcontext *Context;
-    ALsource   *Source;
 
     Context = GetContextRef();
     if(!Context) return;
 
+    alSourcedDirectSOFT(Context, source, param, value);
+
+    ReleaseContextRef(Context);
+}
+
+AL_API ALvoid AL_APIENTRY alSourcedDirectSOFT(ALCcontext *Context, ALuint source, ALenum param, ALdouble value)
+{
+    ALsource   *Source;
+
     if((Source=LookupSource(Context, source)) == NULL)
         alSetError(Context, AL_INVALID_NAME);
     else if(!(DoubleValsByProp(param) == 1))
@@ -1657,18 +1987,24 @@ AL_API ALvoid AL_APIENTRY alSourcedSOFT(ALuint source, ALenum param, ALdouble va
         ALfloat fval = (ALfloat)value;
         SetSourcefv(Source, Context, param, &fval);
     }
-
-    ALCcontext_DecRef(Context);
 }
 
 AL_API ALvoid AL_APIENTRY alSource3dSOFT(ALuint source, ALenum param, ALdouble value1, ALdouble value2, ALdouble value3)
 {
     ALCcontext *Context;
-    ALsource   *Source;
 
     Context = GetContextRef();
     if(!Context) return;
 
+    alSource3dDirectSOFT(Context, source, param, value1, value2, value3);
+
+    ReleaseContextRef(Context);
+}
+
+AL_API ALvoid AL_APIENTRY alSource3dDirectSOFT(ALCcontext *Context, ALuint source, ALenum param, ALdouble value1, ALdouble value2, ALdouble value3)
+{
+    ALsource   *Source;
+
     if((Source=LookupSource(Context, source)) == NULL)
         alSetError(Context, AL_INVALID_NAME);
     else if(!(DoubleValsByProp(param) == 3))
@@ -1678,19 +2014,25 @@ AL_API ALvoid AL_APIENTRY alSource3dSOFT(ALuint source, ALenum param, ALdouble v
         ALfloat fvals[3] = { (ALfloat)value1, (ALfloat)value2, (ALfloat)value3 };
         SetSourcefv(Source, Context, param, fvals);
     }
-
-    ALCcontext_DecRef(Context);
 }
 
 AL_API ALvoid AL_APIENTRY alSourcedvSOFT(ALuint source, ALenum param, const ALdouble *values)
 {
     ALCcontext *Context;
-    ALsource   *Source;
-    ALint      count;
 
     Context = GetContextRef();
     if(!Context) return;
 
+    alSourcedvDirectSOFT(Context, source, param, values);
+
+    ReleaseContextRef(Context);
+}
+
+AL_API ALvoid AL_APIENTRY alSourcedvDirectSOFT(ALCcontext *Context, ALuint source, ALenum param, const ALdouble *values)
+{
+    ALsource   *Source;
+    ALint      count;
+
     if((Source=LookupSource(Context, source)) == NULL)
         alSetError(Context, AL_INVALID_NAME);
     else if(!values)
@@ -1706,37 +2048,49 @@ AL_API ALvoid AL_APIENTRY alSourcedvSOFT(ALuint source, ALenum param, const ALdo
             fvals[i] = (ALfloat)values[i];
         SetSourcefv(Source, Context, param, fvals);
     }
-
-    ALCcontext_DecRef(Context);
 }
 
 
 AL_API ALvoid AL_APIENTRY alSourcei(ALuint source, ALenum param, ALint value)
 {
     ALCcontext *Context;
-    ALsource   *Source;
 
     Context = GetContextRef();
     if(!Context) return;
 
+    alSourceiDirect(Context, source, param, value);
+
+    ReleaseContextRef(Context);
+}
+
+AL_API ALvoid AL_APIENTRY alSourceiDirect(ALCcontext *Context, ALuint source, ALenum param, ALint value)
+{
+    ALsource   *Source;
+
     if((Source=LookupSource(Context, source)) == NULL)
         alSetError(Context, AL_INVALID_NAME);
     else if(!(IntValsByProp(param) == 1))
         alSetError(Context, AL_INVALID_ENUM);
     else
         SetSourceiv(Source, Context, param, &value);
-
-    ALCcontext_DecRef(Context);
 }
 
 AL_API void AL_APIENTRY alSource3i(ALuint source, ALenum param, ALint value1, ALint value2, ALint value3)
 {
     ALCcontext *Context;
-    ALsource   *Source;
 
     Context = GetContextRef();
     if(!Context) return;
 
+    alSource3iDirect(Context, source, param, value1, value2, value3);
+
+    ReleaseContextRef(Context);
+}
+
+AL_API void AL_APIENTRY alSource3iDirect(ALCcontext *Context, ALuint source, ALenum param, ALint value1, ALint value2, ALint value3)
+{
+    ALsource   *Source;
+
     if((Source=LookupSource(Context, source)) == NULL)
         alSetError(Context, AL_INVALID_NAME);
     else if(!(IntValsByProp(param) == 3))
@@ -1746,18 +2100,24 @@ AL_API void AL_APIENTRY alSource3i(ALuint source, ALenum param, ALint value1, AL
         ALint ivals[3] = { value1, value2, value3 };
         SetSourceiv(Source, Context, param, ivals);
     }
-
-    ALCcontext_DecRef(Context);
 }
 
 AL_API void AL_APIENTRY alSourceiv(ALuint source, ALenum param, const ALint *values)
 {
     ALCcontext *Context;
-    ALsource   *Source;
 
     Context = GetContextRef();
     if(!Context) return;
 
+    alSourceivDirect(Context, source, param, values);
+
+    ReleaseContextRef(Context);
+}
+
+AL_API void AL_APIENTRY alSourceivDirect(ALCcontext *Context, ALuint source, ALenum param, const ALint *values)
+{
+    ALsource   *Source;
+
     if((Source=LookupSource(Context, source)) == NULL)
         alSetError(Context, AL_INVALID_NAME);
     else if(!values)
@@ -1766,37 +2126,49 @@ AL_API void AL_APIENTRY alSourceiv(ALuint source, ALenum param, const ALint *val
         alSetError(Context, AL_INVALID_ENUM);
     else
         SetSourceiv(Source, Context, param, values);
-
-    ALCcontext_DecRef(Context);
 }
 
 
 AL_API ALvoid AL_APIENTRY alSourcei64SOFT(ALuint source, ALenum param, ALint64SOFT value)
 {
     ALCcontext *Context;
-    ALsource   *Source;
 
     Context = GetContextRef();
     if(!Context) return;
 
+    alSourcei64DirectSOFT(Context, source, param, value);
+
+    ReleaseContextRef(Context);
+}
+
+AL_API ALvoid AL_APIENTRY alSourcei64DirectSOFT(ALCcontext *Context, ALuint source, ALenum param, ALint64SOFT value)
+{
+    ALsource   *Source;
+
     if((Source=LookupSource(Context, source)) == NULL)
         alSetError(Context, AL_INVALID_NAME);
     else if(!(Int64ValsByProp(param) == 1))
         alSetError(Context, AL_INVALID_ENUM);
     else
         SetSourcei64v(Source, Context, param, &value);
-
-    ALCcontext_DecRef(Context);
 }
 
 AL_API void AL_APIENTRY alSource3i64SOFT(ALuint source, ALenum param, ALint64SOFT value1, ALint64SOFT value2, ALint64SOFT value3)
 {
     ALCcontext *Context;
-    ALsource   *Source;
 
     Context = GetContextRef();
     if(!Context) return;
 
+    alSource3i64DirectSOFT(Context, source, param, value1, value2, value3);
+
+    ReleaseContextRef(Context);
+}
+
+AL_API void AL_APIENTRY alSource3i64DirectSOFT(ALCcontext *Context, ALuint source, ALenum param, ALint64SOFT value1, ALint64SOFT value2, ALint64SOFT value3)
+{
+    ALsource   *Source;
+
     if((Source=LookupSource(Context, source)) == NULL)
         alSetError(Context, AL_INVALID_NAME);
     else if(!(Int64ValsByProp(param) == 3))
@@ -1806,18 +2178,24 @@ AL_API void AL_APIENTRY alSource3i64SOFT(ALuint source, ALenum param, ALint64SOF
         ALint64SOFT i64vals[3] = { value1, value2, value3 };
         SetSourcei64v(Source, Context, param, i64vals);
     }
-
-    ALCcontext_DecRef(Context);
 }
 
 AL_API void AL_APIENTRY alSourcei64vSOFT(ALuint source, ALenum param, const ALint64SOFT *values)
 {
     ALCcontext *Context;
-    ALsource   *Source;
 
     Context = GetContextRef();
     if(!Context) return;
 
+    alSourcei64vDirectSOFT(Context, source, param, values);
+
+    ReleaseContextRef(Context);
+}
+
+AL_API void AL_APIENTRY alSourcei64vDirectSOFT(ALCcontext *Context, ALuint source, ALenum param, const ALint64SOFT *values)
+{
+    ALsource   *Source;
+
     if((Source=LookupSource(Context, source)) == NULL)
         alSetError(Context, AL_INVALID_NAME);
     else if(!values)
@@ -1826,19 +2204,25 @@ AL_API void AL_APIENTRY alSourcei64vSOFT(ALuint source, ALenum param, const ALin
         alSetError(Context, AL_INVALID_ENUM);
     else
         SetSourcei64v(Source, Context, param, values);
-
-    ALCcontext_DecRef(Context);
 }
 
 
 AL_API ALvoid AL_APIENTRY alGetSourcef(ALuint source, ALenum param, ALfloat *value)
 {
     ALCcontext *Context;
-    ALsource   *Source;
 
     Context = GetContextRef();
     if(!Context) return;
 
+    alGetSourcefDirect(Context, source, param, value);
+
+    ReleaseContextRef(Context);
+}
+
+AL_API ALvoid AL_APIENTRY alGetSourcefDirect(ALCcontext *Context, ALuint source, ALenum param, ALfloat *value)
+{
+    ALsource   *Source;
+
     if((Source=LookupSource(Context, source)) == NULL)
         alSetError(Context, AL_INVALID_NAME);
     else if(!value)
@@ -1851,19 +2235,25 @@ AL_API ALvoid AL_APIENTRY alGetSourcef(ALuint source, ALenum param, ALfloat *val
         if(GetSourcedv(Source, Context, param, &dval))
             *value = (ALfloat)dval;
     }
-
-    ALCcontext_DecRef(Context);
 }
 
 
 AL_API ALvoid AL_APIENTRY alGetSource3f(ALuint source, ALenum param, ALfloat *value1, ALfloat *value2, ALfloat *value3)
 {
     ALCcontext *Context;
-    ALsource   *Source;
 
     Context = GetContextRef();
     if(!Context) return;
 
+    alGetSource3fDirect(Context, source, param, value1, value2, value3);
+
+    ReleaseContextRef(Context);
+}
+
+AL_API ALvoid AL_APIENTRY alGetSource3fDirect(ALCcontext *Context, ALuint source, ALenum param, ALfloat *value1, ALfloat *value2, ALfloat *value3)
+{
+    ALsource   *Source;
+
     if((Source=LookupSource(Context, source)) == NULL)
         alSetError(Context, AL_INVALID_NAME);
     else if(!(value1 && value2 && value3))
@@ -1880,20 +2270,26 @@ AL_API ALvoid AL_APIENTRY alGetSource3f(ALuint source, ALenum param, ALfloat *va
             *value3 = (ALfloat)dvals[2];
         }
     }
-
-    ALCcontext_DecRef(Context);
 }
 
 
 AL_API ALvoid AL_APIENTRY alGetSourcefv(ALuint source, ALenum param, ALfloat *values)
 {
     ALCcontext *Context;
-    ALsource   *Source;
-    ALint      count;
 
     Context = GetContextRef();
     if(!Context) return;
 
+    alGetSourcefvDirect(Context, source, param, values);
+
+    ReleaseContextRef(Context);
+}
+
+AL_API ALvoid AL_APIENTRY alGetSourcefvDirect(ALCcontext *Context, ALuint source, ALenum param, ALfloat *values)
+{
+    ALsource   *Source;
+    ALint      count;
+
     if((Source=LookupSource(Context, source)) == NULL)
         alSetError(Context, AL_INVALID_NAME);
     else if(!values)
@@ -1910,19 +2306,25 @@ AL_API ALvoid AL_APIENTRY alGetSourcefv(ALuint source, ALenum param, ALfloat *va
                 values[i] = (ALfloat)dvals[i];
         }
     }
-
-    ALCcontext_DecRef(Context);
 }
 
 
 AL_API void AL_APIENTRY alGetSourcedSOFT(ALuint source, ALenum param, ALdouble *value)
 {
     ALCcontext *Context;
-    ALsource   *Source;
 
     Context = GetContextRef();
     if(!Context) return;
 
+    alGetSourcedDirectSOFT(Context, source, param, value);
+
+    ReleaseContextRef(Context);
+}
+
+AL_API void AL_APIENTRY alGetSourcedDirectSOFT(ALCcontext *Context, ALuint source, ALenum param, ALdouble *value)
+{
+    ALsource   *Source;
+
     if((Source=LookupSource(Context, source)) == NULL)
         alSetError(Context, AL_INVALID_NAME);
     else if(!value)
@@ -1931,18 +2333,24 @@ AL_API void AL_APIENTRY alGetSourcedSOFT(ALuint source, ALenum param, ALdouble *
         alSetError(Context, AL_INVALID_ENUM);
     else
         GetSourcedv(Source, Context, param, value);
-
-    ALCcontext_DecRef(Context);
 }
 
 AL_API void AL_APIENTRY alGetSource3dSOFT(ALuint source, ALenum param, ALdouble *value1, ALdouble *value2, ALdouble *value3)
 {
     ALCcontext *Context;
-    ALsource   *Source;
 
     Context = GetContextRef();
     if(!Context) return;
 
+    alGetSource3dDirectSOFT(Context, source, param, value1, value2, value3);
+
+    ReleaseContextRef(Context);
+}
+
+AL_API void AL_APIENTRY alGetSource3dDirectSOFT(ALCcontext *Context, ALuint source, ALenum param, ALdouble *value1, ALdouble *value2, ALdouble *value3)
+{
+    ALsource   *Source;
+
     if((Source=LookupSource(Context, source)) == NULL)
         alSetError(Context, AL_INVALID_NAME);
     else if(!(value1 && value2 && value3))
@@ -1959,18 +2367,24 @@ AL_API void AL_APIENTRY alGetSource3dSOFT(ALuint source, ALenum param, ALdouble
             *value3 = dvals[2];
         }
     }
-
-    ALCcontext_DecRef(Context);
 }
 
 AL_API void AL_APIENTRY alGetSourcedvSOFT(ALuint source, ALenum param, ALdouble *values)
 {
     ALCcontext *Context;
-    ALsource   *Source;
 
     Context = GetContextRef();
     if(!Context) return;
 
+    alGetSourcedvDirectSOFT(Context, source, param, values);
+
+    ReleaseContextRef(Context);
+}
+
+AL_API void AL_APIENTRY alGetSourcedvDirectSOFT(ALCcontext *Context, ALuint source, ALenum param, ALdouble *values)
+{
+    ALsource   *Source;
+
     if((Source=LookupSource(Context, source)) == NULL)
         alSetError(Context, AL_INVALID_NAME);
     else if(!values)
@@ -1979,19 +2393,25 @@ AL_API void AL_APIENTRY alGetSourcedvSOFT(ALuint source, ALenum param, ALdouble
         alSetError(Context, AL_INVALID_ENUM);
     else
         GetSourcedv(Source, Context, param, values);
-
-    ALCcontext_DecRef(Context);
 }
 
 
 AL_API ALvoid AL_APIENTRY alGetSourcei(ALuint source, ALenum param, ALint *value)
 {
     ALCcontext *Context;
-    ALsource   *Source;
 
     Context = GetContextRef();
     if(!Context) return;
 
+    alGetSourceiDirect(Context, source, param, value);
+
+    ReleaseContextRef(Context);
+}
+
+AL_API ALvoid AL_APIENTRY alGetSourceiDirect(ALCcontext *Context, ALuint source, ALenum param, ALint *value)
+{
+    ALsource   *Source;
+
     if((Source=LookupSource(Context, source)) == NULL)
         alSetError(Context, AL_INVALID_NAME);
     else if(!value)
@@ -2000,19 +2420,25 @@ AL_API ALvoid AL_APIENTRY alGetSourcei(ALuint source, ALenum param, ALint *value
         alSetError(Context, AL_INVALID_ENUM);
     else
         GetSourceiv(Source, Context, param, value);
-
-    ALCcontext_DecRef(Context);
 }
 
 
 AL_API void AL_APIENTRY alGetSource3i(ALuint source, ALenum param, ALint *value1, ALint *value2, ALint *value3)
 {
     ALCcontext *Context;
-    ALsource   *Source;
 
     Context = GetContextRef();
     if(!Context) return;
 
+    alGetSource3iDirect(Context, source, param, value1, value2, value3);
+
+    ReleaseContextRef(Context);
+}
+
+AL_API void AL_APIENTRY alGetSource3iDirect(ALCcontext *Context, ALuint source, ALenum param, ALint *value1, ALint *value2, ALint *value3)
+{
+    ALsource   *Source;
+
     if((Source=LookupSource(Context, source)) == NULL)
         alSetError(Context, AL_INVALID_NAME);
     else if(!(value1 && value2 && value3))
@@ -2029,19 +2455,25 @@ AL_API void AL_APIENTRY alGetSource3i(ALuint source, ALenum param, ALint *value1
             *value3 = ivals[2];
         }
     }
-
-    ALCcontext_DecRef(Context);
 }
 
 
 AL_API void AL_APIENTRY alGetSourceiv(ALuint source, ALenum param, ALint *values)
 {
     ALCcontext *Context;
-    ALsource   *Source;
 
     Context = GetContextRef();
     if(!Context) return;
 
+    alGetSourceivDirect(Context, source, param, values);
+
+    ReleaseContextRef(Context);
+}
+
+AL_API void AL_APIENTRY alGetSourceivDirect(ALCcontext *Context, ALuint source, ALenum param, ALint *values)
+{
+    ALsource   *Source;
+
     if((Source=LookupSource(Context, source)) == NULL)
         alSetError(Context, AL_INVALID_NAME);
     else if(!values)
@@ -2050,19 +2482,25 @@ AL_API void AL_APIENTRY alGetSourceiv(ALuint source, ALenum param, ALint *values
         alSetError(Context, AL_INVALID_ENUM);
     else
         GetSourceiv(Source, Context, param, values);
-
-    ALCcontext_DecRef(Context);
 }
 
 
 AL_API void AL_APIENTRY alGetSourcei64SOFT(ALuint source, ALenum param, ALint64SOFT *value)
 {
     ALCcontext *Context;
-    ALsource   *Source;
 
     Context = GetContextRef();
     if(!Context) return;
 
+    alGetSourcei64DirectSOFT(Context, source, param, value);
+
+    ReleaseContextRef(Context);
+}
+
+AL_API void AL_APIENTRY alGetSourcei64DirectSOFT(ALCcontext *Context, ALuint source, ALenum param, ALint64SOFT *value)
+{
+    ALsource   *Source;
+
     if((Source=LookupSource(Context, source)) == NULL)
         alSetError(Context, AL_INVALID_NAME);
     else if(!value)
@@ -2071,18 +2509,24 @@ AL_API void AL_APIENTRY alGetSourcei64SOFT(ALuint source, ALenum param, ALint64S
         alSetError(Context, AL_INVALID_ENUM);
     else
         GetSourcei64v(Source, Context, param, value);
-
-    ALCcontext_DecRef(Context);
 }
 
 AL_API void AL_APIENTRY alGetSource3i64SOFT(ALuint source, ALenum param, ALint64SOFT *value1, ALint64SOFT *value2, ALint64SOFT *value3)
 {
     ALCcontext *Context;
-    ALsource   *Source;
 
     Context = GetContextRef();
     if(!Context) return;
 
+    alGetSource3i64DirectSOFT(Context, source, param, value1, value2, value3);
+
+    ReleaseContextRef(Context);
+}
+
+AL_API void AL_APIENTRY alGetSource3i64DirectSOFT(ALCcontext *Context, ALuint source, ALenum param, ALint64SOFT *value1, ALint64SOFT *value2, ALint64SOFT *value3)
+{
+    ALsource   *Source;
+
     if((Source=LookupSource(Context, source)) == NULL)
         alSetError(Context, AL_INVALID_NAME);
     else if(!(value1 && value2 && value3))
@@ -2099,18 +2543,24 @@ AL_API void AL_APIENTRY alGetSource3i64SOFT(ALuint source, ALenum param, ALint64
             *value3 = i64vals[2];
         }
     }
-
-    ALCcontext_DecRef(Context);
 }
 
 AL_API void AL_APIENTRY alGetSourcei64vSOFT(ALuint source, ALenum param, ALint64SOFT *values)
 {
     ALCcontext *Context;
-    ALsource   *Source;
 
     Context = GetContextRef();
     if(!Context) return;
 
+    alGetSourcei64vDirectSOFT(Context, source, param, values);
+
+    ReleaseContextRef(Context);
+}
+
+AL_API void AL_APIENTRY alGetSourcei64vDirectSOFT(ALCcontext *Context, ALuint source, ALenum param, ALint64SOFT *values)
+{
+    ALsource   *Source;
+
     if((Source=LookupSource(Context, source)) == NULL)
         alSetError(Context, AL_INVALID_NAME);
     else if(!values)
@@ -2119,8 +2569,6 @@ AL_API void AL_APIENTRY alGetSourcei64vSOFT(ALuint source, ALenum param, ALint64
         alSetError(Context, AL_INVALID_ENUM);
     else
         GetSourcei64v(Source, Context, param, values);
-
-    ALCcontext_DecRef(Context);
 }
 
 
@@ -2128,15 +2576,27 @@ AL_API ALvoid AL_APIENTRY alSourcePlay(ALuint source)
 {
     alSourcePlayv(1, &source);
 }
+AL_API ALvoid AL_APIENTRY alSourcePlayDirect(ALCcontext *context, ALuint source)
+{
+    alSourcePlayvDirect(context, 1, &source);
+}
 AL_API ALvoid AL_APIENTRY alSourcePlayv(ALsizei n, const ALuint *sources)
 {
     ALCcontext *context;
-    ALsource *source;
-    ALsizei i;
 
     context = GetContextRef();
     if(!context) return;
 
+    alSourcePlayvDirect(context, n, sources);
+
+    ReleaseContextRef(context);
+}
+
+AL_API ALvoid AL_APIENTRY alSourcePlayvDirect(ALCcontext *context, ALsizei n, const ALuint *sources)
+{
+    ALsource *source;
+    ALsizei i;
+
     if(!(n >= 0))
         SET_ERROR_AND_GOTO(context, AL_INVALID_VALUE, done);
     for(i = 0;i < n;i++)
@@ -2174,22 +2634,34 @@ AL_API ALvoid AL_APIENTRY alSourcePlayv(ALsizei n, const ALuint *sources)
     UnlockContext(context);
 
 done:
-    ALCcontext_DecRef(context);
+    return;
 }
 
 AL_API ALvoid AL_APIENTRY alSourcePause(ALuint source)
 {
     alSourcePausev(1, &source);
 }
+AL_API ALvoid AL_APIENTRY alSourcePauseDirect(ALCcontext *context, ALuint source)
+{
+    alSourcePausevDirect(context, 1, &source);
+}
 AL_API ALvoid AL_APIENTRY alSourcePausev(ALsizei n, const ALuint *sources)
 {
     ALCcontext *context;
-    ALsource *source;
-    ALsizei i;
 
     context = GetContextRef();
     if(!context) return;
 
+    alSourcePausevDirect(context, n, sources);
+
+    ReleaseContextRef(context);
+}
+
+AL_API ALvoid AL_APIENTRY alSourcePausevDirect(ALCcontext *context, ALsizei n, const ALuint *sources)
+{
+    ALsource *source;
+    ALsizei i;
+
     if(!(n >= 0))
         SET_ERROR_AND_GOTO(context, AL_INVALID_VALUE, done);
     for(i = 0;i < n;i++)
@@ -2208,22 +2680,34 @@ AL_API ALvoid AL_APIENTRY alSourcePausev(ALsizei n, const ALuint *sources)
     UnlockContext(context);
 
 done:
-    ALCcontext_DecRef(context);
+    return;
 }
 
 AL_API ALvoid AL_APIENTRY alSourceStop(ALuint source)
 {
     alSourceStopv(1, &source);
 }
+AL_API ALvoid AL_APIENTRY alSourceStopDirect(ALCcontext *context, ALuint source)
+{
+    alSourceStopvDirect(context, 1, &source);
+}
 AL_API ALvoid AL_APIENTRY alSourceStopv(ALsizei n, const ALuint *sources)
 {
     ALCcontext *context;
-    ALsource *source;
-    ALsizei i;
 
     context = GetContextRef();
     if(!context) return;
 
+    alSourceStopvDirect(context, n, sources);
+
+    ReleaseContextRef(context);
+}
+
+AL_API ALvoid AL_APIENTRY alSourceStopvDirect(ALCcontext *context, ALsizei n, const ALuint *sources)
+{
+    ALsource *source;
+    ALsizei i;
+
     if(!(n >= 0))
         SET_ERROR_AND_GOTO(context, AL_INVALID_VALUE, done);
     for(i = 0;i < n;i++)
@@ -2242,22 +2726,34 @@ AL_API ALvoid AL_APIENTRY alSourceStopv(ALsizei n, const ALuint *sources)
     UnlockContext(context);
 
 done:
-    ALCcontext_DecRef(context);
+    return;
 }
 
 AL_API ALvoid AL_APIENTRY alSourceRewind(ALuint source)
 {
     alSourceRewindv(1, &source);
 }
+AL_API ALvoid AL_APIENTRY alSourceRewindDirect(ALCcontext *context, ALuint source)
+{
+    alSourceRewindvDirect(context, 1, &source);
+}
 AL_API ALvoid AL_APIENTRY alSourceRewindv(ALsizei n, const ALuint *sources)
 {
     ALCcontext *context;
-    ALsource *source;
-    ALsizei i;
 
     context = GetContextRef();
     if(!context) return;
 
+    alSourceRewindvDirect(context, n, sources);
+
+    ReleaseContextRef(context);
+}
+
+AL_API ALvoid AL_APIENTRY alSourceRewindvDirect(ALCcontext *context, ALsizei n, const ALuint *sources)
+{
+    ALsource *source;
+    ALsizei i;
+
     if(!(n >= 0))
         SET_ERROR_AND_GOTO(context, AL_INVALID_VALUE, done);
     for(i = 0;i < n;i++)
@@ -2276,26 +2772,99 @@ AL_API ALvoid AL_APIENTRY alSourceRewindv(ALsizei n, const ALuint *sources)
     UnlockContext(context);
 
 done:
-    ALCcontext_DecRef(context);
+    return;
+}
+
+
+/* Frees a retired run of buffer queue items. The items' buffer references
+ * were already released when they were unqueued.
+ */
+static void FreeRetiredBufferList(ALCcontext *context, ALbufferlistitem *item)
+{
+    ALbufferlistitem *tail = item->RetireTail;
+    ALbufferlistitem *next;
+
+    do {
+        next = (item == tail) ? NULL : ATOMIC_LOAD(&item->next);
+        ObjectPoolFree(&context->BufferListPool, item);
+    } while((item=next) != NULL);
+}
+
+static void PushRetiredBufferList(ALCcontext *context, ALbufferlistitem *item)
+{
+    ALbufferlistitem *head = ATOMIC_LOAD(&context->RetiredBufferLists);
+    do {
+        item->RetireNext = head;
+    } while(!ATOMIC_COMPARE_EXCHANGE_WEAK(ALbufferlistitem*, &context->RetiredBufferLists,
+                                          &head, item));
 }
 
+/* Retires a run of items just removed from a source's queue. If the device
+ * isn't mixing, no mix can still reference them and they're freed right away.
+ * Otherwise they wait on the context's retire list until the current mix is
+ * done.
+ */
+static void RetireBufferList(ALCcontext *context, ALbufferlistitem *head, ALbufferlistitem *tail)
+{
+    uint count = ReadRef(&context->Device->MixCount);
+
+    head->RetireTail = tail;
+    head->RetireEpoch = count;
+    if((count&1) == 0)
+        FreeRetiredBufferList(context, head);
+    else
+        PushRetiredBufferList(context, head);
+}
+
+/* Frees retired items the mixer is done with. Called when queueing and
+ * unqueueing, so a streaming source reclaims its old items as it goes.
+ */
+static void ReclaimRetiredBufferLists(ALCcontext *context)
+{
+    ALbufferlistitem *retired;
+    uint count;
+
+    if(ATOMIC_LOAD(&context->RetiredBufferLists) == NULL)
+        return;
+
+    retired = ATOMIC_EXCHANGE(ALbufferlistitem*, &context->RetiredBufferLists, NULL);
+    count = ReadRef(&context->Device->MixCount);
+    while(retired != NULL)
+    {
+        ALbufferlistitem *next = retired->RetireNext;
+        if(retired->RetireEpoch == count)
+            PushRetiredBufferList(context, retired);
+        else
+            FreeRetiredBufferList(context, retired);
+        retired = next;
+    }
+}
 
 AL_API ALvoid AL_APIENTRY alSourceQueueBuffers(ALuint src, ALsizei nb, const ALuint *buffers)
 {
-    ALCdevice *device;
     ALCcontext *context;
+
+    context = GetContextRef();
+    if(!context) return;
+
+    alSourceQueueBuffersDirect(context, src, nb, buffers);
+
+    ReleaseContextRef(context);
+}
+
+AL_API ALvoid AL_APIENTRY alSourceQueueBuffersDirect(ALCcontext *context, ALuint src, ALsizei nb, const ALuint *buffers)
+{
+    ALCdevice *device;
     ALsource *source;
     ALsizei i;
     ALbufferlistitem *BufferListStart;
     ALbufferlistitem *BufferList;
+    ALbufferlistitem *item;
     ALbuffer *BufferFmt = NULL;
 
     if(nb == 0)
         return;
 
-    context = GetContextRef();
-    if(!context) return;
-
     device = context->Device;
 
     if(!(nb >= 0))
@@ -2320,7 +2889,7 @@ AL_API ALvoid AL_APIENTRY alSourceQueueBuffers(ALuint src, ALsizei nb, const ALu
             BufferFmt = BufferList->buffer;
             break;
         }
-        BufferList = BufferList->next;
+        BufferList = ATOMIC_LOAD(&BufferList->next);
     }
 
     BufferListStart = NULL;
@@ -2334,18 +2903,19 @@ AL_API ALvoid AL_APIENTRY alSourceQueueBuffers(ALuint src, ALsizei nb, const ALu
             SET_ERROR_AND_GOTO(context, AL_INVALID_NAME, buffer_error);
         }
 
-        if(!BufferListStart)
+        item = ObjectPoolAlloc(&context->BufferListPool);
+        if(!item)
         {
-            BufferListStart = malloc(sizeof(ALbufferlistitem));
-            BufferList = BufferListStart;
+            WriteUnlock(&source->queue_lock);
+            SET_ERROR_AND_GOTO(context, AL_OUT_OF_MEMORY, buffer_error);
         }
+        item->buffer = buffer;
+        ATOMIC_INIT(&item->next, NULL);
+        if(!BufferListStart)
+            BufferListStart = item;
         else
-        {
-            BufferList->next = malloc(sizeof(ALbufferlistitem));
-            BufferList = BufferList->next;
-        }
-        BufferList->buffer = buffer;
-        BufferList->next = NULL;
+            ATOMIC_STORE(&BufferList->next, item);
+        BufferList = item;
         if(!buffer) continue;
 
         /* Hold a read lock on each buffer being queued while checking all
@@ -2360,6 +2930,8 @@ AL_API ALvoid AL_APIENTRY alSourceQueueBuffers(ALuint src, ALsizei nb, const ALu
 
             source->NumChannels = ChannelsFromFmt(buffer->FmtChannels);
             source->SampleSize  = BytesFromFmt(buffer->FmtType);
+            source->Frequency   = buffer->Frequency;
+            source->FmtChannels = buffer->FmtChannels;
         }
         else if(BufferFmt->Frequency != buffer->Frequency ||
                 BufferFmt->OriginalChannels != buffer->OriginalChannels ||
@@ -2373,13 +2945,13 @@ AL_API ALvoid AL_APIENTRY alSourceQueueBuffers(ALuint src, ALsizei nb, const ALu
              * each buffer we had. */
             while(BufferListStart)
             {
-                ALbufferlistitem *next = BufferListStart->next;
+                ALbufferlistitem *next = ATOMIC_LOAD(&BufferListStart->next);
                 if((buffer=BufferListStart->buffer) != NULL)
                 {
                     DecrementRef(&buffer->ref);
                     ReadUnlock(&buffer->lock);
                 }
-                free(BufferListStart);
+                ObjectPoolFree(&context->BufferListPool, BufferListStart);
                 BufferListStart = next;
             }
             goto done;
@@ -2391,19 +2963,23 @@ AL_API ALvoid AL_APIENTRY alSourceQueueBuffers(ALuint src, ALsizei nb, const ALu
     {
         ALbuffer *buffer = BufferList->buffer;
         if(buffer) ReadUnlock(&buffer->lock);
-        BufferList = BufferList->next;
+        BufferList = ATOMIC_LOAD(&BufferList->next);
     }
 
     /* Source is now streaming */
     source->SourceType = AL_STREAMING;
 
-    BufferList = NULL;
-    if(!ATOMIC_COMPARE_EXCHANGE_STRONG(ALbufferlistitem*, &source->queue, &BufferList, BufferListStart))
+    /* Append the new items to the end of the queue. The store publishes the
+     * fully initialized items to the mixer, which may pick them up right away.
+     */
+    BufferList = ATOMIC_LOAD(&source->queue);
+    if(!BufferList)
+        ATOMIC_STORE(&source->queue, BufferListStart);
+    else
     {
-        /* Queue head is not NULL, append to the end of the queue */
-        while(BufferList->next != NULL)
-            BufferList = BufferList->next;
-        BufferList->next = BufferListStart;
+        while((item=ATOMIC_LOAD(&BufferList->next)) != NULL)
+            BufferList = item;
+        ATOMIC_STORE(&BufferList->next, BufferListStart);
     }
     /* If the current buffer was at the end (NULL), put it at the start of the newly queued
      * buffers.
@@ -2412,13 +2988,26 @@ AL_API ALvoid AL_APIENTRY alSourceQueueBuffers(ALuint src, ALsizei nb, const ALu
     ATOMIC_COMPARE_EXCHANGE_STRONG(ALbufferlistitem*, &source->current_buffer, &BufferList, BufferListStart);
     WriteUnlock(&source->queue_lock);
 
+    ReclaimRetiredBufferLists(context);
+
 done:
-    ALCcontext_DecRef(context);
+    return;
 }
 
 AL_API ALvoid AL_APIENTRY alSourceUnqueueBuffers(ALuint src, ALsizei nb, ALuint *buffers)
 {
     ALCcontext *context;
+
+    context = GetContextRef();
+    if(!context) return;
+
+    alSourceUnqueueBuffersDirect(context, src, nb, buffers);
+
+    ReleaseContextRef(context);
+}
+
+AL_API ALvoid AL_APIENTRY alSourceUnqueueBuffersDirect(ALCcontext *context, ALuint src, ALsizei nb, ALuint *buffers)
+{
     ALsource *source;
     ALbufferlistitem *OldHead;
     ALbufferlistitem *OldTail;
@@ -2428,9 +3017,6 @@ AL_API ALvoid AL_APIENTRY alSourceUnqueueBuffers(ALuint src, ALsizei nb, ALuint
     if(nb == 0)
         return;
 
-    context = GetContextRef();
-    if(!context) return;
-
     if(!(nb >= 0))
         SET_ERROR_AND_GOTO(context, AL_INVALID_VALUE, done);
 
@@ -2445,7 +3031,7 @@ AL_API ALvoid AL_APIENTRY alSourceUnqueueBuffers(ALuint src, ALsizei nb, ALuint
     {
         for(i = 1;i < nb;i++)
         {
-            ALbufferlistitem *next = OldTail->next;
+            ALbufferlistitem *next = ATOMIC_LOAD(&OldTail->next);
             if(!next || next == Current) break;
             OldTail = next;
         }
@@ -2457,29 +3043,17 @@ AL_API ALvoid AL_APIENTRY alSourceUnqueueBuffers(ALuint src, ALsizei nb, ALuint
         SET_ERROR_AND_GOTO(context, AL_INVALID_VALUE, done);
     }
 
-    /* Swap it, and cut the new head from the old. */
-    OldHead = ATOMIC_EXCHANGE(ALbufferlistitem*, &source->queue, OldTail->next);
-    if(OldTail->next)
-    {
-        ALCdevice *device = context->Device;
-        uint count;
-
-        /* Once the active mix (if any) is done, it's safe to cut the old tail
-         * from the new head.
-         */
-        if(((count=ReadRef(&device->MixCount))&1) != 0)
-        {
-            while(count == ReadRef(&device->MixCount))
-                althrd_yield();
-        }
-        OldTail->next = NULL;
-    }
+    /* Swap it. The old tail is left linked to the new head, since a mix that
+     * started while the source was looping can still wrap back to the old
+     * queue head and walk forward from there.
+     */
+    OldHead = ATOMIC_EXCHANGE(ALbufferlistitem*, &source->queue, ATOMIC_LOAD(&OldTail->next));
     WriteUnlock(&source->queue_lock);
 
-    while(OldHead != NULL)
+    Current = OldHead;
+    for(i = 0;i < nb;i++)
     {
-        ALbufferlistitem *next = OldHead->next;
-        ALbuffer *buffer = OldHead->buffer;
+        ALbuffer *buffer = Current->buffer;
 
         if(!buffer)
             *(buffers++) = 0;
@@ -2488,13 +3062,15 @@ AL_API ALvoid AL_APIENTRY alSourceUnqueueBuffers(ALuint src, ALsizei nb, ALuint
             *(buffers++) = buffer->id;
             DecrementRef(&buffer->ref);
         }
-
-        free(OldHead);
-        OldHead = next;
+        Current = ATOMIC_LOAD(&Current->next);
     }
 
+    /* Hand the old items off to be freed once the mixer is done with them. */
+    RetireBufferList(context, OldHead, OldTail);
+    ReclaimRetiredBufferLists(context);
+
 done:
-    ALCcontext_DecRef(context);
+    return;
 }
 
 
@@ -2533,6 +3109,7 @@ static ALvoid InitSourceParams(ALsource *Source)
     Source->RoomRolloffFactor = 0.0f;
     Source->DopplerFactor = 1.0f;
     Source->DirectChannels = AL_FALSE;
+    Source->Resampler = ResamplerDefault;
 
     Source->StereoPan[0] = DEG2RAD( 30.0f);
     Source->StereoPan[1] = DEG2RAD(-30.0f);
@@ -2564,6 +3141,10 @@ static ALvoid InitSourceParams(ALsource *Source)
     }
 
     ATOMIC_INIT(&Source->NeedsUpdate, AL_TRUE);
+    memcpy(Source->Used.Position, Source->Position.v, sizeof(Source->Used.Position));
+    memcpy(Source->Used.Direction, Source->Direction.v, sizeof(Source->Used.Direction));
+    Source->Used.Gain = Source->Gain;
+    Source->Used.Pitch = Source->Pitch;
 }
 
 
@@ -2573,6 +3154,8 @@ static ALvoid InitSourceParams(ALsource *Source)
  */
 ALvoid SetSourceState(ALsource *Source, ALCcontext *Context, ALenum state)
 {
+    ALvoice *started = NULL;
+
     WriteLock(&Source->queue_lock);
     if(state == AL_PLAYING)
     {
@@ -2590,7 +3173,7 @@ ALvoid SetSourceState(ALsource *Source, ALCcontext *Context, ALenum state)
             ALbuffer *buffer;
             if((buffer=BufferList->buffer) != NULL && buffer->SampleLen > 0)
                 break;
-            BufferList = BufferList->next;
+            BufferList = ATOMIC_LOAD(&BufferList->next);
         }
 
         if(Source->state != AL_PAUSED)
@@ -2643,11 +3226,28 @@ ALvoid SetSourceState(ALsource *Source, ALCcontext *Context, ALenum state)
             voice->Source = Source;
         }
 
+        if(!voice->TargetStore)
+        {
+            voice->TargetStore = al_calloc(16, 3*sizeof(ALvoiceTargets));
+            if(!voice->TargetStore)
+            {
+                ERR("Failed to allocate voice targets\n");
+                voice->Source = NULL;
+                goto do_stop;
+            }
+            voice->NextTargets = 0;
+            voice->MixTargets = 1;
+            ATOMIC_INIT(&voice->PendingTargets, 2);
+        }
+
         /* Clear previous samples if playback is discontinuous. */
         if(discontinuity)
             memset(voice->PrevSamples, 0, sizeof(voice->PrevSamples));
 
         voice->Moving = AL_FALSE;
+        voice->LODSteps = 0;
+        voice->Resampler = SelectResampler(Source->Resampler);
+        voice->Polyphase = NULL;
         for(i = 0;i < MAX_INPUT_CHANNELS;i++)
         {
             ALsizei j;
@@ -2666,6 +3266,7 @@ ALvoid SetSourceState(ALsource *Source, ALCcontext *Context, ALenum state)
             voice->Update = CalcNonAttnSourceParams;
 
         ATOMIC_STORE(&Source->NeedsUpdate, AL_TRUE);
+        started = voice;
     }
     else if(state == AL_PAUSED)
     {
@@ -2694,6 +3295,10 @@ ALvoid SetSourceState(ALsource *Source, ALCcontext *Context, ALenum state)
         Source->Offset = -1.0;
     }
     WriteUnlock(&Source->queue_lock);
+
+    /* The mixer needs targets for the voice before it can start playing. */
+    if(started)
+        aluStartVoice(Context, started);
 }
 
 /* GetSourceSampleOffset
@@ -2725,7 +3330,7 @@ ALint64 GetSourceSampleOffset(ALsource *Source)
     {
         if(BufferList->buffer)
             readPos += (ALuint64)BufferList->buffer->SampleLen << 32;
-        BufferList = BufferList->next;
+        BufferList = ATOMIC_LOAD(&BufferList->next);
     }
 
     ReadUnlock(&Source->queue_lock);
@@ -2765,13 +3370,13 @@ static ALdouble GetSourceSecOffset(ALsource *Source)
             if(!Buffer) Buffer = buffer;
             readPos += (ALuint64)buffer->SampleLen << FRACTIONBITS;
         }
-        BufferList = BufferList->next;
+        BufferList = ATOMIC_LOAD(&BufferList->next);
     }
 
     while(BufferList && !Buffer)
     {
         Buffer = BufferList->buffer;
-        BufferList = BufferList->next;
+        BufferList = ATOMIC_LOAD(&BufferList->next);
     }
     assert(Buffer != NULL);
 
@@ -2819,7 +3424,7 @@ static ALdouble GetSourceOffset(ALsource *Source, ALenum name)
             totalBufferLen += buffer->SampleLen;
             if(!readFin) readPos += buffer->SampleLen;
         }
-        BufferList = BufferList->next;
+        BufferList = ATOMIC_LOAD(&BufferList->next);
     }
     assert(Buffer != NULL);
 
@@ -2882,38 +3487,58 @@ static ALdouble GetSourceOffset(ALsource *Source, ALenum name)
 ALboolean ApplyOffset(ALsource *Source)
 {
     ALbufferlistitem *BufferList;
-    const ALbuffer *Buffer;
-    ALuint bufferLen, totalBufferLen;
     ALuint offset=0, frac=0;
+    ALboolean ok;
 
     /* Get sample frame offset */
-    if(!GetSampleOffset(Source, &offset, &frac))
+    ok = GetSampleOffset(Source, Source->OffsetType, Source->Offset, &offset, &frac);
+    Source->Offset = -1.0;
+    if(!ok) return AL_FALSE;
+
+    if((BufferList=FindBufferOffset(Source, &offset)) == NULL)
+    {
+        /* Offset is out of range of the queue */
         return AL_FALSE;
+    }
+
+    ATOMIC_STORE(&Source->current_buffer, BufferList);
+    Source->position = offset;
+    Source->position_fraction = frac;
+    return AL_TRUE;
+}
+
+
+/* FindBufferOffset
+ *
+ * Finds the queue item the given sample offset falls in, and makes the offset
+ * relative to that item's buffer. Returns NULL if the offset is past the end
+ * of the queue.
+ */
+static ALbufferlistitem *FindBufferOffset(ALsource *Source, ALuint *offset)
+{
+    ALbufferlistitem *BufferList;
+    const ALbuffer *Buffer;
+    ALuint bufferLen, totalBufferLen;
 
     totalBufferLen = 0;
     BufferList = ATOMIC_LOAD(&Source->queue);
-    while(BufferList && totalBufferLen <= offset)
+    while(BufferList && totalBufferLen <= *offset)
     {
         Buffer = BufferList->buffer;
         bufferLen = Buffer ? Buffer->SampleLen : 0;
 
-        if(bufferLen > offset-totalBufferLen)
+        if(bufferLen > *offset-totalBufferLen)
         {
-            /* Offset is in this buffer */
-            ATOMIC_STORE(&Source->current_buffer, BufferList);
-
-            Source->position = offset - totalBufferLen;
-            Source->position_fraction = frac;
-            return AL_TRUE;
+            *offset -= totalBufferLen;
+            return BufferList;
         }
 
         totalBufferLen += bufferLen;
 
-        BufferList = BufferList->next;
+        BufferList = ATOMIC_LOAD(&BufferList->next);
     }
 
-    /* Offset is out of range of the queue */
-    return AL_FALSE;
+    return NULL;
 }
 
 
@@ -2923,7 +3548,7 @@ ALboolean ApplyOffset(ALsource *Source)
  * or Second offset supplied by the application). This takes into account the
  * fact that the buffer format may have been modifed since.
  */
-static ALboolean GetSampleOffset(ALsource *Source, ALuint *offset, ALuint *frac)
+static ALboolean GetSampleOffset(ALsource *Source, ALenum type, ALdouble value, ALuint *offset, ALuint *frac)
 {
     const ALbuffer *Buffer = NULL;
     const ALbufferlistitem *BufferList;
@@ -2938,19 +3563,16 @@ static ALboolean GetSampleOffset(ALsource *Source, ALuint *offset, ALuint *frac)
             Buffer = BufferList->buffer;
             break;
         }
-        BufferList = BufferList->next;
+        BufferList = ATOMIC_LOAD(&BufferList->next);
     }
     if(!Buffer)
-    {
-        Source->Offset = -1.0;
         return AL_FALSE;
-    }
 
-    switch(Source->OffsetType)
+    switch(type)
     {
     case AL_BYTE_OFFSET:
         /* Determine the ByteOffset (and ensure it is block aligned) */
-        *offset = (ALuint)Source->Offset;
+        *offset = (ALuint)value;
         if(Buffer->OriginalType == UserFmtIMA4)
         {
             ALsizei align = (Buffer->OriginalAlign-1)/2 + 4;
@@ -2969,23 +3591,40 @@ static ALboolean GetSampleOffset(ALsource *Source, ALuint *offset, ALuint *frac)
         break;
 
     case AL_SAMPLE_OFFSET:
-        dblfrac = modf(Source->Offset, &dbloff);
+        dblfrac = modf(value, &dbloff);
         *offset = (ALuint)mind(dbloff, UINT_MAX);
         *frac = (ALuint)mind(dblfrac*FRACTIONONE, FRACTIONONE-1.0);
         break;
 
     case AL_SEC_OFFSET:
-        dblfrac = modf(Source->Offset*Buffer->Frequency, &dbloff);
+        dblfrac = modf(value*Buffer->Frequency, &dbloff);
         *offset = (ALuint)mind(dbloff, UINT_MAX);
         *frac = (ALuint)mind(dblfrac*FRACTIONONE, FRACTIONONE-1.0);
         break;
     }
-    Source->Offset = -1.0;
 
     return AL_TRUE;
 }
 
 
+/* ReleaseRetiredBufferLists
+ *
+ * Frees all retired buffer queue items. Only called once the device no longer
+ * mixes the context.
+ */
+ALvoid ReleaseRetiredBufferLists(ALCcontext *Context)
+{
+    ALbufferlistitem *retired;
+
+    retired = ATOMIC_EXCHANGE(ALbufferlistitem*, &Context->RetiredBufferLists, NULL);
+    while(retired != NULL)
+    {
+        ALbufferlistitem *next = retired->RetireNext;
+        FreeRetiredBufferList(Context, retired);
+        retired = next;
+    }
+}
+
 /* ReleaseALSources
  *
  * Destroys all sources in the source map.
@@ -2995,18 +3634,19 @@ ALvoid ReleaseALSources(ALCcontext *Context)
     ALbufferlistitem *item;
     ALsizei pos;
     ALuint j;
-    for(pos = 0;pos < Context->SourceMap.size;pos++)
+    for(pos = 0;pos < GetHandleMapCapacity(&Context->SourceMap);pos++)
     {
-        ALsource *temp = Context->SourceMap.array[pos].value;
-        Context->SourceMap.array[pos].value = NULL;
+        ALsource *temp = LookupHandleMapIndex(&Context->SourceMap, pos);
+        if(!temp) continue;
+        RemoveSource(Context, temp->id);
 
         item = ATOMIC_EXCHANGE(ALbufferlistitem*, &temp->queue, NULL);
         while(item != NULL)
         {
-            ALbufferlistitem *next = item->next;
+            ALbufferlistitem *next = ATOMIC_LOAD(&item->next);
             if(item->buffer != NULL)
                 DecrementRef(&item->buffer->ref);
-            free(item);
+            ObjectPoolFree(&Context->BufferListPool, item);
             item = next;
         }
 
@@ -3018,7 +3658,6 @@ ALvoid ReleaseALSources(ALCcontext *Context)
         }
 
         FreeThunkEntry(temp->id);
-        memset(temp, 0, sizeof(*temp));
-        al_free(temp);
+        ObjectPoolFree(&Context->SourcePool, temp);
     }
 }
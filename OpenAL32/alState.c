@@ -44,6 +44,34 @@ static const ALchar alErrInvalidValue[] = "Invalid Value";
 static const ALchar alErrInvalidOp[] = "Invalid Operation";
 static const ALchar alErrOutOfMemory[] = "Out of Memory";
 
+
+/* Gets the requested object pool statistic, summed over the context's pools
+ * and those of its device. */
+static ALuint GetPoolStat(ALCcontext *context, ALenum pname)
+{
+    ObjectPool *pools[6] = {
+        &context->SourcePool, &context->BufferListPool, &context->EffectSlotPool,
+        &context->Device->BufferPool, &context->Device->EffectPool,
+        &context->Device->FilterPool
+    };
+    ObjectPoolStats stats;
+    ALuint value = 0;
+    size_t i;
+
+    for(i = 0;i < COUNTOF(pools);i++)
+    {
+        GetObjectPoolStats(pools[i], &stats);
+        switch(pname)
+        {
+            case AL_OBJECT_POOL_CAPACITY_SOFTX: value += stats.Capacity; break;
+            case AL_OBJECT_POOL_IN_USE_SOFTX: value += stats.InUse; break;
+            case AL_OBJECT_POOL_ALLOCS_SOFTX: value += stats.Allocs; break;
+            case AL_OBJECT_POOL_CHUNK_ALLOCS_SOFTX: value += stats.ChunkAllocs; break;
+        }
+    }
+    return value;
+}
+
 AL_API ALvoid AL_APIENTRY alEnable(ALenum capability)
 {
     ALCcontext *context;
@@ -51,6 +79,13 @@ AL_API ALvoid AL_APIENTRY alEnable(ALenum capability)
     context = GetContextRef();
     if(!context) return;
 
+    alEnableDirect(context, capability);
+
+    ReleaseContextRef(context);
+}
+
+AL_API ALvoid AL_APIENTRY alEnableDirect(ALCcontext *context, ALenum capability)
+{
     switch(capability)
     {
     case AL_SOURCE_DISTANCE_MODEL:
@@ -63,7 +98,7 @@ AL_API ALvoid AL_APIENTRY alEnable(ALenum capability)
     }
 
 done:
-    ALCcontext_DecRef(context);
+    return;
 }
 
 AL_API ALvoid AL_APIENTRY alDisable(ALenum capability)
@@ -73,6 +108,13 @@ AL_API ALvoid AL_APIENTRY alDisable(ALenum capability)
     context = GetContextRef();
     if(!context) return;
 
+    alDisableDirect(context, capability);
+
+    ReleaseContextRef(context);
+}
+
+AL_API ALvoid AL_APIENTRY alDisableDirect(ALCcontext *context, ALenum capability)
+{
     switch(capability)
     {
     case AL_SOURCE_DISTANCE_MODEL:
@@ -85,17 +127,27 @@ AL_API ALvoid AL_APIENTRY alDisable(ALenum capability)
     }
 
 done:
-    ALCcontext_DecRef(context);
+    return;
 }
 
 AL_API ALboolean AL_APIENTRY alIsEnabled(ALenum capability)
 {
     ALCcontext *context;
-    ALboolean value=AL_FALSE;
+    ALboolean ret;
 
     context = GetContextRef();
     if(!context) return AL_FALSE;
 
+    ret = alIsEnabledDirect(context, capability);
+
+    ReleaseContextRef(context);
+    return ret;
+}
+
+AL_API ALboolean AL_APIENTRY alIsEnabledDirect(ALCcontext *context, ALenum capability)
+{
+    ALboolean value=AL_FALSE;
+
     switch(capability)
     {
     case AL_SOURCE_DISTANCE_MODEL:
@@ -107,19 +159,27 @@ AL_API ALboolean AL_APIENTRY alIsEnabled(ALenum capability)
     }
 
 done:
-    ALCcontext_DecRef(context);
-
     return value;
 }
 
 AL_API ALboolean AL_APIENTRY alGetBoolean(ALenum pname)
 {
     ALCcontext *context;
-    ALboolean value=AL_FALSE;
+    ALboolean ret;
 
     context = GetContextRef();
     if(!context) return AL_FALSE;
 
+    ret = alGetBooleanDirect(context, pname);
+
+    ReleaseContextRef(context);
+    return ret;
+}
+
+AL_API ALboolean AL_APIENTRY alGetBooleanDirect(ALCcontext *context, ALenum pname)
+{
+    ALboolean value=AL_FALSE;
+
     switch(pname)
     {
     case AL_DOPPLER_FACTOR:
@@ -151,19 +211,27 @@ AL_API ALboolean AL_APIENTRY alGetBoolean(ALenum pname)
     }
 
 done:
-    ALCcontext_DecRef(context);
-
     return value;
 }
 
 AL_API ALdouble AL_APIENTRY alGetDouble(ALenum pname)
 {
     ALCcontext *context;
-    ALdouble value = 0.0;
+    ALdouble ret;
 
     context = GetContextRef();
     if(!context) return 0.0;
 
+    ret = alGetDoubleDirect(context, pname);
+
+    ReleaseContextRef(context);
+    return ret;
+}
+
+AL_API ALdouble AL_APIENTRY alGetDoubleDirect(ALCcontext *context, ALenum pname)
+{
+    ALdouble value = 0.0;
+
     switch(pname)
     {
     case AL_DOPPLER_FACTOR:
@@ -191,19 +259,27 @@ AL_API ALdouble AL_APIENTRY alGetDouble(ALenum pname)
     }
 
 done:
-    ALCcontext_DecRef(context);
-
     return value;
 }
 
 AL_API ALfloat AL_APIENTRY alGetFloat(ALenum pname)
 {
     ALCcontext *context;
-    ALfloat value = 0.0f;
+    ALfloat ret;
 
     context = GetContextRef();
     if(!context) return 0.0f;
 
+    ret = alGetFloatDirect(context, pname);
+
+    ReleaseContextRef(context);
+    return ret;
+}
+
+AL_API ALfloat AL_APIENTRY alGetFloatDirect(ALCcontext *context, ALenum pname)
+{
+    ALfloat value = 0.0f;
+
     switch(pname)
     {
     case AL_DOPPLER_FACTOR:
@@ -231,19 +307,27 @@ AL_API ALfloat AL_APIENTRY alGetFloat(ALenum pname)
     }
 
 done:
-    ALCcontext_DecRef(context);
-
     return value;
 }
 
 AL_API ALint AL_APIENTRY alGetInteger(ALenum pname)
 {
     ALCcontext *context;
-    ALint value = 0;
+    ALint ret;
 
     context = GetContextRef();
     if(!context) return 0;
 
+    ret = alGetIntegerDirect(context, pname);
+
+    ReleaseContextRef(context);
+    return ret;
+}
+
+AL_API ALint AL_APIENTRY alGetIntegerDirect(ALCcontext *context, ALenum pname)
+{
+    ALint value = 0;
+
     switch(pname)
     {
     case AL_DOPPLER_FACTOR:
@@ -266,13 +350,34 @@ AL_API ALint AL_APIENTRY alGetInteger(ALenum pname)
         value = (ALint)context->DeferUpdates;
         break;
 
+    case AL_SOURCE_UPDATES_PERFORMED_SOFTX:
+        value = (ALint)ReadRef(&context->UpdatesPerformed);
+        break;
+
+    case AL_SOURCE_UPDATES_SKIPPED_SOFTX:
+        value = (ALint)ReadRef(&context->UpdatesSkipped);
+        break;
+
+    case AL_NUM_RESAMPLERS_SOFTX:
+        value = ResamplerMax + 1;
+        break;
+
+    case AL_DEFAULT_RESAMPLER_SOFTX:
+        value = ResamplerDefault;
+        break;
+
+    case AL_OBJECT_POOL_CAPACITY_SOFTX:
+    case AL_OBJECT_POOL_IN_USE_SOFTX:
+    case AL_OBJECT_POOL_ALLOCS_SOFTX:
+    case AL_OBJECT_POOL_CHUNK_ALLOCS_SOFTX:
+        value = GetPoolStat(context, pname);
+        break;
+
     default:
         SET_ERROR_AND_GOTO(context, AL_INVALID_ENUM, done);
     }
 
 done:
-    ALCcontext_DecRef(context);
-
     return value;
 }
 
@@ -306,12 +411,35 @@ AL_API ALint64SOFT AL_APIENTRY alGetInteger64SOFT(ALenum pname)
         value = (ALint64SOFT)context->DeferUpdates;
         break;
 
+    case AL_SOURCE_UPDATES_PERFORMED_SOFTX:
+        value = (ALint64SOFT)ReadRef(&context->UpdatesPerformed);
+        break;
+
+    case AL_SOURCE_UPDATES_SKIPPED_SOFTX:
+        value = (ALint64SOFT)ReadRef(&context->UpdatesSkipped);
+        break;
+
+    case AL_NUM_RESAMPLERS_SOFTX:
+        value = ResamplerMax + 1;
+        break;
+
+    case AL_DEFAULT_RESAMPLER_SOFTX:
+        value = ResamplerDefault;
+        break;
+
+    case AL_OBJECT_POOL_CAPACITY_SOFTX:
+    case AL_OBJECT_POOL_IN_USE_SOFTX:
+    case AL_OBJECT_POOL_ALLOCS_SOFTX:
+    case AL_OBJECT_POOL_CHUNK_ALLOCS_SOFTX:
+        value = GetPoolStat(context, pname);
+        break;
+
     default:
         SET_ERROR_AND_GOTO(context, AL_INVALID_ENUM, done);
     }
 
 done:
-    ALCcontext_DecRef(context);
+    ReleaseContextRef(context);
 
     return value;
 }
@@ -320,6 +448,16 @@ AL_API ALvoid AL_APIENTRY alGetBooleanv(ALenum pname, ALboolean *values)
 {
     ALCcontext *context;
 
+    context = GetContextRef();
+    if(!context) return;
+
+    alGetBooleanvDirect(context, pname, values);
+
+    ReleaseContextRef(context);
+}
+
+AL_API ALvoid AL_APIENTRY alGetBooleanvDirect(ALCcontext *context, ALenum pname, ALboolean *values)
+{
     if(values)
     {
         switch(pname)
@@ -329,14 +467,11 @@ AL_API ALvoid AL_APIENTRY alGetBooleanv(ALenum pname, ALboolean *values)
             case AL_DISTANCE_MODEL:
             case AL_SPEED_OF_SOUND:
             case AL_DEFERRED_UPDATES_SOFT:
-                values[0] = alGetBoolean(pname);
+                values[0] = alGetBooleanDirect(context, pname);
                 return;
         }
     }
 
-    context = GetContextRef();
-    if(!context) return;
-
     if(!(values))
         SET_ERROR_AND_GOTO(context, AL_INVALID_VALUE, done);
     switch(pname)
@@ -346,13 +481,23 @@ AL_API ALvoid AL_APIENTRY alGetBooleanv(ALenum pname, ALboolean *values)
     }
 
 done:
-    ALCcontext_DecRef(context);
+    return;
 }
 
 AL_API ALvoid AL_APIENTRY alGetDoublev(ALenum pname, ALdouble *values)
 {
     ALCcontext *context;
 
+    context = GetContextRef();
+    if(!context) return;
+
+    alGetDoublevDirect(context, pname, values);
+
+    ReleaseContextRef(context);
+}
+
+AL_API ALvoid AL_APIENTRY alGetDoublevDirect(ALCcontext *context, ALenum pname, ALdouble *values)
+{
     if(values)
     {
         switch(pname)
@@ -362,14 +507,11 @@ AL_API ALvoid AL_APIENTRY alGetDoublev(ALenum pname, ALdouble *values)
             case AL_DISTANCE_MODEL:
             case AL_SPEED_OF_SOUND:
             case AL_DEFERRED_UPDATES_SOFT:
-                values[0] = alGetDouble(pname);
+                values[0] = alGetDoubleDirect(context, pname);
                 return;
         }
     }
 
-    context = GetContextRef();
-    if(!context) return;
-
     if(!(values))
         SET_ERROR_AND_GOTO(context, AL_INVALID_VALUE, done);
     switch(pname)
@@ -379,13 +521,23 @@ AL_API ALvoid AL_APIENTRY alGetDoublev(ALenum pname, ALdouble *values)
     }
 
 done:
-    ALCcontext_DecRef(context);
+    return;
 }
 
 AL_API ALvoid AL_APIENTRY alGetFloatv(ALenum pname, ALfloat *values)
 {
     ALCcontext *context;
 
+    context = GetContextRef();
+    if(!context) return;
+
+    alGetFloatvDirect(context, pname, values);
+
+    ReleaseContextRef(context);
+}
+
+AL_API ALvoid AL_APIENTRY alGetFloatvDirect(ALCcontext *context, ALenum pname, ALfloat *values)
+{
     if(values)
     {
         switch(pname)
@@ -395,14 +547,11 @@ AL_API ALvoid AL_APIENTRY alGetFloatv(ALenum pname, ALfloat *values)
             case AL_DISTANCE_MODEL:
             case AL_SPEED_OF_SOUND:
             case AL_DEFERRED_UPDATES_SOFT:
-                values[0] = alGetFloat(pname);
+                values[0] = alGetFloatDirect(context, pname);
                 return;
         }
     }
 
-    context = GetContextRef();
-    if(!context) return;
-
     if(!(values))
         SET_ERROR_AND_GOTO(context, AL_INVALID_VALUE, done);
     switch(pname)
@@ -412,13 +561,23 @@ AL_API ALvoid AL_APIENTRY alGetFloatv(ALenum pname, ALfloat *values)
     }
 
 done:
-    ALCcontext_DecRef(context);
+    return;
 }
 
 AL_API ALvoid AL_APIENTRY alGetIntegerv(ALenum pname, ALint *values)
 {
     ALCcontext *context;
 
+    context = GetContextRef();
+    if(!context) return;
+
+    alGetIntegervDirect(context, pname, values);
+
+    ReleaseContextRef(context);
+}
+
+AL_API ALvoid AL_APIENTRY alGetIntegervDirect(ALCcontext *context, ALenum pname, ALint *values)
+{
     if(values)
     {
         switch(pname)
@@ -428,14 +587,19 @@ AL_API ALvoid AL_APIENTRY alGetIntegerv(ALenum pname, ALint *values)
             case AL_DISTANCE_MODEL:
             case AL_SPEED_OF_SOUND:
             case AL_DEFERRED_UPDATES_SOFT:
-                values[0] = alGetInteger(pname);
+            case AL_SOURCE_UPDATES_PERFORMED_SOFTX:
+            case AL_SOURCE_UPDATES_SKIPPED_SOFTX:
+            case AL_NUM_RESAMPLERS_SOFTX:
+            case AL_DEFAULT_RESAMPLER_SOFTX:
+            case AL_OBJECT_POOL_CAPACITY_SOFTX:
+            case AL_OBJECT_POOL_IN_USE_SOFTX:
+            case AL_OBJECT_POOL_ALLOCS_SOFTX:
+            case AL_OBJECT_POOL_CHUNK_ALLOCS_SOFTX:
+                values[0] = alGetIntegerDirect(context, pname);
                 return;
         }
     }
 
-    context = GetContextRef();
-    if(!context) return;
-
     switch(pname)
     {
     default:
@@ -443,7 +607,7 @@ AL_API ALvoid AL_APIENTRY alGetIntegerv(ALenum pname, ALint *values)
     }
 
 done:
-    ALCcontext_DecRef(context);
+    return;
 }
 
 AL_API void AL_APIENTRY alGetInteger64vSOFT(ALenum pname, ALint64SOFT *values)
@@ -459,6 +623,14 @@ AL_API void AL_APIENTRY alGetInteger64vSOFT(ALenum pname, ALint64SOFT *values)
             case AL_DISTANCE_MODEL:
             case AL_SPEED_OF_SOUND:
             case AL_DEFERRED_UPDATES_SOFT:
+            case AL_SOURCE_UPDATES_PERFORMED_SOFTX:
+            case AL_SOURCE_UPDATES_SKIPPED_SOFTX:
+            case AL_NUM_RESAMPLERS_SOFTX:
+            case AL_DEFAULT_RESAMPLER_SOFTX:
+            case AL_OBJECT_POOL_CAPACITY_SOFTX:
+            case AL_OBJECT_POOL_IN_USE_SOFTX:
+            case AL_OBJECT_POOL_ALLOCS_SOFTX:
+            case AL_OBJECT_POOL_CHUNK_ALLOCS_SOFTX:
                 values[0] = alGetInteger64SOFT(pname);
                 return;
         }
@@ -474,17 +646,27 @@ AL_API void AL_APIENTRY alGetInteger64vSOFT(ALenum pname, ALint64SOFT *values)
     }
 
 done:
-    ALCcontext_DecRef(context);
+    ReleaseContextRef(context);
 }
 
 AL_API const ALchar* AL_APIENTRY alGetString(ALenum pname)
 {
-    const ALchar *value = NULL;
     ALCcontext *context;
+    const ALchar* ret;
 
     context = GetContextRef();
     if(!context) return NULL;
 
+    ret = alGetStringDirect(context, pname);
+
+    ReleaseContextRef(context);
+    return ret;
+}
+
+AL_API const ALchar* AL_APIENTRY alGetStringDirect(ALCcontext *context, ALenum pname)
+{
+    const ALchar *value = NULL;
+
     switch(pname)
     {
     case AL_VENDOR:
@@ -532,8 +714,6 @@ AL_API const ALchar* AL_APIENTRY alGetString(ALenum pname)
     }
 
 done:
-    ALCcontext_DecRef(context);
-
     return value;
 }
 
@@ -544,6 +724,13 @@ AL_API ALvoid AL_APIENTRY alDopplerFactor(ALfloat value)
     context = GetContextRef();
     if(!context) return;
 
+    alDopplerFactorDirect(context, value);
+
+    ReleaseContextRef(context);
+}
+
+AL_API ALvoid AL_APIENTRY alDopplerFactorDirect(ALCcontext *context, ALfloat value)
+{
     if(!(value >= 0.0f && isfinite(value)))
         SET_ERROR_AND_GOTO(context, AL_INVALID_VALUE, done);
 
@@ -551,7 +738,7 @@ AL_API ALvoid AL_APIENTRY alDopplerFactor(ALfloat value)
     ATOMIC_STORE(&context->UpdateSources, AL_TRUE);
 
 done:
-    ALCcontext_DecRef(context);
+    return;
 }
 
 AL_API ALvoid AL_APIENTRY alDopplerVelocity(ALfloat value)
@@ -561,6 +748,13 @@ AL_API ALvoid AL_APIENTRY alDopplerVelocity(ALfloat value)
     context = GetContextRef();
     if(!context) return;
 
+    alDopplerVelocityDirect(context, value);
+
+    ReleaseContextRef(context);
+}
+
+AL_API ALvoid AL_APIENTRY alDopplerVelocityDirect(ALCcontext *context, ALfloat value)
+{
     if(!(value >= 0.0f && isfinite(value)))
         SET_ERROR_AND_GOTO(context, AL_INVALID_VALUE, done);
 
@@ -568,7 +762,7 @@ AL_API ALvoid AL_APIENTRY alDopplerVelocity(ALfloat value)
     ATOMIC_STORE(&context->UpdateSources, AL_TRUE);
 
 done:
-    ALCcontext_DecRef(context);
+    return;
 }
 
 AL_API ALvoid AL_APIENTRY alSpeedOfSound(ALfloat value)
@@ -578,6 +772,13 @@ AL_API ALvoid AL_APIENTRY alSpeedOfSound(ALfloat value)
     context = GetContextRef();
     if(!context) return;
 
+    alSpeedOfSoundDirect(context, value);
+
+    ReleaseContextRef(context);
+}
+
+AL_API ALvoid AL_APIENTRY alSpeedOfSoundDirect(ALCcontext *context, ALfloat value)
+{
     if(!(value > 0.0f && isfinite(value)))
         SET_ERROR_AND_GOTO(context, AL_INVALID_VALUE, done);
 
@@ -585,7 +786,7 @@ AL_API ALvoid AL_APIENTRY alSpeedOfSound(ALfloat value)
     ATOMIC_STORE(&context->UpdateSources, AL_TRUE);
 
 done:
-    ALCcontext_DecRef(context);
+    return;
 }
 
 AL_API ALvoid AL_APIENTRY alDistanceModel(ALenum value)
@@ -595,6 +796,13 @@ AL_API ALvoid AL_APIENTRY alDistanceModel(ALenum value)
     context = GetContextRef();
     if(!context) return;
 
+    alDistanceModelDirect(context, value);
+
+    ReleaseContextRef(context);
+}
+
+AL_API ALvoid AL_APIENTRY alDistanceModelDirect(ALCcontext *context, ALenum value)
+{
     if(!(value == AL_INVERSE_DISTANCE || value == AL_INVERSE_DISTANCE_CLAMPED ||
          value == AL_LINEAR_DISTANCE || value == AL_LINEAR_DISTANCE_CLAMPED ||
          value == AL_EXPONENT_DISTANCE || value == AL_EXPONENT_DISTANCE_CLAMPED ||
@@ -606,7 +814,7 @@ AL_API ALvoid AL_APIENTRY alDistanceModel(ALenum value)
         ATOMIC_STORE(&context->UpdateSources, AL_TRUE);
 
 done:
-    ALCcontext_DecRef(context);
+    return;
 }
 
 
@@ -617,9 +825,14 @@ AL_API ALvoid AL_APIENTRY alDeferUpdatesSOFT(void)
     context = GetContextRef();
     if(!context) return;
 
-    ALCcontext_DeferUpdates(context);
+    alDeferUpdatesDirectSOFT(context);
 
-    ALCcontext_DecRef(context);
+    ReleaseContextRef(context);
+}
+
+AL_API ALvoid AL_APIENTRY alDeferUpdatesDirectSOFT(ALCcontext *context)
+{
+    ALCcontext_DeferUpdates(context);
 }
 
 AL_API ALvoid AL_APIENTRY alProcessUpdatesSOFT(void)
@@ -629,7 +842,12 @@ AL_API ALvoid AL_APIENTRY alProcessUpdatesSOFT(void)
     context = GetContextRef();
     if(!context) return;
 
-    ALCcontext_ProcessUpdates(context);
+    alProcessUpdatesDirectSOFT(context);
 
-    ALCcontext_DecRef(context);
+    ReleaseContextRef(context);
+}
+
+AL_API ALvoid AL_APIENTRY alProcessUpdatesDirectSOFT(ALCcontext *context)
+{
+    ALCcontext_ProcessUpdates(context);
 }
@@ -27,79 +27,182 @@
 
 #include "almalloc.h"
 
+#include "threads.h"
 
-static ATOMIC(ALenum) *ThunkArray;
-static ALuint          ThunkArraySize;
-static RWLock ThunkLock;
 
-void ThunkInit(void)
+/* IDs are handed out from a lock-free free list (a Treiber stack). Entries
+ * live in fixed-size chunks which are never moved or freed until ThunkExit, so
+ * both allocating and freeing an ID are constant-time, and only need to lock
+ * when the free list runs dry and a new chunk has to be added.
+ */
+#define THUNK_CHUNK_BITS  10
+#define THUNK_CHUNK_SIZE  (1<<THUNK_CHUNK_BITS)
+#define THUNK_CHUNK_MASK  (THUNK_CHUNK_SIZE-1)
+#define THUNK_MAX_CHUNKS  ((HANDLE_INDEX_MASK+1) >> THUNK_CHUNK_BITS)
+
+typedef struct ThunkEntry {
+    /* The generation count for the entry's next (or current) handle, shifted
+     * up by one, with the low bit set while the entry is in use. */
+    ATOMIC(ALuint) state;
+    /* The next free index, while this entry is on the free list. */
+    ATOMIC(ALuint) next;
+} ThunkEntry;
+
+static ThunkEntry *ThunkChunks[THUNK_MAX_CHUNKS];
+static ATOMIC(ALuint) ThunkChunkCount = ATOMIC_INIT_STATIC(0);
+static almtx_t ThunkGrowLock;
+
+/* The head of the free list. The lower HANDLE_INDEX_BITS hold the index of
+ * the first free entry (0 when empty), and the upper bits are a counter bumped
+ * with each change, to avoid ABA problems. It's kept to 32 bits so every
+ * atomics implementation can compare-exchange it, including the x86 inline
+ * assembly one on 32-bit targets.
+ */
+static ATOMIC(ALuint) ThunkFreeHead = ATOMIC_INIT_STATIC(0);
+
+#define THUNK_HEAD_INDEX(h)       ((h) & HANDLE_INDEX_MASK)
+#define THUNK_HEAD_NEXT(h, idx)   (((((h)>>HANDLE_INDEX_BITS)+1)<<HANDLE_INDEX_BITS) | (idx))
+
+
+static inline ThunkEntry *GetThunkEntry(ALuint index)
+{ return &ThunkChunks[index>>THUNK_CHUNK_BITS][index&THUNK_CHUNK_MASK]; }
+
+/* Pushes the list of entries first...last (already linked through 'next') on
+ * to the free list. */
+static void PushThunkList(ALuint first, ALuint last)
 {
-    RWLockInit(&ThunkLock);
-    ThunkArraySize = 1;
-    ThunkArray = al_calloc(16, ThunkArraySize * sizeof(*ThunkArray));
+    ThunkEntry *tail = GetThunkEntry(last);
+    ALuint head = ATOMIC_LOAD(&ThunkFreeHead);
+    ALuint newhead;
+    do {
+        ATOMIC_STORE(&tail->next, THUNK_HEAD_INDEX(head));
+        newhead = THUNK_HEAD_NEXT(head, first);
+    } while(!ATOMIC_COMPARE_EXCHANGE_WEAK(ALuint, &ThunkFreeHead, &head, newhead));
 }
 
-void ThunkExit(void)
+/* Pops an entry from the free list, returning its index or 0 if empty. */
+static ALuint PopThunkEntry(void)
 {
-    al_free(ThunkArray);
-    ThunkArray = NULL;
-    ThunkArraySize = 0;
+    ALuint head = ATOMIC_LOAD(&ThunkFreeHead);
+    ALuint newhead;
+    ALuint index;
+    do {
+        index = THUNK_HEAD_INDEX(head);
+        if(index == 0) return 0;
+        /* The entry may be popped and reused by another thread before the
+         * exchange, but chunks are never freed so the read is safe, and the
+         * counter will make the exchange fail. */
+        newhead = THUNK_HEAD_NEXT(head, ATOMIC_LOAD(&GetThunkEntry(index)->next));
+    } while(!ATOMIC_COMPARE_EXCHANGE_WEAK(ALuint, &ThunkFreeHead, &head, newhead));
+    return index;
 }
 
-ALenum NewThunkEntry(ALuint *index)
+/* Adds another chunk of entries to the free list, unless another thread got
+ * to it first. */
+static ALenum GrowThunkArray(void)
 {
-    void *NewList;
-    ALuint i;
+    ThunkEntry *chunk;
+    ALuint count, base, first, i;
 
-    ReadLock(&ThunkLock);
-    for(i = 0;i < ThunkArraySize;i++)
+    almtx_lock(&ThunkGrowLock);
+    if(THUNK_HEAD_INDEX(ATOMIC_LOAD(&ThunkFreeHead)) != 0)
     {
-        if(ATOMIC_EXCHANGE(ALenum, &ThunkArray[i], AL_TRUE) == AL_FALSE)
-        {
-            ReadUnlock(&ThunkLock);
-            *index = i+1;
-            return AL_NO_ERROR;
-        }
+        almtx_unlock(&ThunkGrowLock);
+        return AL_NO_ERROR;
     }
-    ReadUnlock(&ThunkLock);
 
-    WriteLock(&ThunkLock);
-    /* Double-check that there's still no free entries, in case another
-     * invocation just came through and increased the size of the array.
-     */
-    for(;i < ThunkArraySize;i++)
+    count = ATOMIC_LOAD(&ThunkChunkCount);
+    if(count >= THUNK_MAX_CHUNKS)
     {
-        if(ATOMIC_EXCHANGE(ALenum, &ThunkArray[i], AL_TRUE) == AL_FALSE)
-        {
-            WriteUnlock(&ThunkLock);
-            *index = i+1;
-            return AL_NO_ERROR;
-        }
+        almtx_unlock(&ThunkGrowLock);
+        ERR("Out of IDs (%u in use)!\n", count<<THUNK_CHUNK_BITS);
+        return AL_OUT_OF_MEMORY;
     }
 
-    NewList = al_calloc(16, ThunkArraySize*2 * sizeof(*ThunkArray));
-    if(!NewList)
+    chunk = al_calloc(16, THUNK_CHUNK_SIZE * sizeof(*chunk));
+    if(!chunk)
     {
-        WriteUnlock(&ThunkLock);
-        ERR("Realloc failed to increase to %u entries!\n", ThunkArraySize*2);
+        almtx_unlock(&ThunkGrowLock);
+        ERR("Failed to allocate %u more entries!\n", THUNK_CHUNK_SIZE);
         return AL_OUT_OF_MEMORY;
     }
-    memcpy(NewList, ThunkArray, ThunkArraySize*sizeof(*ThunkArray));
-    al_free(ThunkArray);
-    ThunkArray = NewList;
-    ThunkArraySize *= 2;
 
-    ATOMIC_STORE(&ThunkArray[i], AL_TRUE);
-    WriteUnlock(&ThunkLock);
+    /* Index 0 is never a valid ID. */
+    base = count << THUNK_CHUNK_BITS;
+    first = (base == 0) ? 1 : base;
+    for(i = 0;i < THUNK_CHUNK_SIZE;i++)
+    {
+        ATOMIC_INIT(&chunk[i].state, 0);
+        ATOMIC_INIT(&chunk[i].next, base+i+1);
+    }
+    ThunkChunks[count] = chunk;
+    ATOMIC_STORE(&ThunkChunkCount, count+1);
+
+    PushThunkList(first, base+THUNK_CHUNK_MASK);
+    almtx_unlock(&ThunkGrowLock);
+
+    return AL_NO_ERROR;
+}
+
+
+void ThunkInit(void)
+{
+    almtx_init(&ThunkGrowLock, almtx_plain);
+    ATOMIC_STORE(&ThunkFreeHead, 0);
+    ATOMIC_STORE(&ThunkChunkCount, 0);
+}
+
+void ThunkExit(void)
+{
+    ALuint count = ATOMIC_EXCHANGE(ALuint, &ThunkChunkCount, 0);
+    ALuint i;
+
+    for(i = 0;i < count;i++)
+    {
+        al_free(ThunkChunks[i]);
+        ThunkChunks[i] = NULL;
+    }
+    ATOMIC_STORE(&ThunkFreeHead, 0);
+    almtx_destroy(&ThunkGrowLock);
+}
+
+ALenum NewThunkEntry(ALuint *index)
+{
+    ThunkEntry *entry;
+    ALuint idx, state;
+
+    while((idx=PopThunkEntry()) == 0)
+    {
+        ALenum err = GrowThunkArray();
+        if(err != AL_NO_ERROR)
+            return err;
+    }
 
-    *index = i+1;
+    entry = GetThunkEntry(idx);
+    state = ATOMIC_LOAD(&entry->state);
+    ATOMIC_STORE(&entry->state, state|1);
+
+    *index = MAKE_HANDLE(idx, state>>1);
     return AL_NO_ERROR;
 }
 
 void FreeThunkEntry(ALuint index)
 {
-    ReadLock(&ThunkLock);
-    if(index > 0 && index <= ThunkArraySize)
-        ATOMIC_STORE(&ThunkArray[index-1], AL_FALSE);
-    ReadUnlock(&ThunkLock);
+    ALuint idx = HANDLE_INDEX(index);
+    ThunkEntry *entry;
+    ALuint state;
+
+    if(idx == 0 || (idx>>THUNK_CHUNK_BITS) >= ATOMIC_LOAD(&ThunkChunkCount))
+        return;
+
+    /* Only release the entry if the handle's generation is current, and bump
+     * the generation for the next handle to use this index. */
+    entry = GetThunkEntry(idx);
+    state = (HANDLE_GEN(index)<<1) | 1;
+    if(ATOMIC_COMPARE_EXCHANGE_STRONG(ALuint, &entry->state, &state,
+                                      ((HANDLE_GEN(index)+1)&HANDLE_GEN_MASK) << 1))
+    {
+        ATOMIC_STORE(&entry->next, 0);
+        PushThunkList(idx, idx);
+    }
 }
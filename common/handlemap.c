@@ -0,0 +1,154 @@
+
+#include "config.h"
+
+#include "handlemap.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "almalloc.h"
+
+
+extern inline ALvoid *LookupHandleMapKey(HandleMap *map, ALuint key);
+extern inline ALsizei GetHandleMapCapacity(HandleMap *map);
+extern inline ALvoid *LookupHandleMapIndex(HandleMap *map, ALsizei idx);
+extern inline void LockHandleMapRead(HandleMap *map);
+extern inline void UnlockHandleMapRead(HandleMap *map);
+extern inline void LockHandleMapWrite(HandleMap *map);
+extern inline void UnlockHandleMapWrite(HandleMap *map);
+
+
+void InitHandleMap(HandleMap *map, ALsizei limit)
+{
+    ATOMIC_INIT(&map->dir, NULL);
+    map->size = 0;
+    map->limit = limit;
+    RWLockInit(&map->lock);
+}
+
+void ResetHandleMap(HandleMap *map)
+{
+    HandleMapDir *dir;
+
+    WriteLock(&map->lock);
+    dir = ATOMIC_EXCHANGE(HandleMapDir*, &map->dir, NULL);
+    if(dir)
+    {
+        ALsizei i;
+        for(i = 0;i < dir->count;i++)
+            al_free(ATOMIC_LOAD(&dir->blocks[i]));
+    }
+    while(dir)
+    {
+        HandleMapDir *prev = dir->prev;
+        al_free(dir);
+        dir = prev;
+    }
+    map->size = 0;
+    WriteUnlock(&map->lock);
+}
+
+/* Must be called with the write lock held. Returns the slot for the given
+ * index, allocating its block (and growing the directory) as needed. */
+static HandleMapSlot *GetHandleMapSlot(HandleMap *map, ALuint idx)
+{
+    HandleMapDir *dir = ATOMIC_LOAD(&map->dir);
+    ALsizei b = idx >> HANDLEMAP_BLOCK_BITS;
+    HandleMapSlot *block;
+
+    if(!dir || b >= dir->count)
+    {
+        HandleMapDir *newdir;
+        ALsizei newcount, i;
+
+        newcount = dir ? dir->count : 1;
+        while(newcount <= b)
+            newcount <<= 1;
+
+        newdir = al_calloc(16, sizeof(*newdir) + newcount*sizeof(newdir->blocks[0]));
+        if(!newdir) return NULL;
+        newdir->prev = dir;
+        newdir->count = newcount;
+        for(i = 0;i < newcount;i++)
+            ATOMIC_INIT(&newdir->blocks[i], (dir && i < dir->count) ?
+                        ATOMIC_LOAD(&dir->blocks[i]) : NULL);
+
+        /* The old directory stays allocated, since readers may still be
+         * looking at it. */
+        ATOMIC_STORE(&map->dir, newdir);
+        dir = newdir;
+    }
+
+    block = ATOMIC_LOAD(&dir->blocks[b]);
+    if(!block)
+    {
+        ALsizei i;
+        block = al_calloc(16, HANDLEMAP_BLOCK_SIZE * sizeof(*block));
+        if(!block) return NULL;
+        for(i = 0;i < HANDLEMAP_BLOCK_SIZE;i++)
+        {
+            ATOMIC_INIT(&block[i].key, 0);
+            ATOMIC_INIT(&block[i].value, NULL);
+        }
+        ATOMIC_STORE(&dir->blocks[b], block);
+    }
+
+    return &block[idx&HANDLEMAP_BLOCK_MASK];
+}
+
+ALenum InsertHandleMapEntry(HandleMap *map, ALuint key, ALvoid *value)
+{
+    HandleMapSlot *slot;
+
+    if(key == 0 || HANDLE_INDEX(key) == 0)
+        return AL_INVALID_VALUE;
+
+    WriteLock(&map->lock);
+    if(map->size == map->limit)
+    {
+        WriteUnlock(&map->lock);
+        return AL_OUT_OF_MEMORY;
+    }
+
+    slot = GetHandleMapSlot(map, HANDLE_INDEX(key));
+    if(!slot)
+    {
+        WriteUnlock(&map->lock);
+        return AL_OUT_OF_MEMORY;
+    }
+
+    if(ATOMIC_LOAD(&slot->value) == NULL)
+        map->size++;
+    /* Set the value before the key, so a reader that sees the new key will
+     * also see the new value. */
+    ATOMIC_STORE(&slot->value, value);
+    ATOMIC_STORE(&slot->key, key);
+    WriteUnlock(&map->lock);
+
+    return AL_NO_ERROR;
+}
+
+ALvoid *RemoveHandleMapKey(HandleMap *map, ALuint key)
+{
+    ALuint idx = HANDLE_INDEX(key);
+    ALvoid *ptr = NULL;
+    HandleMapDir *dir;
+
+    WriteLock(&map->lock);
+    dir = ATOMIC_LOAD(&map->dir);
+    if(key != 0 && dir && (ALsizei)(idx>>HANDLEMAP_BLOCK_BITS) < dir->count)
+    {
+        HandleMapSlot *block = ATOMIC_LOAD(&dir->blocks[idx>>HANDLEMAP_BLOCK_BITS]);
+        HandleMapSlot *slot = block ? &block[idx&HANDLEMAP_BLOCK_MASK] : NULL;
+        if(slot && ATOMIC_LOAD(&slot->key) == key)
+        {
+            /* Clear the key first so new lookups fail before the value goes
+             * away. */
+            ATOMIC_STORE(&slot->key, 0);
+            ptr = ATOMIC_EXCHANGE(ALvoid*, &slot->value, NULL);
+            map->size--;
+        }
+    }
+    WriteUnlock(&map->lock);
+    return ptr;
+}
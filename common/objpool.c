@@ -0,0 +1,205 @@
+
+#include "config.h"
+
+#include "objpool.h"
+
+#include <string.h>
+
+#include "almalloc.h"
+
+
+static ObjectPoolChunk *GetChunkForIndex(ObjectPool *pool, ALuint idx)
+{
+    ALuint i = 0;
+    while(idx >= pool->Chunks[i].Start+pool->Chunks[i].Count)
+        i++;
+    return &pool->Chunks[i];
+}
+
+static ALuint GetIndexForPtr(ObjectPool *pool, const char *ptr)
+{
+    ALuint count = ATOMIC_LOAD(&pool->NumChunks);
+    ALuint i;
+    for(i = 0;i < count;i++)
+    {
+        ObjectPoolChunk *chunk = &pool->Chunks[i];
+        if(ptr >= chunk->Mem && ptr < chunk->Mem + chunk->Count*pool->ObjSize)
+            return chunk->Start + (ALuint)((ptr-chunk->Mem) / pool->ObjSize);
+    }
+    return ~0u;
+}
+
+#define FREE_HEAD_INDEX(h)      ((h) & OBJPOOL_INDEX_MASK)
+#define FREE_HEAD_NEXT(h, idx)  (((((h)>>OBJPOOL_INDEX_BITS)+1)<<OBJPOOL_INDEX_BITS) | (idx))
+
+static ATOMIC(ALuint) *GetNextLink(ObjectPool *pool, ALuint idx)
+{
+    ObjectPoolChunk *chunk = GetChunkForIndex(pool, idx);
+    return &chunk->Next[idx - chunk->Start];
+}
+
+/* Pushes the list of objects first...last (already linked) on to the free
+ * list. */
+static void PushFreeList(ObjectPool *pool, ALuint first, ALuint last)
+{
+    ATOMIC(ALuint) *tail = GetNextLink(pool, last);
+    ALuint head = ATOMIC_LOAD(&pool->FreeHead);
+    ALuint newhead;
+    do {
+        ATOMIC_STORE(tail, FREE_HEAD_INDEX(head));
+        newhead = FREE_HEAD_NEXT(head, first+1);
+    } while(!ATOMIC_COMPARE_EXCHANGE_WEAK(ALuint, &pool->FreeHead, &head, newhead));
+}
+
+/* Pops an object index from the free list, returning ~0 if empty. */
+static ALuint PopFreeList(ObjectPool *pool)
+{
+    ALuint head = ATOMIC_LOAD(&pool->FreeHead);
+    ALuint newhead;
+    ALuint idx;
+    do {
+        idx = FREE_HEAD_INDEX(head);
+        if(idx == 0) return ~0u;
+        idx--;
+        /* Another thread may pop and reuse this object before the exchange,
+         * but chunks are never freed so the read is safe, and the counter
+         * will make the exchange fail. */
+        newhead = FREE_HEAD_NEXT(head, ATOMIC_LOAD(GetNextLink(pool, idx)));
+    } while(!ATOMIC_COMPARE_EXCHANGE_WEAK(ALuint, &pool->FreeHead, &head, newhead));
+    return idx;
+}
+
+/* Adds another chunk of objects to the free list, unless another thread got to
+ * it first. */
+static ALboolean GrowObjectPool(ObjectPool *pool)
+{
+    ObjectPoolChunk *chunk;
+    ALuint count, start, i;
+    char *mem;
+
+    almtx_lock(&pool->GrowLock);
+    if(FREE_HEAD_INDEX(ATOMIC_LOAD(&pool->FreeHead)) != 0)
+    {
+        almtx_unlock(&pool->GrowLock);
+        return AL_TRUE;
+    }
+
+    i = ATOMIC_LOAD(&pool->NumChunks);
+    if(i >= OBJPOOL_MAX_CHUNKS)
+    {
+        almtx_unlock(&pool->GrowLock);
+        return AL_FALSE;
+    }
+    count = pool->ChunkBase << i;
+    start = i ? pool->Chunks[i-1].Start+pool->Chunks[i-1].Count : 0;
+    /* The last object's index plus one has to fit in the free list head. */
+    if(count > OBJPOOL_INDEX_MASK - start)
+    {
+        almtx_unlock(&pool->GrowLock);
+        return AL_FALSE;
+    }
+
+    mem = al_malloc(OBJPOOL_ALIGN, count*pool->ObjSize + count*sizeof(ATOMIC(ALuint)));
+    if(!mem)
+    {
+        almtx_unlock(&pool->GrowLock);
+        return AL_FALSE;
+    }
+    IncrementRef(&pool->NumChunkAllocs);
+
+    chunk = &pool->Chunks[i];
+    chunk->Start = start;
+    chunk->Count = count;
+    chunk->Mem = mem;
+    chunk->Next = (ATOMIC(ALuint)*)(mem + count*pool->ObjSize);
+    for(i = 0;i < count;i++)
+        ATOMIC_INIT(&chunk->Next[i], start+i+2);
+    ATOMIC_ADD(ALuint, &pool->NumChunks, 1);
+
+    PushFreeList(pool, start, start+count-1);
+    almtx_unlock(&pool->GrowLock);
+
+    return AL_TRUE;
+}
+
+
+void InitObjectPool(ObjectPool *pool, size_t objsize, ALuint chunkbase)
+{
+    ALuint i;
+
+    pool->ObjSize = (objsize+(OBJPOOL_ALIGN-1)) & ~(size_t)(OBJPOOL_ALIGN-1);
+    pool->ChunkBase = chunkbase ? chunkbase : 1;
+    for(i = 0;i < OBJPOOL_MAX_CHUNKS;i++)
+    {
+        pool->Chunks[i].Start = 0;
+        pool->Chunks[i].Count = 0;
+        pool->Chunks[i].Mem = NULL;
+        pool->Chunks[i].Next = NULL;
+    }
+    ATOMIC_INIT(&pool->NumChunks, 0);
+    almtx_init(&pool->GrowLock, almtx_plain);
+    ATOMIC_INIT(&pool->FreeHead, 0);
+
+    InitRef(&pool->InUse, 0);
+    InitRef(&pool->NumAllocs, 0);
+    InitRef(&pool->NumChunkAllocs, 0);
+}
+
+void DeinitObjectPool(ObjectPool *pool)
+{
+    ALuint count = ATOMIC_EXCHANGE(ALuint, &pool->NumChunks, 0);
+    ALuint i;
+
+    for(i = 0;i < count;i++)
+    {
+        al_free(pool->Chunks[i].Mem);
+        pool->Chunks[i].Mem = NULL;
+        pool->Chunks[i].Next = NULL;
+        pool->Chunks[i].Count = 0;
+    }
+    ATOMIC_STORE(&pool->FreeHead, 0);
+    almtx_destroy(&pool->GrowLock);
+}
+
+void *ObjectPoolAlloc(ObjectPool *pool)
+{
+    ObjectPoolChunk *chunk;
+    ALuint idx;
+    char *ptr;
+
+    while((idx=PopFreeList(pool)) == ~0u)
+    {
+        if(!GrowObjectPool(pool))
+            return NULL;
+    }
+
+    chunk = GetChunkForIndex(pool, idx);
+    ptr = chunk->Mem + (idx-chunk->Start)*pool->ObjSize;
+    memset(ptr, 0, pool->ObjSize);
+
+    IncrementRef(&pool->InUse);
+    IncrementRef(&pool->NumAllocs);
+    return ptr;
+}
+
+void ObjectPoolFree(ObjectPool *pool, void *ptr)
+{
+    ALuint idx;
+
+    if(!ptr) return;
+    idx = GetIndexForPtr(pool, ptr);
+    if(idx == ~0u) return;
+
+    DecrementRef(&pool->InUse);
+    PushFreeList(pool, idx, idx);
+}
+
+void GetObjectPoolStats(ObjectPool *pool, ObjectPoolStats *stats)
+{
+    ALuint count = ATOMIC_LOAD(&pool->NumChunks);
+
+    stats->Capacity = count ? pool->Chunks[count-1].Start+pool->Chunks[count-1].Count : 0;
+    stats->InUse = ReadRef(&pool->InUse);
+    stats->Allocs = ReadRef(&pool->NumAllocs);
+    stats->ChunkAllocs = ReadRef(&pool->NumChunkAllocs);
+}
@@ -1,4 +1,9 @@
 
+#ifdef __linux__
+/* Needed for syscall(), which is used to wait on futexes. */
+#define _GNU_SOURCE
+#endif
+
 #include "config.h"
 
 #include "rwlock.h"
@@ -7,51 +12,171 @@
 #include "atomic.h"
 #include "threads.h"
 
+#ifdef HAVE_FUTEX
+#include <limits.h>
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+
+#define RWLOCK_READER_MASK  0x0000ffffu
+#define RWLOCK_WAITER_ONE   0x00010000u
+#define RWLOCK_WAITER_MASK  0x3fff0000u
+#define RWLOCK_WRITE_LOCKED 0x40000000u
+#define RWLOCK_SLEEPERS     0x80000000u
+
+/* How many times to retry before putting the thread to sleep. Most critical
+ * sections guarded by these locks are short, so this is usually enough to
+ * avoid a trip through the kernel. */
+#define RWLOCK_SPIN_COUNT 100
+
+
+#ifdef ALSOFT_PROFILING
+static RefCount ReadAcquires = ATOMIC_INIT_STATIC(0);
+static RefCount WriteAcquires = ATOMIC_INIT_STATIC(0);
+static RefCount SpinCount = ATOMIC_INIT_STATIC(0);
+static RefCount SleepCount = ATOMIC_INIT_STATIC(0);
+#define STAT_INC(x) IncrementRef(&(x))
+
+void GetRWLockStats(RWLockStats *stats)
+{
+    stats->ReadAcquires = ReadRef(&ReadAcquires);
+    stats->WriteAcquires = ReadRef(&WriteAcquires);
+    stats->Spins = ReadRef(&SpinCount);
+    stats->Sleeps = ReadRef(&SleepCount);
+}
+#else
+#define STAT_INC(x) ((void)0)
+#endif
 
-/* A simple spinlock. Yield the thread while the given integer is set by
- * another. Could probably be improved... */
-#define LOCK(l) do {                                                          \
-    while(ATOMIC_EXCHANGE(int, &(l), true) == true)                            \
-        althrd_yield();                                                       \
-} while(0)
-#define UNLOCK(l) ATOMIC_STORE(&(l), false)
+
+static inline void CpuRelax(void)
+{
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+    __asm__ __volatile__("pause");
+#elif defined(_MSC_VER) && (defined(_M_IX86) || defined(_M_X64))
+    YieldProcessor();
+#endif
+}
+
+/* Waits for the lock state to change from 'expected', which must include the
+ * sleepers flag. */
+static void WaitForState(RWLock *lock, uint expected)
+{
+    STAT_INC(SleepCount);
+#ifdef HAVE_FUTEX
+    syscall(SYS_futex, (int*)&lock->state, FUTEX_WAIT_PRIVATE, (int)expected, NULL, NULL, 0);
+#else
+    (void)expected;
+    althrd_yield();
+#endif
+}
+
+static void WakeAll(RWLock *lock)
+{
+#ifdef HAVE_FUTEX
+    syscall(SYS_futex, (int*)&lock->state, FUTEX_WAKE_PRIVATE, INT_MAX, NULL, NULL, 0);
+#else
+    (void)lock;
+#endif
+}
+
+/* Spins on the lock for a bit, then flags that a thread is sleeping on it and
+ * goes to sleep. Returns with the lock state to retry with. */
+static uint BackOff(RWLock *lock, uint state, uint *spins)
+{
+    if(*spins < RWLOCK_SPIN_COUNT)
+    {
+        ++*spins;
+        STAT_INC(SpinCount);
+        CpuRelax();
+        return ATOMIC_LOAD(&lock->state);
+    }
+
+    if(!(state&RWLOCK_SLEEPERS))
+    {
+        if(!ATOMIC_COMPARE_EXCHANGE_WEAK(uint, &lock->state, &state, state|RWLOCK_SLEEPERS))
+            return state;
+        state |= RWLOCK_SLEEPERS;
+    }
+    WaitForState(lock, state);
+    return ATOMIC_LOAD(&lock->state);
+}
 
 
 void RWLockInit(RWLock *lock)
 {
-    InitRef(&lock->read_count, 0);
-    InitRef(&lock->write_count, 0);
-    ATOMIC_INIT(&lock->read_lock, false);
-    ATOMIC_INIT(&lock->read_entry_lock, false);
-    ATOMIC_INIT(&lock->write_lock, false);
+    ATOMIC_INIT(&lock->state, 0);
 }
 
 void ReadLock(RWLock *lock)
 {
-    LOCK(lock->read_entry_lock);
-    LOCK(lock->read_lock);
-    if(IncrementRef(&lock->read_count) == 1)
-        LOCK(lock->write_lock);
-    UNLOCK(lock->read_lock);
-    UNLOCK(lock->read_entry_lock);
+    uint state = ATOMIC_LOAD(&lock->state);
+    uint spins = 0;
+
+    for(;;)
+    {
+        if(!(state&(RWLOCK_WRITE_LOCKED|RWLOCK_WAITER_MASK)))
+        {
+            if(ATOMIC_COMPARE_EXCHANGE_WEAK(uint, &lock->state, &state, state+1))
+                break;
+            continue;
+        }
+        state = BackOff(lock, state, &spins);
+    }
+    STAT_INC(ReadAcquires);
 }
 
 void ReadUnlock(RWLock *lock)
 {
-    if(DecrementRef(&lock->read_count) == 0)
-        UNLOCK(lock->write_lock);
+    uint state = ATOMIC_LOAD(&lock->state);
+    uint newstate;
+
+    do {
+        newstate = state - 1;
+        /* The last reader out wakes any sleeping threads. */
+        if((newstate&RWLOCK_READER_MASK) == 0)
+            newstate &= ~RWLOCK_SLEEPERS;
+    } while(!ATOMIC_COMPARE_EXCHANGE_WEAK(uint, &lock->state, &state, newstate));
+
+    if((state&RWLOCK_SLEEPERS) && !(newstate&RWLOCK_SLEEPERS))
+        WakeAll(lock);
 }
 
 void WriteLock(RWLock *lock)
 {
-    if(IncrementRef(&lock->write_count) == 1)
-        LOCK(lock->read_lock);
-    LOCK(lock->write_lock);
+    uint state = 0;
+    uint spins = 0;
+
+    if(!ATOMIC_COMPARE_EXCHANGE_STRONG(uint, &lock->state, &state, RWLOCK_WRITE_LOCKED))
+    {
+        /* Register as a waiting writer, which keeps new readers out until the
+         * lock is acquired. */
+        state = ATOMIC_ADD(uint, &lock->state, RWLOCK_WAITER_ONE) + RWLOCK_WAITER_ONE;
+        for(;;)
+        {
+            if(!(state&(RWLOCK_WRITE_LOCKED|RWLOCK_READER_MASK)))
+            {
+                if(ATOMIC_COMPARE_EXCHANGE_WEAK(uint, &lock->state, &state,
+                        (state-RWLOCK_WAITER_ONE) | RWLOCK_WRITE_LOCKED))
+                    break;
+                continue;
+            }
+            state = BackOff(lock, state, &spins);
+        }
+    }
+    STAT_INC(WriteAcquires);
 }
 
 void WriteUnlock(RWLock *lock)
 {
-    UNLOCK(lock->write_lock);
-    if(DecrementRef(&lock->write_count) == 0)
-        UNLOCK(lock->read_lock);
+    uint state = ATOMIC_LOAD(&lock->state);
+    while(!ATOMIC_COMPARE_EXCHANGE_WEAK(uint, &lock->state, &state,
+                                        state & ~(RWLOCK_WRITE_LOCKED|RWLOCK_SLEEPERS)))
+    {
+    }
+
+    if((state&RWLOCK_SLEEPERS))
+        WakeAll(lock);
 }
@@ -0,0 +1,220 @@
+/*
+ * OpenAL Context Lookup Benchmark
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+/* This file contains a benchmark that has a number of threads make cheap AL
+ * calls on the process-wide current context as fast as they can, and reports
+ * the combined call rate. Every call has to look up and reference the current
+ * context, so this shows how well that scales with the number of threads.
+ * Optionally, the main thread keeps switching the current context between two
+ * while the others run.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "AL/al.h"
+#include "AL/alc.h"
+#include "AL/alext.h"
+
+#include "common/alhelpers.h"
+
+
+#define MAX_THREADS 64
+
+static LPALCLOOPBACKOPENDEVICESOFT alcLoopbackOpenDeviceSOFT;
+
+typedef struct BenchThread {
+    althrd_t thread;
+    volatile int *quit;
+    unsigned long calls;
+    unsigned long failed;
+} BenchThread;
+
+
+static double GetTime(void)
+{
+    struct timespec ts;
+    altimespec_get(&ts, AL_TIME_UTC);
+    return ts.tv_sec + ts.tv_nsec/1000000000.0;
+}
+
+static int BenchProc(void *arg)
+{
+    BenchThread *self = arg;
+
+    while(!*self->quit)
+    {
+        /* Any call works, as long as it needs the current context. */
+        if(alGetInteger(AL_DISTANCE_MODEL) == 0)
+            self->failed++;
+        self->calls++;
+    }
+
+    return 0;
+}
+
+int main(int argc, char *argv[])
+{
+    BenchThread threads[MAX_THREADS];
+    ALCcontext *contexts[2];
+    ALCdevice *device;
+    ALCint attrs[16];
+    ALint numthreads = 4;
+    ALint seconds = 5;
+    ALint swap = 0;
+    volatile int quit = 0;
+    unsigned long calls, failed, swaps;
+    double start, elapsed;
+    ALint i;
+
+    for(i = 1;i < argc;i++)
+    {
+        if(strcmp(argv[i], "-h") == 0 || strcmp(argv[i], "--help") == 0)
+        {
+            fprintf(stderr, "OpenAL Context Lookup Benchmark\n"
+"\n"
+"Usage: %s <options>\n"
+"\n"
+"Available options:\n"
+"  --help/-h                 This help text\n"
+"  -n <count>                Number of calling threads (default 4)\n"
+"  -t <seconds>              Length of the run (default 5 seconds)\n"
+"  --swap                    Keep switching the current context\n",
+                argv[0]
+            );
+            return 1;
+        }
+        else if(i+1 < argc && strcmp(argv[i], "-n") == 0)
+        {
+            i++;
+            numthreads = atoi(argv[i]);
+            if(numthreads < 1 || numthreads > MAX_THREADS)
+            {
+                fprintf(stderr, "Invalid thread count: %s (1 to %d)\n", argv[i], MAX_THREADS);
+                return 1;
+            }
+        }
+        else if(i+1 < argc && strcmp(argv[i], "-t") == 0)
+        {
+            i++;
+            seconds = atoi(argv[i]);
+            if(seconds < 1) seconds = 1;
+        }
+        else if(strcmp(argv[i], "--swap") == 0)
+            swap = 1;
+    }
+
+    if(!alcIsExtensionPresent(NULL, "ALC_SOFT_loopback"))
+    {
+        fprintf(stderr, "Error: ALC_SOFT_loopback not supported!\n");
+        return 1;
+    }
+
+#define LOAD_PROC(x)  ((x) = alcGetProcAddress(NULL, #x))
+    LOAD_PROC(alcLoopbackOpenDeviceSOFT);
+#undef LOAD_PROC
+
+    device = alcLoopbackOpenDeviceSOFT(NULL);
+    if(!device)
+    {
+        fprintf(stderr, "Failed to open loopback device!\n");
+        return 1;
+    }
+
+    i = 0;
+    attrs[i++] = ALC_FORMAT_CHANNELS_SOFT;
+    attrs[i++] = ALC_STEREO_SOFT;
+    attrs[i++] = ALC_FORMAT_TYPE_SOFT;
+    attrs[i++] = ALC_FLOAT_SOFT;
+    attrs[i++] = ALC_FREQUENCY;
+    attrs[i++] = 48000;
+    attrs[i++] = 0;
+
+    contexts[0] = alcCreateContext(device, attrs);
+    contexts[1] = alcCreateContext(device, attrs);
+    if(!contexts[0] || !contexts[1] || alcMakeContextCurrent(contexts[0]) == ALC_FALSE)
+    {
+        fprintf(stderr, "Failed to set a loopback context!\n");
+        if(contexts[0])
+            alcDestroyContext(contexts[0]);
+        if(contexts[1])
+            alcDestroyContext(contexts[1]);
+        alcCloseDevice(device);
+        return 1;
+    }
+
+    printf("Running %d thread%s for %d second%s%s...\n", numthreads,
+           (numthreads==1)?"":"s", seconds, (seconds==1)?"":"s",
+           swap ? ", switching contexts" : "");
+    fflush(stdout);
+
+    for(i = 0;i < numthreads;i++)
+    {
+        threads[i].quit = &quit;
+        threads[i].calls = 0;
+        threads[i].failed = 0;
+        if(althrd_create(&threads[i].thread, BenchProc, &threads[i]) != althrd_success)
+        {
+            fprintf(stderr, "Failed to start thread %d\n", i);
+            return 1;
+        }
+    }
+
+    swaps = 0;
+    start = GetTime();
+    do {
+        if(!swap)
+            al_nssleep(10000000);
+        else
+        {
+            alcMakeContextCurrent(contexts[(swaps+1)&1]);
+            swaps++;
+        }
+        elapsed = GetTime() - start;
+    } while(elapsed < seconds);
+    quit = 1;
+
+    calls = failed = 0;
+    for(i = 0;i < numthreads;i++)
+    {
+        althrd_join(threads[i].thread, NULL);
+        calls += threads[i].calls;
+        failed += threads[i].failed;
+    }
+    elapsed = GetTime() - start;
+
+    printf("%lu calls, %.1f million per second (%.1f ns per call per thread)\n",
+           calls, calls/elapsed/1000000.0, elapsed*numthreads/calls*1000000000.0);
+    if(swap)
+        printf("%lu context switches\n", swaps);
+    if(failed)
+        printf("%lu calls failed to find the current context\n", failed);
+
+    alcMakeContextCurrent(NULL);
+    alcDestroyContext(contexts[0]);
+    alcDestroyContext(contexts[1]);
+    alcCloseDevice(device);
+
+    return failed ? 1 : 0;
+}
@@ -0,0 +1,177 @@
+/*
+ * OpenAL Object Generation Benchmark
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+/* This file contains a benchmark that generates and deletes a large number of
+ * buffers, and reports how long it took. The buffers are made in batches, so
+ * it also shows how the ID allocation cost grows with the number of IDs that
+ * are already in use.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "AL/al.h"
+#include "AL/alc.h"
+#include "AL/alext.h"
+
+#include "common/alhelpers.h"
+
+
+static LPALCLOOPBACKOPENDEVICESOFT alcLoopbackOpenDeviceSOFT;
+
+
+static double GetTime(void)
+{
+    struct timespec ts;
+    altimespec_get(&ts, AL_TIME_UTC);
+    return ts.tv_sec + ts.tv_nsec/1000000000.0;
+}
+
+int main(int argc, char *argv[])
+{
+    ALCcontext *context;
+    ALCdevice *device;
+    ALCint attrs[16];
+    ALuint *buffers;
+    ALint count = 100000;
+    ALint batch = 1000;
+    ALint rounds = 4;
+    double start, gentime, deltime;
+    ALint i, r;
+
+    for(i = 1;i < argc;i++)
+    {
+        if(strcmp(argv[i], "-h") == 0 || strcmp(argv[i], "--help") == 0)
+        {
+            fprintf(stderr, "OpenAL Object Generation Benchmark\n"
+"\n"
+"Usage: %s <options>\n"
+"\n"
+"Available options:\n"
+"  --help/-h                 This help text\n"
+"  -n <count>                Number of buffers to generate (default 100000)\n"
+"  -b <count>                Buffers generated per call (default 1000)\n"
+"  -r <rounds>               Number of times to repeat (default 4)\n",
+                argv[0]
+            );
+            return 1;
+        }
+        else if(i+1 < argc && strcmp(argv[i], "-n") == 0)
+        {
+            i++;
+            count = atoi(argv[i]);
+            if(count < 1) count = 1;
+        }
+        else if(i+1 < argc && strcmp(argv[i], "-b") == 0)
+        {
+            i++;
+            batch = atoi(argv[i]);
+            if(batch < 1) batch = 1;
+        }
+        else if(i+1 < argc && strcmp(argv[i], "-r") == 0)
+        {
+            i++;
+            rounds = atoi(argv[i]);
+            if(rounds < 1) rounds = 1;
+        }
+    }
+    if(batch > count)
+        batch = count;
+
+    if(!alcIsExtensionPresent(NULL, "ALC_SOFT_loopback"))
+    {
+        fprintf(stderr, "Error: ALC_SOFT_loopback not supported!\n");
+        return 1;
+    }
+
+#define LOAD_PROC(x)  ((x) = alcGetProcAddress(NULL, #x))
+    LOAD_PROC(alcLoopbackOpenDeviceSOFT);
+#undef LOAD_PROC
+
+    /* A loopback device is used so nothing needs to be played. */
+    device = alcLoopbackOpenDeviceSOFT(NULL);
+    if(!device)
+    {
+        fprintf(stderr, "Failed to open loopback device!\n");
+        return 1;
+    }
+
+    i = 0;
+    attrs[i++] = ALC_FORMAT_CHANNELS_SOFT;
+    attrs[i++] = ALC_STEREO_SOFT;
+    attrs[i++] = ALC_FORMAT_TYPE_SOFT;
+    attrs[i++] = ALC_FLOAT_SOFT;
+    attrs[i++] = ALC_FREQUENCY;
+    attrs[i++] = 48000;
+    attrs[i++] = 0;
+
+    context = alcCreateContext(device, attrs);
+    if(!context || alcMakeContextCurrent(context) == ALC_FALSE)
+    {
+        fprintf(stderr, "Failed to set a loopback context!\n");
+        if(context)
+            alcDestroyContext(context);
+        alcCloseDevice(device);
+        return 1;
+    }
+
+    printf("Generating and deleting %d buffer%s in batches of %d, %d time%s...\n",
+           count, (count==1)?"":"s", batch, rounds, (rounds==1)?"":"s");
+    fflush(stdout);
+
+    buffers = calloc(count, sizeof(ALuint));
+    for(r = 0;r < rounds;r++)
+    {
+        start = GetTime();
+        for(i = 0;i < count;i += batch)
+            alGenBuffers((count-i < batch) ? count-i : batch, buffers+i);
+        gentime = GetTime() - start;
+        if(alGetError() != AL_NO_ERROR)
+        {
+            fprintf(stderr, "Failed to generate %d buffers\n", count);
+            break;
+        }
+
+        start = GetTime();
+        for(i = 0;i < count;i += batch)
+            alDeleteBuffers((count-i < batch) ? count-i : batch, buffers+i);
+        deltime = GetTime() - start;
+        if(alGetError() != AL_NO_ERROR)
+        {
+            fprintf(stderr, "Failed to delete %d buffers\n", count);
+            break;
+        }
+
+        printf("Round %d: generate %.1f ms (%.1f ns each), delete %.1f ms (%.1f ns each)\n",
+               r+1, gentime*1000.0, gentime/count*1000000000.0,
+               deltime*1000.0, deltime/count*1000000000.0);
+    }
+    free(buffers);
+
+    alcMakeContextCurrent(NULL);
+    alcDestroyContext(context);
+    alcCloseDevice(device);
+
+    return 0;
+}
@@ -0,0 +1,215 @@
+/*
+ * OpenAL Output Conversion Benchmark
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+/* This file contains a benchmark that renders silence through a loopback
+ * device as fast as it can, and reports how long it took. With nothing
+ * playing, most of the time is spent converting the mix to the output
+ * format, so this compares output conversion costs. Run it with the
+ * disable-cpu-exts config option set to sse2 to time the scalar conversion,
+ * and with the dither option to include 16-bit dithering.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "AL/al.h"
+#include "AL/alc.h"
+#include "AL/alext.h"
+
+#include "common/alhelpers.h"
+
+
+static LPALCLOOPBACKOPENDEVICESOFT alcLoopbackOpenDeviceSOFT;
+static LPALCISRENDERFORMATSUPPORTEDSOFT alcIsRenderFormatSupportedSOFT;
+static LPALCRENDERSAMPLESSOFT alcRenderSamplesSOFT;
+
+
+static double GetTime(void)
+{
+    struct timespec ts;
+    altimespec_get(&ts, AL_TIME_UTC);
+    return ts.tv_sec + ts.tv_nsec/1000000000.0;
+}
+
+int main(int argc, char *argv[])
+{
+    ALCcontext *context;
+    ALCdevice *device;
+    ALCint attrs[16];
+    ALCenum chans = ALC_7POINT1_SOFT;
+    ALCenum type = ALC_SHORT_SOFT;
+    ALint numchans = 8;
+    ALint typesize = 2;
+    ALint seconds = 60;
+    ALint srate = 96000;
+    ALint update = 1024;
+    void *output;
+    double start, elapsed;
+    ALint i;
+
+    for(i = 1;i < argc;i++)
+    {
+        if(strcmp(argv[i], "-h") == 0 || strcmp(argv[i], "--help") == 0)
+        {
+            fprintf(stderr, "OpenAL Output Conversion Benchmark\n"
+"\n"
+"Usage: %s <options>\n"
+"\n"
+"Available options:\n"
+"  --help/-h                 This help text\n"
+"  -c <channels>             Output channel count: 2, 6, or 8 (default 8)\n"
+"  --type/-f <type>          Output sample type: short, int, or float\n"
+"                            (default short)\n"
+"  -t <seconds>              Length of audio to render (default 60 seconds)\n"
+"  --srate/-s <sample rate>  Output sampling rate (default 96000 hz)\n"
+"  --update/-u <samples>     Samples rendered per call (default 1024)\n",
+                argv[0]
+            );
+            return 1;
+        }
+        else if(i+1 < argc && strcmp(argv[i], "-c") == 0)
+        {
+            i++;
+            numchans = atoi(argv[i]);
+            if(numchans == 2)
+                chans = ALC_STEREO_SOFT;
+            else if(numchans == 6)
+                chans = ALC_5POINT1_SOFT;
+            else if(numchans == 8)
+                chans = ALC_7POINT1_SOFT;
+            else
+            {
+                fprintf(stderr, "Invalid channel count: %s (2, 6, or 8)\n", argv[i]);
+                return 1;
+            }
+        }
+        else if(i+1 < argc && (strcmp(argv[i], "--type") == 0 || strcmp(argv[i], "-f") == 0))
+        {
+            i++;
+            if(strcmp(argv[i], "short") == 0)
+            {
+                type = ALC_SHORT_SOFT;
+                typesize = 2;
+            }
+            else if(strcmp(argv[i], "int") == 0)
+            {
+                type = ALC_INT_SOFT;
+                typesize = 4;
+            }
+            else if(strcmp(argv[i], "float") == 0)
+            {
+                type = ALC_FLOAT_SOFT;
+                typesize = 4;
+            }
+            else
+            {
+                fprintf(stderr, "Invalid sample type: %s (short, int, or float)\n", argv[i]);
+                return 1;
+            }
+        }
+        else if(i+1 < argc && strcmp(argv[i], "-t") == 0)
+        {
+            i++;
+            seconds = atoi(argv[i]);
+            if(seconds < 1) seconds = 1;
+        }
+        else if(i+1 < argc && (strcmp(argv[i], "--srate") == 0 || strcmp(argv[i], "-s") == 0))
+        {
+            i++;
+            srate = atoi(argv[i]);
+            if(srate < 8000) srate = 8000;
+        }
+        else if(i+1 < argc && (strcmp(argv[i], "--update") == 0 || strcmp(argv[i], "-u") == 0))
+        {
+            i++;
+            update = atoi(argv[i]);
+            if(update < 1) update = 1;
+        }
+    }
+
+    if(!alcIsExtensionPresent(NULL, "ALC_SOFT_loopback"))
+    {
+        fprintf(stderr, "Error: ALC_SOFT_loopback not supported!\n");
+        return 1;
+    }
+
+#define LOAD_PROC(x)  ((x) = alcGetProcAddress(NULL, #x))
+    LOAD_PROC(alcLoopbackOpenDeviceSOFT);
+    LOAD_PROC(alcIsRenderFormatSupportedSOFT);
+    LOAD_PROC(alcRenderSamplesSOFT);
+#undef LOAD_PROC
+
+    device = alcLoopbackOpenDeviceSOFT(NULL);
+    if(!device)
+    {
+        fprintf(stderr, "Failed to open loopback device!\n");
+        return 1;
+    }
+
+    i = 0;
+    attrs[i++] = ALC_FORMAT_CHANNELS_SOFT;
+    attrs[i++] = chans;
+    attrs[i++] = ALC_FORMAT_TYPE_SOFT;
+    attrs[i++] = type;
+    attrs[i++] = ALC_FREQUENCY;
+    attrs[i++] = srate;
+    attrs[i++] = 0;
+
+    if(alcIsRenderFormatSupportedSOFT(device, srate, chans, type) == ALC_FALSE)
+    {
+        fprintf(stderr, "Render format not supported!\n");
+        alcCloseDevice(device);
+        return 1;
+    }
+
+    context = alcCreateContext(device, attrs);
+    if(!context || alcMakeContextCurrent(context) == ALC_FALSE)
+    {
+        fprintf(stderr, "Failed to set a loopback context!\n");
+        if(context)
+            alcDestroyContext(context);
+        alcCloseDevice(device);
+        return 1;
+    }
+
+    printf("Rendering %d second%s of %d channel%s at %dhz, %d samples per update...\n",
+           seconds, (seconds==1)?"":"s", numchans, (numchans==1)?"":"s", srate, update);
+    fflush(stdout);
+
+    output = malloc(update * numchans * typesize);
+    start = GetTime();
+    for(i = 0;i < seconds*srate/update;i++)
+        alcRenderSamplesSOFT(device, output, update);
+    elapsed = GetTime() - start;
+    free(output);
+
+    printf("Took %.1f ms, %.1fx realtime (%.3f%% of a core)\n",
+           elapsed*1000.0, seconds/elapsed, elapsed/seconds*100.0);
+
+    alcMakeContextCurrent(NULL);
+    alcDestroyContext(context);
+    alcCloseDevice(device);
+
+    return 0;
+}
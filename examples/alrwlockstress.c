@@ -0,0 +1,213 @@
+/*
+ * OpenAL RWLock Stress Test
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+/* This file contains a stress test for the library's internal reader/writer
+ * lock. A number of threads repeatedly take the lock, mostly for reading and
+ * sometimes for writing, and check that no reader ever runs alongside a
+ * writer, that writers never run alongside each other, and that no write is
+ * lost. It links against the common helper library directly, rather than
+ * going through the AL API.
+ */
+
+#include "config.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "rwlock.h"
+#include "atomic.h"
+#include "threads.h"
+
+
+#define MAX_THREADS 64
+
+typedef struct StressState {
+    RWLock lock;
+
+    /* Threads currently holding the lock for reading and for writing. */
+    ATOMIC(uint) readers;
+    ATOMIC(uint) writers;
+
+    /* Written together under the write lock, so a reader should always see
+     * them equal. */
+    volatile uint value1;
+    volatile uint value2;
+
+    ATOMIC(uint) errors;
+} StressState;
+
+typedef struct StressThread {
+    StressState *state;
+    althrd_t thread;
+    uint seed;
+    uint iterations;
+    uint writepct;
+    uint writes;
+} StressThread;
+
+
+static double GetTime(void)
+{
+    struct timespec ts;
+    altimespec_get(&ts, AL_TIME_UTC);
+    return ts.tv_sec + ts.tv_nsec/1000000000.0;
+}
+
+static int StressProc(void *arg)
+{
+    StressThread *self = arg;
+    StressState *state = self->state;
+    uint i;
+
+    for(i = 0;i < self->iterations;i++)
+    {
+        self->seed = (self->seed*96314165) + 907633515;
+        if((self->seed>>16)%100 < self->writepct)
+        {
+            WriteLock(&state->lock);
+            if(ATOMIC_ADD(uint, &state->writers, 1) != 0 ||
+               ATOMIC_LOAD(&state->readers) != 0)
+                ATOMIC_ADD(uint, &state->errors, 1);
+            state->value1 = state->value1 + 1;
+            althrd_yield();
+            state->value2 = state->value2 + 1;
+            ATOMIC_SUB(uint, &state->writers, 1);
+            WriteUnlock(&state->lock);
+            self->writes++;
+        }
+        else
+        {
+            ReadLock(&state->lock);
+            ATOMIC_ADD(uint, &state->readers, 1);
+            if(ATOMIC_LOAD(&state->writers) != 0 || state->value1 != state->value2)
+                ATOMIC_ADD(uint, &state->errors, 1);
+            ATOMIC_SUB(uint, &state->readers, 1);
+            ReadUnlock(&state->lock);
+        }
+    }
+
+    return 0;
+}
+
+int main(int argc, char *argv[])
+{
+    StressThread threads[MAX_THREADS];
+    StressState state;
+    int numthreads = 16;
+    int iterations = 100000;
+    int writepct = 10;
+    uint writes, errors;
+    double start, elapsed;
+    int i;
+
+    for(i = 1;i < argc;i++)
+    {
+        if(strcmp(argv[i], "-h") == 0 || strcmp(argv[i], "--help") == 0)
+        {
+            fprintf(stderr, "OpenAL RWLock Stress Test\n"
+"\n"
+"Usage: %s <options>\n"
+"\n"
+"Available options:\n"
+"  --help/-h                 This help text\n"
+"  -n <count>                Number of threads (default 16)\n"
+"  -i <count>                Lock operations per thread (default 100000)\n"
+"  -w <percent>              Percentage of operations that write (default 10)\n",
+                argv[0]
+            );
+            return 1;
+        }
+        else if(i+1 < argc && strcmp(argv[i], "-n") == 0)
+        {
+            i++;
+            numthreads = atoi(argv[i]);
+            if(numthreads < 1 || numthreads > MAX_THREADS)
+            {
+                fprintf(stderr, "Invalid thread count: %s (1 to %d)\n", argv[i], MAX_THREADS);
+                return 1;
+            }
+        }
+        else if(i+1 < argc && strcmp(argv[i], "-i") == 0)
+        {
+            i++;
+            iterations = atoi(argv[i]);
+            if(iterations < 1) iterations = 1;
+        }
+        else if(i+1 < argc && strcmp(argv[i], "-w") == 0)
+        {
+            i++;
+            writepct = atoi(argv[i]);
+            if(writepct < 0) writepct = 0;
+            else if(writepct > 100) writepct = 100;
+        }
+    }
+
+    RWLockInit(&state.lock);
+    ATOMIC_INIT(&state.readers, 0);
+    ATOMIC_INIT(&state.writers, 0);
+    state.value1 = 0;
+    state.value2 = 0;
+    ATOMIC_INIT(&state.errors, 0);
+
+    printf("Running %d thread%s, %d operations each, %d%% writes...\n",
+           numthreads, (numthreads==1)?"":"s", iterations, writepct);
+    fflush(stdout);
+
+    start = GetTime();
+    for(i = 0;i < numthreads;i++)
+    {
+        threads[i].state = &state;
+        threads[i].seed = 22222 + (uint)i*7919;
+        threads[i].iterations = iterations;
+        threads[i].writepct = writepct;
+        threads[i].writes = 0;
+        if(althrd_create(&threads[i].thread, StressProc, &threads[i]) != althrd_success)
+        {
+            fprintf(stderr, "Failed to start thread %d\n", i);
+            return 1;
+        }
+    }
+
+    writes = 0;
+    for(i = 0;i < numthreads;i++)
+    {
+        althrd_join(threads[i].thread, NULL);
+        writes += threads[i].writes;
+    }
+    elapsed = GetTime() - start;
+
+    errors = ATOMIC_LOAD(&state.errors);
+    if(state.value1 != writes || state.value2 != writes)
+    {
+        fprintf(stderr, "Lost writes: expected %u, got %u and %u\n", writes,
+                state.value1, state.value2);
+        errors++;
+    }
+
+    printf("Took %.1f ms, %.1f ns per operation, %u write%s, %u error%s\n",
+           elapsed*1000.0, elapsed/((double)numthreads*iterations)*1000000000.0,
+           writes, (writes==1)?"":"s", errors, (errors==1)?"":"s");
+
+    return errors ? 1 : 0;
+}
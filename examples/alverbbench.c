@@ -0,0 +1,245 @@
+/*
+ * OpenAL Reverb Benchmark
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+/* This file contains a benchmark that renders a number of sources, each
+ * feeding its own EAX reverb slot, through a loopback device as fast as it
+ * can, and reports how long it took. Run it with different effect-threads
+ * config settings to compare serial and parallel effect slot processing. As
+ * the default device only allows 4 effect slots, the slots config option
+ * needs to be raised to use more.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "AL/al.h"
+#include "AL/alc.h"
+#include "AL/alext.h"
+#include "AL/efx.h"
+
+#include "common/alhelpers.h"
+
+
+#define MAX_VERBS 64
+
+static LPALCLOOPBACKOPENDEVICESOFT alcLoopbackOpenDeviceSOFT;
+static LPALCRENDERSAMPLESSOFT alcRenderSamplesSOFT;
+
+static LPALGENEFFECTS alGenEffects;
+static LPALDELETEEFFECTS alDeleteEffects;
+static LPALEFFECTI alEffecti;
+static LPALEFFECTF alEffectf;
+
+static LPALGENAUXILIARYEFFECTSLOTS alGenAuxiliaryEffectSlots;
+static LPALDELETEAUXILIARYEFFECTSLOTS alDeleteAuxiliaryEffectSlots;
+static LPALAUXILIARYEFFECTSLOTI alAuxiliaryEffectSloti;
+
+
+static double GetTime(void)
+{
+    struct timespec ts;
+    altimespec_get(&ts, AL_TIME_UTC);
+    return ts.tv_sec + ts.tv_nsec/1000000000.0;
+}
+
+int main(int argc, char *argv[])
+{
+    ALuint sources[MAX_VERBS], slots[MAX_VERBS], effects[MAX_VERBS];
+    ALfloat *data, *output;
+    ALCcontext *context;
+    ALCdevice *device;
+    ALCint attrs[16];
+    ALint numverbs = 8;
+    ALint seconds = 20;
+    ALint srate = 48000;
+    ALint update = 1024;
+    ALuint buffer, seed;
+    double start, elapsed;
+    ALint i;
+
+    for(i = 1;i < argc;i++)
+    {
+        if(strcmp(argv[i], "-h") == 0 || strcmp(argv[i], "--help") == 0)
+        {
+            fprintf(stderr, "OpenAL Reverb Benchmark\n"
+"\n"
+"Usage: %s <options>\n"
+"\n"
+"Available options:\n"
+"  --help/-h                 This help text\n"
+"  -n <count>                Number of reverb slots (default 8)\n"
+"  -t <seconds>              Length of audio to render (default 20 seconds)\n"
+"  --srate/-s <sample rate>  Output sampling rate (default 48000 hz)\n"
+"  --update/-u <samples>     Samples rendered per call (default 1024)\n",
+                argv[0]
+            );
+            return 1;
+        }
+        else if(i+1 < argc && strcmp(argv[i], "-n") == 0)
+        {
+            i++;
+            numverbs = atoi(argv[i]);
+            if(numverbs < 1 || numverbs > MAX_VERBS)
+            {
+                fprintf(stderr, "Invalid slot count: %s (1 to %d)\n", argv[i], MAX_VERBS);
+                return 1;
+            }
+        }
+        else if(i+1 < argc && strcmp(argv[i], "-t") == 0)
+        {
+            i++;
+            seconds = atoi(argv[i]);
+            if(seconds < 1) seconds = 1;
+        }
+        else if(i+1 < argc && (strcmp(argv[i], "--srate") == 0 || strcmp(argv[i], "-s") == 0))
+        {
+            i++;
+            srate = atoi(argv[i]);
+            if(srate < 8000) srate = 8000;
+        }
+        else if(i+1 < argc && (strcmp(argv[i], "--update") == 0 || strcmp(argv[i], "-u") == 0))
+        {
+            i++;
+            update = atoi(argv[i]);
+            if(update < 1) update = 1;
+        }
+    }
+
+    if(!alcIsExtensionPresent(NULL, "ALC_SOFT_loopback"))
+    {
+        fprintf(stderr, "Error: ALC_SOFT_loopback not supported!\n");
+        return 1;
+    }
+
+#define LOAD_PROC(x)  ((x) = alcGetProcAddress(NULL, #x))
+    LOAD_PROC(alcLoopbackOpenDeviceSOFT);
+    LOAD_PROC(alcRenderSamplesSOFT);
+#undef LOAD_PROC
+
+    device = alcLoopbackOpenDeviceSOFT(NULL);
+    if(!device)
+    {
+        fprintf(stderr, "Failed to open loopback device!\n");
+        return 1;
+    }
+
+    i = 0;
+    attrs[i++] = ALC_FORMAT_CHANNELS_SOFT;
+    attrs[i++] = ALC_STEREO_SOFT;
+    attrs[i++] = ALC_FORMAT_TYPE_SOFT;
+    attrs[i++] = ALC_FLOAT_SOFT;
+    attrs[i++] = ALC_FREQUENCY;
+    attrs[i++] = srate;
+    attrs[i++] = 0;
+
+    context = alcCreateContext(device, attrs);
+    if(!context || alcMakeContextCurrent(context) == ALC_FALSE)
+    {
+        fprintf(stderr, "Failed to set a loopback context!\n");
+        if(context)
+            alcDestroyContext(context);
+        alcCloseDevice(device);
+        return 1;
+    }
+
+#define LOAD_PROC(x)  ((x) = alGetProcAddress(#x))
+    LOAD_PROC(alGenEffects);
+    LOAD_PROC(alDeleteEffects);
+    LOAD_PROC(alEffecti);
+    LOAD_PROC(alEffectf);
+    LOAD_PROC(alGenAuxiliaryEffectSlots);
+    LOAD_PROC(alDeleteAuxiliaryEffectSlots);
+    LOAD_PROC(alAuxiliaryEffectSloti);
+#undef LOAD_PROC
+
+    /* One second of white noise for the sources to loop. */
+    data = malloc(srate * sizeof(ALfloat));
+    seed = 22222;
+    for(i = 0;i < srate;i++)
+    {
+        seed = (seed*96314165) + 907633515;
+        data[i] = ((ALint)seed / 2147483648.0f) * 0.25f;
+    }
+    buffer = 0;
+    alGenBuffers(1, &buffer);
+    alBufferData(buffer, AL_FORMAT_MONO_FLOAT32, data, srate*sizeof(ALfloat), srate);
+    free(data);
+
+    alGenAuxiliaryEffectSlots(numverbs, slots);
+    if(alGetError() != AL_NO_ERROR)
+    {
+        fprintf(stderr, "Failed to create %d effect slots (check the slots config option)\n",
+                numverbs);
+        alDeleteBuffers(1, &buffer);
+        alcMakeContextCurrent(NULL);
+        alcDestroyContext(context);
+        alcCloseDevice(device);
+        return 1;
+    }
+    alGenEffects(numverbs, effects);
+    alGenSources(numverbs, sources);
+    for(i = 0;i < numverbs;i++)
+    {
+        /* Give each reverb a different decay, so they aren't all the same. */
+        alEffecti(effects[i], AL_EFFECT_TYPE, AL_EFFECT_EAXREVERB);
+        alEffectf(effects[i], AL_EAXREVERB_DECAY_TIME, 1.0f + i*0.5f);
+        alAuxiliaryEffectSloti(slots[i], AL_EFFECTSLOT_EFFECT, effects[i]);
+
+        alSourcei(sources[i], AL_BUFFER, buffer);
+        alSourcei(sources[i], AL_LOOPING, AL_TRUE);
+        alSource3f(sources[i], AL_POSITION, (ALfloat)(i*2 - numverbs) / numverbs, 0.0f, -1.0f);
+        alSource3i(sources[i], AL_AUXILIARY_SEND_FILTER, slots[i], 0, AL_FILTER_NULL);
+    }
+    if(alGetError() != AL_NO_ERROR)
+    {
+        fprintf(stderr, "Failed to set up the reverbs\n");
+        return 1;
+    }
+    alSourcePlayv(numverbs, sources);
+
+    printf("Rendering %d second%s with %d reverb%s at %dhz, %d samples per update...\n",
+           seconds, (seconds==1)?"":"s", numverbs, (numverbs==1)?"":"s", srate, update);
+    fflush(stdout);
+
+    output = malloc(update * 2 * sizeof(ALfloat));
+    start = GetTime();
+    for(i = 0;i < seconds*srate/update;i++)
+        alcRenderSamplesSOFT(device, output, update);
+    elapsed = GetTime() - start;
+    free(output);
+
+    printf("Took %.1f ms, %.1fx realtime (%.2f%% of a core per reverb)\n",
+           elapsed*1000.0, seconds/elapsed, elapsed/seconds/numverbs*100.0);
+
+    alDeleteSources(numverbs, sources);
+    alDeleteAuxiliaryEffectSlots(numverbs, slots);
+    alDeleteEffects(numverbs, effects);
+    alDeleteBuffers(1, &buffer);
+
+    alcMakeContextCurrent(NULL);
+    alcDestroyContext(context);
+    alcCloseDevice(device);
+
+    return 0;
+}
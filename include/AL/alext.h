@@ -431,6 +431,316 @@ ALC_API ALCboolean ALC_APIENTRY alcResetDeviceSOFT(ALCdevice *device, const ALCi
 #endif
 #endif
 
+#ifndef ALC_SOFTX_output_limiter
+#define ALC_SOFTX_output_limiter 1
+#define ALC_OUTPUT_LIMITER_SOFTX                 0x199A
+#define ALC_OUTPUT_LIMITER_GAIN_REDUCTION_SOFTX  0x199B
+#endif
+
+#ifndef AL_SOFTX_direct_context
+#define AL_SOFTX_direct_context 1
+typedef ALvoid (AL_APIENTRY*LPALENABLEDIRECT)(ALCcontext*,ALenum);
+typedef ALvoid (AL_APIENTRY*LPALDISABLEDIRECT)(ALCcontext*,ALenum);
+typedef ALboolean (AL_APIENTRY*LPALISENABLEDDIRECT)(ALCcontext*,ALenum);
+typedef const ALchar* (AL_APIENTRY*LPALGETSTRINGDIRECT)(ALCcontext*,ALenum);
+typedef ALvoid (AL_APIENTRY*LPALGETBOOLEANVDIRECT)(ALCcontext*,ALenum,ALboolean*);
+typedef ALvoid (AL_APIENTRY*LPALGETINTEGERVDIRECT)(ALCcontext*,ALenum,ALint*);
+typedef ALvoid (AL_APIENTRY*LPALGETFLOATVDIRECT)(ALCcontext*,ALenum,ALfloat*);
+typedef ALvoid (AL_APIENTRY*LPALGETDOUBLEVDIRECT)(ALCcontext*,ALenum,ALdouble*);
+typedef ALboolean (AL_APIENTRY*LPALGETBOOLEANDIRECT)(ALCcontext*,ALenum);
+typedef ALint (AL_APIENTRY*LPALGETINTEGERDIRECT)(ALCcontext*,ALenum);
+typedef ALfloat (AL_APIENTRY*LPALGETFLOATDIRECT)(ALCcontext*,ALenum);
+typedef ALdouble (AL_APIENTRY*LPALGETDOUBLEDIRECT)(ALCcontext*,ALenum);
+typedef ALenum (AL_APIENTRY*LPALGETERRORDIRECT)(ALCcontext*);
+typedef ALboolean (AL_APIENTRY*LPALISEXTENSIONPRESENTDIRECT)(ALCcontext*,const ALchar*);
+typedef ALvoid* (AL_APIENTRY*LPALGETPROCADDRESSDIRECT)(ALCcontext*,const ALchar*);
+typedef ALenum (AL_APIENTRY*LPALGETENUMVALUEDIRECT)(ALCcontext*,const ALchar*);
+typedef ALvoid (AL_APIENTRY*LPALLISTENERFDIRECT)(ALCcontext*,ALenum,ALfloat);
+typedef ALvoid (AL_APIENTRY*LPALLISTENER3FDIRECT)(ALCcontext*,ALenum,ALfloat,ALfloat,ALfloat);
+typedef ALvoid (AL_APIENTRY*LPALLISTENERFVDIRECT)(ALCcontext*,ALenum,const ALfloat*);
+typedef ALvoid (AL_APIENTRY*LPALLISTENERIDIRECT)(ALCcontext*,ALenum,ALint);
+typedef void (AL_APIENTRY*LPALLISTENER3IDIRECT)(ALCcontext*,ALenum,ALint,ALint,ALint);
+typedef void (AL_APIENTRY*LPALLISTENERIVDIRECT)(ALCcontext*,ALenum,const ALint*);
+typedef ALvoid (AL_APIENTRY*LPALGETLISTENERFDIRECT)(ALCcontext*,ALenum,ALfloat*);
+typedef ALvoid (AL_APIENTRY*LPALGETLISTENER3FDIRECT)(ALCcontext*,ALenum,ALfloat*,ALfloat*,ALfloat*);
+typedef ALvoid (AL_APIENTRY*LPALGETLISTENERFVDIRECT)(ALCcontext*,ALenum,ALfloat*);
+typedef ALvoid (AL_APIENTRY*LPALGETLISTENERIDIRECT)(ALCcontext*,ALenum,ALint*);
+typedef void (AL_APIENTRY*LPALGETLISTENER3IDIRECT)(ALCcontext*,ALenum,ALint*,ALint*,ALint*);
+typedef void (AL_APIENTRY*LPALGETLISTENERIVDIRECT)(ALCcontext*,ALenum,ALint*);
+typedef ALvoid (AL_APIENTRY*LPALGENSOURCESDIRECT)(ALCcontext*,ALsizei,ALuint*);
+typedef ALvoid (AL_APIENTRY*LPALDELETESOURCESDIRECT)(ALCcontext*,ALsizei,const ALuint*);
+typedef ALboolean (AL_APIENTRY*LPALISSOURCEDIRECT)(ALCcontext*,ALuint);
+typedef ALvoid (AL_APIENTRY*LPALSOURCEFDIRECT)(ALCcontext*,ALuint,ALenum,ALfloat);
+typedef ALvoid (AL_APIENTRY*LPALSOURCE3FDIRECT)(ALCcontext*,ALuint,ALenum,ALfloat,ALfloat,ALfloat);
+typedef ALvoid (AL_APIENTRY*LPALSOURCEFVDIRECT)(ALCcontext*,ALuint,ALenum,const ALfloat*);
+typedef ALvoid (AL_APIENTRY*LPALSOURCEIDIRECT)(ALCcontext*,ALuint,ALenum,ALint);
+typedef void (AL_APIENTRY*LPALSOURCE3IDIRECT)(ALCcontext*,ALuint,ALenum,ALint,ALint,ALint);
+typedef void (AL_APIENTRY*LPALSOURCEIVDIRECT)(ALCcontext*,ALuint,ALenum,const ALint*);
+typedef ALvoid (AL_APIENTRY*LPALGETSOURCEFDIRECT)(ALCcontext*,ALuint,ALenum,ALfloat*);
+typedef ALvoid (AL_APIENTRY*LPALGETSOURCE3FDIRECT)(ALCcontext*,ALuint,ALenum,ALfloat*,ALfloat*,ALfloat*);
+typedef ALvoid (AL_APIENTRY*LPALGETSOURCEFVDIRECT)(ALCcontext*,ALuint,ALenum,ALfloat*);
+typedef ALvoid (AL_APIENTRY*LPALGETSOURCEIDIRECT)(ALCcontext*,ALuint,ALenum,ALint*);
+typedef void (AL_APIENTRY*LPALGETSOURCE3IDIRECT)(ALCcontext*,ALuint,ALenum,ALint*,ALint*,ALint*);
+typedef void (AL_APIENTRY*LPALGETSOURCEIVDIRECT)(ALCcontext*,ALuint,ALenum,ALint*);
+typedef ALvoid (AL_APIENTRY*LPALSOURCEPLAYVDIRECT)(ALCcontext*,ALsizei,const ALuint*);
+typedef ALvoid (AL_APIENTRY*LPALSOURCESTOPVDIRECT)(ALCcontext*,ALsizei,const ALuint*);
+typedef ALvoid (AL_APIENTRY*LPALSOURCEREWINDVDIRECT)(ALCcontext*,ALsizei,const ALuint*);
+typedef ALvoid (AL_APIENTRY*LPALSOURCEPAUSEVDIRECT)(ALCcontext*,ALsizei,const ALuint*);
+typedef ALvoid (AL_APIENTRY*LPALSOURCEPLAYDIRECT)(ALCcontext*,ALuint);
+typedef ALvoid (AL_APIENTRY*LPALSOURCESTOPDIRECT)(ALCcontext*,ALuint);
+typedef ALvoid (AL_APIENTRY*LPALSOURCEREWINDDIRECT)(ALCcontext*,ALuint);
+typedef ALvoid (AL_APIENTRY*LPALSOURCEPAUSEDIRECT)(ALCcontext*,ALuint);
+typedef ALvoid (AL_APIENTRY*LPALSOURCEQUEUEBUFFERSDIRECT)(ALCcontext*,ALuint,ALsizei,const ALuint*);
+typedef ALvoid (AL_APIENTRY*LPALSOURCEUNQUEUEBUFFERSDIRECT)(ALCcontext*,ALuint,ALsizei,ALuint*);
+typedef ALvoid (AL_APIENTRY*LPALGENBUFFERSDIRECT)(ALCcontext*,ALsizei,ALuint*);
+typedef ALvoid (AL_APIENTRY*LPALDELETEBUFFERSDIRECT)(ALCcontext*,ALsizei,const ALuint*);
+typedef ALboolean (AL_APIENTRY*LPALISBUFFERDIRECT)(ALCcontext*,ALuint);
+typedef ALvoid (AL_APIENTRY*LPALBUFFERDATADIRECT)(ALCcontext*,ALuint,ALenum,const ALvoid*,ALsizei,ALsizei);
+typedef void (AL_APIENTRY*LPALBUFFERFDIRECT)(ALCcontext*,ALuint,ALenum,ALfloat);
+typedef void (AL_APIENTRY*LPALBUFFER3FDIRECT)(ALCcontext*,ALuint,ALenum,ALfloat,ALfloat,ALfloat);
+typedef void (AL_APIENTRY*LPALBUFFERFVDIRECT)(ALCcontext*,ALuint,ALenum,const ALfloat*);
+typedef void (AL_APIENTRY*LPALBUFFERIDIRECT)(ALCcontext*,ALuint,ALenum,ALint);
+typedef void (AL_APIENTRY*LPALBUFFER3IDIRECT)(ALCcontext*,ALuint,ALenum,ALint,ALint,ALint);
+typedef void (AL_APIENTRY*LPALBUFFERIVDIRECT)(ALCcontext*,ALuint,ALenum,const ALint*);
+typedef ALvoid (AL_APIENTRY*LPALGETBUFFERFDIRECT)(ALCcontext*,ALuint,ALenum,ALfloat*);
+typedef void (AL_APIENTRY*LPALGETBUFFER3FDIRECT)(ALCcontext*,ALuint,ALenum,ALfloat*,ALfloat*,ALfloat*);
+typedef void (AL_APIENTRY*LPALGETBUFFERFVDIRECT)(ALCcontext*,ALuint,ALenum,ALfloat*);
+typedef ALvoid (AL_APIENTRY*LPALGETBUFFERIDIRECT)(ALCcontext*,ALuint,ALenum,ALint*);
+typedef void (AL_APIENTRY*LPALGETBUFFER3IDIRECT)(ALCcontext*,ALuint,ALenum,ALint*,ALint*,ALint*);
+typedef void (AL_APIENTRY*LPALGETBUFFERIVDIRECT)(ALCcontext*,ALuint,ALenum,ALint*);
+typedef ALvoid (AL_APIENTRY*LPALDOPPLERFACTORDIRECT)(ALCcontext*,ALfloat);
+typedef ALvoid (AL_APIENTRY*LPALDOPPLERVELOCITYDIRECT)(ALCcontext*,ALfloat);
+typedef ALvoid (AL_APIENTRY*LPALSPEEDOFSOUNDDIRECT)(ALCcontext*,ALfloat);
+typedef ALvoid (AL_APIENTRY*LPALDISTANCEMODELDIRECT)(ALCcontext*,ALenum);
+typedef ALvoid (AL_APIENTRY*LPALGENFILTERSDIRECT)(ALCcontext*,ALsizei,ALuint*);
+typedef ALvoid (AL_APIENTRY*LPALDELETEFILTERSDIRECT)(ALCcontext*,ALsizei,const ALuint*);
+typedef ALboolean (AL_APIENTRY*LPALISFILTERDIRECT)(ALCcontext*,ALuint);
+typedef ALvoid (AL_APIENTRY*LPALFILTERIDIRECT)(ALCcontext*,ALuint,ALenum,ALint);
+typedef ALvoid (AL_APIENTRY*LPALFILTERIVDIRECT)(ALCcontext*,ALuint,ALenum,const ALint*);
+typedef ALvoid (AL_APIENTRY*LPALFILTERFDIRECT)(ALCcontext*,ALuint,ALenum,ALfloat);
+typedef ALvoid (AL_APIENTRY*LPALFILTERFVDIRECT)(ALCcontext*,ALuint,ALenum,const ALfloat*);
+typedef ALvoid (AL_APIENTRY*LPALGETFILTERIDIRECT)(ALCcontext*,ALuint,ALenum,ALint*);
+typedef ALvoid (AL_APIENTRY*LPALGETFILTERIVDIRECT)(ALCcontext*,ALuint,ALenum,ALint*);
+typedef ALvoid (AL_APIENTRY*LPALGETFILTERFDIRECT)(ALCcontext*,ALuint,ALenum,ALfloat*);
+typedef ALvoid (AL_APIENTRY*LPALGETFILTERFVDIRECT)(ALCcontext*,ALuint,ALenum,ALfloat*);
+typedef ALvoid (AL_APIENTRY*LPALGENEFFECTSDIRECT)(ALCcontext*,ALsizei,ALuint*);
+typedef ALvoid (AL_APIENTRY*LPALDELETEEFFECTSDIRECT)(ALCcontext*,ALsizei,const ALuint*);
+typedef ALboolean (AL_APIENTRY*LPALISEFFECTDIRECT)(ALCcontext*,ALuint);
+typedef ALvoid (AL_APIENTRY*LPALEFFECTIDIRECT)(ALCcontext*,ALuint,ALenum,ALint);
+typedef ALvoid (AL_APIENTRY*LPALEFFECTIVDIRECT)(ALCcontext*,ALuint,ALenum,const ALint*);
+typedef ALvoid (AL_APIENTRY*LPALEFFECTFDIRECT)(ALCcontext*,ALuint,ALenum,ALfloat);
+typedef ALvoid (AL_APIENTRY*LPALEFFECTFVDIRECT)(ALCcontext*,ALuint,ALenum,const ALfloat*);
+typedef ALvoid (AL_APIENTRY*LPALGETEFFECTIDIRECT)(ALCcontext*,ALuint,ALenum,ALint*);
+typedef ALvoid (AL_APIENTRY*LPALGETEFFECTIVDIRECT)(ALCcontext*,ALuint,ALenum,ALint*);
+typedef ALvoid (AL_APIENTRY*LPALGETEFFECTFDIRECT)(ALCcontext*,ALuint,ALenum,ALfloat*);
+typedef ALvoid (AL_APIENTRY*LPALGETEFFECTFVDIRECT)(ALCcontext*,ALuint,ALenum,ALfloat*);
+typedef ALvoid (AL_APIENTRY*LPALGENAUXILIARYEFFECTSLOTSDIRECT)(ALCcontext*,ALsizei,ALuint*);
+typedef ALvoid (AL_APIENTRY*LPALDELETEAUXILIARYEFFECTSLOTSDIRECT)(ALCcontext*,ALsizei,const ALuint*);
+typedef ALboolean (AL_APIENTRY*LPALISAUXILIARYEFFECTSLOTDIRECT)(ALCcontext*,ALuint);
+typedef ALvoid (AL_APIENTRY*LPALAUXILIARYEFFECTSLOTIDIRECT)(ALCcontext*,ALuint,ALenum,ALint);
+typedef ALvoid (AL_APIENTRY*LPALAUXILIARYEFFECTSLOTIVDIRECT)(ALCcontext*,ALuint,ALenum,const ALint*);
+typedef ALvoid (AL_APIENTRY*LPALAUXILIARYEFFECTSLOTFDIRECT)(ALCcontext*,ALuint,ALenum,ALfloat);
+typedef ALvoid (AL_APIENTRY*LPALAUXILIARYEFFECTSLOTFVDIRECT)(ALCcontext*,ALuint,ALenum,const ALfloat*);
+typedef ALvoid (AL_APIENTRY*LPALGETAUXILIARYEFFECTSLOTIDIRECT)(ALCcontext*,ALuint,ALenum,ALint*);
+typedef ALvoid (AL_APIENTRY*LPALGETAUXILIARYEFFECTSLOTIVDIRECT)(ALCcontext*,ALuint,ALenum,ALint*);
+typedef ALvoid (AL_APIENTRY*LPALGETAUXILIARYEFFECTSLOTFDIRECT)(ALCcontext*,ALuint,ALenum,ALfloat*);
+typedef ALvoid (AL_APIENTRY*LPALGETAUXILIARYEFFECTSLOTFVDIRECT)(ALCcontext*,ALuint,ALenum,ALfloat*);
+typedef ALvoid (AL_APIENTRY*LPALDEFERUPDATESDIRECTSOFT)(ALCcontext*);
+typedef ALvoid (AL_APIENTRY*LPALPROCESSUPDATESDIRECTSOFT)(ALCcontext*);
+typedef ALvoid (AL_APIENTRY*LPALSOURCEDDIRECTSOFT)(ALCcontext*,ALuint,ALenum,ALdouble);
+typedef ALvoid (AL_APIENTRY*LPALSOURCE3DDIRECTSOFT)(ALCcontext*,ALuint,ALenum,ALdouble,ALdouble,ALdouble);
+typedef ALvoid (AL_APIENTRY*LPALSOURCEDVDIRECTSOFT)(ALCcontext*,ALuint,ALenum,const ALdouble*);
+typedef void (AL_APIENTRY*LPALGETSOURCEDDIRECTSOFT)(ALCcontext*,ALuint,ALenum,ALdouble*);
+typedef void (AL_APIENTRY*LPALGETSOURCE3DDIRECTSOFT)(ALCcontext*,ALuint,ALenum,ALdouble*,ALdouble*,ALdouble*);
+typedef void (AL_APIENTRY*LPALGETSOURCEDVDIRECTSOFT)(ALCcontext*,ALuint,ALenum,ALdouble*);
+typedef ALvoid (AL_APIENTRY*LPALSOURCEI64DIRECTSOFT)(ALCcontext*,ALuint,ALenum,ALint64SOFT);
+typedef void (AL_APIENTRY*LPALSOURCE3I64DIRECTSOFT)(ALCcontext*,ALuint,ALenum,ALint64SOFT,ALint64SOFT,ALint64SOFT);
+typedef void (AL_APIENTRY*LPALSOURCEI64VDIRECTSOFT)(ALCcontext*,ALuint,ALenum,const ALint64SOFT*);
+typedef void (AL_APIENTRY*LPALGETSOURCEI64DIRECTSOFT)(ALCcontext*,ALuint,ALenum,ALint64SOFT*);
+typedef void (AL_APIENTRY*LPALGETSOURCE3I64DIRECTSOFT)(ALCcontext*,ALuint,ALenum,ALint64SOFT*,ALint64SOFT*,ALint64SOFT*);
+typedef void (AL_APIENTRY*LPALGETSOURCEI64VDIRECTSOFT)(ALCcontext*,ALuint,ALenum,ALint64SOFT*);
+typedef ALvoid (AL_APIENTRY*LPALBUFFERSUBDATADIRECTSOFT)(ALCcontext*,ALuint,ALenum,const ALvoid*,ALsizei,ALsizei);
+typedef void (AL_APIENTRY*LPALBUFFERSAMPLESDIRECTSOFT)(ALCcontext*,ALuint,ALuint,ALenum,ALsizei,ALenum,ALenum,const ALvoid*);
+typedef void (AL_APIENTRY*LPALBUFFERSUBSAMPLESDIRECTSOFT)(ALCcontext*,ALuint,ALsizei,ALsizei,ALenum,ALenum,const ALvoid*);
+typedef void (AL_APIENTRY*LPALGETBUFFERSAMPLESDIRECTSOFT)(ALCcontext*,ALuint,ALsizei,ALsizei,ALenum,ALenum,ALvoid*);
+typedef ALboolean (AL_APIENTRY*LPALISBUFFERFORMATSUPPORTEDDIRECTSOFT)(ALCcontext*,ALenum);
+#ifdef AL_ALEXT_PROTOTYPES
+AL_API ALvoid AL_APIENTRY alEnableDirect(ALCcontext *context, ALenum capability);
+AL_API ALvoid AL_APIENTRY alDisableDirect(ALCcontext *context, ALenum capability);
+AL_API ALboolean AL_APIENTRY alIsEnabledDirect(ALCcontext *context, ALenum capability);
+AL_API const ALchar* AL_APIENTRY alGetStringDirect(ALCcontext *context, ALenum pname);
+AL_API ALvoid AL_APIENTRY alGetBooleanvDirect(ALCcontext *context, ALenum pname, ALboolean *values);
+AL_API ALvoid AL_APIENTRY alGetIntegervDirect(ALCcontext *context, ALenum pname, ALint *values);
+AL_API ALvoid AL_APIENTRY alGetFloatvDirect(ALCcontext *context, ALenum pname, ALfloat *values);
+AL_API ALvoid AL_APIENTRY alGetDoublevDirect(ALCcontext *context, ALenum pname, ALdouble *values);
+AL_API ALboolean AL_APIENTRY alGetBooleanDirect(ALCcontext *context, ALenum pname);
+AL_API ALint AL_APIENTRY alGetIntegerDirect(ALCcontext *context, ALenum pname);
+AL_API ALfloat AL_APIENTRY alGetFloatDirect(ALCcontext *context, ALenum pname);
+AL_API ALdouble AL_APIENTRY alGetDoubleDirect(ALCcontext *context, ALenum pname);
+AL_API ALenum AL_APIENTRY alGetErrorDirect(ALCcontext *context);
+AL_API ALboolean AL_APIENTRY alIsExtensionPresentDirect(ALCcontext *context, const ALchar *extName);
+AL_API ALvoid* AL_APIENTRY alGetProcAddressDirect(ALCcontext *context, const ALchar *fname);
+AL_API ALenum AL_APIENTRY alGetEnumValueDirect(ALCcontext *context, const ALchar *ename);
+AL_API ALvoid AL_APIENTRY alListenerfDirect(ALCcontext *context, ALenum param, ALfloat value);
+AL_API ALvoid AL_APIENTRY alListener3fDirect(ALCcontext *context, ALenum param, ALfloat value1, ALfloat value2, ALfloat value3);
+AL_API ALvoid AL_APIENTRY alListenerfvDirect(ALCcontext *context, ALenum param, const ALfloat *values);
+AL_API ALvoid AL_APIENTRY alListeneriDirect(ALCcontext *context, ALenum param, ALint value);
+AL_API void AL_APIENTRY alListener3iDirect(ALCcontext *context, ALenum param, ALint value1, ALint value2, ALint value3);
+AL_API void AL_APIENTRY alListenerivDirect(ALCcontext *context, ALenum param, const ALint *values);
+AL_API ALvoid AL_APIENTRY alGetListenerfDirect(ALCcontext *context, ALenum param, ALfloat *value);
+AL_API ALvoid AL_APIENTRY alGetListener3fDirect(ALCcontext *context, ALenum param, ALfloat *value1, ALfloat *value2, ALfloat *value3);
+AL_API ALvoid AL_APIENTRY alGetListenerfvDirect(ALCcontext *context, ALenum param, ALfloat *values);
+AL_API ALvoid AL_APIENTRY alGetListeneriDirect(ALCcontext *context, ALenum param, ALint *value);
+AL_API void AL_APIENTRY alGetListener3iDirect(ALCcontext *context, ALenum param, ALint *value1, ALint *value2, ALint *value3);
+AL_API void AL_APIENTRY alGetListenerivDirect(ALCcontext *context, ALenum param, ALint* values);
+AL_API ALvoid AL_APIENTRY alGenSourcesDirect(ALCcontext *context, ALsizei n, ALuint *sources);
+AL_API ALvoid AL_APIENTRY alDeleteSourcesDirect(ALCcontext *context, ALsizei n, const ALuint *sources);
+AL_API ALboolean AL_APIENTRY alIsSourceDirect(ALCcontext *context, ALuint source);
+AL_API ALvoid AL_APIENTRY alSourcefDirect(ALCcontext *context, ALuint source, ALenum param, ALfloat value);
+AL_API ALvoid AL_APIENTRY alSource3fDirect(ALCcontext *context, ALuint source, ALenum param, ALfloat value1, ALfloat value2, ALfloat value3);
+AL_API ALvoid AL_APIENTRY alSourcefvDirect(ALCcontext *context, ALuint source, ALenum param, const ALfloat *values);
+AL_API ALvoid AL_APIENTRY alSourceiDirect(ALCcontext *context, ALuint source, ALenum param, ALint value);
+AL_API void AL_APIENTRY alSource3iDirect(ALCcontext *context, ALuint source, ALenum param, ALint value1, ALint value2, ALint value3);
+AL_API void AL_APIENTRY alSourceivDirect(ALCcontext *context, ALuint source, ALenum param, const ALint *values);
+AL_API ALvoid AL_APIENTRY alGetSourcefDirect(ALCcontext *context, ALuint source, ALenum param, ALfloat *value);
+AL_API ALvoid AL_APIENTRY alGetSource3fDirect(ALCcontext *context, ALuint source, ALenum param, ALfloat *value1, ALfloat *value2, ALfloat *value3);
+AL_API ALvoid AL_APIENTRY alGetSourcefvDirect(ALCcontext *context, ALuint source, ALenum param, ALfloat *values);
+AL_API ALvoid AL_APIENTRY alGetSourceiDirect(ALCcontext *context, ALuint source, ALenum param, ALint *value);
+AL_API void AL_APIENTRY alGetSource3iDirect(ALCcontext *context, ALuint source, ALenum param, ALint *value1, ALint *value2, ALint *value3);
+AL_API void AL_APIENTRY alGetSourceivDirect(ALCcontext *context, ALuint source, ALenum param, ALint *values);
+AL_API ALvoid AL_APIENTRY alSourcePlayvDirect(ALCcontext *context, ALsizei n, const ALuint *sources);
+AL_API ALvoid AL_APIENTRY alSourceStopvDirect(ALCcontext *context, ALsizei n, const ALuint *sources);
+AL_API ALvoid AL_APIENTRY alSourceRewindvDirect(ALCcontext *context, ALsizei n, const ALuint *sources);
+AL_API ALvoid AL_APIENTRY alSourcePausevDirect(ALCcontext *context, ALsizei n, const ALuint *sources);
+AL_API ALvoid AL_APIENTRY alSourcePlayDirect(ALCcontext *context, ALuint source);
+AL_API ALvoid AL_APIENTRY alSourceStopDirect(ALCcontext *context, ALuint source);
+AL_API ALvoid AL_APIENTRY alSourceRewindDirect(ALCcontext *context, ALuint source);
+AL_API ALvoid AL_APIENTRY alSourcePauseDirect(ALCcontext *context, ALuint source);
+AL_API ALvoid AL_APIENTRY alSourceQueueBuffersDirect(ALCcontext *context, ALuint src, ALsizei nb, const ALuint *buffers);
+AL_API ALvoid AL_APIENTRY alSourceUnqueueBuffersDirect(ALCcontext *context, ALuint src, ALsizei nb, ALuint *buffers);
+AL_API ALvoid AL_APIENTRY alGenBuffersDirect(ALCcontext *context, ALsizei n, ALuint *buffers);
+AL_API ALvoid AL_APIENTRY alDeleteBuffersDirect(ALCcontext *context, ALsizei n, const ALuint *buffers);
+AL_API ALboolean AL_APIENTRY alIsBufferDirect(ALCcontext *context, ALuint buffer);
+AL_API ALvoid AL_APIENTRY alBufferDataDirect(ALCcontext *context, ALuint buffer, ALenum format, const ALvoid *data, ALsizei size, ALsizei freq);
+AL_API void AL_APIENTRY alBufferfDirect(ALCcontext *context, ALuint buffer, ALenum param, ALfloat value);
+AL_API void AL_APIENTRY alBuffer3fDirect(ALCcontext *context, ALuint buffer, ALenum param, ALfloat value1, ALfloat value2, ALfloat value3);
+AL_API void AL_APIENTRY alBufferfvDirect(ALCcontext *context, ALuint buffer, ALenum param, const ALfloat *values);
+AL_API void AL_APIENTRY alBufferiDirect(ALCcontext *context, ALuint buffer, ALenum param, ALint value);
+AL_API void AL_APIENTRY alBuffer3iDirect(ALCcontext *context, ALuint buffer, ALenum param, ALint value1, ALint value2, ALint value3);
+AL_API void AL_APIENTRY alBufferivDirect(ALCcontext *context, ALuint buffer, ALenum param, const ALint *values);
+AL_API ALvoid AL_APIENTRY alGetBufferfDirect(ALCcontext *context, ALuint buffer, ALenum param, ALfloat *value);
+AL_API void AL_APIENTRY alGetBuffer3fDirect(ALCcontext *context, ALuint buffer, ALenum param, ALfloat *value1, ALfloat *value2, ALfloat *value3);
+AL_API void AL_APIENTRY alGetBufferfvDirect(ALCcontext *context, ALuint buffer, ALenum param, ALfloat *values);
+AL_API ALvoid AL_APIENTRY alGetBufferiDirect(ALCcontext *context, ALuint buffer, ALenum param, ALint *value);
+AL_API void AL_APIENTRY alGetBuffer3iDirect(ALCcontext *context, ALuint buffer, ALenum param, ALint *value1, ALint *value2, ALint *value3);
+AL_API void AL_APIENTRY alGetBufferivDirect(ALCcontext *context, ALuint buffer, ALenum param, ALint *values);
+AL_API ALvoid AL_APIENTRY alDopplerFactorDirect(ALCcontext *context, ALfloat value);
+AL_API ALvoid AL_APIENTRY alDopplerVelocityDirect(ALCcontext *context, ALfloat value);
+AL_API ALvoid AL_APIENTRY alSpeedOfSoundDirect(ALCcontext *context, ALfloat value);
+AL_API ALvoid AL_APIENTRY alDistanceModelDirect(ALCcontext *context, ALenum value);
+AL_API ALvoid AL_APIENTRY alGenFiltersDirect(ALCcontext *context, ALsizei n, ALuint *filters);
+AL_API ALvoid AL_APIENTRY alDeleteFiltersDirect(ALCcontext *context, ALsizei n, const ALuint *filters);
+AL_API ALboolean AL_APIENTRY alIsFilterDirect(ALCcontext *context, ALuint filter);
+AL_API ALvoid AL_APIENTRY alFilteriDirect(ALCcontext *context, ALuint filter, ALenum param, ALint value);
+AL_API ALvoid AL_APIENTRY alFilterivDirect(ALCcontext *context, ALuint filter, ALenum param, const ALint *values);
+AL_API ALvoid AL_APIENTRY alFilterfDirect(ALCcontext *context, ALuint filter, ALenum param, ALfloat value);
+AL_API ALvoid AL_APIENTRY alFilterfvDirect(ALCcontext *context, ALuint filter, ALenum param, const ALfloat *values);
+AL_API ALvoid AL_APIENTRY alGetFilteriDirect(ALCcontext *context, ALuint filter, ALenum param, ALint *value);
+AL_API ALvoid AL_APIENTRY alGetFilterivDirect(ALCcontext *context, ALuint filter, ALenum param, ALint *values);
+AL_API ALvoid AL_APIENTRY alGetFilterfDirect(ALCcontext *context, ALuint filter, ALenum param, ALfloat *value);
+AL_API ALvoid AL_APIENTRY alGetFilterfvDirect(ALCcontext *context, ALuint filter, ALenum param, ALfloat *values);
+AL_API ALvoid AL_APIENTRY alGenEffectsDirect(ALCcontext *context, ALsizei n, ALuint *effects);
+AL_API ALvoid AL_APIENTRY alDeleteEffectsDirect(ALCcontext *context, ALsizei n, const ALuint *effects);
+AL_API ALboolean AL_APIENTRY alIsEffectDirect(ALCcontext *context, ALuint effect);
+AL_API ALvoid AL_APIENTRY alEffectiDirect(ALCcontext *context, ALuint effect, ALenum param, ALint value);
+AL_API ALvoid AL_APIENTRY alEffectivDirect(ALCcontext *context, ALuint effect, ALenum param, const ALint *values);
+AL_API ALvoid AL_APIENTRY alEffectfDirect(ALCcontext *context, ALuint effect, ALenum param, ALfloat value);
+AL_API ALvoid AL_APIENTRY alEffectfvDirect(ALCcontext *context, ALuint effect, ALenum param, const ALfloat *values);
+AL_API ALvoid AL_APIENTRY alGetEffectiDirect(ALCcontext *context, ALuint effect, ALenum param, ALint *value);
+AL_API ALvoid AL_APIENTRY alGetEffectivDirect(ALCcontext *context, ALuint effect, ALenum param, ALint *values);
+AL_API ALvoid AL_APIENTRY alGetEffectfDirect(ALCcontext *context, ALuint effect, ALenum param, ALfloat *value);
+AL_API ALvoid AL_APIENTRY alGetEffectfvDirect(ALCcontext *context, ALuint effect, ALenum param, ALfloat *values);
+AL_API ALvoid AL_APIENTRY alGenAuxiliaryEffectSlotsDirect(ALCcontext *context, ALsizei n, ALuint *effectslots);
+AL_API ALvoid AL_APIENTRY alDeleteAuxiliaryEffectSlotsDirect(ALCcontext *context, ALsizei n, const ALuint *effectslots);
+AL_API ALboolean AL_APIENTRY alIsAuxiliaryEffectSlotDirect(ALCcontext *context, ALuint effectslot);
+AL_API ALvoid AL_APIENTRY alAuxiliaryEffectSlotiDirect(ALCcontext *context, ALuint effectslot, ALenum param, ALint value);
+AL_API ALvoid AL_APIENTRY alAuxiliaryEffectSlotivDirect(ALCcontext *context, ALuint effectslot, ALenum param, const ALint *values);
+AL_API ALvoid AL_APIENTRY alAuxiliaryEffectSlotfDirect(ALCcontext *context, ALuint effectslot, ALenum param, ALfloat value);
+AL_API ALvoid AL_APIENTRY alAuxiliaryEffectSlotfvDirect(ALCcontext *context, ALuint effectslot, ALenum param, const ALfloat *values);
+AL_API ALvoid AL_APIENTRY alGetAuxiliaryEffectSlotiDirect(ALCcontext *context, ALuint effectslot, ALenum param, ALint *value);
+AL_API ALvoid AL_APIENTRY alGetAuxiliaryEffectSlotivDirect(ALCcontext *context, ALuint effectslot, ALenum param, ALint *values);
+AL_API ALvoid AL_APIENTRY alGetAuxiliaryEffectSlotfDirect(ALCcontext *context, ALuint effectslot, ALenum param, ALfloat *value);
+AL_API ALvoid AL_APIENTRY alGetAuxiliaryEffectSlotfvDirect(ALCcontext *context, ALuint effectslot, ALenum param, ALfloat *values);
+AL_API ALvoid AL_APIENTRY alDeferUpdatesDirectSOFT(ALCcontext *context);
+AL_API ALvoid AL_APIENTRY alProcessUpdatesDirectSOFT(ALCcontext *context);
+AL_API ALvoid AL_APIENTRY alSourcedDirectSOFT(ALCcontext *context, ALuint source, ALenum param, ALdouble value);
+AL_API ALvoid AL_APIENTRY alSource3dDirectSOFT(ALCcontext *context, ALuint source, ALenum param, ALdouble value1, ALdouble value2, ALdouble value3);
+AL_API ALvoid AL_APIENTRY alSourcedvDirectSOFT(ALCcontext *context, ALuint source, ALenum param, const ALdouble *values);
+AL_API void AL_APIENTRY alGetSourcedDirectSOFT(ALCcontext *context, ALuint source, ALenum param, ALdouble *value);
+AL_API void AL_APIENTRY alGetSource3dDirectSOFT(ALCcontext *context, ALuint source, ALenum param, ALdouble *value1, ALdouble *value2, ALdouble *value3);
+AL_API void AL_APIENTRY alGetSourcedvDirectSOFT(ALCcontext *context, ALuint source, ALenum param, ALdouble *values);
+AL_API ALvoid AL_APIENTRY alSourcei64DirectSOFT(ALCcontext *context, ALuint source, ALenum param, ALint64SOFT value);
+AL_API void AL_APIENTRY alSource3i64DirectSOFT(ALCcontext *context, ALuint source, ALenum param, ALint64SOFT value1, ALint64SOFT value2, ALint64SOFT value3);
+AL_API void AL_APIENTRY alSourcei64vDirectSOFT(ALCcontext *context, ALuint source, ALenum param, const ALint64SOFT *values);
+AL_API void AL_APIENTRY alGetSourcei64DirectSOFT(ALCcontext *context, ALuint source, ALenum param, ALint64SOFT *value);
+AL_API void AL_APIENTRY alGetSource3i64DirectSOFT(ALCcontext *context, ALuint source, ALenum param, ALint64SOFT *value1, ALint64SOFT *value2, ALint64SOFT *value3);
+AL_API void AL_APIENTRY alGetSourcei64vDirectSOFT(ALCcontext *context, ALuint source, ALenum param, ALint64SOFT *values);
+AL_API ALvoid AL_APIENTRY alBufferSubDataDirectSOFT(ALCcontext *context, ALuint buffer, ALenum format, const ALvoid *data, ALsizei offset, ALsizei length);
+AL_API void AL_APIENTRY alBufferSamplesDirectSOFT(ALCcontext *context, ALuint buffer, ALuint samplerate, ALenum internalformat, ALsizei samples, ALenum channels, ALenum type, const ALvoid *data);
+AL_API void AL_APIENTRY alBufferSubSamplesDirectSOFT(ALCcontext *context, ALuint buffer, ALsizei offset, ALsizei samples, ALenum channels, ALenum type, const ALvoid *data);
+AL_API void AL_APIENTRY alGetBufferSamplesDirectSOFT(ALCcontext *context, ALuint buffer, ALsizei offset, ALsizei samples, ALenum channels, ALenum type, ALvoid *data);
+AL_API ALboolean AL_APIENTRY alIsBufferFormatSupportedDirectSOFT(ALCcontext *context, ALenum format);
+#endif
+#endif
+
+#ifndef AL_SOFTX_source_batch
+#define AL_SOFTX_source_batch 1
+typedef void (AL_APIENTRY*LPALSOURCEBATCHFVSOFT)(ALsizei,const ALuint*,const ALenum*,const ALfloat*);
+typedef void (AL_APIENTRY*LPALSOURCEBATCHFVDIRECTSOFT)(ALCcontext*,ALsizei,const ALuint*,const ALenum*,const ALfloat*);
+#ifdef AL_ALEXT_PROTOTYPES
+AL_API void AL_APIENTRY alSourceBatchfvSOFT(ALsizei count, const ALuint *sources, const ALenum *params, const ALfloat *values);
+AL_API void AL_APIENTRY alSourceBatchfvDirectSOFT(ALCcontext *context, ALsizei count, const ALuint *sources, const ALenum *params, const ALfloat *values);
+#endif
+#endif
+
+#ifndef AL_SOFTX_update_epsilon
+#define AL_SOFTX_update_epsilon 1
+#define AL_SOURCE_UPDATES_PERFORMED_SOFTX        0xC010
+#define AL_SOURCE_UPDATES_SKIPPED_SOFTX          0xC011
+#endif
+
+#ifndef AL_SOFTX_source_resampler
+#define AL_SOFTX_source_resampler 1
+#define AL_NUM_RESAMPLERS_SOFTX                  0xC012
+#define AL_DEFAULT_RESAMPLER_SOFTX               0xC013
+#define AL_SOURCE_RESAMPLER_SOFTX                0xC014
+#define AL_POINT_RESAMPLER_SOFTX                 0
+#define AL_LINEAR_RESAMPLER_SOFTX                1
+#define AL_SINC4_RESAMPLER_SOFTX                 2
+#define AL_SINC8_RESAMPLER_SOFTX                 3
+#define AL_BSINC8_RESAMPLER_SOFTX                4
+#define AL_BSINC12_RESAMPLER_SOFTX               5
+#define AL_BSINC24_RESAMPLER_SOFTX               6
+#endif
+
+#ifndef AL_SOFTX_object_pool_stats
+#define AL_SOFTX_object_pool_stats 1
+#define AL_OBJECT_POOL_CAPACITY_SOFTX            0xC015
+#define AL_OBJECT_POOL_IN_USE_SOFTX              0xC016
+#define AL_OBJECT_POOL_ALLOCS_SOFTX              0xC017
+#define AL_OBJECT_POOL_CHUNK_ALLOCS_SOFTX        0xC018
+#endif
+
+#ifndef AL_SOFTX_convolution_reverb
+#define AL_SOFTX_convolution_reverb 1
+#define AL_EFFECT_CONVOLUTION_REVERB_SOFTX       0xA000
+#endif
+
+#ifndef AL_SOFTX_effect_chain
+#define AL_SOFTX_effect_chain 1
+#define AL_EFFECTSLOT_TARGET_SOFT                0xf000
+#endif
+
 #ifdef __cplusplus
 }
 #endif
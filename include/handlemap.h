@@ -0,0 +1,119 @@
+#ifndef AL_HANDLEMAP_H
+#define AL_HANDLEMAP_H
+
+#include <stddef.h>
+
+#include "AL/al.h"
+#include "atomic.h"
+#include "rwlock.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Object handles are made up of a slot index in the lower bits, and a
+ * generation count in the upper bits. The generation is bumped each time an
+ * index is reused, so a stale handle to a deleted object won't alias a newly
+ * created one. The top bit is left clear so handles survive a round trip
+ * through ALint (e.g. AL_BUFFER and AL_DIRECT_FILTER properties).
+ */
+#define HANDLE_INDEX_BITS  20
+#define HANDLE_INDEX_MASK  ((1u<<HANDLE_INDEX_BITS) - 1)
+#define HANDLE_GEN_BITS    11
+#define HANDLE_GEN_MASK    ((1u<<HANDLE_GEN_BITS) - 1)
+
+#define HANDLE_INDEX(h)    ((h) & HANDLE_INDEX_MASK)
+#define HANDLE_GEN(h)      (((h)>>HANDLE_INDEX_BITS) & HANDLE_GEN_MASK)
+#define MAKE_HANDLE(i, g)  ((ALuint)(i) | ((ALuint)((g)&HANDLE_GEN_MASK)<<HANDLE_INDEX_BITS))
+
+
+#define HANDLEMAP_BLOCK_BITS  8
+#define HANDLEMAP_BLOCK_SIZE  (1<<HANDLEMAP_BLOCK_BITS)
+#define HANDLEMAP_BLOCK_MASK  (HANDLEMAP_BLOCK_SIZE-1)
+
+typedef struct HandleMapSlot {
+    ATOMIC(ALuint) key;
+    ATOMIC(ALvoid*) value;
+} HandleMapSlot;
+
+/* The directory of slot blocks. Blocks are never moved or freed while the map
+ * is live, and a directory that's been outgrown is kept around (linked through
+ * 'prev') until the map is reset, so readers never need to take a lock.
+ */
+typedef struct HandleMapDir {
+    struct HandleMapDir *prev;
+    ALsizei count;
+    ATOMIC(HandleMapSlot*) blocks[];
+} HandleMapDir;
+
+/* Maps object handles to object pointers. Lookups are wait-free, while
+ * inserts and removals are serialized by the write lock. Iterating over the
+ * entries requires holding the read lock, to keep them from being removed.
+ */
+typedef struct HandleMap {
+    ATOMIC(HandleMapDir*) dir;
+    ALsizei size;
+    ALsizei limit;
+    RWLock lock;
+} HandleMap;
+
+void InitHandleMap(HandleMap *map, ALsizei limit);
+void ResetHandleMap(HandleMap *map);
+ALenum InsertHandleMapEntry(HandleMap *map, ALuint key, ALvoid *value);
+ALvoid *RemoveHandleMapKey(HandleMap *map, ALuint key);
+
+inline ALvoid *LookupHandleMapKey(HandleMap *map, ALuint key)
+{
+    HandleMapDir *dir = ATOMIC_LOAD(&map->dir);
+    ALuint idx = HANDLE_INDEX(key);
+    HandleMapSlot *block;
+    HandleMapSlot *slot;
+    ALvoid *ptr;
+
+    if(!dir || (ALsizei)(idx>>HANDLEMAP_BLOCK_BITS) >= dir->count || key == 0)
+        return NULL;
+    block = ATOMIC_LOAD(&dir->blocks[idx>>HANDLEMAP_BLOCK_BITS]);
+    if(!block) return NULL;
+
+    slot = &block[idx&HANDLEMAP_BLOCK_MASK];
+    if(ATOMIC_LOAD(&slot->key) != key)
+        return NULL;
+    ptr = ATOMIC_LOAD(&slot->value);
+    /* Make sure the slot wasn't reused while reading the value. */
+    if(ATOMIC_LOAD(&slot->key) != key)
+        return NULL;
+    return ptr;
+}
+
+/* Returns the number of indices that may be passed to LookupHandleMapIndex.
+ * Only valid while holding the read or write lock. */
+inline ALsizei GetHandleMapCapacity(HandleMap *map)
+{
+    HandleMapDir *dir = ATOMIC_LOAD(&map->dir);
+    return dir ? dir->count*HANDLEMAP_BLOCK_SIZE : 0;
+}
+
+/* Returns the value stored at the given slot index, or NULL if it's empty.
+ * Only valid while holding the read or write lock. */
+inline ALvoid *LookupHandleMapIndex(HandleMap *map, ALsizei idx)
+{
+    HandleMapDir *dir = ATOMIC_LOAD(&map->dir);
+    HandleMapSlot *block = ATOMIC_LOAD(&dir->blocks[idx>>HANDLEMAP_BLOCK_BITS]);
+    if(!block) return NULL;
+    return ATOMIC_LOAD(&block[idx&HANDLEMAP_BLOCK_MASK].value);
+}
+
+inline void LockHandleMapRead(HandleMap *map)
+{ ReadLock(&map->lock); }
+inline void UnlockHandleMapRead(HandleMap *map)
+{ ReadUnlock(&map->lock); }
+inline void LockHandleMapWrite(HandleMap *map)
+{ WriteLock(&map->lock); }
+inline void UnlockHandleMapWrite(HandleMap *map)
+{ WriteUnlock(&map->lock); }
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* AL_HANDLEMAP_H */
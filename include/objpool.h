@@ -0,0 +1,86 @@
+#ifndef AL_OBJPOOL_H
+#define AL_OBJPOOL_H
+
+#include <stddef.h>
+
+#include "AL/alext.h"
+#include "atomic.h"
+#include "threads.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Objects in a pool are aligned to (and padded out to) a cache line, so
+ * neighboring objects touched by different threads don't share one. */
+#define OBJPOOL_ALIGN       64
+#define OBJPOOL_MAX_CHUNKS  24
+
+/* Bits of the free list head used for an object index (plus one). A pool
+ * can't grow past this many objects, and the rest of the bits are the ABA
+ * counter. */
+#define OBJPOOL_INDEX_BITS  22
+#define OBJPOOL_INDEX_MASK  ((1u<<OBJPOOL_INDEX_BITS) - 1)
+
+typedef struct ObjectPoolChunk {
+    /* Index of the first object in this chunk, and the number of objects. */
+    ALuint Start;
+    ALuint Count;
+    char *Mem;
+    /* Free list links for each object in the chunk. */
+    ATOMIC(ALuint) *Next;
+} ObjectPoolChunk;
+
+/* A pool of same-sized objects, carved out of chunks that are allocated as
+ * needed, with each chunk twice the size of the one before it. Freed objects
+ * go on a lock-free free list for reuse, and chunks are only released when the
+ * pool is deinitialized, so the system allocator isn't touched again once the
+ * pool is large enough for the workload.
+ */
+typedef struct ObjectPool {
+    size_t ObjSize;
+    ALuint ChunkBase;
+
+    ObjectPoolChunk Chunks[OBJPOOL_MAX_CHUNKS];
+    ATOMIC(ALuint) NumChunks;
+    almtx_t GrowLock;
+
+    /* The lower OBJPOOL_INDEX_BITS hold the index of the first free object
+     * plus one (0 when empty), and the upper bits are a counter bumped with
+     * each change, to avoid ABA problems. It's kept to 32 bits so every
+     * atomics implementation can compare-exchange it, including the x86
+     * inline assembly one on 32-bit targets. */
+    ATOMIC(ALuint) FreeHead;
+
+    RefCount InUse;
+    RefCount NumAllocs;
+    RefCount NumChunkAllocs;
+} ObjectPool;
+
+typedef struct ObjectPoolStats {
+    /* Number of objects the pool can hold without allocating more memory. */
+    ALuint Capacity;
+    /* Number of objects currently allocated from the pool. */
+    ALuint InUse;
+    /* Total number of objects ever allocated from the pool. */
+    ALuint Allocs;
+    /* Total number of times the pool had to allocate memory for a chunk. */
+    ALuint ChunkAllocs;
+} ObjectPoolStats;
+
+/* Initializes a pool for objects of 'objsize' bytes. The first chunk will hold
+ * 'chunkbase' objects. */
+void InitObjectPool(ObjectPool *pool, size_t objsize, ALuint chunkbase);
+void DeinitObjectPool(ObjectPool *pool);
+
+/* Returns a zero-initialized object, or NULL if out of memory. */
+void *ObjectPoolAlloc(ObjectPool *pool);
+void ObjectPoolFree(ObjectPool *pool, void *ptr);
+
+void GetObjectPoolStats(ObjectPool *pool, ObjectPoolStats *stats);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* AL_OBJPOOL_H */
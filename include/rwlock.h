@@ -8,16 +8,15 @@
 extern "C" {
 #endif
 
+/* The lock state is a single word, holding the number of active readers, the
+ * number of writers waiting for the lock, a flag for when a writer holds the
+ * lock, and a flag for when any thread is sleeping on it. Waiting writers
+ * block new readers, so writers can't be starved.
+ */
 typedef struct {
-    RefCount read_count;
-    RefCount write_count;
-    ATOMIC(int) read_lock;
-    ATOMIC(int) read_entry_lock;
-    ATOMIC(int) write_lock;
+    ATOMIC(uint) state;
 } RWLock;
-#define RWLOCK_STATIC_INITIALIZE { ATOMIC_INIT_STATIC(0), ATOMIC_INIT_STATIC(0),         \
-                                   ATOMIC_INIT_STATIC(false), ATOMIC_INIT_STATIC(false), \
-                                   ATOMIC_INIT_STATIC(false) }
+#define RWLOCK_STATIC_INITIALIZE { ATOMIC_INIT_STATIC(0) }
 
 void RWLockInit(RWLock *lock);
 void ReadLock(RWLock *lock);
@@ -25,6 +24,20 @@ void ReadUnlock(RWLock *lock);
 void WriteLock(RWLock *lock);
 void WriteUnlock(RWLock *lock);
 
+#ifdef ALSOFT_PROFILING
+typedef struct RWLockStats {
+    uint ReadAcquires;
+    uint WriteAcquires;
+    /* Number of times a thread had to retry while spinning for the lock. */
+    uint Spins;
+    /* Number of times a thread had to go to sleep waiting for the lock. */
+    uint Sleeps;
+} RWLockStats;
+
+/* Retrieves the contention statistics collected over all locks. */
+void GetRWLockStats(RWLockStats *stats);
+#endif
+
 #ifdef __cplusplus
 }
 #endif
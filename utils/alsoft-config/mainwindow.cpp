@@ -96,7 +96,9 @@ static const struct NameValuePair {
     { "Default (Linear)", "" },
     { "4-Point Sinc", "sinc4" },
     { "8-Point Sinc", "sinc8" },
+    { "Band-limited Sinc (Fast)", "bsinc8" },
     { "Band-limited Sinc", "bsinc" },
+    { "Band-limited Sinc (High)", "bsinc24" },
 
     { "", "" }
 }, stereoModeList[] = {
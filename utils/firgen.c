@@ -0,0 +1,165 @@
+/*
+ * Sinc FIR resampler coefficient generator for the OpenAL Soft cross platform
+ * audio library.
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Library General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Library General Public License for more details.
+ *
+ * You should have received a copy of the GNU Library General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston,
+ * MA 02110-1301  USA
+ *
+ * Or visit:  http://www.gnu.org/licenses/old-licenses/lgpl-2.0.html
+ */
+
+#include <stdio.h>
+#include <math.h>
+#include <string.h>
+
+/* Must match FRACTIONBITS in OpenAL32/Include/alu.h. */
+#define FRACTIONBITS (12)
+#define FRACTIONONE  (1<<FRACTIONBITS)
+
+/* The sinc resampler makes use of a Kaiser window to limit the needed sample
+ * points to 4 and 8, respectively.
+ */
+
+#ifndef M_PI
+#define M_PI                         (3.14159265358979323846)
+#endif
+static inline double Sinc(double x)
+{
+    if(x == 0.0) return 1.0;
+    return sin(x*M_PI) / (x*M_PI);
+}
+
+/* The zero-order modified Bessel function of the first kind, used for the
+ * Kaiser window.
+ *
+ *   I_0(x) = sum_{k=0}^inf (1 / k!)^2 (x / 2)^(2 k)
+ *          = sum_{k=0}^inf ((x / 2)^k / k!)^2
+ */
+static double BesselI_0(double x)
+{
+    double term, sum, x2, y, last_sum;
+    int k;
+
+    /* Start at k=1 since k=0 is trivial. */
+    term = 1.0;
+    sum = 1.0;
+    x2 = x / 2.0;
+    k = 1;
+
+    /* Let the integration converge until the term of the sum is no longer
+     * significant.
+     */
+    do {
+        y = x2 / k;
+        k ++;
+        last_sum = sum;
+        term *= y * y;
+        sum += term;
+    } while(sum != last_sum);
+    return sum;
+}
+
+/* Calculate a Kaiser window from the given beta value and a normalized k
+ * [-1, 1].
+ *
+ *   w(k) = { I_0(B sqrt(1 - k^2)) / I_0(B),  -1 <= k <= 1
+ *          { 0,                              elsewhere.
+ *
+ * Where k can be calculated as:
+ *
+ *   k = i / l,         where -l <= i <= l.
+ *
+ * or:
+ *
+ *   k = 2 i / M - 1,   where 0 <= i <= M.
+ */
+static inline double Kaiser(double b, double k)
+{
+    if(k <= -1.0 || k >= 1.0) return 0.0;
+    return BesselI_0(b * sqrt(1.0 - (k*k))) / BesselI_0(b);
+}
+
+static inline double CalcKaiserBeta(double rejection)
+{
+    if(rejection > 50.0)
+        return 0.1102 * (rejection - 8.7);
+    if(rejection >= 21.0)
+        return (0.5842 * pow(rejection - 21.0, 0.4)) +
+               (0.07886 * (rejection - 21.0));
+    return 0.0;
+}
+
+static float SincKaiser(double r, double x)
+{
+    /* Limit rippling to -60dB. */
+    return (float)(Kaiser(CalcKaiserBeta(60.0), x / r) * Sinc(x));
+}
+
+
+/* Writes the coefficients for each of the FRACTIONONE phases of a sinc filter
+ * with the given number of points.
+ */
+static void WriteFilter(FILE *output, const char *name, const int points)
+{
+    const double r = points / 2.0;
+    int i, j;
+
+    fprintf(output, "    { /* %s */\n", name);
+    for(i = 0;i < FRACTIONONE;i++)
+    {
+        const double mu = (double)i / FRACTIONONE;
+
+        fprintf(output, "        {");
+        for(j = 0;j < points;j++)
+            fprintf(output, " %+.9ef%s", SincKaiser(r, mu - (j - (r-1.0))),
+                    (j < points-1) ? "," : "");
+        fprintf(output, " },\n");
+    }
+    fprintf(output, "    },\n");
+}
+
+/* Usage: firgen <output file>
+ *
+ * Writes the ResampleCoeffs table for the sinc4 and sinc8 resamplers. The
+ * output file may be "-" for stdout.
+ */
+int main(int argc, char *argv[])
+{
+    FILE *output;
+
+    if(argc != 2)
+    {
+        fprintf(stderr, "Usage: %s <output file>\n", argv[0]);
+        return 1;
+    }
+
+    if(strcmp(argv[1], "-") == 0)
+        output = stdout;
+    else if(!(output=fopen(argv[1], "w")))
+    {
+        fprintf(stderr, "Failed to open %s for writing\n", argv[1]);
+        return 1;
+    }
+
+    fprintf(output, "/* Generated by firgen, do not edit! */\n\n");
+    fprintf(output, "alignas(16) const struct ResamplerCoeffs ResampleCoeffs = {\n");
+    WriteFilter(output, "FIR4", 4);
+    WriteFilter(output, "FIR8", 8);
+    fprintf(output, "};\n");
+
+    if(output != stdout)
+        fclose(output);
+    return 0;
+}